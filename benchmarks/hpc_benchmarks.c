@@ -0,0 +1,456 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the sampling hot path against simulated drivers: context creation
+// latency, start/stop cost, and per-sample query latency for the Adreno and
+// Mali paths across counter counts, plus the generated counter conversion
+// functions in isolation. Results are written as JSON.
+//
+// Usage: hpc_benchmarks [--ioctl_latency_ns=<n>] [--output=<path>]
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#if defined(HPC_ENABLE_GPU_ADRENO)
+#include "adreno/counter_conversion.h"
+#include "adreno/group_capacities.h"
+#include "hpc/gpu/adreno/a6xx.h"
+#include "hpc/gpu/adreno/common.h"
+#include "hpc/gpu/adreno/simulated_driver.h"
+#endif
+
+#if defined(HPC_ENABLE_GPU_MALI)
+#include "hpc/gpu/mali/common.h"
+#include "hpc/gpu/mali/simulated_driver.h"
+#include "mali/counter_conversion.h"
+#endif
+
+static void *allocate(void *user_data, size_t size) { return malloc(size); }
+static void deallocate(void *user_data, void *memory) { return free(memory); }
+
+#define MAX_NUM_COUNTERS 512
+#define MAX_NUM_ITERATIONS 2000
+#define NUM_CREATE_ITERATIONS 200
+#define NUM_START_STOP_ITERATIONS 500
+#define NUM_QUERY_ITERATIONS 2000
+#define NUM_CONVERSION_ITERATIONS 200
+#define NUM_CONVERSIONS_PER_ITERATION 1024
+
+static const uint32_t counter_counts[] = {1, 8, 32, 128, 256, 512};
+#define NUM_COUNTER_COUNTS (sizeof(counter_counts) / sizeof(counter_counts[0]))
+
+typedef struct benchmark_state_t {
+  FILE *output;
+  int num_results;
+  uint64_t ioctl_latency_ns;
+  hpc_gpu_host_allocation_callbacks_t allocator;
+  /// Per-iteration durations of the current benchmark.
+  uint64_t durations_ns[MAX_NUM_ITERATIONS];
+} benchmark_state_t;
+
+static uint64_t get_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static int compare_uint64(const void *lhs, const void *rhs) {
+  uint64_t a = *(const uint64_t *)lhs, b = *(const uint64_t *)rhs;
+  return (a > b) - (a < b);
+}
+
+/// Summarizes the first `num_iterations` durations, each covering
+/// `num_operations` operations, and writes one JSON result.
+static void report(benchmark_state_t *state, const char *name,
+                   uint32_t num_counters, uint32_t num_iterations,
+                   uint32_t num_operations) {
+  uint64_t *durations_ns = state->durations_ns;
+  qsort(durations_ns, num_iterations, sizeof(uint64_t), compare_uint64);
+
+  double total_ns = 0;
+  for (uint32_t i = 0; i < num_iterations; ++i) total_ns += durations_ns[i];
+  double p50_ns = (double)durations_ns[num_iterations / 2] / num_operations;
+  double p99_ns =
+      (double)durations_ns[num_iterations * 99 / 100] / num_operations;
+  double mean_ns = total_ns / num_iterations / num_operations;
+
+  fprintf(state->output,
+          "%s\n    {\"name\": \"%s\", \"num_counters\": %" PRIu32
+          ", \"iterations\": %" PRIu32
+          ", \"p50_ns\": %.1f, \"p99_ns\": %.1f, \"mean_ns\": %.1f}",
+          state->num_results++ ? "," : "", name, num_counters, num_iterations,
+          p50_ns, p99_ns, mean_ns);
+}
+
+static void report_failure(const char *name, int status) {
+  fprintf(stderr, "%s failed: %d\n", name, status);
+}
+
+//===----------------------------------------------------------------------===//
+// Adreno
+//===----------------------------------------------------------------------===//
+
+#if defined(HPC_ENABLE_GPU_ADRENO)
+
+/// Fills `counters` with A6XX counters, cycling through as many distinct
+/// countables per group as the kernel driver exposes registers.
+static void adreno_fill_counters(uint32_t num_counters,
+                                 hpc_gpu_adreno_a6xx_counter_t *counters) {
+  uint32_t count = 0;
+  while (count < num_counters) {
+    for (uint32_t g = 0; g < HPC_GPU_ADRENO_A6XX_NUM_GROUPS; ++g) {
+      uint32_t capacity = hpc_gpu_adreno_a6xx_group_capacities[g];
+      for (uint32_t s = 0; s < capacity && count < num_counters; ++s) {
+        counters[count++] = (hpc_gpu_adreno_a6xx_counter_t)((g << 8) | s);
+      }
+    }
+  }
+}
+
+static void adreno_benchmark_context(benchmark_state_t *state,
+                                     uint32_t num_counters) {
+  hpc_gpu_adreno_a6xx_counter_t counters[MAX_NUM_COUNTERS];
+  adreno_fill_counters(num_counters, counters);
+  const hpc_gpu_host_allocation_callbacks_t *allocator = &state->allocator;
+  hpc_gpu_adreno_context_t *context = NULL;
+
+  for (uint32_t i = 0; i < NUM_CREATE_ITERATIONS; ++i) {
+    uint64_t start_ns = get_time_ns();
+    int status = hpc_gpu_adreno_a6xx_create_context(
+        num_counters, counters, HPC_GPU_ADRENO_OUTPUT_MODE_DELTA, allocator,
+        &context);
+    state->durations_ns[i] = get_time_ns() - start_ns;
+    if (status < 0) {
+      report_failure("adreno create context", status);
+      return;
+    }
+    hpc_gpu_adreno_a6xx_destroy_context(context, allocator);
+  }
+  report(state, "adreno/a6xx/create_context", num_counters,
+         NUM_CREATE_ITERATIONS, 1);
+
+  int status = hpc_gpu_adreno_a6xx_create_context(
+      num_counters, counters, HPC_GPU_ADRENO_OUTPUT_MODE_DELTA, allocator,
+      &context);
+  if (status < 0) {
+    report_failure("adreno create context", status);
+    return;
+  }
+
+  uint64_t stop_durations_ns[NUM_START_STOP_ITERATIONS];
+  for (uint32_t i = 0; i < NUM_START_STOP_ITERATIONS; ++i) {
+    uint64_t start_ns = get_time_ns();
+    status = hpc_gpu_adreno_a6xx_start_counters(context);
+    uint64_t stop_ns = get_time_ns();
+    if (status < 0) {
+      report_failure("adreno start counters", status);
+      return;
+    }
+    status = hpc_gpu_adreno_a6xx_stop_counters(context);
+    uint64_t end_ns = get_time_ns();
+    if (status < 0) {
+      report_failure("adreno stop counters", status);
+      return;
+    }
+    state->durations_ns[i] = stop_ns - start_ns;
+    stop_durations_ns[i] = end_ns - stop_ns;
+  }
+  report(state, "adreno/a6xx/start_counters", num_counters,
+         NUM_START_STOP_ITERATIONS, 1);
+  memcpy(state->durations_ns, stop_durations_ns, sizeof(stop_durations_ns));
+  report(state, "adreno/a6xx/stop_counters", num_counters,
+         NUM_START_STOP_ITERATIONS, 1);
+
+  uint64_t values[MAX_NUM_COUNTERS];
+  hpc_gpu_adreno_a6xx_start_counters(context);
+  for (uint32_t i = 0; i < NUM_QUERY_ITERATIONS; ++i) {
+    uint64_t start_ns = get_time_ns();
+    status = hpc_gpu_adreno_a6xx_query_counters(context, values);
+    state->durations_ns[i] = get_time_ns() - start_ns;
+    if (status < 0) {
+      report_failure("adreno query counters", status);
+      return;
+    }
+  }
+  report(state, "adreno/a6xx/query_counters", num_counters,
+         NUM_QUERY_ITERATIONS, 1);
+
+  hpc_gpu_adreno_a6xx_stop_counters(context);
+  hpc_gpu_adreno_a6xx_destroy_context(context, allocator);
+}
+
+static void adreno_benchmark_conversion(benchmark_state_t *state,
+                                        hpc_gpu_adreno_series_t series,
+                                        const char *name) {
+  static const hpc_gpu_adreno_common_counter_t counters[] = {
+      HPC_GPU_ADRENO_COMMON_CP_ALWAYS_COUNT,
+      HPC_GPU_ADRENO_COMMON_RBBM_DCOM_BUSY,
+      HPC_GPU_ADRENO_COMMON_PC_INSTANCES,
+      HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_UCHE,
+      HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_UCHE,
+      HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_BARYPLANE,
+      HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_SUPER_TILES,
+      HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ1,
+      HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_32BIT,
+      HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_POINT,
+      HPC_GPU_ADRENO_COMMON_SP_WAVE_NOP_CYCLES,
+      HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_HALF_ALU_INSTRUCTIONS,
+      HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO1_FULL,
+      HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG3_COUNT,
+      HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PRIM_AFTER_LRZ,
+      HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT,
+  };
+
+  volatile uint32_t sink = 0;
+  for (uint32_t i = 0; i < NUM_CONVERSION_ITERATIONS; ++i) {
+    uint32_t result = 0;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t j = 0; j < NUM_CONVERSIONS_PER_ITERATION; ++j) {
+      result += hpc_gpu_adreno_common_convert_counter(counters[j & 15], series);
+    }
+    state->durations_ns[i] = get_time_ns() - start_ns;
+    sink += result;
+  }
+  report(state, name, 1, NUM_CONVERSION_ITERATIONS,
+         NUM_CONVERSIONS_PER_ITERATION);
+}
+
+static void adreno_run_benchmarks(benchmark_state_t *state) {
+  hpc_gpu_adreno_simulated_driver_create_info_t create_info = {
+      /*gpu_id=*/640, /*num_groups=*/0, /*num_group_slots=*/NULL,
+      state->ioctl_latency_ns};
+  hpc_gpu_adreno_simulated_driver_t *driver = NULL;
+  int status = hpc_gpu_adreno_create_simulated_driver(
+      &create_info, &state->allocator, &driver);
+  if (status < 0) {
+    report_failure("adreno simulated driver", status);
+    return;
+  }
+  hpc_gpu_adreno_use_simulated_driver(driver);
+
+  for (uint32_t i = 0; i < NUM_COUNTER_COUNTS; ++i) {
+    adreno_benchmark_context(state, counter_counts[i]);
+  }
+  adreno_benchmark_conversion(state, HPC_GPU_ADRENO_SERIES_A6XX,
+                              "adreno/common/convert_counter/a6xx");
+  adreno_benchmark_conversion(state, HPC_GPU_ADRENO_SERIES_A5XX,
+                              "adreno/common/convert_counter/a5xx");
+
+  hpc_gpu_adreno_use_simulated_driver(NULL);
+  hpc_gpu_adreno_destroy_simulated_driver(driver, &state->allocator);
+}
+
+#endif  // defined(HPC_ENABLE_GPU_ADRENO)
+
+//===----------------------------------------------------------------------===//
+// Mali
+//===----------------------------------------------------------------------===//
+
+#if defined(HPC_ENABLE_GPU_MALI)
+
+static const hpc_gpu_mali_common_counter_t mali_counter_pool[] = {
+    HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT,
+    HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE,
+    HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE,
+    HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND,
+    HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS,
+    HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS,
+    HPC_GPU_MALI_COMMON_TILER_POINTS,
+    HPC_GPU_MALI_COMMON_TILER_BACK_FACING,
+    HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED,
+    HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE,
+    HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST,
+    HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS,
+    HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS,
+    HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS,
+    HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP,
+    HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL,
+};
+
+static void mali_benchmark_context(benchmark_state_t *state,
+                                   uint32_t num_counters) {
+  hpc_gpu_mali_common_counter_t counters[MAX_NUM_COUNTERS];
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    counters[i] = mali_counter_pool[i % 16];
+  }
+  const hpc_gpu_host_allocation_callbacks_t *allocator = &state->allocator;
+  hpc_gpu_mali_context_t *context = NULL;
+
+  for (uint32_t i = 0; i < NUM_CREATE_ITERATIONS; ++i) {
+    uint64_t start_ns = get_time_ns();
+    int status = hpc_gpu_mali_common_create_context(num_counters, counters,
+                                                    allocator, &context);
+    state->durations_ns[i] = get_time_ns() - start_ns;
+    if (status < 0) {
+      report_failure("mali create context", status);
+      return;
+    }
+    hpc_gpu_mali_common_destroy_context(context, allocator);
+  }
+  report(state, "mali/common/create_context", num_counters,
+         NUM_CREATE_ITERATIONS, 1);
+
+  int status = hpc_gpu_mali_common_create_context(num_counters, counters,
+                                                  allocator, &context);
+  if (status < 0) {
+    report_failure("mali create context", status);
+    return;
+  }
+
+  uint64_t stop_durations_ns[NUM_START_STOP_ITERATIONS];
+  for (uint32_t i = 0; i < NUM_START_STOP_ITERATIONS; ++i) {
+    uint64_t start_ns = get_time_ns();
+    status = hpc_gpu_mali_common_start_counters(context);
+    uint64_t stop_ns = get_time_ns();
+    if (status < 0) {
+      report_failure("mali start counters", status);
+      return;
+    }
+    status = hpc_gpu_mali_common_stop_counters(context);
+    uint64_t end_ns = get_time_ns();
+    if (status < 0) {
+      report_failure("mali stop counters", status);
+      return;
+    }
+    state->durations_ns[i] = stop_ns - start_ns;
+    stop_durations_ns[i] = end_ns - stop_ns;
+  }
+  report(state, "mali/common/start_counters", num_counters,
+         NUM_START_STOP_ITERATIONS, 1);
+  memcpy(state->durations_ns, stop_durations_ns, sizeof(stop_durations_ns));
+  report(state, "mali/common/stop_counters", num_counters,
+         NUM_START_STOP_ITERATIONS, 1);
+
+  uint64_t values[MAX_NUM_COUNTERS];
+  hpc_gpu_mali_common_start_counters(context);
+  for (uint32_t i = 0; i < NUM_QUERY_ITERATIONS; ++i) {
+    uint64_t start_ns = get_time_ns();
+    status = hpc_gpu_mali_common_query_counters(context, values);
+    state->durations_ns[i] = get_time_ns() - start_ns;
+    if (status < 0) {
+      report_failure("mali query counters", status);
+      return;
+    }
+  }
+  report(state, "mali/common/query_counters", num_counters,
+         NUM_QUERY_ITERATIONS, 1);
+
+  hpc_gpu_mali_common_stop_counters(context);
+  hpc_gpu_mali_common_destroy_context(context, allocator);
+}
+
+static void mali_benchmark_conversion(benchmark_state_t *state,
+                                      hpc_gpu_mali_counter_layout_t layout,
+                                      const char *name) {
+  volatile uint32_t sink = 0;
+  for (uint32_t i = 0; i < NUM_CONVERSION_ITERATIONS; ++i) {
+    uint32_t result = 0;
+    uint64_t start_ns = get_time_ns();
+    for (uint32_t j = 0; j < NUM_CONVERSIONS_PER_ITERATION; ++j) {
+      result += hpc_gpu_mali_common_convert_counter(mali_counter_pool[j & 15],
+                                                    layout);
+    }
+    state->durations_ns[i] = get_time_ns() - start_ns;
+    sink += result;
+  }
+  report(state, name, 1, NUM_CONVERSION_ITERATIONS,
+         NUM_CONVERSIONS_PER_ITERATION);
+}
+
+static void mali_run_benchmarks(benchmark_state_t *state) {
+  // A Valhall GPU with 8 shader cores and 2 L2 slices.
+  const uint64_t core_masks[] = {0xffu};
+  hpc_gpu_mali_simulated_driver_create_info_t create_info = {
+      /*gpu_product_id=*/0x9005u,
+      /*num_l2_slices=*/2,
+      /*num_coherency_groups=*/1,
+      core_masks,
+      /*counter_function=*/NULL,
+      /*counter_user_data=*/NULL,
+      state->ioctl_latency_ns,
+  };
+  hpc_gpu_mali_simulated_driver_t *driver = NULL;
+  int status = hpc_gpu_mali_create_simulated_driver(
+      &create_info, &state->allocator, &driver);
+  if (status < 0) {
+    report_failure("mali simulated driver", status);
+    return;
+  }
+  hpc_gpu_mali_use_simulated_driver(driver);
+
+  for (uint32_t i = 0; i < NUM_COUNTER_COUNTS; ++i) {
+    mali_benchmark_context(state, counter_counts[i]);
+  }
+  mali_benchmark_conversion(state, HPC_GPU_MALI_COUNTER_LAYOUT_T86X,
+                            "mali/common/convert_counter/t86x");
+  mali_benchmark_conversion(state, HPC_GPU_MALI_COUNTER_LAYOUT_TMIX,
+                            "mali/common/convert_counter/tmix");
+  mali_benchmark_conversion(state, HPC_GPU_MALI_COUNTER_LAYOUT_TBOX,
+                            "mali/common/convert_counter/tbox");
+
+  hpc_gpu_mali_use_simulated_driver(NULL);
+  hpc_gpu_mali_destroy_simulated_driver(driver, &state->allocator);
+}
+
+#endif  // defined(HPC_ENABLE_GPU_MALI)
+
+int main(int argc, char **argv) {
+  static benchmark_state_t state;
+  state.output = stdout;
+  state.allocator.alloc = &allocate;
+  state.allocator.free = &deallocate;
+
+  const char *output_path = NULL;
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], "--ioctl_latency_ns=", 19) == 0) {
+      state.ioctl_latency_ns = strtoull(argv[i] + 19, NULL, 10);
+    } else if (strncmp(argv[i], "--output=", 9) == 0) {
+      output_path = argv[i] + 9;
+    } else {
+      fprintf(stderr,
+              "usage: %s [--ioctl_latency_ns=<n>] [--output=<path>]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if (output_path) {
+    state.output = fopen(output_path, "w");
+    if (!state.output) {
+      perror(output_path);
+      return 1;
+    }
+  }
+
+  fprintf(state.output,
+          "{\n  \"ioctl_latency_ns\": %" PRIu64 ",\n  \"benchmarks\": [",
+          state.ioctl_latency_ns);
+#if defined(HPC_ENABLE_GPU_ADRENO)
+  adreno_run_benchmarks(&state);
+#endif
+#if defined(HPC_ENABLE_GPU_MALI)
+  mali_run_benchmarks(&state);
+#endif
+  fprintf(state.output, "\n  ]\n}\n");
+
+  if (output_path) fclose(state.output);
+  return 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares extracting Mali counters from a dump via a precomputed gather plan,
+// with and without vectorized block sums or per-block breakdown, against
+// re-deriving block offsets per sample, over synthetic dumps for several
+// core/L2 topologies. Also checks that the vectorized block sum kernel is
+// bit-exact against the scalar one.
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "block_sum.h"
+#include "gather_plan.h"
+#include "hpc/gpu/base_utilities.h"
+
+static void *allocate(void *user_data, size_t size) { return malloc(size); }
+static void deallocate(void *user_data, void *memory) { return free(memory); }
+
+#define NUM_ITERATIONS 200000
+#define MAX_NUM_COUNTERS 64
+#define BLOCK_SIZE HPC_GPU_MALI_NUM_COUNTERS_PER_BLOCK
+#define MAX_NUM_L2_SLICES 8
+#define MAX_BUFFER_SIZE ((2 + MAX_NUM_L2_SLICES + 32) * BLOCK_SIZE)
+
+typedef struct topology_t {
+  const char *name;
+  uint32_t num_l2_slices;
+  uint32_t shader_core_mask;
+} topology_t;
+
+typedef struct counter_mix_t {
+  const char *name;
+  uint32_t num_counters;
+  /// The blocks to request counters from, used round-robin.
+  const uint32_t *block_cycle;
+  uint32_t block_cycle_length;
+} counter_mix_t;
+
+typedef struct reference_context_t {
+  uint32_t num_counters;
+  const uint32_t *blocks;
+  const uint32_t *indices;
+  uint32_t num_l2_slices;
+  uint32_t shader_core_indices[32];
+  uint32_t num_shader_cores;
+} reference_context_t;
+
+static uint64_t get_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+// The per-sample extraction loop used before gather plans.
+static void reference_extract(const reference_context_t *context,
+                              const uint32_t *buffer, uint64_t *values) {
+  for (int i = 0; i < context->num_counters; ++i) {
+    switch ((hpc_gpu_mali_gather_block_t)context->blocks[i]) {
+      case HPC_GPU_MALI_GATHER_BLOCK_JOB_MANAGER: {
+        values[i] = buffer[context->indices[i]];
+      } break;
+      case HPC_GPU_MALI_GATHER_BLOCK_TILER: {
+        values[i] = buffer[BLOCK_SIZE + context->indices[i]];
+      } break;
+      case HPC_GPU_MALI_GATHER_BLOCK_MEMORY: {
+        uint64_t total = 0;
+        uint32_t base_offset = BLOCK_SIZE * 2;
+        for (int j = 0; j < context->num_l2_slices; ++j) {
+          total += buffer[base_offset + BLOCK_SIZE * j + context->indices[i]];
+        }
+        values[i] = total;
+      } break;
+      case HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE: {
+        uint64_t total = 0;
+        uint32_t base_offset = BLOCK_SIZE * (2 + context->num_l2_slices);
+        for (int j = 0; j < context->num_shader_cores; ++j) {
+          uint32_t offset = base_offset +
+                            BLOCK_SIZE * context->shader_core_indices[j] +
+                            context->indices[i];
+          total += buffer[offset];
+        }
+        values[i] = total;
+      } break;
+    }
+  }
+}
+
+// Times extracting counters via `plan`, or via the reference loop if `plan` is
+// NULL, and returns nanoseconds per sample. Per-block values are extracted too
+// if `breakdown` is set.
+static double time_extraction(const reference_context_t *reference,
+                              const hpc_gpu_mali_gather_plan_t *plan,
+                              int breakdown, uint32_t *buffer,
+                              uint64_t *checksum) {
+  static uint64_t shader_core_values[MAX_NUM_COUNTERS * 32];
+  static uint64_t l2_slice_values[MAX_NUM_COUNTERS * MAX_NUM_L2_SLICES];
+  uint64_t values[MAX_NUM_COUNTERS];
+  // Perturb one value per iteration so the work cannot be hoisted.
+  uint64_t start_time = get_time_ns();
+  for (uint32_t i = 0; i < NUM_ITERATIONS; ++i) {
+    buffer[i % MAX_BUFFER_SIZE] += i;
+    if (plan && breakdown) {
+      hpc_gpu_mali_gather_plan_execute_breakdown(
+          plan, buffer, values, shader_core_values, l2_slice_values);
+    } else if (plan) {
+      hpc_gpu_mali_gather_plan_execute(plan, buffer, values);
+    } else {
+      reference_extract(reference, buffer, values);
+    }
+    *checksum += values[i % reference->num_counters];
+  }
+  return (double)(get_time_ns() - start_time) / NUM_ITERATIONS;
+}
+
+static void run_benchmark(
+    const topology_t *topology, const counter_mix_t *mix,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  static uint32_t buffer[MAX_BUFFER_SIZE];
+  for (uint32_t i = 0; i < MAX_BUFFER_SIZE; ++i) buffer[i] = rand();
+
+  uint32_t blocks[MAX_NUM_COUNTERS], indices[MAX_NUM_COUNTERS];
+  for (uint32_t i = 0; i < mix->num_counters; ++i) {
+    blocks[i] = mix->block_cycle[i % mix->block_cycle_length];
+    indices[i] = (i * 7 + 4) % BLOCK_SIZE;
+  }
+
+  reference_context_t reference = {mix->num_counters, blocks, indices,
+                                   topology->num_l2_slices};
+  for (uint32_t i = 0; i < 32; ++i) {
+    if (topology->shader_core_mask & (1u << i)) {
+      reference.shader_core_indices[reference.num_shader_cores++] = i;
+    }
+  }
+
+  hpc_gpu_mali_gather_plan_t gather_plan, block_sum_plan;
+  hpc_gpu_mali_create_gather_plan(
+      mix->num_counters, blocks, indices, topology->num_l2_slices,
+      topology->shader_core_mask, UINT32_MAX, allocator, &gather_plan);
+  hpc_gpu_mali_create_gather_plan(
+      mix->num_counters, blocks, indices, topology->num_l2_slices,
+      topology->shader_core_mask, HPC_GPU_MALI_BLOCK_SUM_THRESHOLD, allocator,
+      &block_sum_plan);
+
+  uint64_t expected[MAX_NUM_COUNTERS], actual[MAX_NUM_COUNTERS];
+  size_t size = mix->num_counters * sizeof(uint64_t);
+  reference_extract(&reference, buffer, expected);
+  hpc_gpu_mali_gather_plan_execute(&gather_plan, buffer, actual);
+  int matches = memcmp(expected, actual, size) == 0;
+  hpc_gpu_mali_gather_plan_execute(&block_sum_plan, buffer, actual);
+  matches = matches && memcmp(expected, actual, size) == 0;
+
+  // The breakdown should sum up to the same totals.
+  static uint64_t shader_core_values[MAX_NUM_COUNTERS * 32];
+  static uint64_t l2_slice_values[MAX_NUM_COUNTERS * MAX_NUM_L2_SLICES];
+  hpc_gpu_mali_gather_plan_execute_breakdown(
+      &block_sum_plan, buffer, actual, shader_core_values, l2_slice_values);
+  matches = matches && memcmp(expected, actual, size) == 0;
+  const hpc_gpu_mali_block_plan_t *cores = &block_sum_plan.shader_core_blocks;
+  for (uint32_t i = 0; i < cores->num_counters; ++i) {
+    uint64_t total = 0;
+    for (uint32_t j = 0; j < cores->num_blocks; ++j) {
+      total += shader_core_values[i * cores->num_blocks + j];
+    }
+    matches = matches && total == expected[cores->slots[i]];
+  }
+
+  uint64_t checksum = 0;
+  double loop_ns = time_extraction(&reference, NULL, 0, buffer, &checksum);
+  double gather_ns =
+      time_extraction(&reference, &gather_plan, 0, buffer, &checksum);
+  double block_sum_ns =
+      time_extraction(&reference, &block_sum_plan, 0, buffer, &checksum);
+  double breakdown_ns =
+      time_extraction(&reference, &block_sum_plan, 1, buffer, &checksum);
+
+  hpc_gpu_mali_destroy_gather_plan(&block_sum_plan, allocator);
+  hpc_gpu_mali_destroy_gather_plan(&gather_plan, allocator);
+
+  printf("%-20s %-13s loop %7.1f  gather %7.1f  block sum %7.1f"
+         "  breakdown %7.1f ns/sample  %s  (checksum %" PRIu64 ")\n",
+         topology->name, mix->name, loop_ns, gather_ns, block_sum_ns,
+         breakdown_ns, matches ? "match" : "MISMATCH", checksum);
+}
+
+// Checks the block sum kernel picked for this CPU against the scalar one,
+// including values that overflow 32-bit sums.
+static void check_block_sum(void) {
+  static uint32_t buffer[MAX_BUFFER_SIZE];
+  uint32_t block_offsets[32];
+  for (uint32_t i = 0; i < 32; ++i) {
+    block_offsets[i] = BLOCK_SIZE * (2 + MAX_NUM_L2_SLICES + i);
+  }
+
+  hpc_gpu_mali_block_sum_function block_sum =
+      hpc_gpu_mali_get_block_sum_function();
+  int matches = 1;
+  for (int round = 0; round < 3; ++round) {
+    for (uint32_t i = 0; i < MAX_BUFFER_SIZE; ++i) {
+      buffer[i] = round == 0 ? UINT32_MAX : round == 1 ? i : rand();
+    }
+    for (uint32_t num_blocks = 0; num_blocks <= 32; ++num_blocks) {
+      uint64_t expected[BLOCK_SIZE], actual[BLOCK_SIZE];
+      hpc_gpu_mali_block_sum_scalar(buffer, block_offsets, num_blocks,
+                                    expected);
+      block_sum(buffer, block_offsets, num_blocks, actual);
+      matches = matches && memcmp(expected, actual, sizeof(expected)) == 0;
+    }
+  }
+  printf("block sum kernel %s scalar\n",
+         matches ? "bit-exact against" : "MISMATCHES");
+}
+
+int main(void) {
+  hpc_gpu_host_allocation_callbacks_t allocator = {NULL, &allocate,
+                                                   &deallocate};
+
+  const topology_t topologies[] = {
+      {"1 L2, 1 core", 1, 0x00000001u},
+      {"2 L2, 4 cores", 2, 0x0000000fu},
+      {"2 L2, 6 sparse cores", 2, 0x00000077u},
+      {"4 L2, 16 cores", 4, 0x00ff00ffu},
+      {"8 L2, 32 cores", 8, 0xffffffffu},
+  };
+
+  const uint32_t mixed_blocks[] = {
+      HPC_GPU_MALI_GATHER_BLOCK_JOB_MANAGER,
+      HPC_GPU_MALI_GATHER_BLOCK_TILER,
+      HPC_GPU_MALI_GATHER_BLOCK_MEMORY,
+      HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE,
+      HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE,
+  };
+  const uint32_t shader_core_blocks[] = {
+      HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE,
+      HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE,
+      HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE,
+      HPC_GPU_MALI_GATHER_BLOCK_MEMORY,
+  };
+  const counter_mix_t mixes[] = {
+      {"4 mixed", 4, mixed_blocks, 5},
+      {"32 mixed", 32, mixed_blocks, 5},
+      {"64 core-heavy", 64, shader_core_blocks, 4},
+  };
+
+  check_block_sum();
+  for (int i = 0; i < sizeof(topologies) / sizeof(topologies[0]); ++i) {
+    for (int j = 0; j < sizeof(mixes) / sizeof(mixes[0]); ++j) {
+      run_benchmark(&topologies[i], &mixes[j], &allocator);
+    }
+  }
+
+  return 0;
+}
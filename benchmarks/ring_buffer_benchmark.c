@@ -0,0 +1,125 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures ring buffer throughput with one consumer draining in batches while
+// one or more producers push samples one at a time, as a sampler thread does.
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/ring_buffer.h"
+
+static void *allocate(void *user_data, size_t size) { return malloc(size); }
+static void deallocate(void *user_data, void *memory) { return free(memory); }
+
+#define NUM_SAMPLES_PER_PRODUCER (1u << 20)
+#define NUM_SAMPLES_PER_POP 256
+#define MAX_NUM_COUNTERS 256
+#define MAX_NUM_PRODUCERS 4
+
+typedef struct producer_t {
+  hpc_gpu_ring_buffer_t *ring_buffer;
+  uint32_t num_counters;
+} producer_t;
+
+static uint64_t get_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static void *produce(void *data) {
+  producer_t *producer = (producer_t *)data;
+  uint64_t values[MAX_NUM_COUNTERS];
+  for (uint32_t i = 0; i < producer->num_counters; ++i) values[i] = i;
+
+  for (uint64_t timestamp = 0; timestamp < NUM_SAMPLES_PER_PRODUCER;) {
+    if (hpc_gpu_ring_buffer_push(producer->ring_buffer, 1, &timestamp,
+                                 values) == 0) {
+      sched_yield();  // Full; let the consumer drain
+      continue;
+    }
+    ++timestamp;
+  }
+  return NULL;
+}
+
+static void run_benchmark(hpc_gpu_ring_buffer_mode_t mode,
+                          uint32_t num_producers, uint32_t num_counters,
+                          const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  hpc_gpu_ring_buffer_t *ring_buffer = NULL;
+  hpc_gpu_create_ring_buffer(num_counters, 4096, mode, allocator,
+                             &ring_buffer);
+
+  static uint64_t timestamps[NUM_SAMPLES_PER_POP];
+  static uint64_t values[NUM_SAMPLES_PER_POP * MAX_NUM_COUNTERS];
+
+  producer_t producer = {ring_buffer, num_counters};
+  pthread_t threads[MAX_NUM_PRODUCERS];
+
+  uint64_t start_time = get_time_ns();
+  for (uint32_t i = 0; i < num_producers; ++i) {
+    pthread_create(&threads[i], NULL, produce, &producer);
+  }
+
+  uint64_t total = (uint64_t)num_producers * NUM_SAMPLES_PER_PRODUCER;
+  uint64_t num_pops = 0;
+  for (uint64_t num_popped = 0; num_popped < total;) {
+    uint32_t count = hpc_gpu_ring_buffer_pop(ring_buffer, NUM_SAMPLES_PER_POP,
+                                             timestamps, values);
+    if (count == 0) {
+      sched_yield();  // Empty; let producers run
+      continue;
+    }
+    num_popped += count;
+    ++num_pops;
+  }
+  uint64_t elapsed_ns = get_time_ns() - start_time;
+
+  for (uint32_t i = 0; i < num_producers; ++i) pthread_join(threads[i], NULL);
+  hpc_gpu_destroy_ring_buffer(ring_buffer, allocator);
+
+  double seconds = elapsed_ns * 1e-9;
+  double bytes = (double)total * (num_counters + 1) * sizeof(uint64_t);
+  printf("%-6s producers=%" PRIu32 " counters=%-3" PRIu32
+         " %8.2f Msamples/s %8.2f MB/s %6.1f samples/pop\n",
+         mode == HPC_GPU_RING_BUFFER_SINGLE_PRODUCER ? "spsc" : "mpsc",
+         num_producers, num_counters, total / seconds * 1e-6,
+         bytes / seconds * 1e-6, (double)total / num_pops);
+}
+
+int main(void) {
+  hpc_gpu_host_allocation_callbacks_t allocator = {NULL, &allocate,
+                                                   &deallocate};
+
+  const uint32_t counter_counts[] = {1, 8, 64, 256};
+  for (int i = 0; i < sizeof(counter_counts) / sizeof(counter_counts[0]); ++i) {
+    run_benchmark(HPC_GPU_RING_BUFFER_SINGLE_PRODUCER, 1, counter_counts[i],
+                  &allocator);
+    run_benchmark(HPC_GPU_RING_BUFFER_MULTI_PRODUCER, 1, counter_counts[i],
+                  &allocator);
+    run_benchmark(HPC_GPU_RING_BUFFER_MULTI_PRODUCER, MAX_NUM_PRODUCERS,
+                  counter_counts[i], &allocator);
+  }
+
+  return 0;
+}
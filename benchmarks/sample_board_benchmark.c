@@ -0,0 +1,136 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures sample board read throughput with several reader threads taking
+// snapshots while one writer publishes as fast as it can, far more often than
+// any sampler would. Every snapshot is also checked for tearing.
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/sample_board.h"
+
+static void *allocate(void *user_data, size_t size) { return malloc(size); }
+static void deallocate(void *user_data, void *memory) { return free(memory); }
+
+#define NUM_READS_PER_READER (1u << 22)
+#define MAX_NUM_COUNTERS 256
+#define MAX_NUM_READERS 4
+
+typedef struct benchmark_t {
+  hpc_gpu_sample_board_t *board;
+  uint32_t num_counters;
+  _Atomic int stop_writer;
+  _Atomic uint64_t num_torn_reads;
+} benchmark_t;
+
+static uint64_t get_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static void *write_samples(void *data) {
+  benchmark_t *benchmark = (benchmark_t *)data;
+  uint64_t values[MAX_NUM_COUNTERS];
+
+  // Every value of a sample equals its timestamp so readers can spot mixes.
+  for (uint64_t timestamp = 1;
+       !atomic_load_explicit(&benchmark->stop_writer, memory_order_relaxed);
+       ++timestamp) {
+    for (uint32_t i = 0; i < benchmark->num_counters; ++i) {
+      values[i] = timestamp;
+    }
+    hpc_gpu_sample_board_publish(benchmark->board, timestamp, values);
+  }
+  return NULL;
+}
+
+static void *read_samples(void *data) {
+  benchmark_t *benchmark = (benchmark_t *)data;
+  uint64_t values[MAX_NUM_COUNTERS];
+
+  uint64_t num_torn_reads = 0;
+  for (uint32_t i = 0; i < NUM_READS_PER_READER; ++i) {
+    uint64_t timestamp = 0;
+    hpc_gpu_sample_board_read(benchmark->board, &timestamp, values);
+    for (uint32_t j = 0; j < benchmark->num_counters; ++j) {
+      if (values[j] != timestamp) {
+        ++num_torn_reads;
+        break;
+      }
+    }
+  }
+  atomic_fetch_add_explicit(&benchmark->num_torn_reads, num_torn_reads,
+                            memory_order_relaxed);
+  return NULL;
+}
+
+static void run_benchmark(
+    uint32_t num_readers, uint32_t num_counters,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  benchmark_t benchmark;
+  hpc_gpu_create_sample_board(num_counters, allocator, &benchmark.board);
+  benchmark.num_counters = num_counters;
+  atomic_init(&benchmark.stop_writer, 0);
+  atomic_init(&benchmark.num_torn_reads, 0);
+
+  pthread_t writer;
+  pthread_t readers[MAX_NUM_READERS];
+  pthread_create(&writer, NULL, write_samples, &benchmark);
+
+  uint64_t start_time = get_time_ns();
+  uint64_t start_sequence = hpc_gpu_sample_board_get_sequence(benchmark.board);
+  for (uint32_t i = 0; i < num_readers; ++i) {
+    pthread_create(&readers[i], NULL, read_samples, &benchmark);
+  }
+  for (uint32_t i = 0; i < num_readers; ++i) pthread_join(readers[i], NULL);
+  uint64_t elapsed_ns = get_time_ns() - start_time;
+  uint64_t num_published =
+      hpc_gpu_sample_board_get_sequence(benchmark.board) - start_sequence;
+
+  atomic_store_explicit(&benchmark.stop_writer, 1, memory_order_relaxed);
+  pthread_join(writer, NULL);
+  hpc_gpu_destroy_sample_board(benchmark.board, allocator);
+
+  double seconds = elapsed_ns * 1e-9;
+  printf("readers=%" PRIu32 " counters=%-3" PRIu32
+         " %8.2f Mreads/s/reader %8.2f Mpublishes/s torn=%" PRIu64 "\n",
+         num_readers, num_counters, NUM_READS_PER_READER / seconds * 1e-6,
+         num_published / seconds * 1e-6,
+         atomic_load_explicit(&benchmark.num_torn_reads, memory_order_relaxed));
+}
+
+int main(void) {
+  hpc_gpu_host_allocation_callbacks_t allocator = {NULL, &allocate,
+                                                   &deallocate};
+
+  const uint32_t counter_counts[] = {1, 8, 64, 256};
+  for (int i = 0; i < sizeof(counter_counts) / sizeof(counter_counts[0]); ++i) {
+    for (uint32_t num_readers = 1; num_readers <= MAX_NUM_READERS;
+         num_readers *= 2) {
+      run_benchmark(num_readers, counter_counts[i], &allocator);
+    }
+  }
+
+  return 0;
+}
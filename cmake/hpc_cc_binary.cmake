@@ -31,7 +31,7 @@ function(hpc_cc_binary)
     _RULE
     ""
     "NAME"
-    "SRCS;DEPS;INCLUDES,COPTS"
+    "SRCS;DEPS;INCLUDES;COPTS"
     ${ARGN}
   )
 
@@ -50,8 +50,9 @@ int main(void) {
   hpc_gpu_adreno_context_t *context = NULL;
   hpc_gpu_host_allocation_callbacks_t allocator = {NULL, &allocate,
                                                    &deallocate};
-  int status = hpc_gpu_adreno_a6xx_create_context(num_counters, counters,
-                                                  &allocator, &context);
+  int status = hpc_gpu_adreno_a6xx_create_context(
+      num_counters, counters, HPC_GPU_ADRENO_OUTPUT_MODE_DELTA, &allocator,
+      &context);
   if (status < 0) return print_error(status, "create context");
 
   status = hpc_gpu_adreno_a6xx_start_counters(context);
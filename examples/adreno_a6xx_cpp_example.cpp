@@ -0,0 +1,87 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+#include "hpc/gpu/adreno/a6xx.hpp"
+#include "hpc/gpu/base_utilities.h"
+
+namespace a6xx = hpc::gpu::adreno::a6xx;
+
+using ShaderCounters = a6xx::CounterSet<
+    HPC_GPU_ADRENO_A6XX_SP_BUSY_CYCLES, HPC_GPU_ADRENO_A6XX_SP_VS_INSTRUCTIONS,
+    HPC_GPU_ADRENO_A6XX_SP_FS_INSTRUCTIONS,
+    HPC_GPU_ADRENO_A6XX_SP_CS_INSTRUCTIONS,
+    HPC_GPU_ADRENO_A6XX_SP_GPR_READ_CONFLICT,   // A6XX specific
+    HPC_GPU_ADRENO_A6XX_SP_GPR_WRITE_CONFLICT>;  // A6XX specific
+
+// All counters above are in the SP group, which has enough registers to sample
+// them together.
+static_assert(ShaderCounters::count_in_group(hpc::gpu::adreno::A6xx::get_group(
+                  HPC_GPU_ADRENO_A6XX_SP_BUSY_CYCLES)) == ShaderCounters::size,
+              "expected SP counters only");
+
+static int print_error(int status, const char *message) {
+  if (-status >= HPC_GPU_FIRST_ERROR_CODE) {
+    std::printf("error %d: %s\n", status, message);
+  } else {
+    std::perror(message);
+  }
+  return status;
+}
+
+int main() {
+  a6xx::Context<ShaderCounters> context;
+  int status = a6xx::Context<ShaderCounters>::create(
+      HPC_GPU_ADRENO_OUTPUT_MODE_DELTA, &context);
+  if (status < 0) return print_error(status, "create context");
+
+  status = context.start();
+  if (status < 0) return print_error(status, "start counters");
+
+  a6xx::Context<ShaderCounters>::Values values;
+  hpc_gpu_sample_times_t times;
+
+  struct timespec sleep_time, remaining_time;
+  sleep_time.tv_sec = 0;
+  sleep_time.tv_nsec = 100000000;  // 100ms
+
+  for (int i = 0; i < 100; ++i) {
+    context.query(&values, &times);
+    std::printf(
+        "  gpu-clock-cycles=%" PRIu64 ", sp-busy-cycles=%" PRId64
+        ", sp-instructions=[vs=%" PRId64 ", fs=%" PRId64 ", cs=%" PRId64
+        "], sp-gpr-conflict=[load=%" PRId64 ", store=%" PRId64 "]\n",
+        times.gpu_clock_cycles,
+        values.get<HPC_GPU_ADRENO_A6XX_SP_BUSY_CYCLES>(),
+        values.get<HPC_GPU_ADRENO_A6XX_SP_VS_INSTRUCTIONS>(),
+        values.get<HPC_GPU_ADRENO_A6XX_SP_FS_INSTRUCTIONS>(),
+        values.get<HPC_GPU_ADRENO_A6XX_SP_CS_INSTRUCTIONS>(),
+        values.get<HPC_GPU_ADRENO_A6XX_SP_GPR_READ_CONFLICT>(),
+        values.get<HPC_GPU_ADRENO_A6XX_SP_GPR_WRITE_CONFLICT>());
+
+    nanosleep(&sleep_time, &remaining_time);
+  }
+
+  status = context.stop();
+  if (status < 0) return print_error(status, "stop counters");
+
+  // The context is destroyed when it goes out of scope.
+  return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "hpc/gpu/adreno/a6xx.h"
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/sampler.h"
+
+static void *allocate(void *user_data, size_t size) { return malloc(size); }
+static void deallocate(void *user_data, void *memory) { return free(memory); }
+
+static int query(void *context, uint64_t *values,
+                 hpc_gpu_sample_times_t *times) {
+  return hpc_gpu_adreno_a6xx_query_counters_with_times(context, values, times);
+}
+
+int print_error(int status, char *message) {
+  if (-status >= HPC_GPU_FIRST_ERROR_CODE) {
+    printf("error %d: %s\n", status, message);
+  } else {
+    perror(message);
+  }
+  return status;
+}
+
+#define NUM_SAMPLES_PER_FLUSH 128
+
+int main(void) {
+  hpc_gpu_adreno_a6xx_counter_t counters[] = {
+      HPC_GPU_ADRENO_A6XX_SP_BUSY_CYCLES,
+      HPC_GPU_ADRENO_A6XX_SP_ALU_WORKING_CYCLES,
+      HPC_GPU_ADRENO_A6XX_SP_FS_INSTRUCTIONS,
+  };
+
+  uint32_t num_counters = sizeof(counters) / sizeof(counters[0]);
+  uint32_t num_values = num_counters + HPC_GPU_SAMPLER_NUM_TIME_VALUES;
+
+  hpc_gpu_adreno_context_t *context = NULL;
+  hpc_gpu_host_allocation_callbacks_t allocator = {NULL, &allocate,
+                                                   &deallocate};
+  int status = hpc_gpu_adreno_a6xx_create_context(
+      num_counters, counters, HPC_GPU_ADRENO_OUTPUT_MODE_DELTA, &allocator,
+      &context);
+  if (status < 0) return print_error(status, "create context");
+
+  status = hpc_gpu_adreno_a6xx_start_counters(context);
+  if (status < 0) return print_error(status, "start counters");
+
+  hpc_gpu_sampler_create_info_t create_info;
+  create_info.context = context;
+  create_info.query = query;
+  create_info.num_counters = num_counters;
+  create_info.max_num_samples = 4 * NUM_SAMPLES_PER_FLUSH;
+  create_info.period_ns = 1000000;  // 1ms
+
+  hpc_gpu_sampler_t *sampler = NULL;
+  status = hpc_gpu_create_sampler(&create_info, &allocator, &sampler);
+  if (status < 0) return print_error(status, "create sampler");
+
+  status = hpc_gpu_sampler_start(sampler);
+  if (status < 0) return print_error(status, "start sampler");
+
+  uint64_t timestamps[NUM_SAMPLES_PER_FLUSH];
+  uint64_t values[NUM_SAMPLES_PER_FLUSH * num_values];
+
+  struct timespec sleep_time, remaining_time;
+  sleep_time.tv_sec = 0;
+  sleep_time.tv_nsec = 100000000;  // 100ms
+
+  for (int i = 0; i < 10; ++i) {
+    nanosleep(&sleep_time, &remaining_time);
+
+    uint32_t num_samples = 0;
+    hpc_gpu_sampler_flush(sampler, NUM_SAMPLES_PER_FLUSH, timestamps, values,
+                          &num_samples);
+    for (uint32_t j = 0; j < num_samples; ++j) {
+      const uint64_t *sample = values + j * num_values;
+      // The GPU clock cycles are the last time value.
+      printf("  t=%" PRIu64 "ns sp-busy-cycles=%" PRIu64
+             ", sp-alu-working-cycles=%" PRIu64 ", fs-instructions=%" PRIu64
+             ", gpu-clock-cycles=%" PRIu64 "\n",
+             timestamps[j], sample[0], sample[1], sample[2],
+             sample[num_values - 1]);
+    }
+  }
+
+  status = hpc_gpu_sampler_stop(sampler);
+  if (status < 0) return print_error(status, "stop sampler");
+  printf("dropped samples: %" PRIu64 "\n",
+         hpc_gpu_sampler_get_num_dropped_samples(sampler));
+
+  status = hpc_gpu_destroy_sampler(sampler, &allocator);
+  if (status < 0) return print_error(status, "destroy sampler");
+
+  status = hpc_gpu_adreno_a6xx_stop_counters(context);
+  if (status < 0) return print_error(status, "stop counters");
+
+  status = hpc_gpu_adreno_a6xx_destroy_context(context, &allocator);
+  if (status < 0) return print_error(status, "destroy context");
+
+  return 0;
+}
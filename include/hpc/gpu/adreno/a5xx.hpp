@@ -0,0 +1,66 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_A5XX_HPP_
+#define HPC_GPU_ADRENO_A5XX_HPP_
+
+#include <cstdint>
+
+#include "hpc/gpu/adreno/a5xx.h"
+#include "hpc/gpu/adreno/context.hpp"
+#include "hpc/gpu/counter_set.hpp"
+
+namespace hpc {
+namespace gpu {
+namespace adreno {
+
+/// Traits for A5XX Adreno GPU counters.
+struct A5xx
+    : SeriesTraits<hpc_gpu_adreno_a5xx_counter_t,
+                   hpc_gpu_adreno_a5xx_create_context,
+                   hpc_gpu_adreno_a5xx_create_decoded_context,
+                   hpc_gpu_adreno_a5xx_destroy_context,
+                   hpc_gpu_adreno_a5xx_start_counters,
+                   hpc_gpu_adreno_a5xx_start_counters_multiplexed,
+                   hpc_gpu_adreno_a5xx_stop_counters,
+                   hpc_gpu_adreno_a5xx_query_counters,
+                   hpc_gpu_adreno_a5xx_query_counters_with_times> {
+  static constexpr uint32_t get_group(counter_type counter) {
+    return static_cast<uint32_t>(counter) >> 8u;
+  }
+  static constexpr uint32_t get_selector(counter_type counter) {
+    return static_cast<uint32_t>(counter) & (256u - 1u);
+  }
+};
+
+namespace a5xx {
+
+/// A set of A5XX Adreno GPU counters fixed at compile time, e.g.,
+/// `CounterSet<HPC_GPU_ADRENO_A5XX_SP_BUSY_CYCLES>`.
+template <hpc_gpu_adreno_a5xx_counter_t... Counters>
+using CounterSet = ::hpc::gpu::CounterSet<A5xx, Counters...>;
+
+/// A move-only handle owning a context for sampling the counter set `Set`.
+template <typename Set>
+using Context = ::hpc::gpu::adreno::Context<Set>;
+
+}  // namespace a5xx
+
+}  // namespace adreno
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_ADRENO_A5XX_HPP_
@@ -17,75 +17,17 @@
 #ifndef HPC_GPU_ADRENO_A6XX_H_
 #define HPC_GPU_ADRENO_A6XX_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "hpc/gpu/adreno/output_mode.h"
 #include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/counter_info.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
 
-// Forward declaration of the counter enum
-typedef enum hpc_gpu_adreno_a6xx_counter_e hpc_gpu_adreno_a6xx_counter_t;
-
-/// The context for A6XX Adreno GPU counters.
-///
-/// Common counters mean counters available to all known Adreno GPUs.
-typedef struct hpc_gpu_adreno_context_t hpc_gpu_adreno_context_t;
-
-/// Creates a context for A6XX Adreno GPU counters.
-///
-/// Creating the context means talking with the Adreno kernel GPU driver and
-/// allocating resources for sampling the given counters.
-///
-/// @param[in]  num_counters The number of counters to sample later.
-/// @param[in]  counters     The pointer to the list of counters to sample
-///                          later.
-/// @param[in]  allocator    The allocator used to allocate host memory for
-///                          sampling counters later.
-/// @param[out] out_context  The pointer to the object receiving the resultant
-///                          context.
-int hpc_gpu_adreno_a6xx_create_context(
-    uint32_t num_counters, hpc_gpu_adreno_a6xx_counter_t *counters,
-    const hpc_gpu_host_allocation_callbacks_t *allocator,
-    hpc_gpu_adreno_context_t **out_context);
-
-/// Destroys the context for A6XX Adreno GPU counters.
-///
-/// @param[in] context   The counter sampling context.
-/// @param[in] allocator The allocator used to free allocated host memory.
-int hpc_gpu_adreno_a6xx_destroy_context(
-    hpc_gpu_adreno_context_t *context,
-    const hpc_gpu_host_allocation_callbacks_t *allocator);
-
-/// Starts sampling the A6XX Adreno GPU counters specified when creating
-/// the context.
-///
-/// This activates the registered counters and reads their initial values in
-/// preparation for continuously sampling.
-///
-/// @param[in] context The counter sampling context.
-int hpc_gpu_adreno_a6xx_start_counters(const hpc_gpu_adreno_context_t *context);
-
-/// Stops sampling the A6XX Adreno GPU counters specified when creating
-/// the context.
-///
-/// This deactivates the registered counters.
-///
-/// @param[in] context The counter sampling context.
-int hpc_gpu_adreno_a6xx_stop_counters(const hpc_gpu_adreno_context_t *context);
-
-/// Samples the A6XX Adreno GPU counters specified when creating
-/// the context.
-///
-/// @param[in]  context The counter sampling context.
-/// @param[out] values  The pointer to the memory for receiving newly sampled
-///                     values. Its element count should be greater than or
-///                     equal to the number of counters specified when
-///                     creating the `context`.
-int hpc_gpu_adreno_a6xx_query_counters(hpc_gpu_adreno_context_t *context,
-                                       uint64_t *values);
-
 //===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
 
 /// Counter choices for Adreno A6XX series.
@@ -1180,6 +1122,199 @@ typedef enum hpc_gpu_adreno_a6xx_counter_e {
 
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
 
+/// The context for A6XX Adreno GPU counters.
+///
+/// Common counters mean counters available to all known Adreno GPUs.
+typedef struct hpc_gpu_adreno_context_t hpc_gpu_adreno_context_t;
+
+/// Creates a context for A6XX Adreno GPU counters.
+///
+/// Creating the context means talking with the Adreno kernel GPU driver and
+/// allocating resources for sampling the given counters.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  counters     The pointer to the list of counters to sample
+///                          later.
+/// @param[in]  output_mode  What queries report for each counter.
+/// @param[in]  allocator    The allocator used to allocate host memory for
+///                          sampling counters later.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_adreno_a6xx_create_context(
+    uint32_t num_counters, hpc_gpu_adreno_a6xx_counter_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context);
+
+/// Creates a context for A6XX Adreno GPU counters already decoded into their
+/// groups and selectors.
+///
+/// This is for callers that decode counters ahead of time, e.g., the C++
+/// counter sets, which decode them at compile time.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  group_ids    The pointer to the group ID of each counter.
+/// @param[in]  selectors    The pointer to the selector of each counter.
+/// @param[in]  output_mode  What queries report for each counter.
+/// @param[in]  allocator    The allocator used to allocate host memory for
+///                          sampling counters later.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_adreno_a6xx_create_decoded_context(
+    uint32_t num_counters, const uint32_t *group_ids, const uint32_t *selectors,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context);
+
+/// Destroys the context for A6XX Adreno GPU counters.
+///
+/// @param[in] context   The counter sampling context.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_adreno_a6xx_destroy_context(
+    hpc_gpu_adreno_context_t *context,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Returns the size and alignment of the memory needed by a context for
+/// A6XX Adreno GPU counters.
+///
+/// Together with `hpc_gpu_adreno_a6xx_create_context_in_memory`, this
+/// allows placing contexts in static or arena memory without any host memory
+/// allocation.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[out] size         The number of bytes needed.
+/// @param[out] alignment    The required alignment of the memory in bytes.
+void hpc_gpu_adreno_a6xx_get_context_memory_requirements(
+    uint32_t num_counters, size_t *size, size_t *alignment);
+
+/// Creates a context for A6XX Adreno GPU counters in the given memory.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  counters     The pointer to the list of counters to sample
+///                          later.
+/// @param[in]  output_mode  What queries report for each counter.
+/// @param[in]  memory       The memory for holding the context. It must
+///                          have the size and alignment reported by the
+///                          `*_get_context_memory_requirements` function
+///                          and outlive the context.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_adreno_a6xx_create_context_in_memory(
+    uint32_t num_counters, hpc_gpu_adreno_a6xx_counter_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode, void *memory,
+    hpc_gpu_adreno_context_t **out_context);
+
+/// Destroys the context for A6XX Adreno GPU counters created by
+/// `hpc_gpu_adreno_a6xx_create_context_in_memory`. The memory itself is
+/// left to the caller.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_adreno_a6xx_destroy_context_in_memory(
+    hpc_gpu_adreno_context_t *context);
+
+/// Starts sampling the A6XX Adreno GPU counters specified when creating
+/// the context.
+///
+/// This activates the registered counters and reads their initial values in
+/// preparation for continuously sampling.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_adreno_a6xx_start_counters(hpc_gpu_adreno_context_t *context);
+
+/// Starts sampling the A6XX Adreno GPU counters specified when creating
+/// the context, time-multiplexing groups with more counters than registers.
+///
+/// Each oversubscribed group is partitioned into slices that fit its
+/// registers, and queries rotate through the slices at most once per
+/// `rotation_period_ns`. Queries then report scaled estimates; see
+/// `hpc_gpu_adreno_a6xx_get_multiplexing_times` for how much of each was
+/// measured.
+///
+/// @param[in] context            The counter sampling context.
+/// @param[in] rotation_period_ns The minimal time between two rotations in
+///                               nanoseconds. Zero rotates on every query.
+int hpc_gpu_adreno_a6xx_start_counters_multiplexed(
+    hpc_gpu_adreno_context_t *context, uint64_t rotation_period_ns);
+
+/// Stops sampling the A6XX Adreno GPU counters specified when creating
+/// the context.
+///
+/// This deactivates the registered counters.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_adreno_a6xx_stop_counters(const hpc_gpu_adreno_context_t *context);
+
+/// Samples the A6XX Adreno GPU counters specified when creating
+/// the context.
+///
+/// @param[in]  context The counter sampling context.
+/// @param[out] values  The pointer to the memory for receiving newly sampled
+///                     values. Its element count should be greater than or
+///                     equal to the number of counters specified when
+///                     creating the `context`.
+int hpc_gpu_adreno_a6xx_query_counters(hpc_gpu_adreno_context_t *context,
+                                       uint64_t *values);
+
+/// Samples the A6XX Adreno GPU counters specified when creating
+/// the context, and reports when the sample was taken.
+///
+/// The kernel driver reports no timestamp, so `driver_timestamp_ns` is always
+/// 0. `gpu_clock_cycles` is the delta of the RBBM always-count counter, which
+/// is enabled together with the requested counters if possible, or 0.
+///
+/// @param[in]  context The counter sampling context.
+/// @param[out] values  The pointer to the memory for receiving newly sampled
+///                     values, as `hpc_gpu_adreno_a6xx_query_counters` does.
+/// @param[out] times   The pointer to the object receiving sample times.
+int hpc_gpu_adreno_a6xx_query_counters_with_times(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times);
+
+/// Returns how long the A6XX Adreno GPU counters have been enabled and
+/// running as of the last query. Without multiplexing, both are the same.
+///
+/// @param[in]  context         The counter sampling context.
+/// @param[out] time_enabled_ns The time since starting counters in
+///                             nanoseconds.
+/// @param[out] time_running_ns The pointer to the memory for receiving the
+///                             time each counter was active in nanoseconds.
+///                             Its element count should be greater than or
+///                             equal to the number of counters specified when
+///                             creating the `context`.
+int hpc_gpu_adreno_a6xx_get_multiplexing_times(
+    const hpc_gpu_adreno_context_t *context, uint64_t *time_enabled_ns,
+    uint64_t *time_running_ns);
+
+/// Packs A6XX Adreno GPU counters into as few replay passes as possible,
+/// given the number of counter registers the KGSL kernel driver exposes for
+/// each group.
+///
+/// See `hpc_gpu_plan_passes` for details.
+///
+/// @param[in]  num_counters   The number of counters to plan.
+/// @param[in]  counters       The pointer to the list of counters to plan.
+/// @param[in]  counter_sets   The set each counter belongs to, or NULL.
+///                            Counters in the same set, e.g., all inputs of
+///                            a derived metric, are placed into the same
+///                            pass.
+/// @param[in]  allocator      The allocator used to allocate temporary host
+///                            memory for planning.
+/// @param[out] counter_passes The pointer to the memory for receiving the
+///                            pass index of each counter.
+/// @param[out] num_passes     The number of passes.
+int hpc_gpu_adreno_a6xx_plan_passes(
+    uint32_t num_counters, const hpc_gpu_adreno_a6xx_counter_t *counters,
+    const uint32_t *counter_sets,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    uint32_t *counter_passes, uint32_t *num_passes);
+
+/// Returns the metadata registry of A6XX Adreno GPU counters.
+///
+/// Use `hpc_gpu_find_counter_info` to look up counters by name, e.g., when
+/// loading counter sets from text configurations.
+const hpc_gpu_counter_registry_t *hpc_gpu_adreno_a6xx_get_counter_registry(
+    void);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
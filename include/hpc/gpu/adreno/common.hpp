@@ -0,0 +1,65 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_COMMON_HPP_
+#define HPC_GPU_ADRENO_COMMON_HPP_
+
+#include <cstdint>
+
+#include "hpc/gpu/adreno/common.h"
+#include "hpc/gpu/adreno/context.hpp"
+#include "hpc/gpu/counter_set.hpp"
+
+namespace hpc {
+namespace gpu {
+namespace adreno {
+
+/// Traits for common Adreno GPU counters.
+///
+/// Common counters only encode their group; selectors depend on the series
+/// of the current GPU and are resolved when creating contexts.
+struct Common
+    : SeriesTraits<hpc_gpu_adreno_common_counter_t,
+                   hpc_gpu_adreno_common_create_context, nullptr,
+                   hpc_gpu_adreno_common_destroy_context,
+                   hpc_gpu_adreno_common_start_counters,
+                   hpc_gpu_adreno_common_start_counters_multiplexed,
+                   hpc_gpu_adreno_common_stop_counters,
+                   hpc_gpu_adreno_common_query_counters,
+                   hpc_gpu_adreno_common_query_counters_with_times> {
+  static constexpr uint32_t get_group(counter_type counter) {
+    return static_cast<uint32_t>(counter) >> 8u;
+  }
+};
+
+namespace common {
+
+/// A set of common Adreno GPU counters fixed at compile time, e.g.,
+/// `CounterSet<HPC_GPU_ADRENO_COMMON_SP_BUSY_CYCLES>`.
+template <hpc_gpu_adreno_common_counter_t... Counters>
+using CounterSet = ::hpc::gpu::CounterSet<Common, Counters...>;
+
+/// A move-only handle owning a context for sampling the counter set `Set`.
+template <typename Set>
+using Context = ::hpc::gpu::adreno::Context<Set>;
+
+}  // namespace common
+
+}  // namespace adreno
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_ADRENO_COMMON_HPP_
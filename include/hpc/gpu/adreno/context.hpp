@@ -0,0 +1,240 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_CONTEXT_HPP_
+#define HPC_GPU_ADRENO_CONTEXT_HPP_
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+#include "hpc/gpu/adreno/output_mode.h"
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/base_utilities.hpp"
+#include "hpc/gpu/counter_set.hpp"
+
+extern "C" {
+typedef struct hpc_gpu_adreno_context_t hpc_gpu_adreno_context_t;
+}
+
+namespace hpc {
+namespace gpu {
+namespace adreno {
+
+template <typename Counter>
+using CreateContextFunction = int (*)(
+    uint32_t num_counters, Counter *counters,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context);
+using CreateDecodedContextFunction = int (*)(
+    uint32_t num_counters, const uint32_t *group_ids, const uint32_t *selectors,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context);
+using DestroyContextFunction = int (*)(
+    hpc_gpu_adreno_context_t *context,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+using StartCountersFunction = int (*)(hpc_gpu_adreno_context_t *context);
+using StartCountersMultiplexedFunction = int (*)(
+    hpc_gpu_adreno_context_t *context, uint64_t rotation_period_ns);
+using StopCountersFunction = int (*)(const hpc_gpu_adreno_context_t *context);
+using QueryCountersFunction = int (*)(hpc_gpu_adreno_context_t *context,
+                                      uint64_t *values);
+using QueryCountersWithTimesFunction = int (*)(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times);
+
+/// Traits describing an Adreno GPU series to `Context`, forwarding to the
+/// series' C functions.
+///
+/// Series derive from this and add how their counters encode groups and
+/// selectors. `CreateDecodedContext` is null for series whose selectors are
+/// only known at runtime; otherwise contexts are created from the groups and
+/// selectors decoded at compile time by `CounterSet`.
+template <typename Counter, CreateContextFunction<Counter> CreateContext,
+          CreateDecodedContextFunction CreateDecodedContext,
+          DestroyContextFunction DestroyContext,
+          StartCountersFunction StartCounters,
+          StartCountersMultiplexedFunction StartCountersMultiplexed,
+          StopCountersFunction StopCounters,
+          QueryCountersFunction QueryCounters,
+          QueryCountersWithTimesFunction QueryCountersWithTimes>
+struct SeriesTraits {
+  using counter_type = Counter;
+
+  /// Creates a context for the counters in `Set`.
+  template <typename Set>
+  static int create_context(
+      hpc_gpu_adreno_output_mode_t output_mode,
+      const hpc_gpu_host_allocation_callbacks_t *allocator,
+      hpc_gpu_adreno_context_t **out_context) {
+    using Decoded =
+        std::integral_constant<bool, CreateDecodedContext != nullptr>;
+    return create_context<Set>(output_mode, allocator, out_context, Decoded());
+  }
+  static int destroy_context(
+      hpc_gpu_adreno_context_t *context,
+      const hpc_gpu_host_allocation_callbacks_t *allocator) {
+    return DestroyContext(context, allocator);
+  }
+  static int start_counters(hpc_gpu_adreno_context_t *context) {
+    return StartCounters(context);
+  }
+  static int start_counters_multiplexed(hpc_gpu_adreno_context_t *context,
+                                        uint64_t rotation_period_ns) {
+    return StartCountersMultiplexed(context, rotation_period_ns);
+  }
+  static int stop_counters(const hpc_gpu_adreno_context_t *context) {
+    return StopCounters(context);
+  }
+  static int query_counters(hpc_gpu_adreno_context_t *context,
+                            uint64_t *values) {
+    return QueryCounters(context, values);
+  }
+  static int query_counters_with_times(hpc_gpu_adreno_context_t *context,
+                                       uint64_t *values,
+                                       hpc_gpu_sample_times_t *times) {
+    return QueryCountersWithTimes(context, values, times);
+  }
+
+ private:
+  template <typename Set>
+  static int create_context(
+      hpc_gpu_adreno_output_mode_t output_mode,
+      const hpc_gpu_host_allocation_callbacks_t *allocator,
+      hpc_gpu_adreno_context_t **out_context, std::true_type) {
+    static constexpr std::array<uint32_t, Set::size> group_ids =
+        Set::group_ids();
+    static constexpr std::array<uint32_t, Set::size> selectors =
+        Set::selectors();
+    return CreateDecodedContext(static_cast<uint32_t>(Set::size),
+                                group_ids.data(), selectors.data(),
+                                output_mode, allocator, out_context);
+  }
+  template <typename Set>
+  static int create_context(
+      hpc_gpu_adreno_output_mode_t output_mode,
+      const hpc_gpu_host_allocation_callbacks_t *allocator,
+      hpc_gpu_adreno_context_t **out_context, std::false_type) {
+    auto counters = Set::counters();
+    return CreateContext(static_cast<uint32_t>(Set::size), counters.data(),
+                         output_mode, allocator, out_context);
+  }
+};
+
+/// A move-only handle owning an Adreno counter sampling context for the
+/// counter set `Set`.
+///
+/// Errors are reported as return values like the C API; no exceptions are
+/// thrown. Host memory is only allocated when creating the context.
+template <typename Set>
+class Context {
+ public:
+  using Series = typename Set::series_type;
+  using Values = CounterValues<Set>;
+
+  /// Creates an empty handle.
+  Context() noexcept = default;
+  ~Context() { reset(); }
+
+  Context(Context &&other) noexcept
+      : context_(other.context_), allocator_(other.allocator_) {
+    other.context_ = nullptr;
+  }
+  Context &operator=(Context &&other) noexcept {
+    if (this != &other) {
+      reset();
+      context_ = other.context_;
+      allocator_ = other.allocator_;
+      other.context_ = nullptr;
+    }
+    return *this;
+  }
+
+  Context(const Context &) = delete;
+  Context &operator=(const Context &) = delete;
+
+  /// Creates a context for sampling the counters in `Set`.
+  ///
+  /// @param[in]  output_mode What queries report for each counter.
+  /// @param[out] out_context The handle receiving the context. It is left
+  ///                         untouched on failure.
+  /// @param[in]  allocator   The allocator used to allocate host memory. It
+  ///                         is copied into the handle.
+  static int create(hpc_gpu_adreno_output_mode_t output_mode,
+                    Context *out_context,
+                    const hpc_gpu_host_allocation_callbacks_t &allocator =
+                        default_allocator()) {
+    hpc_gpu_adreno_context_t *context = nullptr;
+    int status = Series::template create_context<Set>(output_mode, &allocator,
+                                                       &context);
+    if (status < 0) return status;
+    *out_context = Context(context, allocator);
+    return 0;
+  }
+
+  /// Starts sampling counters.
+  int start() noexcept { return Series::start_counters(context_); }
+
+  /// Starts sampling counters, time-multiplexing groups with more counters
+  /// than registers.
+  ///
+  /// @param[in] rotation_period_ns The minimal time between two rotations in
+  ///                               nanoseconds.
+  int start_multiplexed(uint64_t rotation_period_ns) noexcept {
+    return Series::start_counters_multiplexed(context_, rotation_period_ns);
+  }
+
+  /// Stops sampling counters.
+  int stop() noexcept { return Series::stop_counters(context_); }
+
+  /// Samples counters into `values`.
+  int query(Values *values) noexcept {
+    return Series::query_counters(context_, values->data());
+  }
+
+  /// Samples counters into `values` and their sample times into `times`.
+  int query(Values *values, hpc_gpu_sample_times_t *times) noexcept {
+    return Series::query_counters_with_times(context_, values->data(), times);
+  }
+
+  /// Destroys the owned context, if any.
+  void reset() noexcept {
+    if (context_ == nullptr) return;
+    Series::destroy_context(context_, &allocator_);
+    context_ = nullptr;
+  }
+
+  explicit operator bool() const noexcept { return context_ != nullptr; }
+
+  /// Returns the underlying C context for calling the C API directly.
+  hpc_gpu_adreno_context_t *get() const noexcept { return context_; }
+
+ private:
+  Context(hpc_gpu_adreno_context_t *context,
+          const hpc_gpu_host_allocation_callbacks_t &allocator) noexcept
+      : context_(context), allocator_(allocator) {}
+
+  hpc_gpu_adreno_context_t *context_ = nullptr;
+  hpc_gpu_host_allocation_callbacks_t allocator_ = {};
+};
+
+}  // namespace adreno
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_ADRENO_CONTEXT_HPP_
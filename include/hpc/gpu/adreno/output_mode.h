@@ -0,0 +1,43 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_OUTPUT_MODE_H_
+#define HPC_GPU_ADRENO_OUTPUT_MODE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// What Adreno counter queries report for each counter.
+///
+/// The kernel driver exposes free-running counters; all modes are derived
+/// from consecutive raw reads.
+typedef enum hpc_gpu_adreno_output_mode_e {
+  /// The increment since the previous query, or since starting counters for
+  /// the first query.
+  HPC_GPU_ADRENO_OUTPUT_MODE_DELTA = 0,
+  /// The increment since starting counters.
+  HPC_GPU_ADRENO_OUTPUT_MODE_CUMULATIVE = 1,
+  /// The increment since the previous query divided by the elapsed
+  /// `CLOCK_MONOTONIC` time, in counts per second.
+  HPC_GPU_ADRENO_OUTPUT_MODE_RATE = 2,
+} hpc_gpu_adreno_output_mode_t;
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_ADRENO_OUTPUT_MODE_H_
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_SAMPLING_CLIENT_H_
+#define HPC_GPU_ADRENO_SAMPLING_CLIENT_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/adreno/a6xx.h"
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// The abstract Unix domain socket name the sampling daemon listens on by
+/// default.
+#define HPC_GPU_ADRENO_SAMPLING_DEFAULT_SOCKET "hpc-gpu-adreno-sampling"
+
+/// The maximal number of distinct counters the sampling daemon samples for
+/// all clients together.
+#define HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS 128
+
+/// A client of the Adreno sampling daemon.
+///
+/// The daemon owns the only counter context of the device and samples the
+/// union of all counters its clients registered at a fixed rate. Samples are
+/// published into a shared-memory ring that each client maps read-only, so
+/// reading samples needs no system call and never blocks the daemon.
+/// Clients that fall behind by more than the ring capacity lose the oldest
+/// samples.
+typedef struct hpc_gpu_adreno_sampling_client_t
+    hpc_gpu_adreno_sampling_client_t;
+
+/// Connects to the sampling daemon and registers interest in counters.
+///
+/// The interest lasts until the client disconnects. Returns the daemon's
+/// error, e.g., `-HPC_GPU_ERROR_UNSUPPORTED_COUNTER`, if it cannot sample
+/// the requested counters together with those of other clients.
+///
+/// @param[in]  socket_name  The abstract socket name of the daemon, or NULL
+///                          for `HPC_GPU_ADRENO_SAMPLING_DEFAULT_SOCKET`.
+/// @param[in]  num_counters The number of counters, at most
+///                          `HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS`.
+/// @param[in]  counters     The counters to sample.
+/// @param[in]  allocator    The allocator used to allocate host memory for
+///                          the client.
+/// @param[out] out_client   The pointer to the object receiving the
+///                          resultant client.
+int hpc_gpu_adreno_connect_sampling_daemon(
+    const char *socket_name, uint32_t num_counters,
+    const hpc_gpu_adreno_a6xx_counter_t *counters,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_sampling_client_t **out_client);
+
+/// Withdraws the client's counter interest and destroys the client.
+///
+/// @param[in] client    The sampling client.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_adreno_disconnect_sampling_daemon(
+    hpc_gpu_adreno_sampling_client_t *client,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Reads samples published since the previous read, oldest first.
+///
+/// Only samples taken after connecting are returned. Values are the
+/// increments since the previous sample, in the client's counter order.
+///
+/// If the daemon keeps the counter layout locked, this returns -1 and sets
+/// errno to EPIPE if the daemon died while changing it, or EAGAIN otherwise.
+/// `num_samples` still reports the samples read before.
+///
+/// @param[in]  client          The sampling client.
+/// @param[in]  max_num_samples The maximal number of samples to read.
+/// @param[out] timestamps      The pointer to the memory for receiving
+///                             `CLOCK_MONOTONIC` sample timestamps in
+///                             nanoseconds. Its element count should be at
+///                             least `max_num_samples`.
+/// @param[out] values          The pointer to the memory for receiving
+///                             sampled values, one row of `num_counters` per
+///                             sample. Its element count should be at least
+///                             `max_num_samples * num_counters`.
+/// @param[out] num_samples     The number of read samples.
+int hpc_gpu_adreno_sampling_client_read(
+    hpc_gpu_adreno_sampling_client_t *client, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples);
+
+/// Returns the daemon's sampling period in nanoseconds.
+///
+/// @param[in] client The sampling client.
+uint64_t hpc_gpu_adreno_sampling_client_get_period_ns(
+    const hpc_gpu_adreno_sampling_client_t *client);
+
+/// Returns the number of samples the client missed so far because it did not
+/// read them before the daemon overwrote them.
+///
+/// @param[in] client The sampling client.
+uint64_t hpc_gpu_adreno_sampling_client_get_num_dropped_samples(
+    const hpc_gpu_adreno_sampling_client_t *client);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_ADRENO_SAMPLING_CLIENT_H_
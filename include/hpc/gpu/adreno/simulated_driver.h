@@ -0,0 +1,104 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_SIMULATED_DRIVER_H_
+#define HPC_GPU_ADRENO_SIMULATED_DRIVER_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Struct containing information for creating a simulated Adreno driver.
+typedef struct hpc_gpu_adreno_simulated_driver_create_info_t {
+  /// The GPU ID reported to contexts, e.g., 640 for Adreno 640.
+  uint32_t gpu_id;
+  /// The number of counter groups. Zero means using the A6XX group layout
+  /// of the KGSL kernel driver.
+  uint32_t num_groups;
+  /// The number of hardware counter slots in each group, i.e., how many
+  /// distinct countables in the group can be active at the same time. Its
+  /// element count should be `num_groups`. Ignored if `num_groups` is zero.
+  const uint32_t *num_group_slots;
+  /// The time each simulated driver call takes, in nanoseconds.
+  uint64_t ioctl_latency_ns;
+} hpc_gpu_adreno_simulated_driver_create_info_t;
+
+/// A simulated KGSL kernel driver for exercising and benchmarking Adreno
+/// counter sampling without Adreno GPUs.
+///
+/// It models counter groups with a limited number of slots each. Activating
+/// a countable takes a free slot in its group, or bumps the refcount of the
+/// slot already holding it; deactivating drops the refcount and frees the
+/// slot when it reaches zero. Active countables increase monotonically with
+/// time, each at its own fixed rate; inactive ones read as zero. Each driver
+/// call busy-waits for the configured latency to mimic the ioctl cost.
+typedef struct hpc_gpu_adreno_simulated_driver_t
+    hpc_gpu_adreno_simulated_driver_t;
+
+/// Creates a simulated Adreno driver.
+///
+/// @param[in]  create_info The information for creating the driver.
+/// @param[in]  allocator   The allocator used to allocate host memory for the
+///                         driver.
+/// @param[out] out_driver  The pointer to the object receiving the resultant
+///                         driver.
+int hpc_gpu_adreno_create_simulated_driver(
+    const hpc_gpu_adreno_simulated_driver_create_info_t *create_info,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_simulated_driver_t **out_driver);
+
+/// Destroys the simulated Adreno driver.
+///
+/// The driver should not be in use; see `hpc_gpu_adreno_use_simulated_driver`.
+///
+/// @param[in] driver    The simulated driver.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_adreno_destroy_simulated_driver(
+    hpc_gpu_adreno_simulated_driver_t *driver,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Routes all Adreno driver calls to the given simulated driver.
+///
+/// This affects contexts created afterwards and should only be called when no
+/// Adreno context exists.
+///
+/// @param[in] driver The simulated driver, or NULL to go back to the KGSL
+///                   kernel driver.
+void hpc_gpu_adreno_use_simulated_driver(
+    hpc_gpu_adreno_simulated_driver_t *driver);
+
+/// Returns the number of driver calls the simulated driver has served.
+///
+/// @param[in] driver The simulated driver.
+uint64_t hpc_gpu_adreno_simulated_driver_get_num_ioctls(
+    const hpc_gpu_adreno_simulated_driver_t *driver);
+
+/// Returns the number of active counter slots in the given group.
+///
+/// @param[in] driver   The simulated driver.
+/// @param[in] group_id The counter group ID.
+uint32_t hpc_gpu_adreno_simulated_driver_get_num_active_slots(
+    hpc_gpu_adreno_simulated_driver_t *driver, uint32_t group_id);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_ADRENO_SIMULATED_DRIVER_H_
@@ -18,6 +18,7 @@
 #define HPC_GPU_ALLOCATION_CALLBACK_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,6 +41,8 @@ typedef enum hpc_gpu_error_e {
   HPC_GPU_ERROR_DRIVER_HUNGUP,
   /// Internal error.
   HPC_GPU_ERROR_INTERNAL,
+  /// A requested counter is not available on the current GPU device.
+  HPC_GPU_ERROR_UNSUPPORTED_COUNTER,
 } hpc_gpu_error_t;
 
 /// Pointer to host memory allocation function.
@@ -55,6 +58,24 @@ typedef struct hpc_gpu_host_allocation_callbacks_t {
   hpc_gpu_host_free_function free;
 } hpc_gpu_host_allocation_callbacks_t;
 
+/// Timing information of one counter sample.
+///
+/// Host timestamps bracket the driver calls taking the sample, so the sample
+/// was taken somewhere between them. Rates should be computed from the
+/// driver timestamp or the GPU clock reference when available.
+typedef struct hpc_gpu_sample_times_t {
+  /// The kernel driver's timestamp of the sample in nanoseconds, or 0 if the
+  /// driver does not report one.
+  uint64_t driver_timestamp_ns;
+  /// The `CLOCK_MONOTONIC_RAW` time right before sampling in nanoseconds.
+  uint64_t host_begin_ns;
+  /// The `CLOCK_MONOTONIC_RAW` time right after sampling in nanoseconds.
+  uint64_t host_end_ns;
+  /// The number of cycles an always-on GPU counter advanced since the
+  /// previous sample, or 0 if the GPU provides no such counter.
+  uint64_t gpu_clock_cycles;
+} hpc_gpu_sample_times_t;
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
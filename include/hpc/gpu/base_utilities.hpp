@@ -0,0 +1,50 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_BASE_UTILITIES_HPP_
+#define HPC_GPU_BASE_UTILITIES_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+
+#include "hpc/gpu/base_utilities.h"
+
+namespace hpc {
+namespace gpu {
+
+namespace detail {
+
+inline void *default_alloc(void * /*user_data*/, size_t size) {
+  return std::malloc(size);
+}
+
+inline void default_free(void * /*user_data*/, void *memory) {
+  std::free(memory);
+}
+
+}  // namespace detail
+
+/// Returns allocation callbacks forwarding to `std::malloc` and `std::free`.
+inline const hpc_gpu_host_allocation_callbacks_t &default_allocator() {
+  static const hpc_gpu_host_allocation_callbacks_t allocator = {
+      nullptr, &detail::default_alloc, &detail::default_free};
+  return allocator;
+}
+
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_BASE_UTILITIES_HPP_
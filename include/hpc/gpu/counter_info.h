@@ -0,0 +1,84 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_COUNTER_INFO_H_
+#define HPC_GPU_COUNTER_INFO_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Metadata of one GPU counter.
+typedef struct hpc_gpu_counter_info_t {
+  /// The counter's enum value in its series.
+  uint32_t counter;
+  /// Bit mask of the GPU series providing a counter with the same name. Bit
+  /// `i` corresponds to the registry's `series_names[i]`.
+  uint32_t availability;
+  /// The counter name, i.e., the enum symbol without the series prefix, e.g.,
+  /// "SP_BUSY_CYCLES".
+  const char *name;
+  /// The name of the counter group or block, e.g., "SP".
+  const char *group;
+  /// A human-readable description.
+  const char *description;
+  /// The unit of counted values, e.g., "cycles". This is a best-effort guess
+  /// from the counter name as vendor definitions carry no units.
+  const char *unit;
+} hpc_gpu_counter_info_t;
+
+/// A read-only registry of counter metadata for one series.
+///
+/// All tables are generated at build time. Names are looked up through a
+/// minimal perfect hash: one hash of the name, one displacement load and one
+/// string comparison, regardless of the number of counters.
+typedef struct hpc_gpu_counter_registry_t {
+  /// The number of counters.
+  uint32_t num_counters;
+  /// Counter metadata, in the order of the series' counter enum.
+  const hpc_gpu_counter_info_t *counters;
+  /// The number of series availability bits refer to.
+  uint32_t num_series;
+  /// The names of the series availability bits refer to.
+  const char *const *series_names;
+  /// The number of perfect hash buckets.
+  uint32_t num_buckets;
+  /// The displacement of each perfect hash bucket.
+  const uint16_t *displacements;
+  /// The index into `counters` of each perfect hash slot.
+  const uint16_t *slots;
+} hpc_gpu_counter_registry_t;
+
+/// Looks up counter metadata by name.
+///
+/// Returns NULL if no counter in the registry has the given name.
+///
+/// @param[in] registry    The counter registry.
+/// @param[in] name        The counter name, e.g., "SP_BUSY_CYCLES". It needs
+///                        not be NUL-terminated.
+/// @param[in] name_length The number of characters in `name`.
+const hpc_gpu_counter_info_t *hpc_gpu_find_counter_info(
+    const hpc_gpu_counter_registry_t *registry, const char *name,
+    size_t name_length);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_COUNTER_INFO_H_
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_COUNTER_SET_HPP_
+#define HPC_GPU_COUNTER_SET_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpc {
+namespace gpu {
+
+/// A set of counters fixed at compile time.
+///
+/// `Series` describes the GPU series the counters come from; it provides the
+/// `counter_type` enum and the functions for sampling counters. Everything
+/// about the set itself, e.g., where a counter's value lives in a sample, is
+/// resolved at compile time.
+template <typename Series, typename Series::counter_type... Counters>
+struct CounterSet {
+  static_assert(sizeof...(Counters) > 0, "counter sets cannot be empty");
+
+  using series_type = Series;
+  using counter_type = typename Series::counter_type;
+
+  /// The number of counters in the set.
+  static constexpr std::size_t size = sizeof...(Counters);
+
+  /// Returns the counters in the set, in order.
+  static constexpr std::array<counter_type, size> counters() {
+    return {{Counters...}};
+  }
+
+  /// Returns the index of the counter's value in samples, or `size` if the
+  /// counter is not in the set.
+  static constexpr std::size_t index_of(counter_type counter) {
+    const counter_type counters[] = {Counters...};
+    for (std::size_t i = 0; i < size; ++i) {
+      if (counters[i] == counter) return i;
+    }
+    return size;
+  }
+
+  /// Returns whether the counter is in the set.
+  static constexpr bool contains(counter_type counter) {
+    return index_of(counter) != size;
+  }
+
+  /// Returns the group ID of each counter, for series whose counters encode
+  /// one.
+  static constexpr std::array<uint32_t, size> group_ids() {
+    return {{Series::get_group(Counters)...}};
+  }
+
+  /// Returns the selector of each counter, for series whose counters encode
+  /// one. Together with `group_ids`, contexts for such series are created
+  /// without decoding counters at runtime.
+  static constexpr std::array<uint32_t, size> selectors() {
+    return {{Series::get_selector(Counters)...}};
+  }
+
+  /// Returns the number of counters in the set belonging to the given group.
+  static constexpr uint32_t count_in_group(uint32_t group_id) {
+    const uint32_t group_ids[] = {Series::get_group(Counters)...};
+    uint32_t count = 0;
+    for (std::size_t i = 0; i < size; ++i) count += group_ids[i] == group_id;
+    return count;
+  }
+};
+
+template <typename Series, typename Series::counter_type... Counters>
+constexpr std::size_t CounterSet<Series, Counters...>::size;
+
+/// Values sampled for a counter set.
+///
+/// Values are stored in the order of counters in the set. They can be
+/// accessed by counter with `get`, which resolves the index at compile time.
+template <typename Set>
+class CounterValues {
+ public:
+  using counter_type = typename Set::counter_type;
+
+  /// Returns the value of the given counter.
+  template <counter_type Counter>
+  uint64_t get() const noexcept {
+    static_assert(Set::contains(Counter), "counter not in the counter set");
+    return values_[Set::index_of(Counter)];
+  }
+
+  uint64_t operator[](std::size_t index) const noexcept {
+    return values_[index];
+  }
+
+  const std::array<uint64_t, Set::size> &array() const noexcept {
+    return values_;
+  }
+
+  /// Returns the pointer for C query functions to write values into.
+  uint64_t *data() noexcept { return values_.data(); }
+
+ private:
+  std::array<uint64_t, Set::size> values_ = {};
+};
+
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_COUNTER_SET_HPP_
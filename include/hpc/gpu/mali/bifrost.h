@@ -17,71 +17,16 @@
 #ifndef HPC_GPU_MALI_BIFROST_H_
 #define HPC_GPU_MALI_BIFROST_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/counter_info.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
 
-// Forward declaration of the counter enum.
-typedef enum hpc_gpu_mali_bifrost_counter_e hpc_gpu_mali_bifrost_counter_t;
-
-/// The context for sampling Mali GPU counters.
-typedef struct hpc_gpu_mali_context_t hpc_gpu_mali_context_t;
-
-/// Creates a context for sampling counters available to all known Mali Bifrost
-/// GPUs.
-///
-/// Creating the context means talking with the Mali GPU kernel driver and
-/// allocating resources for sampling the given counters.
-///
-/// @param[in]  num_counters The number of counters to sample later.
-/// @param[in]  counters     The pointer to the list of counters to sample
-///                          later.
-/// @param[in]  allocator    The allocator used to allocate host memory for
-///                          sampling counters later.
-/// @param[out] out_context  The pointer to the object receiving the resultant
-///                          context.
-int hpc_gpu_mali_bifrost_create_context(
-    uint32_t num_counters, hpc_gpu_mali_bifrost_counter_t *counters,
-    const hpc_gpu_host_allocation_callbacks_t *allocator,
-    hpc_gpu_mali_context_t **out_context);
-
-/// Destroys the context for common Mali Bifrost GPU counters.
-///
-/// @param[in] context   The counter sampling context.
-/// @param[in] allocator The allocator used to free allocated host memory.
-int hpc_gpu_mali_bifrost_destroy_context(
-    hpc_gpu_mali_context_t *context,
-    const hpc_gpu_host_allocation_callbacks_t *allocator);
-
-/// Starts sampling the common Mali Bifrost GPU counters specified when creating
-/// the context.
-///
-/// This zeros the registered counters in preparation for continously sampling.
-///
-/// @param[in] context The counter sampling context.
-int hpc_gpu_mali_bifrost_start_counters(const hpc_gpu_mali_context_t *context);
-
-/// Stops sampling the common Mali Bifrost GPU counters specified when creating
-/// the context.
-///
-/// @param[in] context The counter sampling context.
-int hpc_gpu_mali_bifrost_stop_counters(const hpc_gpu_mali_context_t *context);
-
-/// Samples the common Mali Bifrost GPU counters specified when creating
-/// the context.
-///
-/// @param[in]  context The counter sampling context.
-/// @param[out] values  The pointer to the memory for receiving newly sampled
-///                     values. Its element count should be greater than or
-///                     equal to the number of counters specified when
-///                     creating the `context`.
-int hpc_gpu_mali_bifrost_query_counters(const hpc_gpu_mali_context_t *context,
-                                        uint64_t *values);
-
 //===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
 
 /// Common Mali Bifrost GPU counters.
@@ -258,6 +203,192 @@ typedef enum hpc_gpu_mali_bifrost_counter_e {
 
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
 
+/// The context for sampling Mali GPU counters.
+typedef struct hpc_gpu_mali_context_t hpc_gpu_mali_context_t;
+
+/// Creates a context for sampling counters available to all known Mali Bifrost
+/// GPUs.
+///
+/// Creating the context means talking with the Mali GPU kernel driver and
+/// allocating resources for sampling the given counters.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  counters     The pointer to the list of counters to sample
+///                          later.
+/// @param[in]  allocator    The allocator used to allocate host memory for
+///                          sampling counters later.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_mali_bifrost_create_context(
+    uint32_t num_counters, hpc_gpu_mali_bifrost_counter_t *counters,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_context_t **out_context);
+
+/// Destroys the context for common Mali Bifrost GPU counters.
+///
+/// @param[in] context   The counter sampling context.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_mali_bifrost_destroy_context(
+    hpc_gpu_mali_context_t *context,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Returns the size and alignment of the memory needed by a context for
+/// common Mali Bifrost GPU counters.
+///
+/// Together with `hpc_gpu_mali_bifrost_create_context_in_memory`, this
+/// allows placing contexts in static or arena memory without any host memory
+/// allocation. The size covers the largest supported GPU topology.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[out] size         The number of bytes needed.
+/// @param[out] alignment    The required alignment of the memory in bytes.
+void hpc_gpu_mali_bifrost_get_context_memory_requirements(
+    uint32_t num_counters, size_t *size, size_t *alignment);
+
+/// Creates a context for common Mali Bifrost GPU counters in the given memory.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  counters     The pointer to the list of counters to sample
+///                          later.
+/// @param[in]  memory       The memory for holding the context. It must
+///                          have the size and alignment reported by the
+///                          `*_get_context_memory_requirements` function
+///                          and outlive the context.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_mali_bifrost_create_context_in_memory(
+    uint32_t num_counters, hpc_gpu_mali_bifrost_counter_t *counters,
+    void *memory, hpc_gpu_mali_context_t **out_context);
+
+/// Destroys the context for common Mali Bifrost GPU counters created by
+/// `hpc_gpu_mali_bifrost_create_context_in_memory`. The memory itself is
+/// left to the caller.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_mali_bifrost_destroy_context_in_memory(
+    hpc_gpu_mali_context_t *context);
+
+/// Starts sampling the common Mali Bifrost GPU counters specified when creating
+/// the context.
+///
+/// This zeros the registered counters in preparation for continously sampling.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_mali_bifrost_start_counters(const hpc_gpu_mali_context_t *context);
+
+/// Stops sampling the common Mali Bifrost GPU counters specified when creating
+/// the context.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_mali_bifrost_stop_counters(const hpc_gpu_mali_context_t *context);
+
+/// Samples the common Mali Bifrost GPU counters specified when creating
+/// the context.
+///
+/// @param[in]  context The counter sampling context.
+/// @param[out] values  The pointer to the memory for receiving newly sampled
+///                     values. Its element count should be greater than or
+///                     equal to the number of counters specified when
+///                     creating the `context`.
+int hpc_gpu_mali_bifrost_query_counters(const hpc_gpu_mali_context_t *context,
+                                        uint64_t *values);
+
+/// Samples the common Mali Bifrost GPU counters specified when creating
+/// the context, and reports when the sample was taken.
+///
+/// `driver_timestamp_ns` is the kernel driver's timestamp of the dump. Mali
+/// GPUs have no clock reference counter, so `gpu_clock_cycles` is always 0.
+///
+/// @param[in]  context The counter sampling context.
+/// @param[out] values  The pointer to the memory for receiving newly sampled
+///                     values, as `hpc_gpu_mali_bifrost_query_counters` does.
+/// @param[out] times   The pointer to the object receiving sample times.
+int hpc_gpu_mali_bifrost_query_counters_with_times(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times);
+
+/// Starts sampling the common Mali Bifrost GPU counters specified when creating
+/// the context, with dumps driven by the kernel driver.
+///
+/// This zeros the registered counters and then asks the kernel driver to dump
+/// them every `interval_ns`. Use `hpc_gpu_mali_bifrost_query_counter_batch`
+/// to retrieve the samples.
+///
+/// @param[in] context     The counter sampling context.
+/// @param[in] interval_ns The dump interval in nanoseconds.
+int hpc_gpu_mali_bifrost_start_periodic_counters(
+    const hpc_gpu_mali_context_t *context, uint32_t interval_ns);
+
+/// Retrieves all samples of the common Mali Bifrost GPU counters periodically
+/// dumped by the kernel driver since the last call.
+///
+/// This blocks until at least one dump is ready, then drains as many ready
+/// dumps as possible, oldest first.
+///
+/// The kernel driver takes these dumps on its own timer, not during this
+/// call, so there are no host times bracketing them as with
+/// `*_query_counters_with_times`. The kernel driver's timestamp is the only
+/// sample time.
+///
+/// @param[in]  context         The counter sampling context.
+/// @param[in]  max_num_samples The maximal number of samples to retrieve.
+/// @param[out] timestamps      The pointer to the memory for receiving the
+///                             kernel driver's timestamp for each sample. Its
+///                             element count should be at least
+///                             `max_num_samples`.
+/// @param[out] values          The pointer to the memory for receiving
+///                             sampled values, one row of `num_counters` per
+///                             sample. Its element count should be at least
+///                             `max_num_samples * num_counters`.
+/// @param[out] num_samples     The number of retrieved samples.
+int hpc_gpu_mali_bifrost_query_counter_batch(
+    const hpc_gpu_mali_context_t *context, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples);
+
+/// Returns the dimensions of the breakdown matrices written by
+/// `hpc_gpu_mali_bifrost_query_counter_breakdown`.
+///
+/// @param[in]  context                  The counter sampling context.
+/// @param[out] num_shader_core_counters The number of requested shader core
+///                                      counters.
+/// @param[out] num_shader_cores         The number of enabled shader cores.
+/// @param[out] num_l2_slice_counters    The number of requested L2 slice
+///                                      (memory) counters.
+/// @param[out] num_l2_slices            The number of L2 slices.
+void hpc_gpu_mali_bifrost_get_breakdown_dimensions(
+    const hpc_gpu_mali_context_t *context, uint32_t *num_shader_core_counters,
+    uint32_t *num_shader_cores, uint32_t *num_l2_slice_counters,
+    uint32_t *num_l2_slices);
+
+/// Samples the common Mali Bifrost GPU counters specified when creating the
+/// context, together with the value from each enabled shader core and each L2
+/// slice.
+///
+/// The breakdown matrices have one row per requested shader core or L2 slice
+/// counter, in the order they were requested, and one column per enabled
+/// shader core or L2 slice.
+///
+/// @param[in]  context            The counter sampling context.
+/// @param[out] values             The pointer to the memory for receiving
+///                                totals, as
+///                                `hpc_gpu_mali_bifrost_query_counters` does.
+/// @param[out] shader_core_values The pointer to the memory for receiving the
+///                                `num_shader_core_counters x
+///                                num_shader_cores` matrix.
+/// @param[out] l2_slice_values    The pointer to the memory for receiving the
+///                                `num_l2_slice_counters x num_l2_slices`
+///                                matrix.
+int hpc_gpu_mali_bifrost_query_counter_breakdown(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    uint64_t *shader_core_values, uint64_t *l2_slice_values);
+
+/// Returns the metadata registry of Bifrost Mali GPU counters.
+///
+/// Use `hpc_gpu_find_counter_info` to look up counters by name, e.g., when
+/// loading counter sets from text configurations.
+const hpc_gpu_counter_registry_t *hpc_gpu_mali_bifrost_get_counter_registry(
+    void);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_CONTEXT_HPP_
+#define HPC_GPU_MALI_CONTEXT_HPP_
+
+#include <cstdint>
+
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/base_utilities.hpp"
+#include "hpc/gpu/counter_set.hpp"
+
+extern "C" {
+typedef struct hpc_gpu_mali_context_t hpc_gpu_mali_context_t;
+}
+
+namespace hpc {
+namespace gpu {
+namespace mali {
+
+template <typename Counter>
+using CreateContextFunction = int (*)(
+    uint32_t num_counters, Counter *counters,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_context_t **out_context);
+using DestroyContextFunction = int (*)(
+    hpc_gpu_mali_context_t *context,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+using StartCountersFunction = int (*)(const hpc_gpu_mali_context_t *context);
+using StartPeriodicCountersFunction = int (*)(
+    const hpc_gpu_mali_context_t *context, uint32_t interval_ns);
+using StopCountersFunction = int (*)(const hpc_gpu_mali_context_t *context);
+using QueryCountersFunction = int (*)(const hpc_gpu_mali_context_t *context,
+                                      uint64_t *values);
+using QueryCountersWithTimesFunction = int (*)(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times);
+
+/// Traits describing a Mali GPU series to `Context`, forwarding to the
+/// series' C functions.
+///
+/// Counters are always decoded when creating contexts, because where they
+/// live in counter dumps depends on the layout of the current GPU.
+template <typename Counter, CreateContextFunction<Counter> CreateContext,
+          DestroyContextFunction DestroyContext,
+          StartCountersFunction StartCounters,
+          StartPeriodicCountersFunction StartPeriodicCounters,
+          StopCountersFunction StopCounters,
+          QueryCountersFunction QueryCounters,
+          QueryCountersWithTimesFunction QueryCountersWithTimes>
+struct SeriesTraits {
+  using counter_type = Counter;
+
+  /// Creates a context for the counters in `Set`.
+  template <typename Set>
+  static int create_context(
+      const hpc_gpu_host_allocation_callbacks_t *allocator,
+      hpc_gpu_mali_context_t **out_context) {
+    auto counters = Set::counters();
+    return CreateContext(static_cast<uint32_t>(Set::size), counters.data(),
+                         allocator, out_context);
+  }
+  static int destroy_context(
+      hpc_gpu_mali_context_t *context,
+      const hpc_gpu_host_allocation_callbacks_t *allocator) {
+    return DestroyContext(context, allocator);
+  }
+  static int start_counters(const hpc_gpu_mali_context_t *context) {
+    return StartCounters(context);
+  }
+  static int start_periodic_counters(const hpc_gpu_mali_context_t *context,
+                                     uint32_t interval_ns) {
+    return StartPeriodicCounters(context, interval_ns);
+  }
+  static int stop_counters(const hpc_gpu_mali_context_t *context) {
+    return StopCounters(context);
+  }
+  static int query_counters(const hpc_gpu_mali_context_t *context,
+                            uint64_t *values) {
+    return QueryCounters(context, values);
+  }
+  static int query_counters_with_times(const hpc_gpu_mali_context_t *context,
+                                       uint64_t *values,
+                                       hpc_gpu_sample_times_t *times) {
+    return QueryCountersWithTimes(context, values, times);
+  }
+};
+
+/// A move-only handle owning a Mali counter sampling context for the counter
+/// set `Set`.
+///
+/// Errors are reported as return values like the C API; no exceptions are
+/// thrown. Host memory is only allocated when creating the context.
+template <typename Set>
+class Context {
+ public:
+  using Series = typename Set::series_type;
+  using Values = CounterValues<Set>;
+
+  /// Creates an empty handle.
+  Context() noexcept = default;
+  ~Context() { reset(); }
+
+  Context(Context &&other) noexcept
+      : context_(other.context_), allocator_(other.allocator_) {
+    other.context_ = nullptr;
+  }
+  Context &operator=(Context &&other) noexcept {
+    if (this != &other) {
+      reset();
+      context_ = other.context_;
+      allocator_ = other.allocator_;
+      other.context_ = nullptr;
+    }
+    return *this;
+  }
+
+  Context(const Context &) = delete;
+  Context &operator=(const Context &) = delete;
+
+  /// Creates a context for sampling the counters in `Set`.
+  ///
+  /// @param[out] out_context The handle receiving the context. It is left
+  ///                         untouched on failure.
+  /// @param[in]  allocator   The allocator used to allocate host memory. It
+  ///                         is copied into the handle.
+  static int create(Context *out_context,
+                    const hpc_gpu_host_allocation_callbacks_t &allocator =
+                        default_allocator()) {
+    hpc_gpu_mali_context_t *context = nullptr;
+    int status = Series::template create_context<Set>(&allocator, &context);
+    if (status < 0) return status;
+    *out_context = Context(context, allocator);
+    return 0;
+  }
+
+  /// Starts sampling counters.
+  int start() const noexcept { return Series::start_counters(context_); }
+
+  /// Starts sampling counters with dumps driven by the kernel driver every
+  /// `interval_ns`. Samples are retrieved with the C batch query function.
+  int start_periodic(uint32_t interval_ns) const noexcept {
+    return Series::start_periodic_counters(context_, interval_ns);
+  }
+
+  /// Stops sampling counters.
+  int stop() const noexcept { return Series::stop_counters(context_); }
+
+  /// Samples counters into `values`.
+  int query(Values *values) const noexcept {
+    return Series::query_counters(context_, values->data());
+  }
+
+  /// Samples counters into `values` and their sample times into `times`.
+  int query(Values *values, hpc_gpu_sample_times_t *times) const noexcept {
+    return Series::query_counters_with_times(context_, values->data(), times);
+  }
+
+  /// Destroys the owned context, if any.
+  void reset() noexcept {
+    if (context_ == nullptr) return;
+    Series::destroy_context(context_, &allocator_);
+    context_ = nullptr;
+  }
+
+  explicit operator bool() const noexcept { return context_ != nullptr; }
+
+  /// Returns the underlying C context for calling the C API directly.
+  hpc_gpu_mali_context_t *get() const noexcept { return context_; }
+
+ private:
+  Context(hpc_gpu_mali_context_t *context,
+          const hpc_gpu_host_allocation_callbacks_t &allocator) noexcept
+      : context_(context), allocator_(allocator) {}
+
+  hpc_gpu_mali_context_t *context_ = nullptr;
+  hpc_gpu_host_allocation_callbacks_t allocator_ = {};
+};
+
+}  // namespace mali
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_MALI_CONTEXT_HPP_
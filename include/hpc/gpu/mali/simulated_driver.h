@@ -0,0 +1,127 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_SIMULATED_DRIVER_H_
+#define HPC_GPU_MALI_SIMULATED_DRIVER_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Pointer to the function producing the value of one counter in one dump.
+///
+/// @param[in] user_data     The user data from the create info.
+/// @param[in] dump_index    The index of the dump since the driver was
+///                          created, counting from 0.
+/// @param[in] block_index   The index of the counter block in the dump: 0 for
+///                          the job manager, 1 for the tiler, then one block
+///                          per L2 slice, then one block per shader core bit.
+/// @param[in] counter_index The index of the counter inside the block.
+typedef uint32_t (*hpc_gpu_mali_simulated_counter_function)(
+    void *user_data, uint64_t dump_index, uint32_t block_index,
+    uint32_t counter_index);
+
+/// The maximal number of coherency groups a simulated driver reports.
+#define HPC_GPU_MALI_SIMULATED_MAX_NUM_COHERENCY_GROUPS 16u
+
+/// Struct containing information for creating a simulated Mali driver.
+typedef struct hpc_gpu_mali_simulated_driver_create_info_t {
+  /// The GPU product ID reported to contexts. It selects the counter layout,
+  /// e.g., 0x9005 for TBOX or 0x6000 for TMIX.
+  uint32_t gpu_product_id;
+  /// The number of L2 cache slices.
+  uint32_t num_l2_slices;
+  /// The number of coherency groups.
+  uint32_t num_coherency_groups;
+  /// The mask of shader cores in each coherency group. Its element count
+  /// should be `num_coherency_groups`. Shader cores across all groups form
+  /// the GPU's shader core mask.
+  const uint64_t *coherency_group_core_masks;
+  /// The function producing counter values. If NULL, each counter packs
+  /// `block_index + 1`, `counter_index + 1`, and the low byte of `dump_index`
+  /// into bits [16, 32), [8, 16), and [0, 8) respectively, so extracted
+  /// values can be checked exactly.
+  hpc_gpu_mali_simulated_counter_function counter_function;
+  /// The user data passed to `counter_function`.
+  void *counter_user_data;
+  /// The time each simulated driver call takes, in nanoseconds.
+  uint64_t ioctl_latency_ns;
+} hpc_gpu_mali_simulated_driver_create_info_t;
+
+/// A simulated kbase kernel driver for exercising and benchmarking Mali
+/// counter sampling without Mali GPUs.
+///
+/// It serves the API version handshake, a packed device property blob, and a
+/// hardware counter reader with a memory-mapped ring of dump buffers laid out
+/// like the kernel driver's: job manager, tiler, L2 slices, then shader
+/// cores, each a block of 64 counters. Dumps are produced on request or
+/// periodically once an interval is set, and are dropped when the ring is
+/// full. Each driver call busy-waits for the configured latency to mimic the
+/// ioctl cost. Only one counter reader can be open at a time.
+typedef struct hpc_gpu_mali_simulated_driver_t hpc_gpu_mali_simulated_driver_t;
+
+/// Creates a simulated Mali driver.
+///
+/// @param[in]  create_info The information for creating the driver.
+/// @param[in]  allocator   The allocator used to allocate host memory for the
+///                         driver.
+/// @param[out] out_driver  The pointer to the object receiving the resultant
+///                         driver.
+int hpc_gpu_mali_create_simulated_driver(
+    const hpc_gpu_mali_simulated_driver_create_info_t *create_info,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_simulated_driver_t **out_driver);
+
+/// Destroys the simulated Mali driver.
+///
+/// The driver should not be in use; see `hpc_gpu_mali_use_simulated_driver`.
+///
+/// @param[in] driver    The simulated driver.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_mali_destroy_simulated_driver(
+    hpc_gpu_mali_simulated_driver_t *driver,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Routes all Mali driver calls to the given simulated driver.
+///
+/// This affects contexts created afterwards and should only be called when no
+/// Mali context exists.
+///
+/// @param[in] driver The simulated driver, or NULL to go back to the kbase
+///                   kernel driver.
+void hpc_gpu_mali_use_simulated_driver(hpc_gpu_mali_simulated_driver_t *driver);
+
+/// Returns the number of driver calls the simulated driver has served.
+///
+/// @param[in] driver The simulated driver.
+uint64_t hpc_gpu_mali_simulated_driver_get_num_ioctls(
+    const hpc_gpu_mali_simulated_driver_t *driver);
+
+/// Returns the number of dumps dropped because the ring was full.
+///
+/// @param[in] driver The simulated driver.
+uint64_t hpc_gpu_mali_simulated_driver_get_num_dropped_dumps(
+    hpc_gpu_mali_simulated_driver_t *driver);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_MALI_SIMULATED_DRIVER_H_
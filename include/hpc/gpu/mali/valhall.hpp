@@ -0,0 +1,67 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_VALHALL_HPP_
+#define HPC_GPU_MALI_VALHALL_HPP_
+
+#include <cstdint>
+
+#include "hpc/gpu/counter_set.hpp"
+#include "hpc/gpu/mali/context.hpp"
+#include "hpc/gpu/mali/valhall.h"
+
+namespace hpc {
+namespace gpu {
+namespace mali {
+
+/// Traits for Valhall Mali GPU counters.
+///
+/// Counters encode their block category as the group and their index in the
+/// block as the selector.
+struct Valhall
+    : SeriesTraits<hpc_gpu_mali_valhall_counter_t,
+                   hpc_gpu_mali_valhall_create_context,
+                   hpc_gpu_mali_valhall_destroy_context,
+                   hpc_gpu_mali_valhall_start_counters,
+                   hpc_gpu_mali_valhall_start_periodic_counters,
+                   hpc_gpu_mali_valhall_stop_counters,
+                   hpc_gpu_mali_valhall_query_counters,
+                   hpc_gpu_mali_valhall_query_counters_with_times> {
+  static constexpr uint32_t get_group(counter_type counter) {
+    return static_cast<uint32_t>(counter) >> 8u;
+  }
+  static constexpr uint32_t get_selector(counter_type counter) {
+    return static_cast<uint32_t>(counter) & (256u - 1u);
+  }
+};
+
+namespace valhall {
+
+/// A set of Valhall Mali GPU counters fixed at compile time.
+template <hpc_gpu_mali_valhall_counter_t... Counters>
+using CounterSet = ::hpc::gpu::CounterSet<Valhall, Counters...>;
+
+/// A move-only handle owning a context for sampling the counter set `Set`.
+template <typename Set>
+using Context = ::hpc::gpu::mali::Context<Set>;
+
+}  // namespace valhall
+
+}  // namespace mali
+}  // namespace gpu
+}  // namespace hpc
+
+#endif  // HPC_GPU_MALI_VALHALL_HPP_
@@ -0,0 +1,136 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_METRIC_H_
+#define HPC_GPU_METRIC_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// The maximal number of values a metric expression keeps live at once while
+/// being evaluated. Deeper expressions are rejected at compile time.
+#define HPC_GPU_METRIC_MAX_STACK_DEPTH 16
+
+/// A derived metric compiled from an expression over counters.
+///
+/// Expressions use `+`, `-`, `*`, `/`, unary `-`, parentheses, decimal
+/// number literals, counter names and the `duration` keyword, which stands
+/// for the sample duration in seconds, e.g.,
+///
+///   SP_ALU_WORKING_CYCLES / SP_BUSY_CYCLES
+///   (MEMORY_L2_EXT_READ_BEATS * 16) / duration
+///
+/// Expressions are compiled once into a compact stack bytecode with constant
+/// subexpressions folded. Evaluation runs each instruction over a block of
+/// samples at a time so that the inner loops are simple, branch-free and
+/// vectorizable. Division by zero yields zero rather than infinity or NaN,
+/// so that ratios over idle samples read as zero utilization.
+typedef struct hpc_gpu_metric_t hpc_gpu_metric_t;
+
+/// Compiles a metric expression.
+///
+/// Returns -1 and sets `errno` to `EINVAL` if the expression is malformed or
+/// to `E2BIG` if it needs more than `HPC_GPU_METRIC_MAX_STACK_DEPTH` stack
+/// slots. Returns `-HPC_GPU_ERROR_UNSUPPORTED_COUNTER` if it references a
+/// counter not in `counter_names`.
+///
+/// @param[in]  expression    The NUL-terminated metric expression.
+/// @param[in]  num_counters  The number of counters in each sample.
+/// @param[in]  counter_names The name of each counter in a sample, in sample
+///                           order, e.g., `hpc_gpu_counter_info_t::name`.
+/// @param[in]  allocator     The allocator used to allocate host memory for
+///                           the compiled metric.
+/// @param[out] out_metric    The pointer to the object receiving the compiled
+///                           metric.
+int hpc_gpu_compile_metric(const char *expression, uint32_t num_counters,
+                           const char *const *counter_names,
+                           const hpc_gpu_host_allocation_callbacks_t *allocator,
+                           hpc_gpu_metric_t **out_metric);
+
+/// Destroys the compiled metric.
+///
+/// @param[in] metric    The compiled metric.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_destroy_metric(
+    hpc_gpu_metric_t *metric,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Returns whether the metric refers to `duration` and thus needs sample
+/// durations for evaluation.
+///
+/// @param[in] metric The compiled metric.
+int hpc_gpu_metric_uses_duration(const hpc_gpu_metric_t *metric);
+
+/// Evaluates the metric over a batch of samples.
+///
+/// Counter values are expected to be per-sample deltas, e.g., the difference
+/// between two consecutive queries. A compiled metric is read-only, so one
+/// metric can be evaluated from multiple threads at the same time.
+/// Returns -1 and sets `errno` to `EINVAL` if the metric uses `duration` but
+/// `durations_ns` is NULL.
+///
+/// @param[in]  metric       The compiled metric.
+/// @param[in]  num_samples  The number of samples.
+/// @param[in]  durations_ns The duration of each sample in nanoseconds, or
+///                          NULL if the metric does not use `duration`.
+/// @param[in]  values       Counter values, one row of `num_counters` per
+///                          sample as in `hpc_gpu_sampler_flush`.
+/// @param[out] column       The pointer to the memory for receiving the
+///                          metric value of each sample. Its element count
+///                          should be at least `num_samples`.
+int hpc_gpu_metric_evaluate(const hpc_gpu_metric_t *metric,
+                            uint32_t num_samples, const uint64_t *durations_ns,
+                            const uint64_t *values, double *column);
+
+/// A built-in derived metric definition.
+typedef struct hpc_gpu_metric_definition_t {
+  /// The metric name, e.g., "alu_utilization".
+  const char *name;
+  /// A human-readable description.
+  const char *description;
+  /// The unit of metric values, e.g., "ratio" or "bytes/s".
+  const char *unit;
+  /// The metric expression for `hpc_gpu_compile_metric`. Counter names match
+  /// the series' counter registry.
+  const char *expression;
+} hpc_gpu_metric_definition_t;
+
+/// GPU series with built-in metric definitions.
+typedef enum hpc_gpu_metric_series_e {
+  HPC_GPU_METRIC_SERIES_ADRENO_A6XX,
+  HPC_GPU_METRIC_SERIES_MALI_VALHALL,
+  HPC_GPU_METRIC_SERIES_MALI_BIFROST,
+} hpc_gpu_metric_series_t;
+
+/// Returns the built-in metric definitions for a GPU series.
+///
+/// Returns NULL if there are no definitions for `series`.
+///
+/// @param[in]  series      The GPU series.
+/// @param[out] num_metrics The number of returned definitions.
+const hpc_gpu_metric_definition_t *hpc_gpu_get_builtin_metrics(
+    hpc_gpu_metric_series_t series, uint32_t *num_metrics);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_METRIC_H_
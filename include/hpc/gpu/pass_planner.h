@@ -0,0 +1,77 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_PASS_PLANNER_H_
+#define HPC_GPU_PASS_PLANNER_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// The counter set for counters that may be placed in any pass on their own.
+#define HPC_GPU_PASS_PLANNER_NO_SET UINT32_MAX
+
+/// Struct containing information for planning replay passes.
+///
+/// Counters use the encoding shared by the generated counter enums, with the
+/// group (Adreno) or block category (Mali) in bits above the low 8 bits.
+typedef struct hpc_gpu_pass_plan_info_t {
+  /// The number of counters to plan.
+  uint32_t num_counters;
+  /// The counters to plan, e.g., `hpc_gpu_adreno_a6xx_counter_t` values.
+  /// Duplicated counters share one register within a pass.
+  const uint32_t *counters;
+  /// The set each counter belongs to, or NULL if no counters need to stay
+  /// together. Counters in the same set, e.g., all inputs of a derived
+  /// metric, are always placed into the same pass. Counters in
+  /// `HPC_GPU_PASS_PLANNER_NO_SET` are placed independently.
+  const uint32_t *counter_sets;
+  /// The number of entries in `group_capacities`.
+  uint32_t num_groups;
+  /// The number of counters each group can sample at the same time, indexed
+  /// by group, or NULL if there is no limit. Mali GPUs dump every counter of
+  /// enabled blocks at once, so this should be NULL for Mali counters.
+  const uint32_t *group_capacities;
+} hpc_gpu_pass_plan_info_t;
+
+/// Packs counters into as few passes as possible, so that each pass fits
+/// into the counter registers of every group.
+///
+/// The result is minimal unless the search gives up on very large inputs,
+/// in which case it is still no worse than first-fit decreasing packing.
+/// Returns -1 and sets `errno` to `EINVAL` if a counter's group is out of
+/// range or to `E2BIG` if a counter set does not fit into one pass.
+///
+/// @param[in]  plan_info      The information for planning passes.
+/// @param[in]  allocator      The allocator used to allocate temporary host
+///                            memory for planning.
+/// @param[out] counter_passes The pointer to the memory for receiving the
+///                            pass index of each counter. Its element count
+///                            should be at least `num_counters`.
+/// @param[out] num_passes     The number of passes.
+int hpc_gpu_plan_passes(const hpc_gpu_pass_plan_info_t *plan_info,
+                        const hpc_gpu_host_allocation_callbacks_t *allocator,
+                        uint32_t *counter_passes, uint32_t *num_passes);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_PASS_PLANNER_H_
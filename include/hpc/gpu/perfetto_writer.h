@@ -0,0 +1,124 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_PERFETTO_WRITER_H_
+#define HPC_GPU_PERFETTO_WRITER_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Struct containing information for creating a Perfetto writer.
+typedef struct hpc_gpu_perfetto_writer_create_info_t {
+  /// The name of the track grouping all counter tracks, e.g., "Adreno 640".
+  const char *track_name;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The name of each counter track, in sample order, e.g.,
+  /// `hpc_gpu_counter_info_t::name`.
+  const char *const *counter_names;
+  /// The unit of each counter, e.g., `hpc_gpu_counter_info_t::unit`, or NULL
+  /// to leave units unspecified.
+  const char *const *counter_units;
+  /// The number of bytes buffered in memory before the background thread
+  /// writes them out. Appending blocks once the whole buffer is waiting to
+  /// be written. Zero selects 256 KiB.
+  uint32_t buffer_size;
+  /// The longest time in nanoseconds appended samples may stay buffered, or
+  /// zero to only write out full buffer blocks. The background thread writes
+  /// out older samples even if no more are appended. This bounds the samples
+  /// lost if the process crashes.
+  uint64_t flush_period_ns;
+} hpc_gpu_perfetto_writer_create_info_t;
+
+/// A writer streaming counter samples into a Perfetto trace file.
+///
+/// The file is a sequence of `TracePacket`s encoded by hand, so no protobuf
+/// library is needed. It starts with one counter track descriptor per
+/// counter under a common parent track, followed by one counter event per
+/// counter value, timestamped in the `CLOCK_MONOTONIC` domain like sampler
+/// timestamps. Packets are written whole and in order, so the file is a
+/// loadable trace at any point, including after a crash.
+///
+/// Encoded packets go into fixed-size blocks; full blocks are written out by
+/// a background thread, keeping memory usage constant regardless of session
+/// length.
+typedef struct hpc_gpu_perfetto_writer_t hpc_gpu_perfetto_writer_t;
+
+/// Creates a Perfetto writer, truncating the file at `path`.
+///
+/// Returns -1 and sets `errno` to `EINVAL` if a track descriptor does not
+/// fit into one buffer block.
+///
+/// @param[in]  path        The path of the trace file.
+/// @param[in]  create_info The information for creating the writer.
+/// @param[in]  allocator   The allocator used to allocate host memory for
+///                         buffering packets.
+/// @param[out] out_writer  The pointer to the object receiving the resultant
+///                         writer.
+int hpc_gpu_create_perfetto_writer(
+    const char *path, const hpc_gpu_perfetto_writer_create_info_t *create_info,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_perfetto_writer_t **out_writer);
+
+/// Writes out buffered packets, stops the background thread and destroys the
+/// writer.
+///
+/// Returns -1 and sets `errno` to the first error encountered when writing
+/// or closing the file, if any.
+///
+/// @param[in] writer    The Perfetto writer.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_destroy_perfetto_writer(
+    hpc_gpu_perfetto_writer_t *writer,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Appends samples as counter events.
+///
+/// Values are written as they are; pass per-sample deltas to plot rates
+/// rather than cumulative counts. This should be called from one thread at a
+/// time.
+///
+/// Returns -1 and sets `errno` to the first error encountered when writing
+/// the file, if any. Packets appended after an error are dropped.
+///
+/// @param[in] writer      The Perfetto writer.
+/// @param[in] num_samples The number of samples.
+/// @param[in] timestamps  The timestamp of each sample in nanoseconds.
+/// @param[in] values      Counter values, one row of `num_counters` per
+///                        sample as in `hpc_gpu_sampler_flush`.
+int hpc_gpu_perfetto_writer_append(hpc_gpu_perfetto_writer_t *writer,
+                                   uint32_t num_samples,
+                                   const uint64_t *timestamps,
+                                   const uint64_t *values);
+
+/// Writes out all buffered packets and waits for the writes to finish.
+///
+/// Returns -1 and sets `errno` to the first error encountered when writing
+/// the file, if any.
+///
+/// @param[in] writer The Perfetto writer.
+int hpc_gpu_perfetto_writer_flush(hpc_gpu_perfetto_writer_t *writer);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_PERFETTO_WRITER_H_
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_RING_BUFFER_H_
+#define HPC_GPU_RING_BUFFER_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Ring buffer producer modes.
+typedef enum hpc_gpu_ring_buffer_mode_e {
+  /// Only one thread pushes samples.
+  HPC_GPU_RING_BUFFER_SINGLE_PRODUCER,
+  /// Any number of threads push samples concurrently.
+  HPC_GPU_RING_BUFFER_MULTI_PRODUCER,
+} hpc_gpu_ring_buffer_mode_t;
+
+/// A lock-free bounded ring buffer of counter samples.
+///
+/// Each sample is a fixed-size record containing one timestamp and the values
+/// of `num_counters` counters. There can only be one consumer thread; the
+/// number of producer threads is decided by the ring buffer's mode. The
+/// producer and consumer indices live on separate cache lines so they do not
+/// contend with each other.
+typedef struct hpc_gpu_ring_buffer_t hpc_gpu_ring_buffer_t;
+
+/// Creates a ring buffer.
+///
+/// @param[in]  num_counters    The number of counters in each sample.
+/// @param[in]  min_num_samples The minimal number of samples the ring buffer
+///                             should be able to hold. The actual capacity is
+///                             rounded up to a power of two.
+/// @param[in]  mode            The producer mode.
+/// @param[in]  allocator       The allocator used to allocate host memory for
+///                             the ring buffer.
+/// @param[out] out_ring_buffer The pointer to the object receiving the
+///                             resultant ring buffer.
+int hpc_gpu_create_ring_buffer(
+    uint32_t num_counters, uint32_t min_num_samples,
+    hpc_gpu_ring_buffer_mode_t mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_ring_buffer_t **out_ring_buffer);
+
+/// Destroys the ring buffer.
+///
+/// @param[in] ring_buffer The ring buffer.
+/// @param[in] allocator   The allocator used to free allocated host memory.
+int hpc_gpu_destroy_ring_buffer(
+    hpc_gpu_ring_buffer_t *ring_buffer,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Returns the number of samples the ring buffer can hold.
+///
+/// @param[in] ring_buffer The ring buffer.
+uint32_t hpc_gpu_ring_buffer_get_capacity(
+    const hpc_gpu_ring_buffer_t *ring_buffer);
+
+/// Returns the number of counters in each sample.
+///
+/// @param[in] ring_buffer The ring buffer.
+uint32_t hpc_gpu_ring_buffer_get_num_counters(
+    const hpc_gpu_ring_buffer_t *ring_buffer);
+
+/// Pushes samples into the ring buffer.
+///
+/// Returns the number of samples actually pushed, which is less than
+/// `num_samples` if the ring buffer runs full.
+///
+/// @param[in] ring_buffer The ring buffer.
+/// @param[in] num_samples The number of samples to push.
+/// @param[in] timestamps  The timestamps of the samples.
+/// @param[in] values      The values of the samples, one row of
+///                        `num_counters` per sample.
+uint32_t hpc_gpu_ring_buffer_push(hpc_gpu_ring_buffer_t *ring_buffer,
+                                  uint32_t num_samples,
+                                  const uint64_t *timestamps,
+                                  const uint64_t *values);
+
+/// Pops samples out of the ring buffer, oldest first.
+///
+/// Returns the number of samples actually popped. This must only be called
+/// from the single consumer thread.
+///
+/// @param[in]  ring_buffer     The ring buffer.
+/// @param[in]  max_num_samples The maximal number of samples to pop.
+/// @param[out] timestamps      The pointer to the memory for receiving sample
+///                             timestamps. Its element count should be at
+///                             least `max_num_samples`.
+/// @param[out] values          The pointer to the memory for receiving sample
+///                             values, one row of `num_counters` per sample.
+///                             Its element count should be at least
+///                             `max_num_samples * num_counters`.
+uint32_t hpc_gpu_ring_buffer_pop(hpc_gpu_ring_buffer_t *ring_buffer,
+                                 uint32_t max_num_samples, uint64_t *timestamps,
+                                 uint64_t *values);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_RING_BUFFER_H_
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_SAMPLE_BOARD_H_
+#define HPC_GPU_SAMPLE_BOARD_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// A board holding the latest counter sample for any number of readers.
+///
+/// One writer thread publishes samples, typically the thread owning the
+/// vendor context, since querying counters mutates the context. Readers take
+/// consistent snapshots of the latest sample without locking and without
+/// touching the driver. The board keeps two copies of the sample and a
+/// sequence number selecting the current one: the writer always fills the
+/// other copy, so it never waits for readers, and a reader only retries if
+/// a newer sample lands while it is copying.
+typedef struct hpc_gpu_sample_board_t hpc_gpu_sample_board_t;
+
+/// Creates a sample board.
+///
+/// Returns -1 and sets `errno` to `ENOMEM` if host memory cannot be
+/// allocated.
+///
+/// @param[in]  num_counters The number of counters in each sample.
+/// @param[in]  allocator    The allocator used to allocate host memory for
+///                          the board.
+/// @param[out] out_board    The pointer to the object receiving the resultant
+///                          board.
+int hpc_gpu_create_sample_board(
+    uint32_t num_counters, const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_sample_board_t **out_board);
+
+/// Destroys the sample board.
+///
+/// @param[in] board     The board.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_destroy_sample_board(
+    hpc_gpu_sample_board_t *board,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Returns the number of counters in each sample.
+///
+/// @param[in] board The board.
+uint32_t hpc_gpu_sample_board_get_num_counters(
+    const hpc_gpu_sample_board_t *board);
+
+/// Publishes a sample, replacing the previous one.
+///
+/// This must only be called from one writer thread at a time.
+///
+/// @param[in] board     The board.
+/// @param[in] timestamp The timestamp of the sample.
+/// @param[in] values    The values of the sample; `num_counters` elements.
+void hpc_gpu_sample_board_publish(hpc_gpu_sample_board_t *board,
+                                  uint64_t timestamp, const uint64_t *values);
+
+/// Returns the number of samples published so far.
+///
+/// This is cheap enough for polling whether a new sample is available before
+/// taking a snapshot.
+///
+/// @param[in] board The board.
+uint64_t hpc_gpu_sample_board_get_sequence(const hpc_gpu_sample_board_t *board);
+
+/// Copies out the latest sample.
+///
+/// Returns the sequence number of the copied sample, i.e., the number of
+/// samples published up to and including it. Returns 0 if nothing has been
+/// published yet, in which case the timestamp and values are all zeros. This
+/// can be called from any number of threads concurrently.
+///
+/// @param[in]  board     The board.
+/// @param[out] timestamp The pointer to the memory for receiving the sample
+///                       timestamp.
+/// @param[out] values    The pointer to the memory for receiving the sample
+///                       values. Its element count should be at least
+///                       `num_counters`.
+uint64_t hpc_gpu_sample_board_read(const hpc_gpu_sample_board_t *board,
+                                   uint64_t *timestamp, uint64_t *values);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_SAMPLE_BOARD_H_
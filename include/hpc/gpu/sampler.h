@@ -0,0 +1,159 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_SAMPLER_H_
+#define HPC_GPU_SAMPLER_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/ring_buffer.h"
+#include "hpc/gpu/sample_board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Pointer to the function sampling counters from a vendor context.
+///
+/// This is expected to forward to one of the vendor query functions
+/// reporting sample times, e.g.,
+/// `hpc_gpu_adreno_a6xx_query_counters_with_times` or
+/// `hpc_gpu_mali_valhall_query_counters_with_times`.
+typedef int (*hpc_gpu_sampler_query_function)(void *context, uint64_t *values,
+                                              hpc_gpu_sample_times_t *times);
+
+/// The number of values the sampler appends to the counter values of each
+/// sample for the sample times besides the timestamp, in this order:
+/// `driver_timestamp_ns`, `host_end_ns` and `gpu_clock_cycles` of
+/// `hpc_gpu_sample_times_t`.
+#define HPC_GPU_SAMPLER_NUM_TIME_VALUES 3
+
+/// Struct containing information for creating a sampler.
+typedef struct hpc_gpu_sampler_create_info_t {
+  /// The vendor context to sample. It must outlive the sampler.
+  void *context;
+  /// The function for sampling `context`.
+  hpc_gpu_sampler_query_function query;
+  /// The number of counters `query` writes for each sample.
+  uint32_t num_counters;
+  /// The maximal number of samples buffered between two flushes. Samples
+  /// taken when the buffer is full are dropped.
+  uint32_t max_num_samples;
+  /// The sampling period in nanoseconds.
+  uint64_t period_ns;
+} hpc_gpu_sampler_create_info_t;
+
+/// A sampler periodically sampling counters on a dedicated thread.
+///
+/// The sampler thread is woken up by a timer at the requested period; each
+/// wake-up queries the context once and publishes the sample into a
+/// single-producer ring buffer. The latest sample is also published onto a
+/// sample board for threads that only want current values.
+///
+/// Each published sample keeps all its times: the timestamp is the sample's
+/// `host_begin_ns`, and each row holds `num_counters` counter values followed
+/// by `HPC_GPU_SAMPLER_NUM_TIME_VALUES` time values.
+typedef struct hpc_gpu_sampler_t hpc_gpu_sampler_t;
+
+/// Creates a sampler.
+///
+/// @param[in]  create_info The information for creating the sampler.
+/// @param[in]  allocator   The allocator used to allocate host memory for
+///                         buffering samples.
+/// @param[out] out_sampler The pointer to the object receiving the resultant
+///                         sampler.
+int hpc_gpu_create_sampler(const hpc_gpu_sampler_create_info_t *create_info,
+                           const hpc_gpu_host_allocation_callbacks_t *allocator,
+                           hpc_gpu_sampler_t **out_sampler);
+
+/// Destroys the sampler.
+///
+/// The sampler is stopped first if it is still running.
+///
+/// @param[in] sampler   The sampler.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_destroy_sampler(
+    hpc_gpu_sampler_t *sampler,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Starts the sampler thread.
+///
+/// Counters in the context should already be started via the vendor
+/// `*_start_counters` function.
+///
+/// @param[in] sampler The sampler.
+int hpc_gpu_sampler_start(hpc_gpu_sampler_t *sampler);
+
+/// Stops the sampler thread and waits for it to exit.
+///
+/// Returns the first error the sampler thread encountered when querying
+/// counters, if any. Samples taken before stopping can still be flushed.
+///
+/// @param[in] sampler The sampler.
+int hpc_gpu_sampler_stop(hpc_gpu_sampler_t *sampler);
+
+/// Moves buffered samples out of the sampler, oldest first.
+///
+/// This can be called while the sampler thread is running, but only from one
+/// consumer thread at a time.
+///
+/// @param[in]  sampler         The sampler.
+/// @param[in]  max_num_samples The maximal number of samples to flush.
+/// @param[out] timestamps      The pointer to the memory for receiving
+///                             sample timestamps in nanoseconds. Its element
+///                             count should be at least `max_num_samples`.
+/// @param[out] values          The pointer to the memory for receiving
+///                             sampled values, one row of `num_counters +
+///                             HPC_GPU_SAMPLER_NUM_TIME_VALUES` per sample.
+///                             Its element count should be at least
+///                             `max_num_samples` times the row size.
+/// @param[out] num_samples     The number of flushed samples.
+int hpc_gpu_sampler_flush(hpc_gpu_sampler_t *sampler, uint32_t max_num_samples,
+                          uint64_t *timestamps, uint64_t *values,
+                          uint32_t *num_samples);
+
+/// Returns the ring buffer the sampler thread publishes samples into.
+///
+/// Consumers can pop from it directly instead of calling
+/// `hpc_gpu_sampler_flush`; the same single-consumer rule applies.
+///
+/// @param[in] sampler The sampler.
+hpc_gpu_ring_buffer_t *hpc_gpu_sampler_get_ring_buffer(
+    hpc_gpu_sampler_t *sampler);
+
+/// Returns the board the sampler thread publishes the latest sample onto.
+///
+/// Any number of threads can read it concurrently, independent of the ring
+/// buffer consumer. Samples are published there even when the ring buffer is
+/// full.
+///
+/// @param[in] sampler The sampler.
+const hpc_gpu_sample_board_t *hpc_gpu_sampler_get_sample_board(
+    const hpc_gpu_sampler_t *sampler);
+
+/// Returns the number of samples dropped so far, either because the buffer was
+/// full or because the sampler thread missed timer expirations.
+///
+/// @param[in] sampler The sampler.
+uint64_t hpc_gpu_sampler_get_num_dropped_samples(
+    const hpc_gpu_sampler_t *sampler);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_SAMPLER_H_
@@ -0,0 +1,190 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_TRACE_H_
+#define HPC_GPU_TRACE_H_
+
+#include <stdint.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// The GPU vendor recorded in a trace.
+typedef enum hpc_gpu_trace_vendor_e {
+  HPC_GPU_TRACE_VENDOR_UNKNOWN = 0,
+  HPC_GPU_TRACE_VENDOR_ADRENO = 1,
+  HPC_GPU_TRACE_VENDOR_MALI = 2,
+} hpc_gpu_trace_vendor_t;
+
+/// The maximal number of characters in a trace's series name, excluding the
+/// terminating NUL.
+#define HPC_GPU_TRACE_MAX_SERIES_NAME_LENGTH 15
+
+/// Struct describing the device and counters of a trace.
+typedef struct hpc_gpu_trace_info_t {
+  /// The GPU vendor.
+  hpc_gpu_trace_vendor_t vendor;
+  /// The vendor-specific device ID, e.g., the Adreno chip ID or the Mali GPU
+  /// product ID.
+  uint64_t device_id;
+  /// The NUL-terminated name of the series or counter layout the counter
+  /// enums belong to, e.g., "a6xx" or "TTRX", as listed in the counter
+  /// registry. Longer names are truncated.
+  const char *series;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The counter enum values, in sample order.
+  const uint32_t *counters;
+} hpc_gpu_trace_info_t;
+
+/// A writer appending counter samples to a trace file.
+///
+/// Samples are buffered into chunks. Each chunk stores timestamps and every
+/// counter as separate columns of zig-zag varint deltas, so that slowly
+/// changing cumulative counter values take one or two bytes per sample.
+typedef struct hpc_gpu_trace_writer_t hpc_gpu_trace_writer_t;
+
+/// Creates a trace writer, truncating the file at `path`.
+///
+/// @param[in]  path       The path of the trace file.
+/// @param[in]  info       The device and counters of the trace.
+/// @param[in]  chunk_size The number of samples per chunk, e.g., 4096.
+///                        Larger chunks compress slightly better; smaller
+///                        chunks lose fewer samples if the process dies.
+/// @param[in]  allocator  The allocator used to allocate host memory for
+///                        buffering samples.
+/// @param[out] out_writer The pointer to the object receiving the resultant
+///                        writer.
+int hpc_gpu_create_trace_writer(
+    const char *path, const hpc_gpu_trace_info_t *info, uint32_t chunk_size,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_trace_writer_t **out_writer);
+
+/// Flushes buffered samples and destroys the trace writer.
+///
+/// @param[in] writer    The trace writer.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_destroy_trace_writer(
+    hpc_gpu_trace_writer_t *writer,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Appends samples to the trace.
+///
+/// If writing a full chunk fails, its samples stay buffered for the next
+/// flush, and the remaining samples are not appended.
+///
+/// @param[in] writer      The trace writer.
+/// @param[in] num_samples The number of samples.
+/// @param[in] timestamps  The timestamp of each sample in nanoseconds.
+/// @param[in] values      Counter values, one row of `num_counters` per
+///                        sample as in `hpc_gpu_sampler_flush`.
+int hpc_gpu_trace_writer_append(hpc_gpu_trace_writer_t *writer,
+                                uint32_t num_samples,
+                                const uint64_t *timestamps,
+                                const uint64_t *values);
+
+/// Writes buffered samples to the file as a possibly partial chunk.
+///
+/// On failure, the samples stay buffered for a later flush to retry, and a
+/// partially written chunk is cut off the file.
+///
+/// @param[in] writer The trace writer.
+int hpc_gpu_trace_writer_flush(hpc_gpu_trace_writer_t *writer);
+
+/// A reader mapping a trace file into memory.
+///
+/// Opening a trace only walks chunk headers; chunk contents are decoded on
+/// demand, and only the requested columns are touched. A trailing chunk that
+/// was cut short, e.g., because the writer process died, is ignored.
+typedef struct hpc_gpu_trace_reader_t hpc_gpu_trace_reader_t;
+
+/// Opens a trace file for reading.
+///
+/// Returns -1 and sets `errno` to `EINVAL` if the file is not a trace.
+///
+/// @param[in]  path       The path of the trace file.
+/// @param[in]  allocator  The allocator used to allocate host memory for
+///                        indexing chunks.
+/// @param[out] out_reader The pointer to the object receiving the resultant
+///                        reader.
+int hpc_gpu_open_trace(const char *path,
+                       const hpc_gpu_host_allocation_callbacks_t *allocator,
+                       hpc_gpu_trace_reader_t **out_reader);
+
+/// Closes the trace file and destroys the reader.
+///
+/// @param[in] reader    The trace reader.
+/// @param[in] allocator The allocator used to free allocated host memory.
+int hpc_gpu_close_trace(hpc_gpu_trace_reader_t *reader,
+                        const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Returns the device and counters of the trace. The returned pointers are
+/// valid until the reader is closed.
+///
+/// @param[in] reader The trace reader.
+const hpc_gpu_trace_info_t *hpc_gpu_trace_get_info(
+    const hpc_gpu_trace_reader_t *reader);
+
+/// Returns the number of chunks in the trace.
+///
+/// @param[in] reader The trace reader.
+uint32_t hpc_gpu_trace_get_num_chunks(const hpc_gpu_trace_reader_t *reader);
+
+/// Returns the number of samples in a chunk.
+///
+/// @param[in] reader The trace reader.
+/// @param[in] chunk  The chunk index.
+uint32_t hpc_gpu_trace_get_chunk_num_samples(
+    const hpc_gpu_trace_reader_t *reader, uint32_t chunk);
+
+/// Decodes all samples of a chunk.
+///
+/// Returns -1 and sets `errno` to `EINVAL` if the chunk is corrupted.
+///
+/// @param[in]  reader     The trace reader.
+/// @param[in]  chunk      The chunk index.
+/// @param[out] timestamps The pointer to the memory for receiving sample
+///                        timestamps, or NULL to skip them. Its element count
+///                        should be at least the chunk's sample count.
+/// @param[out] values     The pointer to the memory for receiving counter
+///                        values, one row of `num_counters` per sample, or
+///                        NULL to skip them.
+int hpc_gpu_trace_read_chunk(const hpc_gpu_trace_reader_t *reader,
+                             uint32_t chunk, uint64_t *timestamps,
+                             uint64_t *values);
+
+/// Decodes one counter column of a chunk without touching other columns.
+///
+/// Returns -1 and sets `errno` to `EINVAL` if the chunk is corrupted.
+///
+/// @param[in]  reader  The trace reader.
+/// @param[in]  chunk   The chunk index.
+/// @param[in]  counter The index of the counter in `num_counters`.
+/// @param[out] values  The pointer to the memory for receiving the counter's
+///                     values. Its element count should be at least the
+///                     chunk's sample count.
+int hpc_gpu_trace_read_chunk_counter(const hpc_gpu_trace_reader_t *reader,
+                                     uint32_t chunk, uint32_t counter,
+                                     uint64_t *values);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_TRACE_H_
@@ -0,0 +1,1329 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/adreno/a5xx.h"
+
+#include <stdint.h>
+
+#include "hpc/gpu/counter_info.h"
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The series that availability bits refer to.
+static const char *const adreno_a5xx_series_names[2] = {
+    "a5xx", "a6xx",
+};
+
+/// Metadata of all counters, in enum order.
+static const hpc_gpu_counter_info_t adreno_a5xx_counter_infos[501] = {
+    // clang-format off
+    {HPC_GPU_ADRENO_A5XX_CP_ALWAYS_COUNT, 0x3u, "CP_ALWAYS_COUNT", "CP",
+     "Command Parser: always count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_BUSY_GFX_CORE_IDLE, 0x3u, "CP_BUSY_GFX_CORE_IDLE",
+     "CP", "Command Parser: busy gfx core idle", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_BUSY_CYCLES, 0x3u, "CP_BUSY_CYCLES", "CP",
+     "Command Parser: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_IDLE, 0x1u, "CP_PFP_IDLE", "CP",
+     "Command Parser: pfp idle", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_BUSY_WORKING, 0x1u, "CP_PFP_BUSY_WORKING", "CP",
+     "Command Parser: pfp busy working", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_STALL_CYCLES_ANY, 0x1u,
+     "CP_PFP_STALL_CYCLES_ANY", "CP", "Command Parser: pfp stall cycles any",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_STARVE_CYCLES_ANY, 0x1u,
+     "CP_PFP_STARVE_CYCLES_ANY", "CP", "Command Parser: pfp starve cycles any",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_ICACHE_MISS, 0x1u, "CP_PFP_ICACHE_MISS", "CP",
+     "Command Parser: pfp icache miss", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_ICACHE_HIT, 0x1u, "CP_PFP_ICACHE_HIT", "CP",
+     "Command Parser: pfp icache hit", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PFP_MATCH_PM4_PKT_PROFILE, 0x1u,
+     "CP_PFP_MATCH_PM4_PKT_PROFILE", "CP",
+     "Command Parser: pfp match pm4 pkt profile", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_BUSY_WORKING, 0x1u, "CP_ME_BUSY_WORKING", "CP",
+     "Command Parser: ME busy working", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_IDLE, 0x1u, "CP_ME_IDLE", "CP",
+     "Command Parser: ME idle", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_STARVE_CYCLES_ANY, 0x1u,
+     "CP_ME_STARVE_CYCLES_ANY", "CP", "Command Parser: ME starve cycles any",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_FIFO_EMPTY_PFP_IDLE, 0x1u,
+     "CP_ME_FIFO_EMPTY_PFP_IDLE", "CP",
+     "Command Parser: ME fifo empty pfp idle", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_FIFO_EMPTY_PFP_BUSY, 0x1u,
+     "CP_ME_FIFO_EMPTY_PFP_BUSY", "CP",
+     "Command Parser: ME fifo empty pfp busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_FIFO_FULL_ME_BUSY, 0x1u,
+     "CP_ME_FIFO_FULL_ME_BUSY", "CP", "Command Parser: ME fifo full ME busy",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_FIFO_FULL_ME_NON_WORKING, 0x1u,
+     "CP_ME_FIFO_FULL_ME_NON_WORKING", "CP",
+     "Command Parser: ME fifo full ME non working", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_STALL_CYCLES_ANY, 0x1u, "CP_ME_STALL_CYCLES_ANY",
+     "CP", "Command Parser: ME stall cycles any", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_ICACHE_MISS, 0x1u, "CP_ME_ICACHE_MISS", "CP",
+     "Command Parser: ME icache miss", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_ME_ICACHE_HIT, 0x1u, "CP_ME_ICACHE_HIT", "CP",
+     "Command Parser: ME icache hit", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_NUM_PREEMPTIONS, 0x3u, "CP_NUM_PREEMPTIONS", "CP",
+     "Command Parser: num preemptions", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PREEMPTION_REACTION_DELAY, 0x3u,
+     "CP_PREEMPTION_REACTION_DELAY", "CP",
+     "Command Parser: preemption reaction delay", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PREEMPTION_SWITCH_OUT_TIME, 0x3u,
+     "CP_PREEMPTION_SWITCH_OUT_TIME", "CP",
+     "Command Parser: preemption switch out time", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PREEMPTION_SWITCH_IN_TIME, 0x3u,
+     "CP_PREEMPTION_SWITCH_IN_TIME", "CP",
+     "Command Parser: preemption switch IN time", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_DEAD_DRAWS_IN_BIN_RENDER, 0x3u,
+     "CP_DEAD_DRAWS_IN_BIN_RENDER", "CP",
+     "Command Parser: dead draws IN bin render", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_PREDICATED_DRAWS_KILLED, 0x3u,
+     "CP_PREDICATED_DRAWS_KILLED", "CP",
+     "Command Parser: predicated draws killed", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_MODE_SWITCH, 0x3u, "CP_MODE_SWITCH", "CP",
+     "Command Parser: mode switch", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_ZPASS_DONE, 0x3u, "CP_ZPASS_DONE", "CP",
+     "Command Parser: zpass done", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_CONTEXT_DONE, 0x3u, "CP_CONTEXT_DONE", "CP",
+     "Command Parser: context done", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_CACHE_FLUSH, 0x3u, "CP_CACHE_FLUSH", "CP",
+     "Command Parser: cache flush", "events"},
+    {HPC_GPU_ADRENO_A5XX_CP_LONG_PREEMPTIONS, 0x3u, "CP_LONG_PREEMPTIONS", "CP",
+     "Command Parser: long preemptions", "events"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_ALWAYS_COUNT, 0x3u, "RBBM_ALWAYS_COUNT", "RBBM",
+     "RBBM: always count", "events"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_ALWAYS_ON, 0x3u, "RBBM_ALWAYS_ON", "RBBM",
+     "RBBM: always ON", "events"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_TSE_BUSY, 0x3u, "RBBM_TSE_BUSY", "RBBM",
+     "RBBM: TSE busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_RAS_BUSY, 0x3u, "RBBM_RAS_BUSY", "RBBM",
+     "RBBM: RAS busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_PC_DCALL_BUSY, 0x3u, "RBBM_PC_DCALL_BUSY", "RBBM",
+     "RBBM: PC dcall busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_PC_VSD_BUSY, 0x3u, "RBBM_PC_VSD_BUSY", "RBBM",
+     "RBBM: PC vsd busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_STATUS_MASKED, 0x3u, "RBBM_STATUS_MASKED", "RBBM",
+     "RBBM: status masked", "events"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_COM_BUSY, 0x3u, "RBBM_COM_BUSY", "RBBM",
+     "RBBM: com busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_DCOM_BUSY, 0x3u, "RBBM_DCOM_BUSY", "RBBM",
+     "RBBM: dcom busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_VBIF_BUSY, 0x3u, "RBBM_VBIF_BUSY", "RBBM",
+     "RBBM: VBIF busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_VSC_BUSY, 0x3u, "RBBM_VSC_BUSY", "RBBM",
+     "RBBM: VSC busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_TESS_BUSY, 0x3u, "RBBM_TESS_BUSY", "RBBM",
+     "RBBM: tess busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_UCHE_BUSY, 0x3u, "RBBM_UCHE_BUSY", "RBBM",
+     "RBBM: UCHE busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RBBM_HLSQ_BUSY, 0x3u, "RBBM_HLSQ_BUSY", "RBBM",
+     "RBBM: HLSQ busy", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_BUSY_CYCLES, 0x3u, "PC_BUSY_CYCLES", "PC",
+     "PC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_WORKING_CYCLES, 0x3u, "PC_WORKING_CYCLES", "PC",
+     "PC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_VFD, 0x3u, "PC_STALL_CYCLES_VFD", "PC",
+     "PC: stall cycles VFD", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_TSE, 0x3u, "PC_STALL_CYCLES_TSE", "PC",
+     "PC: stall cycles TSE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_VPC, 0x3u, "PC_STALL_CYCLES_VPC", "PC",
+     "PC: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_UCHE, 0x3u, "PC_STALL_CYCLES_UCHE",
+     "PC", "PC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_TESS, 0x3u, "PC_STALL_CYCLES_TESS",
+     "PC", "PC: stall cycles tess", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_TSE_ONLY, 0x3u,
+     "PC_STALL_CYCLES_TSE_ONLY", "PC", "PC: stall cycles TSE only", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STALL_CYCLES_VPC_ONLY, 0x3u,
+     "PC_STALL_CYCLES_VPC_ONLY", "PC", "PC: stall cycles VPC only", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_PASS1_TF_STALL_CYCLES, 0x3u,
+     "PC_PASS1_TF_STALL_CYCLES", "PC", "PC: pass1 TF stall cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STARVE_CYCLES_FOR_INDEX, 0x3u,
+     "PC_STARVE_CYCLES_FOR_INDEX", "PC", "PC: starve cycles for index",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STARVE_CYCLES_FOR_TESS_FACTOR, 0x3u,
+     "PC_STARVE_CYCLES_FOR_TESS_FACTOR", "PC",
+     "PC: starve cycles for tess factor", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STARVE_CYCLES_FOR_VIZ_STREAM, 0x3u,
+     "PC_STARVE_CYCLES_FOR_VIZ_STREAM", "PC",
+     "PC: starve cycles for viz stream", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STARVE_CYCLES_FOR_POSITION, 0x3u,
+     "PC_STARVE_CYCLES_FOR_POSITION", "PC", "PC: starve cycles for position",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_STARVE_CYCLES_DI, 0x3u, "PC_STARVE_CYCLES_DI", "PC",
+     "PC: starve cycles DI", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_VIS_STREAMS_LOADED, 0x3u, "PC_VIS_STREAMS_LOADED",
+     "PC", "PC: vis streams loaded", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_INSTANCES, 0x3u, "PC_INSTANCES", "PC",
+     "PC: instances", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_VPC_PRIMITIVES, 0x3u, "PC_VPC_PRIMITIVES", "PC",
+     "PC: VPC primitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_DEAD_PRIM, 0x3u, "PC_DEAD_PRIM", "PC",
+     "PC: dead prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_LIVE_PRIM, 0x3u, "PC_LIVE_PRIM", "PC",
+     "PC: live prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_VERTEX_HITS, 0x3u, "PC_VERTEX_HITS", "PC",
+     "PC: vertex hits", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_IA_VERTICES, 0x3u, "PC_IA_VERTICES", "PC",
+     "PC: IA vertices", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_IA_PRIMITIVES, 0x3u, "PC_IA_PRIMITIVES", "PC",
+     "PC: IA primitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_GS_PRIMITIVES, 0x3u, "PC_GS_PRIMITIVES", "PC",
+     "PC: GS primitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_HS_INVOCATIONS, 0x3u, "PC_HS_INVOCATIONS", "PC",
+     "PC: HS invocations", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_DS_INVOCATIONS, 0x3u, "PC_DS_INVOCATIONS", "PC",
+     "PC: DS invocations", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_VS_INVOCATIONS, 0x3u, "PC_VS_INVOCATIONS", "PC",
+     "PC: VS invocations", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_GS_INVOCATIONS, 0x3u, "PC_GS_INVOCATIONS", "PC",
+     "PC: GS invocations", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_DS_PRIMITIVES, 0x3u, "PC_DS_PRIMITIVES", "PC",
+     "PC: DS primitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_VPC_POS_DATA_TRANSACTION, 0x3u,
+     "PC_VPC_POS_DATA_TRANSACTION", "PC", "PC: VPC pos data transaction",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_3D_DRAWCALLS, 0x3u, "PC_3D_DRAWCALLS", "PC",
+     "PC: 3D drawcalls", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_2D_DRAWCALLS, 0x3u, "PC_2D_DRAWCALLS", "PC",
+     "PC: 2D drawcalls", "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_NON_DRAWCALL_GLOBAL_EVENTS, 0x3u,
+     "PC_NON_DRAWCALL_GLOBAL_EVENTS", "PC", "PC: non drawcall global events",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_PC_TESS_BUSY_CYCLES, 0x3u, "PC_TESS_BUSY_CYCLES", "PC",
+     "PC: tess busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_TESS_WORKING_CYCLES, 0x3u, "PC_TESS_WORKING_CYCLES",
+     "PC", "PC: tess working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_TESS_STALL_CYCLES_PC, 0x3u,
+     "PC_TESS_STALL_CYCLES_PC", "PC", "PC: tess stall cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_PC_TESS_STARVE_CYCLES_PC, 0x3u,
+     "PC_TESS_STARVE_CYCLES_PC", "PC", "PC: tess starve cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_BUSY_CYCLES, 0x3u, "VFD_BUSY_CYCLES", "VFD",
+     "VFD: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_UCHE, 0x3u, "VFD_STALL_CYCLES_UCHE",
+     "VFD", "VFD: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_VPC_ALLOC, 0x3u,
+     "VFD_STALL_CYCLES_VPC_ALLOC", "VFD", "VFD: stall cycles VPC alloc",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_MISS_VB, 0x1u,
+     "VFD_STALL_CYCLES_MISS_VB", "VFD", "VFD: stall cycles miss VB", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_MISS_Q, 0x1u,
+     "VFD_STALL_CYCLES_MISS_Q", "VFD", "VFD: stall cycles miss Q", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_SP_INFO, 0x3u,
+     "VFD_STALL_CYCLES_SP_INFO", "VFD", "VFD: stall cycles SP info", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_SP_ATTR, 0x3u,
+     "VFD_STALL_CYCLES_SP_ATTR", "VFD", "VFD: stall cycles SP attr", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_VFDP_VB, 0x1u,
+     "VFD_STALL_CYCLES_VFDP_VB", "VFD", "VFD: stall cycles vfdp VB", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STALL_CYCLES_VFDP_Q, 0x1u,
+     "VFD_STALL_CYCLES_VFDP_Q", "VFD", "VFD: stall cycles vfdp Q", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_DECODER_PACKER_STALL, 0x1u,
+     "VFD_DECODER_PACKER_STALL", "VFD", "VFD: decoder packer stall", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_STARVE_CYCLES_UCHE, 0x3u, "VFD_STARVE_CYCLES_UCHE",
+     "VFD", "VFD: starve cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_RBUFFER_FULL, 0x3u, "VFD_RBUFFER_FULL", "VFD",
+     "VFD: rbuffer full", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_ATTR_INFO_FIFO_FULL, 0x3u,
+     "VFD_ATTR_INFO_FIFO_FULL", "VFD", "VFD: attr info fifo full", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_DECODED_ATTRIBUTE_BYTES, 0x3u,
+     "VFD_DECODED_ATTRIBUTE_BYTES", "VFD", "VFD: decoded attribute bytes",
+     "bytes"},
+    {HPC_GPU_ADRENO_A5XX_VFD_NUM_ATTRIBUTES, 0x3u, "VFD_NUM_ATTRIBUTES", "VFD",
+     "VFD: num attributes", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_INSTRUCTIONS, 0x1u, "VFD_INSTRUCTIONS", "VFD",
+     "VFD: instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_UPPER_SHADER_FIBERS, 0x3u,
+     "VFD_UPPER_SHADER_FIBERS", "VFD", "VFD: upper shader fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_LOWER_SHADER_FIBERS, 0x3u,
+     "VFD_LOWER_SHADER_FIBERS", "VFD", "VFD: lower shader fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_MODE_0_FIBERS, 0x3u, "VFD_MODE_0_FIBERS", "VFD",
+     "VFD: mode 0 fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_MODE_1_FIBERS, 0x3u, "VFD_MODE_1_FIBERS", "VFD",
+     "VFD: mode 1 fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_MODE_2_FIBERS, 0x3u, "VFD_MODE_2_FIBERS", "VFD",
+     "VFD: mode 2 fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_MODE_3_FIBERS, 0x3u, "VFD_MODE_3_FIBERS", "VFD",
+     "VFD: mode 3 fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_MODE_4_FIBERS, 0x3u, "VFD_MODE_4_FIBERS", "VFD",
+     "VFD: mode 4 fibers", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_TOTAL_VERTICES, 0x3u, "VFD_TOTAL_VERTICES", "VFD",
+     "VFD: total vertices", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_NUM_ATTR_MISS, 0x1u, "VFD_NUM_ATTR_MISS", "VFD",
+     "VFD: num attr miss", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_1_BURST_REQ, 0x1u, "VFD_1_BURST_REQ", "VFD",
+     "VFD: 1 burst req", "events"},
+    {HPC_GPU_ADRENO_A5XX_VFD_VFDP_STALL_CYCLES_VFD, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD", "VFD", "VFD: vfdp stall cycles VFD",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_VFDP_STALL_CYCLES_VFD_INDEX, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD_INDEX", "VFD",
+     "VFD: vfdp stall cycles VFD index", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_VFDP_STALL_CYCLES_VFD_PROG, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD_PROG", "VFD", "VFD: vfdp stall cycles VFD prog",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_VFDP_STARVE_CYCLES_PC, 0x3u,
+     "VFD_VFDP_STARVE_CYCLES_PC", "VFD", "VFD: vfdp starve cycles PC",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VFD_VFDP_VS_STAGE_32_WAVES, 0x1u,
+     "VFD_VFDP_VS_STAGE_32_WAVES", "VFD", "VFD: vfdp VS stage 32 waves",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_BUSY_CYCLES, 0x3u, "HLSQ_BUSY_CYCLES", "HLSQ",
+     "High Level SeQuencer: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_STALL_CYCLES_UCHE, 0x3u, "HLSQ_STALL_CYCLES_UCHE",
+     "HLSQ", "High Level SeQuencer: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_STALL_CYCLES_SP_STATE, 0x3u,
+     "HLSQ_STALL_CYCLES_SP_STATE", "HLSQ",
+     "High Level SeQuencer: stall cycles SP state", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_STALL_CYCLES_SP_FS_STAGE, 0x3u,
+     "HLSQ_STALL_CYCLES_SP_FS_STAGE", "HLSQ",
+     "High Level SeQuencer: stall cycles SP FS stage", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_UCHE_LATENCY_CYCLES, 0x3u,
+     "HLSQ_UCHE_LATENCY_CYCLES", "HLSQ",
+     "High Level SeQuencer: UCHE latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_UCHE_LATENCY_COUNT, 0x3u,
+     "HLSQ_UCHE_LATENCY_COUNT", "HLSQ",
+     "High Level SeQuencer: UCHE latency count", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_FS_STAGE_32_WAVES, 0x1u, "HLSQ_FS_STAGE_32_WAVES",
+     "HLSQ", "High Level SeQuencer: FS stage 32 waves", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_FS_STAGE_64_WAVES, 0x1u, "HLSQ_FS_STAGE_64_WAVES",
+     "HLSQ", "High Level SeQuencer: FS stage 64 waves", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_QUADS, 0x3u, "HLSQ_QUADS", "HLSQ",
+     "High Level SeQuencer: quads", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_SP_STATE_COPY_TRANS_FS_STAGE, 0x1u,
+     "HLSQ_SP_STATE_COPY_TRANS_FS_STAGE", "HLSQ",
+     "High Level SeQuencer: SP state copy trans FS stage", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_SP_STATE_COPY_TRANS_VS_STAGE, 0x1u,
+     "HLSQ_SP_STATE_COPY_TRANS_VS_STAGE", "HLSQ",
+     "High Level SeQuencer: SP state copy trans VS stage", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_TP_STATE_COPY_TRANS_FS_STAGE, 0x1u,
+     "HLSQ_TP_STATE_COPY_TRANS_FS_STAGE", "HLSQ",
+     "High Level SeQuencer: TP state copy trans FS stage", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_TP_STATE_COPY_TRANS_VS_STAGE, 0x1u,
+     "HLSQ_TP_STATE_COPY_TRANS_VS_STAGE", "HLSQ",
+     "High Level SeQuencer: TP state copy trans VS stage", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_CS_INVOCATIONS, 0x3u, "HLSQ_CS_INVOCATIONS",
+     "HLSQ", "High Level SeQuencer: CS invocations", "events"},
+    {HPC_GPU_ADRENO_A5XX_HLSQ_COMPUTE_DRAWCALLS, 0x3u, "HLSQ_COMPUTE_DRAWCALLS",
+     "HLSQ", "High Level SeQuencer: compute drawcalls", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_BUSY_CYCLES, 0x3u, "VPC_BUSY_CYCLES", "VPC",
+     "VPC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_WORKING_CYCLES, 0x3u, "VPC_WORKING_CYCLES", "VPC",
+     "VPC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STALL_CYCLES_UCHE, 0x3u, "VPC_STALL_CYCLES_UCHE",
+     "VPC", "VPC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STALL_CYCLES_VFD_WACK, 0x3u,
+     "VPC_STALL_CYCLES_VFD_WACK", "VPC", "VPC: stall cycles VFD wack",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC, 0x3u,
+     "VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC", "VPC",
+     "VPC: stall cycles HLSQ prim alloc", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STALL_CYCLES_PC, 0x3u, "VPC_STALL_CYCLES_PC",
+     "VPC", "VPC: stall cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STALL_CYCLES_SP_LM, 0x3u, "VPC_STALL_CYCLES_SP_LM",
+     "VPC", "VPC: stall cycles SP LM", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_POS_EXPORT_STALL_CYCLES, 0x1u,
+     "VPC_POS_EXPORT_STALL_CYCLES", "VPC", "VPC: pos export stall cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STARVE_CYCLES_SP, 0x3u, "VPC_STARVE_CYCLES_SP",
+     "VPC", "VPC: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STARVE_CYCLES_LRZ, 0x3u, "VPC_STARVE_CYCLES_LRZ",
+     "VPC", "VPC: starve cycles LRZ", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VPC_PC_PRIMITIVES, 0x3u, "VPC_PC_PRIMITIVES", "VPC",
+     "VPC: PC primitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_SP_COMPONENTS, 0x3u, "VPC_SP_COMPONENTS", "VPC",
+     "VPC: SP components", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_SP_LM_PRIMITIVES, 0x1u, "VPC_SP_LM_PRIMITIVES",
+     "VPC", "VPC: SP LM primitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_SP_LM_COMPONENTS, 0x1u, "VPC_SP_LM_COMPONENTS",
+     "VPC", "VPC: SP LM components", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_SP_LM_DWORDS, 0x1u, "VPC_SP_LM_DWORDS", "VPC",
+     "VPC: SP LM dwords", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_STREAMOUT_COMPONENTS, 0x1u,
+     "VPC_STREAMOUT_COMPONENTS", "VPC", "VPC: streamout components", "events"},
+    {HPC_GPU_ADRENO_A5XX_VPC_GRANT_PHASES, 0x1u, "VPC_GRANT_PHASES", "VPC",
+     "VPC: grant phases", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_BUSY_CYCLES, 0x3u, "TSE_BUSY_CYCLES", "TSE",
+     "Triangle Setup Engine: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TSE_CLIPPING_CYCLES, 0x3u, "TSE_CLIPPING_CYCLES",
+     "TSE", "Triangle Setup Engine: clipping cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TSE_STALL_CYCLES_RAS, 0x3u, "TSE_STALL_CYCLES_RAS",
+     "TSE", "Triangle Setup Engine: stall cycles RAS", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TSE_STALL_CYCLES_LRZ_BARYPLANE, 0x3u,
+     "TSE_STALL_CYCLES_LRZ_BARYPLANE", "TSE",
+     "Triangle Setup Engine: stall cycles LRZ baryplane", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TSE_STALL_CYCLES_LRZ_ZPLANE, 0x3u,
+     "TSE_STALL_CYCLES_LRZ_ZPLANE", "TSE",
+     "Triangle Setup Engine: stall cycles LRZ zplane", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TSE_STARVE_CYCLES_PC, 0x3u, "TSE_STARVE_CYCLES_PC",
+     "TSE", "Triangle Setup Engine: starve cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TSE_INPUT_PRIM, 0x3u, "TSE_INPUT_PRIM", "TSE",
+     "Triangle Setup Engine: input prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_INPUT_NULL_PRIM, 0x3u, "TSE_INPUT_NULL_PRIM",
+     "TSE", "Triangle Setup Engine: input null prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_TRIVAL_REJ_PRIM, 0x3u, "TSE_TRIVAL_REJ_PRIM",
+     "TSE", "Triangle Setup Engine: trival rej prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_CLIPPED_PRIM, 0x3u, "TSE_CLIPPED_PRIM", "TSE",
+     "Triangle Setup Engine: clipped prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_ZERO_AREA_PRIM, 0x3u, "TSE_ZERO_AREA_PRIM", "TSE",
+     "Triangle Setup Engine: zero area prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_FACENESS_CULLED_PRIM, 0x3u,
+     "TSE_FACENESS_CULLED_PRIM", "TSE",
+     "Triangle Setup Engine: faceness culled prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_ZERO_PIXEL_PRIM, 0x3u, "TSE_ZERO_PIXEL_PRIM",
+     "TSE", "Triangle Setup Engine: zero pixel prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_OUTPUT_NULL_PRIM, 0x3u, "TSE_OUTPUT_NULL_PRIM",
+     "TSE", "Triangle Setup Engine: output null prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_OUTPUT_VISIBLE_PRIM, 0x3u,
+     "TSE_OUTPUT_VISIBLE_PRIM", "TSE",
+     "Triangle Setup Engine: output visible prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_CINVOCATION, 0x3u, "TSE_CINVOCATION", "TSE",
+     "Triangle Setup Engine: cinvocation", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_CPRIMITIVES, 0x3u, "TSE_CPRIMITIVES", "TSE",
+     "Triangle Setup Engine: cprimitives", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_2D_INPUT_PRIM, 0x3u, "TSE_2D_INPUT_PRIM", "TSE",
+     "Triangle Setup Engine: 2D input prim", "events"},
+    {HPC_GPU_ADRENO_A5XX_TSE_2D_ALIVE_CLCLES, 0x1u, "TSE_2D_ALIVE_CLCLES",
+     "TSE", "Triangle Setup Engine: 2D alive clcles", "events"},
+    {HPC_GPU_ADRENO_A5XX_RAS_BUSY_CYCLES, 0x3u, "RAS_BUSY_CYCLES", "RAS",
+     "RAS: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RAS_SUPERTILE_ACTIVE_CYCLES, 0x3u,
+     "RAS_SUPERTILE_ACTIVE_CYCLES", "RAS", "RAS: supertile active cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RAS_STALL_CYCLES_LRZ, 0x3u, "RAS_STALL_CYCLES_LRZ",
+     "RAS", "RAS: stall cycles LRZ", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RAS_STARVE_CYCLES_TSE, 0x3u, "RAS_STARVE_CYCLES_TSE",
+     "RAS", "RAS: starve cycles TSE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RAS_SUPER_TILES, 0x3u, "RAS_SUPER_TILES", "RAS",
+     "RAS: super tiles", "events"},
+    {HPC_GPU_ADRENO_A5XX_RAS_8X4_TILES, 0x3u, "RAS_8X4_TILES", "RAS",
+     "RAS: 8x4 tiles", "events"},
+    {HPC_GPU_ADRENO_A5XX_RAS_MASKGEN_ACTIVE, 0x3u, "RAS_MASKGEN_ACTIVE", "RAS",
+     "RAS: maskgen active", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RAS_FULLY_COVERED_SUPER_TILES, 0x3u,
+     "RAS_FULLY_COVERED_SUPER_TILES", "RAS", "RAS: fully covered super tiles",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RAS_FULLY_COVERED_8X4_TILES, 0x3u,
+     "RAS_FULLY_COVERED_8X4_TILES", "RAS", "RAS: fully covered 8x4 tiles",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RAS_PRIM_KILLED_INVISILBE, 0x3u,
+     "RAS_PRIM_KILLED_INVISILBE", "RAS", "RAS: prim killed invisilbe",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BUSY_CYCLES, 0x3u, "UCHE_BUSY_CYCLES", "UCHE",
+     "Unified L2 Cache: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_STALL_CYCLES_VBIF, 0x1u, "UCHE_STALL_CYCLES_VBIF",
+     "UCHE", "Unified L2 Cache: stall cycles VBIF", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_LATENCY_CYCLES, 0x3u,
+     "UCHE_VBIF_LATENCY_CYCLES", "UCHE",
+     "Unified L2 Cache: VBIF latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_LATENCY_SAMPLES, 0x3u,
+     "UCHE_VBIF_LATENCY_SAMPLES", "UCHE",
+     "Unified L2 Cache: VBIF latency samples", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_TP, 0x3u,
+     "UCHE_VBIF_READ_BEATS_TP", "UCHE", "Unified L2 Cache: VBIF read beats TP",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_VFD, 0x3u,
+     "UCHE_VBIF_READ_BEATS_VFD", "UCHE",
+     "Unified L2 Cache: VBIF read beats VFD", "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_HLSQ, 0x3u,
+     "UCHE_VBIF_READ_BEATS_HLSQ", "UCHE",
+     "Unified L2 Cache: VBIF read beats HLSQ", "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_LRZ, 0x3u,
+     "UCHE_VBIF_READ_BEATS_LRZ", "UCHE",
+     "Unified L2 Cache: VBIF read beats LRZ", "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_SP, 0x3u,
+     "UCHE_VBIF_READ_BEATS_SP", "UCHE", "Unified L2 Cache: VBIF read beats SP",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_READ_REQUESTS_TP, 0x3u, "UCHE_READ_REQUESTS_TP",
+     "UCHE", "Unified L2 Cache: read requests TP", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_READ_REQUESTS_VFD, 0x3u, "UCHE_READ_REQUESTS_VFD",
+     "UCHE", "Unified L2 Cache: read requests VFD", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_READ_REQUESTS_HLSQ, 0x3u,
+     "UCHE_READ_REQUESTS_HLSQ", "UCHE", "Unified L2 Cache: read requests HLSQ",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_READ_REQUESTS_LRZ, 0x3u, "UCHE_READ_REQUESTS_LRZ",
+     "UCHE", "Unified L2 Cache: read requests LRZ", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_READ_REQUESTS_SP, 0x3u, "UCHE_READ_REQUESTS_SP",
+     "UCHE", "Unified L2 Cache: read requests SP", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_WRITE_REQUESTS_LRZ, 0x3u,
+     "UCHE_WRITE_REQUESTS_LRZ", "UCHE", "Unified L2 Cache: write requests LRZ",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_WRITE_REQUESTS_SP, 0x3u, "UCHE_WRITE_REQUESTS_SP",
+     "UCHE", "Unified L2 Cache: write requests SP", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_WRITE_REQUESTS_VPC, 0x3u,
+     "UCHE_WRITE_REQUESTS_VPC", "UCHE", "Unified L2 Cache: write requests VPC",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_WRITE_REQUESTS_VSC, 0x3u,
+     "UCHE_WRITE_REQUESTS_VSC", "UCHE", "Unified L2 Cache: write requests VSC",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_EVICTS, 0x3u, "UCHE_EVICTS", "UCHE",
+     "Unified L2 Cache: evicts", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ0, 0x3u, "UCHE_BANK_REQ0", "UCHE",
+     "Unified L2 Cache: bank req0", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ1, 0x3u, "UCHE_BANK_REQ1", "UCHE",
+     "Unified L2 Cache: bank req1", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ2, 0x3u, "UCHE_BANK_REQ2", "UCHE",
+     "Unified L2 Cache: bank req2", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ3, 0x3u, "UCHE_BANK_REQ3", "UCHE",
+     "Unified L2 Cache: bank req3", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ4, 0x3u, "UCHE_BANK_REQ4", "UCHE",
+     "Unified L2 Cache: bank req4", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ5, 0x3u, "UCHE_BANK_REQ5", "UCHE",
+     "Unified L2 Cache: bank req5", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ6, 0x3u, "UCHE_BANK_REQ6", "UCHE",
+     "Unified L2 Cache: bank req6", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_BANK_REQ7, 0x3u, "UCHE_BANK_REQ7", "UCHE",
+     "Unified L2 Cache: bank req7", "events"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_CH0, 0x3u,
+     "UCHE_VBIF_READ_BEATS_CH0", "UCHE",
+     "Unified L2 Cache: VBIF read beats ch0", "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_VBIF_READ_BEATS_CH1, 0x3u,
+     "UCHE_VBIF_READ_BEATS_CH1", "UCHE",
+     "Unified L2 Cache: VBIF read beats ch1", "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_GMEM_READ_BEATS, 0x3u, "UCHE_GMEM_READ_BEATS",
+     "UCHE", "Unified L2 Cache: gmem read beats", "beats"},
+    {HPC_GPU_ADRENO_A5XX_UCHE_FLAG_COUNT, 0x1u, "UCHE_FLAG_COUNT", "UCHE",
+     "Unified L2 Cache: flag count", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_BUSY_CYCLES, 0x3u, "TP_BUSY_CYCLES", "TP",
+     "Texture Processor: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TP_STALL_CYCLES_UCHE, 0x3u, "TP_STALL_CYCLES_UCHE",
+     "TP", "Texture Processor: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TP_LATENCY_CYCLES, 0x3u, "TP_LATENCY_CYCLES", "TP",
+     "Texture Processor: latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_TP_LATENCY_TRANS, 0x3u, "TP_LATENCY_TRANS", "TP",
+     "Texture Processor: latency trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_FLAG_CACHE_REQUEST_SAMPLES, 0x3u,
+     "TP_FLAG_CACHE_REQUEST_SAMPLES", "TP",
+     "Texture Processor: flag cache request samples", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_FLAG_CACHE_REQUEST_LATENCY, 0x3u,
+     "TP_FLAG_CACHE_REQUEST_LATENCY", "TP",
+     "Texture Processor: flag cache request latency", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_L1_CACHELINE_REQUESTS, 0x3u,
+     "TP_L1_CACHELINE_REQUESTS", "TP",
+     "Texture Processor: L1 cacheline requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_L1_CACHELINE_MISSES, 0x3u, "TP_L1_CACHELINE_MISSES",
+     "TP", "Texture Processor: L1 cacheline misses", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_SP_TP_TRANS, 0x3u, "TP_SP_TP_TRANS", "TP",
+     "Texture Processor: SP TP trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_TP_SP_TRANS, 0x3u, "TP_TP_SP_TRANS", "TP",
+     "Texture Processor: TP SP trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_OUTPUT_PIXELS, 0x3u, "TP_OUTPUT_PIXELS", "TP",
+     "Texture Processor: output pixels", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_FILTER_WORKLOAD_16BIT, 0x3u,
+     "TP_FILTER_WORKLOAD_16BIT", "TP",
+     "Texture Processor: filter workload 16bit", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_FILTER_WORKLOAD_32BIT, 0x3u,
+     "TP_FILTER_WORKLOAD_32BIT", "TP",
+     "Texture Processor: filter workload 32bit", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_RECEIVED, 0x3u, "TP_QUADS_RECEIVED", "TP",
+     "Texture Processor: quads received", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_OFFSET, 0x3u, "TP_QUADS_OFFSET", "TP",
+     "Texture Processor: quads offset", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_SHADOW, 0x3u, "TP_QUADS_SHADOW", "TP",
+     "Texture Processor: quads shadow", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_ARRAY, 0x3u, "TP_QUADS_ARRAY", "TP",
+     "Texture Processor: quads array", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_GRADIENT, 0x3u, "TP_QUADS_GRADIENT", "TP",
+     "Texture Processor: quads gradient", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_1D, 0x3u, "TP_QUADS_1D", "TP",
+     "Texture Processor: quads 1D", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_2D, 0x3u, "TP_QUADS_2D", "TP",
+     "Texture Processor: quads 2D", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_BUFFER, 0x3u, "TP_QUADS_BUFFER", "TP",
+     "Texture Processor: quads buffer", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_3D, 0x3u, "TP_QUADS_3D", "TP",
+     "Texture Processor: quads 3D", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_QUADS_CUBE, 0x3u, "TP_QUADS_CUBE", "TP",
+     "Texture Processor: quads cube", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_STATE_CACHE_REQUESTS, 0x1u,
+     "TP_STATE_CACHE_REQUESTS", "TP", "Texture Processor: state cache requests",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_STATE_CACHE_MISSES, 0x1u, "TP_STATE_CACHE_MISSES",
+     "TP", "Texture Processor: state cache misses", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_DIVERGENT_QUADS_RECEIVED, 0x3u,
+     "TP_DIVERGENT_QUADS_RECEIVED", "TP",
+     "Texture Processor: divergent quads received", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_BINDLESS_STATE_CACHE_REQUESTS, 0x1u,
+     "TP_BINDLESS_STATE_CACHE_REQUESTS", "TP",
+     "Texture Processor: bindless state cache requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_BINDLESS_STATE_CACHE_MISSES, 0x1u,
+     "TP_BINDLESS_STATE_CACHE_MISSES", "TP",
+     "Texture Processor: bindless state cache misses", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_PRT_NON_RESIDENT_EVENTS, 0x3u,
+     "TP_PRT_NON_RESIDENT_EVENTS", "TP",
+     "Texture Processor: prt non resident events", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_OUTPUT_PIXELS_POINT, 0x3u, "TP_OUTPUT_PIXELS_POINT",
+     "TP", "Texture Processor: output pixels point", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_OUTPUT_PIXELS_BILINEAR, 0x3u,
+     "TP_OUTPUT_PIXELS_BILINEAR", "TP",
+     "Texture Processor: output pixels bilinear", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_OUTPUT_PIXELS_MIP, 0x3u, "TP_OUTPUT_PIXELS_MIP",
+     "TP", "Texture Processor: output pixels mip", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_OUTPUT_PIXELS_ANISO, 0x3u, "TP_OUTPUT_PIXELS_ANISO",
+     "TP", "Texture Processor: output pixels aniso", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_OUTPUT_PIXELS_ZERO_LOD, 0x3u,
+     "TP_OUTPUT_PIXELS_ZERO_LOD", "TP",
+     "Texture Processor: output pixels zero lod", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_FLAG_CACHE_REQUESTS, 0x3u, "TP_FLAG_CACHE_REQUESTS",
+     "TP", "Texture Processor: flag cache requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_FLAG_CACHE_MISSES, 0x3u, "TP_FLAG_CACHE_MISSES",
+     "TP", "Texture Processor: flag cache misses", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_L1_5_L2_REQUESTS, 0x3u, "TP_L1_5_L2_REQUESTS", "TP",
+     "Texture Processor: L1 5 L2 requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_2D_OUTPUT_PIXELS, 0x3u, "TP_2D_OUTPUT_PIXELS", "TP",
+     "Texture Processor: 2D output pixels", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_2D_OUTPUT_PIXELS_POINT, 0x3u,
+     "TP_2D_OUTPUT_PIXELS_POINT", "TP",
+     "Texture Processor: 2D output pixels point", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_2D_OUTPUT_PIXELS_BILINEAR, 0x3u,
+     "TP_2D_OUTPUT_PIXELS_BILINEAR", "TP",
+     "Texture Processor: 2D output pixels bilinear", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_2D_FILTER_WORKLOAD_16BIT, 0x3u,
+     "TP_2D_FILTER_WORKLOAD_16BIT", "TP",
+     "Texture Processor: 2D filter workload 16bit", "events"},
+    {HPC_GPU_ADRENO_A5XX_TP_2D_FILTER_WORKLOAD_32BIT, 0x3u,
+     "TP_2D_FILTER_WORKLOAD_32BIT", "TP",
+     "Texture Processor: 2D filter workload 32bit", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_BUSY_CYCLES, 0x3u, "SP_BUSY_CYCLES", "SP",
+     "Shader/Streaming Processor: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_ALU_WORKING_CYCLES, 0x3u, "SP_ALU_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: ALU working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_EFU_WORKING_CYCLES, 0x3u, "SP_EFU_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: EFU working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_STALL_CYCLES_VPC, 0x3u, "SP_STALL_CYCLES_VPC", "SP",
+     "Shader/Streaming Processor: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_STALL_CYCLES_TP, 0x3u, "SP_STALL_CYCLES_TP", "SP",
+     "Shader/Streaming Processor: stall cycles TP", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_STALL_CYCLES_UCHE, 0x3u, "SP_STALL_CYCLES_UCHE",
+     "SP", "Shader/Streaming Processor: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_STALL_CYCLES_RB, 0x3u, "SP_STALL_CYCLES_RB", "SP",
+     "Shader/Streaming Processor: stall cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_SCHEDULER_NON_WORKING, 0x1u,
+     "SP_SCHEDULER_NON_WORKING", "SP",
+     "Shader/Streaming Processor: scheduler non working", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_CONTEXTS, 0x3u, "SP_WAVE_CONTEXTS", "SP",
+     "Shader/Streaming Processor: wave contexts", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_CONTEXT_CYCLES, 0x3u, "SP_WAVE_CONTEXT_CYCLES",
+     "SP", "Shader/Streaming Processor: wave context cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_WAVE_CYCLES, 0x3u,
+     "SP_FS_STAGE_WAVE_CYCLES", "SP",
+     "Shader/Streaming Processor: FS stage wave cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_WAVE_SAMPLES, 0x3u,
+     "SP_FS_STAGE_WAVE_SAMPLES", "SP",
+     "Shader/Streaming Processor: FS stage wave samples", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_WAVE_CYCLES, 0x3u,
+     "SP_VS_STAGE_WAVE_CYCLES", "SP",
+     "Shader/Streaming Processor: VS stage wave cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_WAVE_SAMPLES, 0x3u,
+     "SP_VS_STAGE_WAVE_SAMPLES", "SP",
+     "Shader/Streaming Processor: VS stage wave samples", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_DURATION_CYCLES, 0x3u,
+     "SP_FS_STAGE_DURATION_CYCLES", "SP",
+     "Shader/Streaming Processor: FS stage duration cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_DURATION_CYCLES, 0x3u,
+     "SP_VS_STAGE_DURATION_CYCLES", "SP",
+     "Shader/Streaming Processor: VS stage duration cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_CTRL_CYCLES, 0x3u, "SP_WAVE_CTRL_CYCLES", "SP",
+     "Shader/Streaming Processor: wave ctrl cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_LOAD_CYCLES, 0x3u, "SP_WAVE_LOAD_CYCLES", "SP",
+     "Shader/Streaming Processor: wave load cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_EMIT_CYCLES, 0x3u, "SP_WAVE_EMIT_CYCLES", "SP",
+     "Shader/Streaming Processor: wave emit cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_NOP_CYCLES, 0x3u, "SP_WAVE_NOP_CYCLES", "SP",
+     "Shader/Streaming Processor: wave nop cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_WAIT_CYCLES, 0x3u, "SP_WAVE_WAIT_CYCLES", "SP",
+     "Shader/Streaming Processor: wave wait cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_FETCH_CYCLES, 0x3u, "SP_WAVE_FETCH_CYCLES",
+     "SP", "Shader/Streaming Processor: wave fetch cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_IDLE_CYCLES, 0x3u, "SP_WAVE_IDLE_CYCLES", "SP",
+     "Shader/Streaming Processor: wave idle cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_END_CYCLES, 0x3u, "SP_WAVE_END_CYCLES", "SP",
+     "Shader/Streaming Processor: wave end cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_LONG_SYNC_CYCLES, 0x3u,
+     "SP_WAVE_LONG_SYNC_CYCLES", "SP",
+     "Shader/Streaming Processor: wave long sync cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_SHORT_SYNC_CYCLES, 0x3u,
+     "SP_WAVE_SHORT_SYNC_CYCLES", "SP",
+     "Shader/Streaming Processor: wave short sync cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_WAVE_JOIN_CYCLES, 0x3u, "SP_WAVE_JOIN_CYCLES", "SP",
+     "Shader/Streaming Processor: wave join cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_SP_LM_LOAD_INSTRUCTIONS, 0x3u,
+     "SP_LM_LOAD_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: LM load instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_LM_STORE_INSTRUCTIONS, 0x3u,
+     "SP_LM_STORE_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: LM store instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_LM_ATOMICS, 0x3u, "SP_LM_ATOMICS", "SP",
+     "Shader/Streaming Processor: LM atomics", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_GM_LOAD_INSTRUCTIONS, 0x3u,
+     "SP_GM_LOAD_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GM load instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_GM_STORE_INSTRUCTIONS, 0x3u,
+     "SP_GM_STORE_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GM store instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_GM_ATOMICS, 0x3u, "SP_GM_ATOMICS", "SP",
+     "Shader/Streaming Processor: GM atomics", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_TEX_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_TEX_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage tex instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_CFLOW_INSTRUCTIONS, 0x1u,
+     "SP_VS_STAGE_CFLOW_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage cflow instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_EFU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage EFU instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_FULL_ALU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_FULL_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage full ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_STAGE_HALF_ALU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_HALF_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage half ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_TEX_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_TEX_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage tex instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_CFLOW_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_CFLOW_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage cflow instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_EFU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage EFU instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_FULL_ALU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_FULL_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage full ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_HALF_ALU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_HALF_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage half ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_STAGE_BARY_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_BARY_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage bary instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_VS_INSTRUCTIONS, 0x3u, "SP_VS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_FS_INSTRUCTIONS, 0x3u, "SP_FS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_ADDR_LOCK_COUNT, 0x3u, "SP_ADDR_LOCK_COUNT", "SP",
+     "Shader/Streaming Processor: addr lock count", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_UCHE_READ_TRANS, 0x3u, "SP_UCHE_READ_TRANS", "SP",
+     "Shader/Streaming Processor: UCHE read trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_UCHE_WRITE_TRANS, 0x3u, "SP_UCHE_WRITE_TRANS", "SP",
+     "Shader/Streaming Processor: UCHE write trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_EXPORT_VPC_TRANS, 0x3u, "SP_EXPORT_VPC_TRANS", "SP",
+     "Shader/Streaming Processor: export VPC trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_EXPORT_RB_TRANS, 0x3u, "SP_EXPORT_RB_TRANS", "SP",
+     "Shader/Streaming Processor: export RB trans", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_PIXELS_KILLED, 0x3u, "SP_PIXELS_KILLED", "SP",
+     "Shader/Streaming Processor: pixels killed", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_ICL1_REQUESTS, 0x3u, "SP_ICL1_REQUESTS", "SP",
+     "Shader/Streaming Processor: icl1 requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_ICL1_MISSES, 0x3u, "SP_ICL1_MISSES", "SP",
+     "Shader/Streaming Processor: icl1 misses", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_ICL0_REQUESTS, 0x1u, "SP_ICL0_REQUESTS", "SP",
+     "Shader/Streaming Processor: icl0 requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_ICL0_MISSES, 0x1u, "SP_ICL0_MISSES", "SP",
+     "Shader/Streaming Processor: icl0 misses", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_HS_INSTRUCTIONS, 0x3u, "SP_HS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: HS instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_DS_INSTRUCTIONS, 0x3u, "SP_DS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: DS instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_GS_INSTRUCTIONS, 0x3u, "SP_GS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GS instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_CS_INSTRUCTIONS, 0x3u, "SP_CS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: CS instructions", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_GPR_READ, 0x3u, "SP_GPR_READ", "SP",
+     "Shader/Streaming Processor: GPR read", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_GPR_WRITE, 0x3u, "SP_GPR_WRITE", "SP",
+     "Shader/Streaming Processor: GPR write", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_LM_CH0_REQUESTS, 0x1u, "SP_LM_CH0_REQUESTS", "SP",
+     "Shader/Streaming Processor: LM ch0 requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_LM_CH1_REQUESTS, 0x1u, "SP_LM_CH1_REQUESTS", "SP",
+     "Shader/Streaming Processor: LM ch1 requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_SP_LM_BANK_CONFLICTS, 0x3u, "SP_LM_BANK_CONFLICTS",
+     "SP", "Shader/Streaming Processor: LM bank conflicts", "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_BUSY_CYCLES, 0x3u, "RB_BUSY_CYCLES", "RB",
+     "RB: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STALL_CYCLES_CCU, 0x3u, "RB_STALL_CYCLES_CCU", "RB",
+     "RB: stall cycles CCU", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STALL_CYCLES_HLSQ, 0x3u, "RB_STALL_CYCLES_HLSQ",
+     "RB", "RB: stall cycles HLSQ", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STALL_CYCLES_FIFO0_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO0_FULL", "RB", "RB: stall cycles fifo0 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STALL_CYCLES_FIFO1_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO1_FULL", "RB", "RB: stall cycles fifo1 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STALL_CYCLES_FIFO2_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO2_FULL", "RB", "RB: stall cycles fifo2 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STARVE_CYCLES_SP, 0x3u, "RB_STARVE_CYCLES_SP", "RB",
+     "RB: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STARVE_CYCLES_LRZ_TILE, 0x3u,
+     "RB_STARVE_CYCLES_LRZ_TILE", "RB", "RB: starve cycles LRZ tile", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STARVE_CYCLES_CCU, 0x3u, "RB_STARVE_CYCLES_CCU",
+     "RB", "RB: starve cycles CCU", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STARVE_CYCLES_Z_PLANE, 0x3u,
+     "RB_STARVE_CYCLES_Z_PLANE", "RB", "RB: starve cycles Z plane", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_STARVE_CYCLES_BARY_PLANE, 0x3u,
+     "RB_STARVE_CYCLES_BARY_PLANE", "RB", "RB: starve cycles bary plane",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_Z_WORKLOAD, 0x3u, "RB_Z_WORKLOAD", "RB",
+     "RB: Z workload", "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_HLSQ_ACTIVE, 0x3u, "RB_HLSQ_ACTIVE", "RB",
+     "RB: HLSQ active", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_Z_READ, 0x3u, "RB_Z_READ", "RB", "RB: Z read",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_Z_WRITE, 0x3u, "RB_Z_WRITE", "RB", "RB: Z write",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_C_READ, 0x3u, "RB_C_READ", "RB", "RB: C read",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_C_WRITE, 0x3u, "RB_C_WRITE", "RB", "RB: C write",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_TOTAL_PASS, 0x3u, "RB_TOTAL_PASS", "RB",
+     "RB: total pass", "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_Z_PASS, 0x3u, "RB_Z_PASS", "RB", "RB: Z pass",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_Z_FAIL, 0x3u, "RB_Z_FAIL", "RB", "RB: Z fail",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_S_FAIL, 0x3u, "RB_S_FAIL", "RB", "RB: S fail",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_BLENDED_FXP_COMPONENTS, 0x3u,
+     "RB_BLENDED_FXP_COMPONENTS", "RB", "RB: blended fxp components", "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_BLENDED_FP16_COMPONENTS, 0x3u,
+     "RB_BLENDED_FP16_COMPONENTS", "RB", "RB: blended fp16 components",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_RESERVED, 0x1u, "RB_RESERVED", "RB", "RB: reserved",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_RB_2D_ALIVE_CYCLES, 0x3u, "RB_2D_ALIVE_CYCLES", "RB",
+     "RB: 2D alive cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_2D_STALL_CYCLES_A2D, 0x3u, "RB_2D_STALL_CYCLES_A2D",
+     "RB", "RB: 2D stall cycles a2d", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_2D_STARVE_CYCLES_SRC, 0x3u,
+     "RB_2D_STARVE_CYCLES_SRC", "RB", "RB: 2D starve cycles src", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_2D_STARVE_CYCLES_SP, 0x3u, "RB_2D_STARVE_CYCLES_SP",
+     "RB", "RB: 2D starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_2D_STARVE_CYCLES_DST, 0x3u,
+     "RB_2D_STARVE_CYCLES_DST", "RB", "RB: 2D starve cycles dst", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_RB_2D_VALID_PIXELS, 0x3u, "RB_2D_VALID_PIXELS", "RB",
+     "RB: 2D valid pixels", "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_0, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_0", "VBIF", "VBIF: axi read requests ID 0",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_1, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_1", "VBIF", "VBIF: axi read requests ID 1",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_2, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_2", "VBIF", "VBIF: axi read requests ID 2",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_3, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_3", "VBIF", "VBIF: axi read requests ID 3",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_4, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_4", "VBIF", "VBIF: axi read requests ID 4",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_5, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_5", "VBIF", "VBIF: axi read requests ID 5",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_6, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_6", "VBIF", "VBIF: axi read requests ID 6",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_7, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_7", "VBIF", "VBIF: axi read requests ID 7",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_8, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_8", "VBIF", "VBIF: axi read requests ID 8",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_9, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_9", "VBIF", "VBIF: axi read requests ID 9",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_10, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_10", "VBIF", "VBIF: axi read requests ID 10",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_11, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_11", "VBIF", "VBIF: axi read requests ID 11",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_12, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_12", "VBIF", "VBIF: axi read requests ID 12",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_13, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_13", "VBIF", "VBIF: axi read requests ID 13",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_14, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_14", "VBIF", "VBIF: axi read requests ID 14",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_ID_15, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_ID_15", "VBIF", "VBIF: axi read requests ID 15",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI0_READ_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI0_READ_REQUESTS_TOTAL", "VBIF", "VBIF: axi0 read requests total",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI1_READ_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI1_READ_REQUESTS_TOTAL", "VBIF", "VBIF: axi1 read requests total",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI2_READ_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI2_READ_REQUESTS_TOTAL", "VBIF", "VBIF: axi2 read requests total",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI3_READ_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI3_READ_REQUESTS_TOTAL", "VBIF", "VBIF: axi3 read requests total",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI_READ_REQUESTS_TOTAL", "VBIF", "VBIF: axi read requests total",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_0, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_0", "VBIF", "VBIF: axi write requests ID 0",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_1, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_1", "VBIF", "VBIF: axi write requests ID 1",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_2, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_2", "VBIF", "VBIF: axi write requests ID 2",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_3, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_3", "VBIF", "VBIF: axi write requests ID 3",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_4, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_4", "VBIF", "VBIF: axi write requests ID 4",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_5, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_5", "VBIF", "VBIF: axi write requests ID 5",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_6, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_6", "VBIF", "VBIF: axi write requests ID 6",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_7, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_7", "VBIF", "VBIF: axi write requests ID 7",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_8, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_8", "VBIF", "VBIF: axi write requests ID 8",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_9, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_9", "VBIF", "VBIF: axi write requests ID 9",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_10, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_10", "VBIF", "VBIF: axi write requests ID 10",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_11, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_11", "VBIF", "VBIF: axi write requests ID 11",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_12, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_12", "VBIF", "VBIF: axi write requests ID 12",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_13, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_13", "VBIF", "VBIF: axi write requests ID 13",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_14, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_14", "VBIF", "VBIF: axi write requests ID 14",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_ID_15, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_ID_15", "VBIF", "VBIF: axi write requests ID 15",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI0_WRITE_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI0_WRITE_REQUESTS_TOTAL", "VBIF",
+     "VBIF: axi0 write requests total", "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI1_WRITE_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI1_WRITE_REQUESTS_TOTAL", "VBIF",
+     "VBIF: axi1 write requests total", "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI2_WRITE_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI2_WRITE_REQUESTS_TOTAL", "VBIF",
+     "VBIF: axi2 write requests total", "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI3_WRITE_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI3_WRITE_REQUESTS_TOTAL", "VBIF",
+     "VBIF: axi3 write requests total", "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_REQUESTS_TOTAL, 0x1u,
+     "VBIF_AXI_WRITE_REQUESTS_TOTAL", "VBIF", "VBIF: axi write requests total",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_TOTAL_REQUESTS, 0x1u,
+     "VBIF_AXI_TOTAL_REQUESTS", "VBIF", "VBIF: axi total requests", "events"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_0, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_0", "VBIF", "VBIF: axi read data beats ID 0",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_1, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_1", "VBIF", "VBIF: axi read data beats ID 1",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_2, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_2", "VBIF", "VBIF: axi read data beats ID 2",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_3, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_3", "VBIF", "VBIF: axi read data beats ID 3",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_4, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_4", "VBIF", "VBIF: axi read data beats ID 4",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_5, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_5", "VBIF", "VBIF: axi read data beats ID 5",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_6, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_6", "VBIF", "VBIF: axi read data beats ID 6",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_7, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_7", "VBIF", "VBIF: axi read data beats ID 7",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_8, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_8", "VBIF", "VBIF: axi read data beats ID 8",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_9, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_9", "VBIF", "VBIF: axi read data beats ID 9",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_10, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_10", "VBIF",
+     "VBIF: axi read data beats ID 10", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_11, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_11", "VBIF",
+     "VBIF: axi read data beats ID 11", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_12, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_12", "VBIF",
+     "VBIF: axi read data beats ID 12", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_13, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_13", "VBIF",
+     "VBIF: axi read data beats ID 13", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_14, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_14", "VBIF",
+     "VBIF: axi read data beats ID 14", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_ID_15, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_ID_15", "VBIF",
+     "VBIF: axi read data beats ID 15", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI0_READ_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI0_READ_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi0 read data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI1_READ_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI1_READ_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi1 read data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI2_READ_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI2_READ_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi2 read data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI3_READ_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI3_READ_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi3 read data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_READ_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI_READ_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi read data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_0, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_0", "VBIF",
+     "VBIF: axi write data beats ID 0", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_1, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_1", "VBIF",
+     "VBIF: axi write data beats ID 1", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_2, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_2", "VBIF",
+     "VBIF: axi write data beats ID 2", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_3, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_3", "VBIF",
+     "VBIF: axi write data beats ID 3", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_4, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_4", "VBIF",
+     "VBIF: axi write data beats ID 4", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_5, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_5", "VBIF",
+     "VBIF: axi write data beats ID 5", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_6, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_6", "VBIF",
+     "VBIF: axi write data beats ID 6", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_7, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_7", "VBIF",
+     "VBIF: axi write data beats ID 7", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_8, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_8", "VBIF",
+     "VBIF: axi write data beats ID 8", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_9, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_9", "VBIF",
+     "VBIF: axi write data beats ID 9", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_10, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_10", "VBIF",
+     "VBIF: axi write data beats ID 10", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_11, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_11", "VBIF",
+     "VBIF: axi write data beats ID 11", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_12, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_12", "VBIF",
+     "VBIF: axi write data beats ID 12", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_13, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_13", "VBIF",
+     "VBIF: axi write data beats ID 13", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_14, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_14", "VBIF",
+     "VBIF: axi write data beats ID 14", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_ID_15, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_ID_15", "VBIF",
+     "VBIF: axi write data beats ID 15", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI0_WRITE_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI0_WRITE_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi0 write data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI1_WRITE_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI1_WRITE_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi1 write data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI2_WRITE_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI2_WRITE_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi2 write data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI3_WRITE_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI3_WRITE_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi3 write data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_WRITE_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI_WRITE_DATA_BEATS_TOTAL", "VBIF",
+     "VBIF: axi write data beats total", "beats"},
+    {HPC_GPU_ADRENO_A5XX_VBIF_AXI_DATA_BEATS_TOTAL, 0x1u,
+     "VBIF_AXI_DATA_BEATS_TOTAL", "VBIF", "VBIF: axi data beats total",
+     "beats"},
+    {HPC_GPU_ADRENO_A5XX_VSC_BUSY_CYCLES, 0x3u, "VSC_BUSY_CYCLES", "VSC",
+     "VSC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VSC_WORKING_CYCLES, 0x3u, "VSC_WORKING_CYCLES", "VSC",
+     "VSC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VSC_STALL_CYCLES_UCHE, 0x3u, "VSC_STALL_CYCLES_UCHE",
+     "VSC", "VSC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_VSC_EOT_NUM, 0x3u, "VSC_EOT_NUM", "VSC",
+     "VSC: eot num", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_BUSY_CYCLES, 0x3u, "CCU_BUSY_CYCLES", "CCU",
+     "Cache and Compression Unit: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CCU_STALL_CYCLES_RB_DEPTH_RETURN, 0x3u,
+     "CCU_STALL_CYCLES_RB_DEPTH_RETURN", "CCU",
+     "Cache and Compression Unit: stall cycles RB depth return", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CCU_STALL_CYCLES_RB_COLOR_RETURN, 0x3u,
+     "CCU_STALL_CYCLES_RB_COLOR_RETURN", "CCU",
+     "Cache and Compression Unit: stall cycles RB color return", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CCU_STARVE_CYCLES_FLAG_RETURN, 0x3u,
+     "CCU_STARVE_CYCLES_FLAG_RETURN", "CCU",
+     "Cache and Compression Unit: starve cycles flag return", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_BLOCKS, 0x3u, "CCU_DEPTH_BLOCKS", "CCU",
+     "Cache and Compression Unit: depth blocks", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_BLOCKS, 0x3u, "CCU_COLOR_BLOCKS", "CCU",
+     "Cache and Compression Unit: color blocks", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_BLOCK_HIT, 0x3u, "CCU_DEPTH_BLOCK_HIT",
+     "CCU", "Cache and Compression Unit: depth block hit", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_BLOCK_HIT, 0x3u, "CCU_COLOR_BLOCK_HIT",
+     "CCU", "Cache and Compression Unit: color block hit", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_PARTIAL_BLOCK_READ, 0x3u, "CCU_PARTIAL_BLOCK_READ",
+     "CCU", "Cache and Compression Unit: partial block read", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_GMEM_READ, 0x3u, "CCU_GMEM_READ", "CCU",
+     "Cache and Compression Unit: gmem read", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_GMEM_WRITE, 0x3u, "CCU_GMEM_WRITE", "CCU",
+     "Cache and Compression Unit: gmem write", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_READ_FLAG0_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG0_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag0 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_READ_FLAG1_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG1_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag1 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_READ_FLAG2_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG2_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag2 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_READ_FLAG3_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG3_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag3 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_DEPTH_READ_FLAG4_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG4_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag4 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_READ_FLAG0_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG0_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag0 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_READ_FLAG1_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG1_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag1 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_READ_FLAG2_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG2_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag2 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_READ_FLAG3_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG3_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag3 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_COLOR_READ_FLAG4_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG4_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag4 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_2D_BUSY_CYCLES, 0x1u, "CCU_2D_BUSY_CYCLES", "CCU",
+     "Cache and Compression Unit: 2D busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CCU_2D_RD_REQ, 0x3u, "CCU_2D_RD_REQ", "CCU",
+     "Cache and Compression Unit: 2D RD req", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_2D_WR_REQ, 0x3u, "CCU_2D_WR_REQ", "CCU",
+     "Cache and Compression Unit: 2D WR req", "events"},
+    {HPC_GPU_ADRENO_A5XX_CCU_2D_REORDER_STARVE_CYCLES, 0x1u,
+     "CCU_2D_REORDER_STARVE_CYCLES", "CCU",
+     "Cache and Compression Unit: 2D reorder starve cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CCU_2D_PIXELS, 0x1u, "CCU_2D_PIXELS", "CCU",
+     "Cache and Compression Unit: 2D pixels", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_BUSY_CYCLES, 0x3u, "LRZ_BUSY_CYCLES", "LRZ",
+     "Low Resolution Z: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_STARVE_CYCLES_RAS, 0x3u, "LRZ_STARVE_CYCLES_RAS",
+     "LRZ", "Low Resolution Z: starve cycles RAS", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_STALL_CYCLES_RB, 0x3u, "LRZ_STALL_CYCLES_RB",
+     "LRZ", "Low Resolution Z: stall cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_STALL_CYCLES_VSC, 0x3u, "LRZ_STALL_CYCLES_VSC",
+     "LRZ", "Low Resolution Z: stall cycles VSC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_STALL_CYCLES_VPC, 0x3u, "LRZ_STALL_CYCLES_VPC",
+     "LRZ", "Low Resolution Z: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_STALL_CYCLES_FLAG_PREFETCH, 0x3u,
+     "LRZ_STALL_CYCLES_FLAG_PREFETCH", "LRZ",
+     "Low Resolution Z: stall cycles flag prefetch", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_STALL_CYCLES_UCHE, 0x3u, "LRZ_STALL_CYCLES_UCHE",
+     "LRZ", "Low Resolution Z: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_LRZ_READ, 0x3u, "LRZ_LRZ_READ", "LRZ",
+     "Low Resolution Z: LRZ read", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_LRZ_WRITE, 0x3u, "LRZ_LRZ_WRITE", "LRZ",
+     "Low Resolution Z: LRZ write", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_READ_LATENCY, 0x3u, "LRZ_READ_LATENCY", "LRZ",
+     "Low Resolution Z: read latency", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_MERGE_CACHE_UPDATING, 0x3u,
+     "LRZ_MERGE_CACHE_UPDATING", "LRZ",
+     "Low Resolution Z: merge cache updating", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_PRIM_KILLED_BY_MASKGEN, 0x3u,
+     "LRZ_PRIM_KILLED_BY_MASKGEN", "LRZ",
+     "Low Resolution Z: prim killed BY maskgen", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_PRIM_KILLED_BY_LRZ, 0x3u, "LRZ_PRIM_KILLED_BY_LRZ",
+     "LRZ", "Low Resolution Z: prim killed BY LRZ", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_VISIBLE_PRIM_AFTER_LRZ, 0x3u,
+     "LRZ_VISIBLE_PRIM_AFTER_LRZ", "LRZ",
+     "Low Resolution Z: visible prim after LRZ", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_FULL_8X8_TILES, 0x3u, "LRZ_FULL_8X8_TILES", "LRZ",
+     "Low Resolution Z: full 8x8 tiles", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_PARTIAL_8X8_TILES, 0x3u, "LRZ_PARTIAL_8X8_TILES",
+     "LRZ", "Low Resolution Z: partial 8x8 tiles", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_TILE_KILLED, 0x3u, "LRZ_TILE_KILLED", "LRZ",
+     "Low Resolution Z: tile killed", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_TOTAL_PIXEL, 0x3u, "LRZ_TOTAL_PIXEL", "LRZ",
+     "Low Resolution Z: total pixel", "events"},
+    {HPC_GPU_ADRENO_A5XX_LRZ_VISIBLE_PIXEL_AFTER_LRZ, 0x3u,
+     "LRZ_VISIBLE_PIXEL_AFTER_LRZ", "LRZ",
+     "Low Resolution Z: visible pixel after LRZ", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_STALL_CYCLES_VBIF, 0x1u,
+     "CMP_CMPDECMP_STALL_CYCLES_VBIF", "CMP", "CMP: cmpdecmp stall cycles VBIF",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_LATENCY_CYCLES, 0x3u,
+     "CMP_CMPDECMP_VBIF_LATENCY_CYCLES", "CMP",
+     "CMP: cmpdecmp VBIF latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_LATENCY_SAMPLES, 0x3u,
+     "CMP_CMPDECMP_VBIF_LATENCY_SAMPLES", "CMP",
+     "CMP: cmpdecmp VBIF latency samples", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_READ_DATA_CCU, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_DATA_CCU", "CMP",
+     "CMP: cmpdecmp VBIF read data CCU", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_WRITE_DATA_CCU, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA_CCU", "CMP",
+     "CMP: cmpdecmp VBIF write data CCU", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_READ_REQUEST, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_REQUEST", "CMP", "CMP: cmpdecmp VBIF read request",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_WRITE_REQUEST, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_REQUEST", "CMP",
+     "CMP: cmpdecmp VBIF write request", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_READ_DATA, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_DATA", "CMP", "CMP: cmpdecmp VBIF read data",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_VBIF_WRITE_DATA, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA", "CMP", "CMP: cmpdecmp VBIF write data",
+     "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_FLAG_FETCH_CYCLES, 0x3u,
+     "CMP_CMPDECMP_FLAG_FETCH_CYCLES", "CMP", "CMP: cmpdecmp flag fetch cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_FLAG_FETCH_SAMPLES, 0x3u,
+     "CMP_CMPDECMP_FLAG_FETCH_SAMPLES", "CMP",
+     "CMP: cmpdecmp flag fetch samples", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag1 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag2 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag3 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag4 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag1 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag2 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag3 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag4 count", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ", "CMP",
+     "CMP: cmpdecmp 2D stall cycles VBIF req", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR", "CMP",
+     "CMP: cmpdecmp 2D stall cycles VBIF WR", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN", "CMP",
+     "CMP: cmpdecmp 2D stall cycles VBIF return", "cycles"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_2D_RD_DATA, 0x3u,
+     "CMP_CMPDECMP_2D_RD_DATA", "CMP", "CMP: cmpdecmp 2D RD data", "events"},
+    {HPC_GPU_ADRENO_A5XX_CMP_CMPDECMP_2D_WR_DATA, 0x3u,
+     "CMP_CMPDECMP_2D_WR_DATA", "CMP", "CMP: cmpdecmp 2D WR data", "events"},
+    // clang-format on
+};
+
+/// The displacement of each perfect hash bucket.
+static const uint16_t adreno_a5xx_counter_displacements[126] = {
+    96, 11, 1, 13, 70, 7, 46, 17, 137, 83, 43, 31, 126, 33, 89, 43, 11, 21, 207,
+    4, 27, 1, 99, 17, 15, 33, 4, 9, 9, 10, 91, 43, 160, 7, 3, 2, 246, 43, 17,
+    87, 2, 0, 94, 62, 323, 17, 430, 230, 28, 10, 49, 0, 1, 31, 206, 31, 41, 13,
+    122, 6, 3, 0, 77, 32, 78, 101, 23, 159, 0, 20, 108, 217, 14, 204, 25, 138,
+    0, 37, 19, 0, 257, 6, 3, 120, 357, 589, 0, 103, 3, 16, 154, 29, 133, 15, 12,
+    692, 37, 363, 36, 3, 1, 96, 79, 125, 2, 0, 125, 8, 484, 25, 4, 678, 88, 612,
+    39, 6, 453, 334, 0, 357, 169, 210, 7, 35, 2, 1556,
+};
+
+/// The metadata index of each perfect hash slot.
+static const uint16_t adreno_a5xx_counter_slots[501] = {
+    307, 27, 57, 55, 396, 294, 137, 443, 80, 230, 215, 152, 226, 67, 390, 104,
+    268, 156, 464, 13, 97, 202, 245, 169, 486, 70, 41, 44, 39, 188, 52, 196, 37,
+    260, 434, 170, 466, 374, 46, 25, 50, 401, 494, 402, 477, 393, 119, 355, 435,
+    340, 361, 478, 302, 409, 163, 11, 274, 135, 459, 442, 102, 200, 180, 98,
+    490, 75, 360, 411, 240, 40, 42, 283, 303, 204, 65, 341, 192, 347, 394, 86,
+    308, 389, 298, 474, 416, 81, 408, 384, 267, 290, 467, 143, 222, 432, 258,
+    103, 300, 238, 26, 410, 136, 441, 183, 208, 140, 87, 62, 129, 358, 319, 181,
+    472, 375, 146, 229, 20, 367, 272, 440, 154, 186, 207, 392, 499, 243, 218,
+    177, 115, 182, 391, 117, 109, 451, 287, 164, 193, 371, 305, 63, 356, 212,
+    61, 473, 325, 425, 454, 299, 280, 73, 253, 178, 112, 449, 462, 224, 427,
+    476, 383, 241, 263, 337, 79, 333, 281, 36, 45, 291, 210, 351, 406, 190, 189,
+    399, 176, 500, 58, 144, 14, 338, 271, 28, 191, 5, 221, 346, 32, 195, 23,
+    113, 257, 1, 269, 64, 219, 237, 468, 139, 423, 403, 420, 225, 213, 495, 278,
+    173, 465, 232, 185, 458, 345, 120, 256, 179, 400, 405, 101, 158, 496, 111,
+    428, 197, 231, 118, 377, 431, 312, 395, 47, 114, 100, 311, 296, 88, 404,
+    165, 379, 388, 201, 84, 125, 445, 323, 10, 484, 147, 373, 209, 262, 314,
+    194, 331, 362, 141, 59, 8, 24, 492, 407, 252, 292, 357, 348, 497, 142, 301,
+    149, 330, 93, 246, 288, 491, 270, 460, 22, 228, 321, 29, 148, 121, 83, 421,
+    30, 96, 339, 424, 364, 216, 110, 4, 250, 463, 455, 433, 487, 155, 199, 438,
+    381, 38, 313, 456, 124, 422, 223, 370, 162, 470, 310, 7, 95, 90, 386, 211,
+    249, 365, 174, 376, 214, 419, 157, 398, 172, 9, 315, 448, 304, 203, 417,
+    123, 378, 205, 369, 430, 306, 493, 366, 335, 33, 3, 89, 498, 482, 77, 452,
+    363, 145, 387, 327, 68, 317, 359, 130, 414, 187, 380, 382, 277, 426, 342,
+    471, 457, 18, 276, 168, 279, 297, 326, 15, 254, 344, 255, 16, 309, 316, 248,
+    242, 175, 150, 244, 12, 133, 436, 284, 261, 166, 35, 131, 336, 479, 106,
+    368, 332, 66, 19, 354, 85, 275, 483, 318, 415, 0, 160, 233, 264, 51, 329,
+    43, 91, 289, 31, 159, 273, 480, 453, 161, 488, 251, 343, 53, 447, 412, 126,
+    220, 413, 286, 105, 49, 128, 6, 48, 450, 217, 153, 134, 265, 385, 247, 69,
+    328, 72, 444, 266, 239, 397, 56, 481, 116, 76, 132, 108, 82, 429, 71, 372,
+    184, 167, 324, 21, 92, 282, 99, 418, 489, 78, 236, 127, 350, 469, 151, 171,
+    107, 285, 334, 461, 198, 138, 293, 437, 352, 322, 60, 206, 295, 17, 353,
+    235, 349, 74, 475, 439, 54, 485, 94, 227, 320, 259, 446, 234, 122, 2, 34,
+};
+
+static const hpc_gpu_counter_registry_t adreno_a5xx_counter_registry = {
+    501,
+    adreno_a5xx_counter_infos,
+    2,
+    adreno_a5xx_series_names,
+    126,
+    adreno_a5xx_counter_displacements,
+    adreno_a5xx_counter_slots,
+};
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+const hpc_gpu_counter_registry_t *hpc_gpu_adreno_a5xx_get_counter_registry(
+    void) {
+  return &adreno_a5xx_counter_registry;
+}
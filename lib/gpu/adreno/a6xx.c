@@ -21,7 +21,9 @@
 #include <unistd.h>
 
 #include "context.h"
+#include "group_capacities.h"
 #include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/pass_planner.h"
 
 //===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
 
@@ -37,37 +39,98 @@ static inline uint32_t adreno_a6xx_counter_get_selector(
 
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
 
+/// Returns 0 if the current GPU is an A6XX one, or the error code otherwise.
+static int adreno_a6xx_check_series(const hpc_gpu_adreno_context_t *context) {
+  switch (hpc_gpu_adreno_get_series(context->gpu_id)) {
+    case HPC_GPU_ADRENO_SERIES_UNKNOWN:
+      return -HPC_GPU_ERROR_UNKNOWN_DEVICE;
+    case HPC_GPU_ADRENO_SERIES_A6XX:
+      return 0;
+    case HPC_GPU_ADRENO_SERIES_A5XX:
+      return -HPC_GPU_ERROR_INCOMPATIBLE_DEVICE;
+  }
+  return -HPC_GPU_ERROR_UNKNOWN_DEVICE;
+}
+
+/// Decodes counters into their groups and selectors for the current GPU and
+/// reserves them.
+static int adreno_a6xx_setup_context(
+    hpc_gpu_adreno_context_t *context, uint32_t num_counters,
+    const hpc_gpu_adreno_a6xx_counter_t *counters) {
+  int status = adreno_a6xx_check_series(context);
+  if (status < 0) return status;
+
+  for (int i = 0; i < num_counters; ++i) {
+    context->counters[i].group_id = adreno_a6xx_counter_get_group(counters[i]);
+    context->counters[i].countable_selector =
+        adreno_a6xx_counter_get_selector(counters[i]);
+  }
+
+  hpc_gpu_adreno_context_reserve_counters(context);
+  return 0;
+}
+
+/// Fills in counters already decoded into their groups and selectors for the
+/// current GPU and reserves them.
+static int adreno_a6xx_setup_decoded_context(
+    hpc_gpu_adreno_context_t *context, uint32_t num_counters,
+    const uint32_t *group_ids, const uint32_t *selectors) {
+  int status = adreno_a6xx_check_series(context);
+  if (status < 0) return status;
+
+  for (int i = 0; i < num_counters; ++i) {
+    context->counters[i].group_id = group_ids[i];
+    context->counters[i].countable_selector = selectors[i];
+  }
+
+  hpc_gpu_adreno_context_reserve_counters(context);
+  return 0;
+}
+
 int hpc_gpu_adreno_a6xx_create_context(
     uint32_t num_counters, hpc_gpu_adreno_a6xx_counter_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode,
     const hpc_gpu_host_allocation_callbacks_t *allocator,
     hpc_gpu_adreno_context_t **out_context) {
-  int status = hpc_gpu_adreno_create_context(num_counters, counters, allocator,
+  int status = hpc_gpu_adreno_create_context(num_counters, counters,
+                                             output_mode, allocator,
                                              out_context);
   if (status < 0) return status;
+  status = adreno_a6xx_setup_context(*out_context, num_counters, counters);
+  if (status < 0) hpc_gpu_adreno_destroy_context(*out_context, allocator);
+  return status;
+}
 
-  hpc_gpu_adreno_context_t *context = *out_context;
-  int gpu_device = context->gpu_device;
-  hpc_gpu_adreno_series_t series = hpc_gpu_adreno_get_series(context->gpu_id);
+int hpc_gpu_adreno_a6xx_create_decoded_context(
+    uint32_t num_counters, const uint32_t *group_ids, const uint32_t *selectors,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context) {
+  int status = hpc_gpu_adreno_create_context(num_counters, NULL, output_mode,
+                                             allocator, out_context);
+  if (status < 0) return status;
+  status = adreno_a6xx_setup_decoded_context(*out_context, num_counters,
+                                                 group_ids, selectors);
+  if (status < 0) hpc_gpu_adreno_destroy_context(*out_context, allocator);
+  return status;
+}
 
-  switch (series) {
-    case HPC_GPU_ADRENO_SERIES_UNKNOWN:
-      return -HPC_GPU_ERROR_UNKNOWN_DEVICE;
-    case HPC_GPU_ADRENO_SERIES_A6XX:
-      for (int i = 0; i < num_counters; ++i) {
-        uint32_t group_id = adreno_a6xx_counter_get_group(counters[i]);
-        uint32_t countable_selector =
-            adreno_a6xx_counter_get_selector(counters[i]);
-        context->counters[i].group_id = group_id;
-        context->counters[i].countable_selector = countable_selector;
-        hpc_gpu_adreno_ioctl_activate_counter(gpu_device, group_id,
-                                              countable_selector);
-      }
-      break;
-    case HPC_GPU_ADRENO_SERIES_A5XX:
-      return -HPC_GPU_ERROR_INCOMPATIBLE_DEVICE;
-  }
+void hpc_gpu_adreno_a6xx_get_context_memory_requirements(
+    uint32_t num_counters, size_t *size, size_t *alignment) {
+  hpc_gpu_adreno_get_context_memory_requirements(num_counters, size,
+                                                 alignment);
+}
 
-  return 0;
+int hpc_gpu_adreno_a6xx_create_context_in_memory(
+    uint32_t num_counters, hpc_gpu_adreno_a6xx_counter_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode, void *memory,
+    hpc_gpu_adreno_context_t **out_context) {
+  int status = hpc_gpu_adreno_create_context_in_memory(
+      num_counters, counters, output_mode, memory, out_context);
+  if (status < 0) return status;
+  status = adreno_a6xx_setup_context(*out_context, num_counters, counters);
+  if (status < 0) hpc_gpu_adreno_destroy_context_in_memory(*out_context);
+  return status;
 }
 
 int hpc_gpu_adreno_a6xx_destroy_context(
@@ -76,11 +139,21 @@ int hpc_gpu_adreno_a6xx_destroy_context(
   return hpc_gpu_adreno_destroy_context(context, allocator);
 }
 
-int hpc_gpu_adreno_a6xx_start_counters(
-    const hpc_gpu_adreno_context_t *context) {
+int hpc_gpu_adreno_a6xx_destroy_context_in_memory(
+    hpc_gpu_adreno_context_t *context) {
+  return hpc_gpu_adreno_destroy_context_in_memory(context);
+}
+
+int hpc_gpu_adreno_a6xx_start_counters(hpc_gpu_adreno_context_t *context) {
   return hpc_gpu_adreno_context_start_counters(context);
 }
 
+int hpc_gpu_adreno_a6xx_start_counters_multiplexed(
+    hpc_gpu_adreno_context_t *context, uint64_t rotation_period_ns) {
+  return hpc_gpu_adreno_context_start_counters_multiplexed(context,
+                                                           rotation_period_ns);
+}
+
 int hpc_gpu_adreno_a6xx_stop_counters(const hpc_gpu_adreno_context_t *context) {
   return hpc_gpu_adreno_context_stop_counters(context);
 }
@@ -89,3 +162,32 @@ int hpc_gpu_adreno_a6xx_query_counters(hpc_gpu_adreno_context_t *context,
                                        uint64_t *values) {
   return hpc_gpu_adreno_context_query_counters(context, values);
 }
+
+int hpc_gpu_adreno_a6xx_query_counters_with_times(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  return hpc_gpu_adreno_context_query_counters_with_times(context, values,
+                                                          times);
+}
+
+int hpc_gpu_adreno_a6xx_get_multiplexing_times(
+    const hpc_gpu_adreno_context_t *context, uint64_t *time_enabled_ns,
+    uint64_t *time_running_ns) {
+  return hpc_gpu_adreno_context_get_multiplexing_times(
+      context, time_enabled_ns, time_running_ns);
+}
+
+int hpc_gpu_adreno_a6xx_plan_passes(
+    uint32_t num_counters, const hpc_gpu_adreno_a6xx_counter_t *counters,
+    const uint32_t *counter_sets,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    uint32_t *counter_passes, uint32_t *num_passes) {
+  hpc_gpu_pass_plan_info_t plan_info;
+  plan_info.num_counters = num_counters;
+  plan_info.counters = (const uint32_t *)counters;
+  plan_info.counter_sets = counter_sets;
+  plan_info.num_groups = HPC_GPU_ADRENO_A6XX_NUM_GROUPS;
+  plan_info.group_capacities = hpc_gpu_adreno_a6xx_group_capacities;
+  return hpc_gpu_plan_passes(&plan_info, allocator, counter_passes,
+                             num_passes);
+}
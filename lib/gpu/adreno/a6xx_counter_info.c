@@ -0,0 +1,1399 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/adreno/a6xx.h"
+
+#include <stdint.h>
+
+#include "hpc/gpu/counter_info.h"
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The series that availability bits refer to.
+static const char *const adreno_a6xx_series_names[2] = {
+    "a5xx", "a6xx",
+};
+
+/// Metadata of all counters, in enum order.
+static const hpc_gpu_counter_info_t adreno_a6xx_counter_infos[543] = {
+    // clang-format off
+    {HPC_GPU_ADRENO_A6XX_CP_ALWAYS_COUNT, 0x3u, "CP_ALWAYS_COUNT", "CP",
+     "Command Parser: always count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_BUSY_GFX_CORE_IDLE, 0x3u, "CP_BUSY_GFX_CORE_IDLE",
+     "CP", "Command Parser: busy gfx core idle", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_BUSY_CYCLES, 0x3u, "CP_BUSY_CYCLES", "CP",
+     "Command Parser: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_NUM_PREEMPTIONS, 0x3u, "CP_NUM_PREEMPTIONS", "CP",
+     "Command Parser: num preemptions", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_PREEMPTION_REACTION_DELAY, 0x3u,
+     "CP_PREEMPTION_REACTION_DELAY", "CP",
+     "Command Parser: preemption reaction delay", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_PREEMPTION_SWITCH_OUT_TIME, 0x3u,
+     "CP_PREEMPTION_SWITCH_OUT_TIME", "CP",
+     "Command Parser: preemption switch out time", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_PREEMPTION_SWITCH_IN_TIME, 0x3u,
+     "CP_PREEMPTION_SWITCH_IN_TIME", "CP",
+     "Command Parser: preemption switch IN time", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_DEAD_DRAWS_IN_BIN_RENDER, 0x3u,
+     "CP_DEAD_DRAWS_IN_BIN_RENDER", "CP",
+     "Command Parser: dead draws IN bin render", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_PREDICATED_DRAWS_KILLED, 0x3u,
+     "CP_PREDICATED_DRAWS_KILLED", "CP",
+     "Command Parser: predicated draws killed", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_MODE_SWITCH, 0x3u, "CP_MODE_SWITCH", "CP",
+     "Command Parser: mode switch", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_ZPASS_DONE, 0x3u, "CP_ZPASS_DONE", "CP",
+     "Command Parser: zpass done", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CONTEXT_DONE, 0x3u, "CP_CONTEXT_DONE", "CP",
+     "Command Parser: context done", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CACHE_FLUSH, 0x3u, "CP_CACHE_FLUSH", "CP",
+     "Command Parser: cache flush", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_LONG_PREEMPTIONS, 0x3u, "CP_LONG_PREEMPTIONS", "CP",
+     "Command Parser: long preemptions", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_I_CACHE_STARVE, 0x2u, "CP_SQE_I_CACHE_STARVE",
+     "CP", "Command Parser: sqe I cache starve", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_IDLE, 0x2u, "CP_SQE_IDLE", "CP",
+     "Command Parser: sqe idle", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_PM4_STARVE_RB_IB, 0x2u,
+     "CP_SQE_PM4_STARVE_RB_IB", "CP", "Command Parser: sqe pm4 starve RB IB",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_PM4_STARVE_SDS, 0x2u, "CP_SQE_PM4_STARVE_SDS",
+     "CP", "Command Parser: sqe pm4 starve sds", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_MRB_STARVE, 0x2u, "CP_SQE_MRB_STARVE", "CP",
+     "Command Parser: sqe mrb starve", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_RRB_STARVE, 0x2u, "CP_SQE_RRB_STARVE", "CP",
+     "Command Parser: sqe rrb starve", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_VSD_STARVE, 0x2u, "CP_SQE_VSD_STARVE", "CP",
+     "Command Parser: sqe vsd starve", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_VSD_DECODE_STARVE, 0x2u, "CP_VSD_DECODE_STARVE",
+     "CP", "Command Parser: vsd decode starve", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_PIPE_OUT_STALL, 0x2u, "CP_SQE_PIPE_OUT_STALL",
+     "CP", "Command Parser: sqe pipe out stall", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_SYNC_STALL, 0x2u, "CP_SQE_SYNC_STALL", "CP",
+     "Command Parser: sqe sync stall", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_PM4_WFI_STALL, 0x2u, "CP_SQE_PM4_WFI_STALL",
+     "CP", "Command Parser: sqe pm4 wfi stall", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_SYS_WFI_STALL, 0x2u, "CP_SQE_SYS_WFI_STALL",
+     "CP", "Command Parser: sqe sys wfi stall", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_T4_EXEC, 0x2u, "CP_SQE_T4_EXEC", "CP",
+     "Command Parser: sqe T4 exec", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_LOAD_STATE_EXEC, 0x2u, "CP_SQE_LOAD_STATE_EXEC",
+     "CP", "Command Parser: sqe load state exec", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_SAVE_SDS_STATE, 0x2u, "CP_SQE_SAVE_SDS_STATE",
+     "CP", "Command Parser: sqe save sds state", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_DRAW_EXEC, 0x2u, "CP_SQE_DRAW_EXEC", "CP",
+     "Command Parser: sqe draw exec", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_CTXT_REG_BUNCH_EXEC, 0x2u,
+     "CP_SQE_CTXT_REG_BUNCH_EXEC", "CP",
+     "Command Parser: sqe ctxt reg bunch exec", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_EXEC_PROFILED, 0x2u, "CP_SQE_EXEC_PROFILED",
+     "CP", "Command Parser: sqe exec profiled", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_MEMORY_POOL_EMPTY, 0x2u, "CP_MEMORY_POOL_EMPTY",
+     "CP", "Command Parser: memory pool empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_MEMORY_POOL_SYNC_STALL, 0x2u,
+     "CP_MEMORY_POOL_SYNC_STALL", "CP",
+     "Command Parser: memory pool sync stall", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_MEMORY_POOL_ABOVE_THRESH, 0x2u,
+     "CP_MEMORY_POOL_ABOVE_THRESH", "CP",
+     "Command Parser: memory pool above thresh", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_AHB_WR_STALL_PRE_DRAWS, 0x2u,
+     "CP_AHB_WR_STALL_PRE_DRAWS", "CP",
+     "Command Parser: ahb WR stall pre draws", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_AHB_STALL_SQE_GMU, 0x2u, "CP_AHB_STALL_SQE_GMU",
+     "CP", "Command Parser: ahb stall sqe gmu", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_AHB_STALL_SQE_WR_OTHER, 0x2u,
+     "CP_AHB_STALL_SQE_WR_OTHER", "CP",
+     "Command Parser: ahb stall sqe WR other", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_AHB_STALL_SQE_RD_OTHER, 0x2u,
+     "CP_AHB_STALL_SQE_RD_OTHER", "CP",
+     "Command Parser: ahb stall sqe RD other", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CP_CLUSTER0_EMPTY, 0x2u, "CP_CLUSTER0_EMPTY", "CP",
+     "Command Parser: cluster0 empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CLUSTER1_EMPTY, 0x2u, "CP_CLUSTER1_EMPTY", "CP",
+     "Command Parser: cluster1 empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CLUSTER2_EMPTY, 0x2u, "CP_CLUSTER2_EMPTY", "CP",
+     "Command Parser: cluster2 empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CLUSTER3_EMPTY, 0x2u, "CP_CLUSTER3_EMPTY", "CP",
+     "Command Parser: cluster3 empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CLUSTER4_EMPTY, 0x2u, "CP_CLUSTER4_EMPTY", "CP",
+     "Command Parser: cluster4 empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_CLUSTER5_EMPTY, 0x2u, "CP_CLUSTER5_EMPTY", "CP",
+     "Command Parser: cluster5 empty", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_PM4_DATA, 0x2u, "CP_PM4_DATA", "CP",
+     "Command Parser: pm4 data", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_PM4_HEADERS, 0x2u, "CP_PM4_HEADERS", "CP",
+     "Command Parser: pm4 headers", "events"},
+    {HPC_GPU_ADRENO_A6XX_CP_VBIF_READ_BEATS, 0x2u, "CP_VBIF_READ_BEATS", "CP",
+     "Command Parser: vbif read beats", "beats"},
+    {HPC_GPU_ADRENO_A6XX_CP_VBIF_WRITE_BEATS, 0x2u, "CP_VBIF_WRITE_BEATS", "CP",
+     "Command Parser: vbif write beats", "beats"},
+    {HPC_GPU_ADRENO_A6XX_CP_SQE_INSTR_COUNTER, 0x2u, "CP_SQE_INSTR_COUNTER",
+     "CP", "Command Parser: sqe instr counter", "events"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_ALWAYS_COUNT, 0x3u, "RBBM_ALWAYS_COUNT", "RBBM",
+     "RBBM: always count", "events"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_ALWAYS_ON, 0x3u, "RBBM_ALWAYS_ON", "RBBM",
+     "RBBM: always ON", "events"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_TSE_BUSY, 0x3u, "RBBM_TSE_BUSY", "RBBM",
+     "RBBM: TSE busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_RAS_BUSY, 0x3u, "RBBM_RAS_BUSY", "RBBM",
+     "RBBM: RAS busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_PC_DCALL_BUSY, 0x3u, "RBBM_PC_DCALL_BUSY", "RBBM",
+     "RBBM: PC dcall busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_PC_VSD_BUSY, 0x3u, "RBBM_PC_VSD_BUSY", "RBBM",
+     "RBBM: PC vsd busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_STATUS_MASKED, 0x3u, "RBBM_STATUS_MASKED", "RBBM",
+     "RBBM: status masked", "events"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_COM_BUSY, 0x3u, "RBBM_COM_BUSY", "RBBM",
+     "RBBM: com busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_DCOM_BUSY, 0x3u, "RBBM_DCOM_BUSY", "RBBM",
+     "RBBM: dcom busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_VBIF_BUSY, 0x3u, "RBBM_VBIF_BUSY", "RBBM",
+     "RBBM: vbif busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_VSC_BUSY, 0x3u, "RBBM_VSC_BUSY", "RBBM",
+     "RBBM: VSC busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_TESS_BUSY, 0x3u, "RBBM_TESS_BUSY", "RBBM",
+     "RBBM: tess busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_UCHE_BUSY, 0x3u, "RBBM_UCHE_BUSY", "RBBM",
+     "RBBM: UCHE busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RBBM_HLSQ_BUSY, 0x3u, "RBBM_HLSQ_BUSY", "RBBM",
+     "RBBM: HLSQ busy", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_BUSY_CYCLES, 0x3u, "PC_BUSY_CYCLES", "PC",
+     "PC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_WORKING_CYCLES, 0x3u, "PC_WORKING_CYCLES", "PC",
+     "PC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_VFD, 0x3u, "PC_STALL_CYCLES_VFD", "PC",
+     "PC: stall cycles VFD", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_TSE, 0x3u, "PC_STALL_CYCLES_TSE", "PC",
+     "PC: stall cycles TSE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_VPC, 0x3u, "PC_STALL_CYCLES_VPC", "PC",
+     "PC: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_UCHE, 0x3u, "PC_STALL_CYCLES_UCHE",
+     "PC", "PC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_TESS, 0x3u, "PC_STALL_CYCLES_TESS",
+     "PC", "PC: stall cycles tess", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_TSE_ONLY, 0x3u,
+     "PC_STALL_CYCLES_TSE_ONLY", "PC", "PC: stall cycles TSE only", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STALL_CYCLES_VPC_ONLY, 0x3u,
+     "PC_STALL_CYCLES_VPC_ONLY", "PC", "PC: stall cycles VPC only", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_PASS1_TF_STALL_CYCLES, 0x3u,
+     "PC_PASS1_TF_STALL_CYCLES", "PC", "PC: pass1 TF stall cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STARVE_CYCLES_FOR_INDEX, 0x3u,
+     "PC_STARVE_CYCLES_FOR_INDEX", "PC", "PC: starve cycles for index",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STARVE_CYCLES_FOR_TESS_FACTOR, 0x3u,
+     "PC_STARVE_CYCLES_FOR_TESS_FACTOR", "PC",
+     "PC: starve cycles for tess factor", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STARVE_CYCLES_FOR_VIZ_STREAM, 0x3u,
+     "PC_STARVE_CYCLES_FOR_VIZ_STREAM", "PC",
+     "PC: starve cycles for viz stream", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STARVE_CYCLES_FOR_POSITION, 0x3u,
+     "PC_STARVE_CYCLES_FOR_POSITION", "PC", "PC: starve cycles for position",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_STARVE_CYCLES_DI, 0x3u, "PC_STARVE_CYCLES_DI", "PC",
+     "PC: starve cycles DI", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_VIS_STREAMS_LOADED, 0x3u, "PC_VIS_STREAMS_LOADED",
+     "PC", "PC: vis streams loaded", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_INSTANCES, 0x3u, "PC_INSTANCES", "PC",
+     "PC: instances", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_VPC_PRIMITIVES, 0x3u, "PC_VPC_PRIMITIVES", "PC",
+     "PC: VPC primitives", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_DEAD_PRIM, 0x3u, "PC_DEAD_PRIM", "PC",
+     "PC: dead prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_LIVE_PRIM, 0x3u, "PC_LIVE_PRIM", "PC",
+     "PC: live prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_VERTEX_HITS, 0x3u, "PC_VERTEX_HITS", "PC",
+     "PC: vertex hits", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_IA_VERTICES, 0x3u, "PC_IA_VERTICES", "PC",
+     "PC: IA vertices", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_IA_PRIMITIVES, 0x3u, "PC_IA_PRIMITIVES", "PC",
+     "PC: IA primitives", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_GS_PRIMITIVES, 0x3u, "PC_GS_PRIMITIVES", "PC",
+     "PC: GS primitives", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_HS_INVOCATIONS, 0x3u, "PC_HS_INVOCATIONS", "PC",
+     "PC: HS invocations", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_DS_INVOCATIONS, 0x3u, "PC_DS_INVOCATIONS", "PC",
+     "PC: DS invocations", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_VS_INVOCATIONS, 0x3u, "PC_VS_INVOCATIONS", "PC",
+     "PC: VS invocations", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_GS_INVOCATIONS, 0x3u, "PC_GS_INVOCATIONS", "PC",
+     "PC: GS invocations", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_DS_PRIMITIVES, 0x3u, "PC_DS_PRIMITIVES", "PC",
+     "PC: DS primitives", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_VPC_POS_DATA_TRANSACTION, 0x3u,
+     "PC_VPC_POS_DATA_TRANSACTION", "PC", "PC: VPC pos data transaction",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_3D_DRAWCALLS, 0x3u, "PC_3D_DRAWCALLS", "PC",
+     "PC: 3D drawcalls", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_2D_DRAWCALLS, 0x3u, "PC_2D_DRAWCALLS", "PC",
+     "PC: 2D drawcalls", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_NON_DRAWCALL_GLOBAL_EVENTS, 0x3u,
+     "PC_NON_DRAWCALL_GLOBAL_EVENTS", "PC", "PC: non drawcall global events",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_BUSY_CYCLES, 0x3u, "PC_TESS_BUSY_CYCLES", "PC",
+     "PC: tess busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_WORKING_CYCLES, 0x3u, "PC_TESS_WORKING_CYCLES",
+     "PC", "PC: tess working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_STALL_CYCLES_PC, 0x3u,
+     "PC_TESS_STALL_CYCLES_PC", "PC", "PC: tess stall cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_STARVE_CYCLES_PC, 0x3u,
+     "PC_TESS_STARVE_CYCLES_PC", "PC", "PC: tess starve cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_PC_TSE_TRANSACTION, 0x2u, "PC_TSE_TRANSACTION", "PC",
+     "PC: TSE transaction", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_TSE_VERTEX, 0x2u, "PC_TSE_VERTEX", "PC",
+     "PC: TSE vertex", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_PC_UV_TRANS, 0x2u, "PC_TESS_PC_UV_TRANS", "PC",
+     "PC: tess PC UV trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_PC_UV_PATCHES, 0x2u, "PC_TESS_PC_UV_PATCHES",
+     "PC", "PC: tess PC UV patches", "events"},
+    {HPC_GPU_ADRENO_A6XX_PC_TESS_FACTOR_TRANS, 0x2u, "PC_TESS_FACTOR_TRANS",
+     "PC", "PC: tess factor trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_BUSY_CYCLES, 0x3u, "VFD_BUSY_CYCLES", "VFD",
+     "VFD: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_STALL_CYCLES_UCHE, 0x3u, "VFD_STALL_CYCLES_UCHE",
+     "VFD", "VFD: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_STALL_CYCLES_VPC_ALLOC, 0x3u,
+     "VFD_STALL_CYCLES_VPC_ALLOC", "VFD", "VFD: stall cycles VPC alloc",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_STALL_CYCLES_SP_INFO, 0x3u,
+     "VFD_STALL_CYCLES_SP_INFO", "VFD", "VFD: stall cycles SP info", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_STALL_CYCLES_SP_ATTR, 0x3u,
+     "VFD_STALL_CYCLES_SP_ATTR", "VFD", "VFD: stall cycles SP attr", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_STARVE_CYCLES_UCHE, 0x3u, "VFD_STARVE_CYCLES_UCHE",
+     "VFD", "VFD: starve cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_RBUFFER_FULL, 0x3u, "VFD_RBUFFER_FULL", "VFD",
+     "VFD: rbuffer full", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_ATTR_INFO_FIFO_FULL, 0x3u,
+     "VFD_ATTR_INFO_FIFO_FULL", "VFD", "VFD: attr info fifo full", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_DECODED_ATTRIBUTE_BYTES, 0x3u,
+     "VFD_DECODED_ATTRIBUTE_BYTES", "VFD", "VFD: decoded attribute bytes",
+     "bytes"},
+    {HPC_GPU_ADRENO_A6XX_VFD_NUM_ATTRIBUTES, 0x3u, "VFD_NUM_ATTRIBUTES", "VFD",
+     "VFD: num attributes", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_UPPER_SHADER_FIBERS, 0x3u,
+     "VFD_UPPER_SHADER_FIBERS", "VFD", "VFD: upper shader fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_LOWER_SHADER_FIBERS, 0x3u,
+     "VFD_LOWER_SHADER_FIBERS", "VFD", "VFD: lower shader fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_MODE_0_FIBERS, 0x3u, "VFD_MODE_0_FIBERS", "VFD",
+     "VFD: mode 0 fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_MODE_1_FIBERS, 0x3u, "VFD_MODE_1_FIBERS", "VFD",
+     "VFD: mode 1 fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_MODE_2_FIBERS, 0x3u, "VFD_MODE_2_FIBERS", "VFD",
+     "VFD: mode 2 fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_MODE_3_FIBERS, 0x3u, "VFD_MODE_3_FIBERS", "VFD",
+     "VFD: mode 3 fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_MODE_4_FIBERS, 0x3u, "VFD_MODE_4_FIBERS", "VFD",
+     "VFD: mode 4 fibers", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_TOTAL_VERTICES, 0x3u, "VFD_TOTAL_VERTICES", "VFD",
+     "VFD: total vertices", "events"},
+    {HPC_GPU_ADRENO_A6XX_VFD_VFDP_STALL_CYCLES_VFD, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD", "VFD", "VFD: vfdp stall cycles VFD",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_VFDP_STALL_CYCLES_VFD_INDEX, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD_INDEX", "VFD",
+     "VFD: vfdp stall cycles VFD index", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_VFDP_STALL_CYCLES_VFD_PROG, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD_PROG", "VFD", "VFD: vfdp stall cycles VFD prog",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_VFDP_STARVE_CYCLES_PC, 0x3u,
+     "VFD_VFDP_STARVE_CYCLES_PC", "VFD", "VFD: vfdp starve cycles PC",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VFD_VFDP_VS_STAGE_WAVES, 0x2u,
+     "VFD_VFDP_VS_STAGE_WAVES", "VFD", "VFD: vfdp VS stage waves", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_BUSY_CYCLES, 0x3u, "HLSQ_BUSY_CYCLES", "HLSQ",
+     "High Level SeQuencer: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_STALL_CYCLES_UCHE, 0x3u, "HLSQ_STALL_CYCLES_UCHE",
+     "HLSQ", "High Level SeQuencer: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_STALL_CYCLES_SP_STATE, 0x3u,
+     "HLSQ_STALL_CYCLES_SP_STATE", "HLSQ",
+     "High Level SeQuencer: stall cycles SP state", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_STALL_CYCLES_SP_FS_STAGE, 0x3u,
+     "HLSQ_STALL_CYCLES_SP_FS_STAGE", "HLSQ",
+     "High Level SeQuencer: stall cycles SP FS stage", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_UCHE_LATENCY_CYCLES, 0x3u,
+     "HLSQ_UCHE_LATENCY_CYCLES", "HLSQ",
+     "High Level SeQuencer: UCHE latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_UCHE_LATENCY_COUNT, 0x3u,
+     "HLSQ_UCHE_LATENCY_COUNT", "HLSQ",
+     "High Level SeQuencer: UCHE latency count", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_FS_STAGE_1X_WAVES, 0x2u, "HLSQ_FS_STAGE_1X_WAVES",
+     "HLSQ", "High Level SeQuencer: FS stage 1X waves", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_FS_STAGE_2X_WAVES, 0x2u, "HLSQ_FS_STAGE_2X_WAVES",
+     "HLSQ", "High Level SeQuencer: FS stage 2X waves", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_QUADS, 0x3u, "HLSQ_QUADS", "HLSQ",
+     "High Level SeQuencer: quads", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_CS_INVOCATIONS, 0x3u, "HLSQ_CS_INVOCATIONS",
+     "HLSQ", "High Level SeQuencer: CS invocations", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_COMPUTE_DRAWCALLS, 0x3u, "HLSQ_COMPUTE_DRAWCALLS",
+     "HLSQ", "High Level SeQuencer: compute drawcalls", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_FS_DATA_WAIT_PROGRAMMING, 0x2u,
+     "HLSQ_FS_DATA_WAIT_PROGRAMMING", "HLSQ",
+     "High Level SeQuencer: FS data wait programming", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_DUAL_FS_PROG_ACTIVE, 0x2u,
+     "HLSQ_DUAL_FS_PROG_ACTIVE", "HLSQ",
+     "High Level SeQuencer: dual FS prog active", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_DUAL_VS_PROG_ACTIVE, 0x2u,
+     "HLSQ_DUAL_VS_PROG_ACTIVE", "HLSQ",
+     "High Level SeQuencer: dual VS prog active", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_FS_BATCH_COUNT_ZERO, 0x2u,
+     "HLSQ_FS_BATCH_COUNT_ZERO", "HLSQ",
+     "High Level SeQuencer: FS batch count zero", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_VS_BATCH_COUNT_ZERO, 0x2u,
+     "HLSQ_VS_BATCH_COUNT_ZERO", "HLSQ",
+     "High Level SeQuencer: VS batch count zero", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_WAVE_PENDING_NO_QUAD, 0x2u,
+     "HLSQ_WAVE_PENDING_NO_QUAD", "HLSQ",
+     "High Level SeQuencer: wave pending NO quad", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_WAVE_PENDING_NO_PRIM_BASE, 0x2u,
+     "HLSQ_WAVE_PENDING_NO_PRIM_BASE", "HLSQ",
+     "High Level SeQuencer: wave pending NO prim base", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_STALL_CYCLES_VPC, 0x2u, "HLSQ_STALL_CYCLES_VPC",
+     "HLSQ", "High Level SeQuencer: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_PIXELS, 0x2u, "HLSQ_PIXELS", "HLSQ",
+     "High Level SeQuencer: pixels", "events"},
+    {HPC_GPU_ADRENO_A6XX_HLSQ_DRAW_MODE_SWITCH_VSFS_SYNC, 0x2u,
+     "HLSQ_DRAW_MODE_SWITCH_VSFS_SYNC", "HLSQ",
+     "High Level SeQuencer: draw mode switch vsfs sync", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_BUSY_CYCLES, 0x3u, "VPC_BUSY_CYCLES", "VPC",
+     "VPC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_WORKING_CYCLES, 0x3u, "VPC_WORKING_CYCLES", "VPC",
+     "VPC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STALL_CYCLES_UCHE, 0x3u, "VPC_STALL_CYCLES_UCHE",
+     "VPC", "VPC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STALL_CYCLES_VFD_WACK, 0x3u,
+     "VPC_STALL_CYCLES_VFD_WACK", "VPC", "VPC: stall cycles VFD wack",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC, 0x3u,
+     "VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC", "VPC",
+     "VPC: stall cycles HLSQ prim alloc", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STALL_CYCLES_PC, 0x3u, "VPC_STALL_CYCLES_PC",
+     "VPC", "VPC: stall cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STALL_CYCLES_SP_LM, 0x3u, "VPC_STALL_CYCLES_SP_LM",
+     "VPC", "VPC: stall cycles SP LM", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STARVE_CYCLES_SP, 0x3u, "VPC_STARVE_CYCLES_SP",
+     "VPC", "VPC: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STARVE_CYCLES_LRZ, 0x3u, "VPC_STARVE_CYCLES_LRZ",
+     "VPC", "VPC: starve cycles LRZ", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_PC_PRIMITIVES, 0x3u, "VPC_PC_PRIMITIVES", "VPC",
+     "VPC: PC primitives", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_SP_COMPONENTS, 0x3u, "VPC_SP_COMPONENTS", "VPC",
+     "VPC: SP components", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STALL_CYCLES_VPCRAM_POS, 0x2u,
+     "VPC_STALL_CYCLES_VPCRAM_POS", "VPC", "VPC: stall cycles vpcram pos",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_LRZ_ASSIGN_PRIMITIVES, 0x2u,
+     "VPC_LRZ_ASSIGN_PRIMITIVES", "VPC", "VPC: LRZ assign primitives",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_RB_VISIBLE_PRIMITIVES, 0x2u,
+     "VPC_RB_VISIBLE_PRIMITIVES", "VPC", "VPC: RB visible primitives",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_LM_TRANSACTION, 0x2u, "VPC_LM_TRANSACTION", "VPC",
+     "VPC: LM transaction", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STREAMOUT_TRANSACTION, 0x2u,
+     "VPC_STREAMOUT_TRANSACTION", "VPC", "VPC: streamout transaction",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_VS_BUSY_CYCLES, 0x2u, "VPC_VS_BUSY_CYCLES", "VPC",
+     "VPC: VS busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_PS_BUSY_CYCLES, 0x2u, "VPC_PS_BUSY_CYCLES", "VPC",
+     "VPC: PS busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_VS_WORKING_CYCLES, 0x2u, "VPC_VS_WORKING_CYCLES",
+     "VPC", "VPC: VS working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_PS_WORKING_CYCLES, 0x2u, "VPC_PS_WORKING_CYCLES",
+     "VPC", "VPC: PS working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_STARVE_CYCLES_RB, 0x2u, "VPC_STARVE_CYCLES_RB",
+     "VPC", "VPC: starve cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_NUM_VPCRAM_READ_POS, 0x2u,
+     "VPC_NUM_VPCRAM_READ_POS", "VPC", "VPC: num vpcram read pos", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_WIT_FULL_CYCLES, 0x2u, "VPC_WIT_FULL_CYCLES",
+     "VPC", "VPC: wit full cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_VPCRAM_FULL_CYCLES, 0x2u, "VPC_VPCRAM_FULL_CYCLES",
+     "VPC", "VPC: vpcram full cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VPC_LM_FULL_WAIT_FOR_INTP_END, 0x2u,
+     "VPC_LM_FULL_WAIT_FOR_INTP_END", "VPC", "VPC: LM full wait for intp end",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_NUM_VPCRAM_WRITE, 0x2u, "VPC_NUM_VPCRAM_WRITE",
+     "VPC", "VPC: num vpcram write", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_NUM_VPCRAM_READ_SO, 0x2u, "VPC_NUM_VPCRAM_READ_SO",
+     "VPC", "VPC: num vpcram read SO", "events"},
+    {HPC_GPU_ADRENO_A6XX_VPC_NUM_ATTR_REQ_LM, 0x2u, "VPC_NUM_ATTR_REQ_LM",
+     "VPC", "VPC: num attr req LM", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_BUSY_CYCLES, 0x3u, "TSE_BUSY_CYCLES", "TSE",
+     "Triangle Setup Engine: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_CLIPPING_CYCLES, 0x3u, "TSE_CLIPPING_CYCLES",
+     "TSE", "Triangle Setup Engine: clipping cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_STALL_CYCLES_RAS, 0x3u, "TSE_STALL_CYCLES_RAS",
+     "TSE", "Triangle Setup Engine: stall cycles RAS", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_STALL_CYCLES_LRZ_BARYPLANE, 0x3u,
+     "TSE_STALL_CYCLES_LRZ_BARYPLANE", "TSE",
+     "Triangle Setup Engine: stall cycles LRZ baryplane", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_STALL_CYCLES_LRZ_ZPLANE, 0x3u,
+     "TSE_STALL_CYCLES_LRZ_ZPLANE", "TSE",
+     "Triangle Setup Engine: stall cycles LRZ zplane", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_STARVE_CYCLES_PC, 0x3u, "TSE_STARVE_CYCLES_PC",
+     "TSE", "Triangle Setup Engine: starve cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_INPUT_PRIM, 0x3u, "TSE_INPUT_PRIM", "TSE",
+     "Triangle Setup Engine: input prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_INPUT_NULL_PRIM, 0x3u, "TSE_INPUT_NULL_PRIM",
+     "TSE", "Triangle Setup Engine: input null prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_TRIVAL_REJ_PRIM, 0x3u, "TSE_TRIVAL_REJ_PRIM",
+     "TSE", "Triangle Setup Engine: trival rej prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_CLIPPED_PRIM, 0x3u, "TSE_CLIPPED_PRIM", "TSE",
+     "Triangle Setup Engine: clipped prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_ZERO_AREA_PRIM, 0x3u, "TSE_ZERO_AREA_PRIM", "TSE",
+     "Triangle Setup Engine: zero area prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_FACENESS_CULLED_PRIM, 0x3u,
+     "TSE_FACENESS_CULLED_PRIM", "TSE",
+     "Triangle Setup Engine: faceness culled prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_ZERO_PIXEL_PRIM, 0x3u, "TSE_ZERO_PIXEL_PRIM",
+     "TSE", "Triangle Setup Engine: zero pixel prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_OUTPUT_NULL_PRIM, 0x3u, "TSE_OUTPUT_NULL_PRIM",
+     "TSE", "Triangle Setup Engine: output null prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_OUTPUT_VISIBLE_PRIM, 0x3u,
+     "TSE_OUTPUT_VISIBLE_PRIM", "TSE",
+     "Triangle Setup Engine: output visible prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_CINVOCATION, 0x3u, "TSE_CINVOCATION", "TSE",
+     "Triangle Setup Engine: cinvocation", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_CPRIMITIVES, 0x3u, "TSE_CPRIMITIVES", "TSE",
+     "Triangle Setup Engine: cprimitives", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_2D_INPUT_PRIM, 0x3u, "TSE_2D_INPUT_PRIM", "TSE",
+     "Triangle Setup Engine: 2D input prim", "events"},
+    {HPC_GPU_ADRENO_A6XX_TSE_2D_ALIVE_CYCLES, 0x2u, "TSE_2D_ALIVE_CYCLES",
+     "TSE", "Triangle Setup Engine: 2D alive cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TSE_CLIP_PLANES, 0x2u, "TSE_CLIP_PLANES", "TSE",
+     "Triangle Setup Engine: clip planes", "events"},
+    {HPC_GPU_ADRENO_A6XX_RAS_BUSY_CYCLES, 0x3u, "RAS_BUSY_CYCLES", "RAS",
+     "RAS: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_SUPERTILE_ACTIVE_CYCLES, 0x3u,
+     "RAS_SUPERTILE_ACTIVE_CYCLES", "RAS", "RAS: supertile active cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_STALL_CYCLES_LRZ, 0x3u, "RAS_STALL_CYCLES_LRZ",
+     "RAS", "RAS: stall cycles LRZ", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_STARVE_CYCLES_TSE, 0x3u, "RAS_STARVE_CYCLES_TSE",
+     "RAS", "RAS: starve cycles TSE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_SUPER_TILES, 0x3u, "RAS_SUPER_TILES", "RAS",
+     "RAS: super tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_RAS_8X4_TILES, 0x3u, "RAS_8X4_TILES", "RAS",
+     "RAS: 8x4 tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_RAS_MASKGEN_ACTIVE, 0x3u, "RAS_MASKGEN_ACTIVE", "RAS",
+     "RAS: maskgen active", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_FULLY_COVERED_SUPER_TILES, 0x3u,
+     "RAS_FULLY_COVERED_SUPER_TILES", "RAS", "RAS: fully covered super tiles",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RAS_FULLY_COVERED_8X4_TILES, 0x3u,
+     "RAS_FULLY_COVERED_8X4_TILES", "RAS", "RAS: fully covered 8x4 tiles",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RAS_PRIM_KILLED_INVISILBE, 0x3u,
+     "RAS_PRIM_KILLED_INVISILBE", "RAS", "RAS: prim killed invisilbe",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RAS_SUPERTILE_GEN_ACTIVE_CYCLES, 0x2u,
+     "RAS_SUPERTILE_GEN_ACTIVE_CYCLES", "RAS",
+     "RAS: supertile gen active cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_LRZ_INTF_WORKING_CYCLES, 0x2u,
+     "RAS_LRZ_INTF_WORKING_CYCLES", "RAS", "RAS: LRZ intf working cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RAS_BLOCKS, 0x2u, "RAS_BLOCKS", "RAS", "RAS: blocks",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BUSY_CYCLES, 0x3u, "UCHE_BUSY_CYCLES", "UCHE",
+     "Unified L2 Cache: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_STALL_CYCLES_ARBITER, 0x2u,
+     "UCHE_STALL_CYCLES_ARBITER", "UCHE",
+     "Unified L2 Cache: stall cycles arbiter", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_LATENCY_CYCLES, 0x3u,
+     "UCHE_VBIF_LATENCY_CYCLES", "UCHE",
+     "Unified L2 Cache: vbif latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_LATENCY_SAMPLES, 0x3u,
+     "UCHE_VBIF_LATENCY_SAMPLES", "UCHE",
+     "Unified L2 Cache: vbif latency samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_TP, 0x3u,
+     "UCHE_VBIF_READ_BEATS_TP", "UCHE", "Unified L2 Cache: vbif read beats TP",
+     "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_VFD, 0x3u,
+     "UCHE_VBIF_READ_BEATS_VFD", "UCHE",
+     "Unified L2 Cache: vbif read beats VFD", "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_HLSQ, 0x3u,
+     "UCHE_VBIF_READ_BEATS_HLSQ", "UCHE",
+     "Unified L2 Cache: vbif read beats HLSQ", "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_LRZ, 0x3u,
+     "UCHE_VBIF_READ_BEATS_LRZ", "UCHE",
+     "Unified L2 Cache: vbif read beats LRZ", "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_SP, 0x3u,
+     "UCHE_VBIF_READ_BEATS_SP", "UCHE", "Unified L2 Cache: vbif read beats SP",
+     "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_READ_REQUESTS_TP, 0x3u, "UCHE_READ_REQUESTS_TP",
+     "UCHE", "Unified L2 Cache: read requests TP", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_READ_REQUESTS_VFD, 0x3u, "UCHE_READ_REQUESTS_VFD",
+     "UCHE", "Unified L2 Cache: read requests VFD", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_READ_REQUESTS_HLSQ, 0x3u,
+     "UCHE_READ_REQUESTS_HLSQ", "UCHE", "Unified L2 Cache: read requests HLSQ",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_READ_REQUESTS_LRZ, 0x3u, "UCHE_READ_REQUESTS_LRZ",
+     "UCHE", "Unified L2 Cache: read requests LRZ", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_READ_REQUESTS_SP, 0x3u, "UCHE_READ_REQUESTS_SP",
+     "UCHE", "Unified L2 Cache: read requests SP", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_WRITE_REQUESTS_LRZ, 0x3u,
+     "UCHE_WRITE_REQUESTS_LRZ", "UCHE", "Unified L2 Cache: write requests LRZ",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_WRITE_REQUESTS_SP, 0x3u, "UCHE_WRITE_REQUESTS_SP",
+     "UCHE", "Unified L2 Cache: write requests SP", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_WRITE_REQUESTS_VPC, 0x3u,
+     "UCHE_WRITE_REQUESTS_VPC", "UCHE", "Unified L2 Cache: write requests VPC",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_WRITE_REQUESTS_VSC, 0x3u,
+     "UCHE_WRITE_REQUESTS_VSC", "UCHE", "Unified L2 Cache: write requests VSC",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_EVICTS, 0x3u, "UCHE_EVICTS", "UCHE",
+     "Unified L2 Cache: evicts", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ0, 0x3u, "UCHE_BANK_REQ0", "UCHE",
+     "Unified L2 Cache: bank req0", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ1, 0x3u, "UCHE_BANK_REQ1", "UCHE",
+     "Unified L2 Cache: bank req1", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ2, 0x3u, "UCHE_BANK_REQ2", "UCHE",
+     "Unified L2 Cache: bank req2", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ3, 0x3u, "UCHE_BANK_REQ3", "UCHE",
+     "Unified L2 Cache: bank req3", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ4, 0x3u, "UCHE_BANK_REQ4", "UCHE",
+     "Unified L2 Cache: bank req4", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ5, 0x3u, "UCHE_BANK_REQ5", "UCHE",
+     "Unified L2 Cache: bank req5", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ6, 0x3u, "UCHE_BANK_REQ6", "UCHE",
+     "Unified L2 Cache: bank req6", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_BANK_REQ7, 0x3u, "UCHE_BANK_REQ7", "UCHE",
+     "Unified L2 Cache: bank req7", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_CH0, 0x3u,
+     "UCHE_VBIF_READ_BEATS_CH0", "UCHE",
+     "Unified L2 Cache: vbif read beats ch0", "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_CH1, 0x3u,
+     "UCHE_VBIF_READ_BEATS_CH1", "UCHE",
+     "Unified L2 Cache: vbif read beats ch1", "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_GMEM_READ_BEATS, 0x3u, "UCHE_GMEM_READ_BEATS",
+     "UCHE", "Unified L2 Cache: gmem read beats", "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_TPH_REF_FULL, 0x2u, "UCHE_TPH_REF_FULL", "UCHE",
+     "Unified L2 Cache: tph ref full", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_TPH_VICTIM_FULL, 0x2u, "UCHE_TPH_VICTIM_FULL",
+     "UCHE", "Unified L2 Cache: tph victim full", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_TPH_EXT_FULL, 0x2u, "UCHE_TPH_EXT_FULL", "UCHE",
+     "Unified L2 Cache: tph ext full", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_STALL_WRITE_DATA, 0x2u,
+     "UCHE_VBIF_STALL_WRITE_DATA", "UCHE",
+     "Unified L2 Cache: vbif stall write data", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_DCMP_LATENCY_SAMPLES, 0x2u,
+     "UCHE_DCMP_LATENCY_SAMPLES", "UCHE",
+     "Unified L2 Cache: dcmp latency samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_DCMP_LATENCY_CYCLES, 0x2u,
+     "UCHE_DCMP_LATENCY_CYCLES", "UCHE",
+     "Unified L2 Cache: dcmp latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_VBIF_READ_BEATS_PC, 0x2u,
+     "UCHE_VBIF_READ_BEATS_PC", "UCHE", "Unified L2 Cache: vbif read beats PC",
+     "beats"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_READ_REQUESTS_PC, 0x2u, "UCHE_READ_REQUESTS_PC",
+     "UCHE", "Unified L2 Cache: read requests PC", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_RAM_READ_REQ, 0x2u, "UCHE_RAM_READ_REQ", "UCHE",
+     "Unified L2 Cache: ram read req", "events"},
+    {HPC_GPU_ADRENO_A6XX_UCHE_RAM_WRITE_REQ, 0x2u, "UCHE_RAM_WRITE_REQ", "UCHE",
+     "Unified L2 Cache: ram write req", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_BUSY_CYCLES, 0x3u, "TP_BUSY_CYCLES", "TP",
+     "Texture Processor: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_STALL_CYCLES_UCHE, 0x3u, "TP_STALL_CYCLES_UCHE",
+     "TP", "Texture Processor: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_LATENCY_CYCLES, 0x3u, "TP_LATENCY_CYCLES", "TP",
+     "Texture Processor: latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_LATENCY_TRANS, 0x3u, "TP_LATENCY_TRANS", "TP",
+     "Texture Processor: latency trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FLAG_CACHE_REQUEST_SAMPLES, 0x3u,
+     "TP_FLAG_CACHE_REQUEST_SAMPLES", "TP",
+     "Texture Processor: flag cache request samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FLAG_CACHE_REQUEST_LATENCY, 0x3u,
+     "TP_FLAG_CACHE_REQUEST_LATENCY", "TP",
+     "Texture Processor: flag cache request latency", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_CACHELINE_REQUESTS, 0x3u,
+     "TP_L1_CACHELINE_REQUESTS", "TP",
+     "Texture Processor: L1 cacheline requests", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_CACHELINE_MISSES, 0x3u, "TP_L1_CACHELINE_MISSES",
+     "TP", "Texture Processor: L1 cacheline misses", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_SP_TP_TRANS, 0x3u, "TP_SP_TP_TRANS", "TP",
+     "Texture Processor: SP TP trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_TP_SP_TRANS, 0x3u, "TP_TP_SP_TRANS", "TP",
+     "Texture Processor: TP SP trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_OUTPUT_PIXELS, 0x3u, "TP_OUTPUT_PIXELS", "TP",
+     "Texture Processor: output pixels", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FILTER_WORKLOAD_16BIT, 0x3u,
+     "TP_FILTER_WORKLOAD_16BIT", "TP",
+     "Texture Processor: filter workload 16bit", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FILTER_WORKLOAD_32BIT, 0x3u,
+     "TP_FILTER_WORKLOAD_32BIT", "TP",
+     "Texture Processor: filter workload 32bit", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_RECEIVED, 0x3u, "TP_QUADS_RECEIVED", "TP",
+     "Texture Processor: quads received", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_OFFSET, 0x3u, "TP_QUADS_OFFSET", "TP",
+     "Texture Processor: quads offset", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_SHADOW, 0x3u, "TP_QUADS_SHADOW", "TP",
+     "Texture Processor: quads shadow", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_ARRAY, 0x3u, "TP_QUADS_ARRAY", "TP",
+     "Texture Processor: quads array", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_GRADIENT, 0x3u, "TP_QUADS_GRADIENT", "TP",
+     "Texture Processor: quads gradient", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_1D, 0x3u, "TP_QUADS_1D", "TP",
+     "Texture Processor: quads 1D", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_2D, 0x3u, "TP_QUADS_2D", "TP",
+     "Texture Processor: quads 2D", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_BUFFER, 0x3u, "TP_QUADS_BUFFER", "TP",
+     "Texture Processor: quads buffer", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_3D, 0x3u, "TP_QUADS_3D", "TP",
+     "Texture Processor: quads 3D", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_CUBE, 0x3u, "TP_QUADS_CUBE", "TP",
+     "Texture Processor: quads cube", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_DIVERGENT_QUADS_RECEIVED, 0x3u,
+     "TP_DIVERGENT_QUADS_RECEIVED", "TP",
+     "Texture Processor: divergent quads received", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_PRT_NON_RESIDENT_EVENTS, 0x3u,
+     "TP_PRT_NON_RESIDENT_EVENTS", "TP",
+     "Texture Processor: prt non resident events", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_OUTPUT_PIXELS_POINT, 0x3u, "TP_OUTPUT_PIXELS_POINT",
+     "TP", "Texture Processor: output pixels point", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_OUTPUT_PIXELS_BILINEAR, 0x3u,
+     "TP_OUTPUT_PIXELS_BILINEAR", "TP",
+     "Texture Processor: output pixels bilinear", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_OUTPUT_PIXELS_MIP, 0x3u, "TP_OUTPUT_PIXELS_MIP",
+     "TP", "Texture Processor: output pixels mip", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_OUTPUT_PIXELS_ANISO, 0x3u, "TP_OUTPUT_PIXELS_ANISO",
+     "TP", "Texture Processor: output pixels aniso", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_OUTPUT_PIXELS_ZERO_LOD, 0x3u,
+     "TP_OUTPUT_PIXELS_ZERO_LOD", "TP",
+     "Texture Processor: output pixels zero lod", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FLAG_CACHE_REQUESTS, 0x3u, "TP_FLAG_CACHE_REQUESTS",
+     "TP", "Texture Processor: flag cache requests", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FLAG_CACHE_MISSES, 0x3u, "TP_FLAG_CACHE_MISSES",
+     "TP", "Texture Processor: flag cache misses", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_5_L2_REQUESTS, 0x3u, "TP_L1_5_L2_REQUESTS", "TP",
+     "Texture Processor: L1 5 L2 requests", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_2D_OUTPUT_PIXELS, 0x3u, "TP_2D_OUTPUT_PIXELS", "TP",
+     "Texture Processor: 2D output pixels", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_2D_OUTPUT_PIXELS_POINT, 0x3u,
+     "TP_2D_OUTPUT_PIXELS_POINT", "TP",
+     "Texture Processor: 2D output pixels point", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_2D_OUTPUT_PIXELS_BILINEAR, 0x3u,
+     "TP_2D_OUTPUT_PIXELS_BILINEAR", "TP",
+     "Texture Processor: 2D output pixels bilinear", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_2D_FILTER_WORKLOAD_16BIT, 0x3u,
+     "TP_2D_FILTER_WORKLOAD_16BIT", "TP",
+     "Texture Processor: 2D filter workload 16bit", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_2D_FILTER_WORKLOAD_32BIT, 0x3u,
+     "TP_2D_FILTER_WORKLOAD_32BIT", "TP",
+     "Texture Processor: 2D filter workload 32bit", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_TPA2TPC_TRANS, 0x2u, "TP_TPA2TPC_TRANS", "TP",
+     "Texture Processor: tpa2tpc trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_MISSES_ASTC_1TILE, 0x2u,
+     "TP_L1_MISSES_ASTC_1TILE", "TP", "Texture Processor: L1 misses astc 1tile",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_MISSES_ASTC_2TILE, 0x2u,
+     "TP_L1_MISSES_ASTC_2TILE", "TP", "Texture Processor: L1 misses astc 2tile",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_MISSES_ASTC_4TILE, 0x2u,
+     "TP_L1_MISSES_ASTC_4TILE", "TP", "Texture Processor: L1 misses astc 4tile",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_5_L2_COMPRESS_REQS, 0x2u,
+     "TP_L1_5_L2_COMPRESS_REQS", "TP",
+     "Texture Processor: L1 5 L2 compress reqs", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_5_L2_COMPRESS_MISS, 0x2u,
+     "TP_L1_5_L2_COMPRESS_MISS", "TP",
+     "Texture Processor: L1 5 L2 compress miss", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_BANK_CONFLICT, 0x2u, "TP_L1_BANK_CONFLICT", "TP",
+     "Texture Processor: L1 bank conflict", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_5_MISS_LATENCY_CYCLES, 0x2u,
+     "TP_L1_5_MISS_LATENCY_CYCLES", "TP",
+     "Texture Processor: L1 5 miss latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_5_MISS_LATENCY_TRANS, 0x2u,
+     "TP_L1_5_MISS_LATENCY_TRANS", "TP",
+     "Texture Processor: L1 5 miss latency trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_QUADS_CONSTANT_MULTIPLIED, 0x2u,
+     "TP_QUADS_CONSTANT_MULTIPLIED", "TP",
+     "Texture Processor: quads constant multiplied", "events"},
+    {HPC_GPU_ADRENO_A6XX_TP_FRONTEND_WORKING_CYCLES, 0x2u,
+     "TP_FRONTEND_WORKING_CYCLES", "TP",
+     "Texture Processor: frontend working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_TAG_WORKING_CYCLES, 0x2u,
+     "TP_L1_TAG_WORKING_CYCLES", "TP",
+     "Texture Processor: L1 tag working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_DATA_WRITE_WORKING_CYCLES, 0x2u,
+     "TP_L1_DATA_WRITE_WORKING_CYCLES", "TP",
+     "Texture Processor: L1 data write working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_PRE_L1_DECOM_WORKING_CYCLES, 0x2u,
+     "TP_PRE_L1_DECOM_WORKING_CYCLES", "TP",
+     "Texture Processor: pre L1 decom working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_BACKEND_WORKING_CYCLES, 0x2u,
+     "TP_BACKEND_WORKING_CYCLES", "TP",
+     "Texture Processor: backend working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_FLAG_CACHE_WORKING_CYCLES, 0x2u,
+     "TP_FLAG_CACHE_WORKING_CYCLES", "TP",
+     "Texture Processor: flag cache working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_L1_5_CACHE_WORKING_CYCLES, 0x2u,
+     "TP_L1_5_CACHE_WORKING_CYCLES", "TP",
+     "Texture Processor: L1 5 cache working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_STARVE_CYCLES_SP, 0x2u, "TP_STARVE_CYCLES_SP", "TP",
+     "Texture Processor: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_TP_STARVE_CYCLES_UCHE, 0x2u, "TP_STARVE_CYCLES_UCHE",
+     "TP", "Texture Processor: starve cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_BUSY_CYCLES, 0x3u, "SP_BUSY_CYCLES", "SP",
+     "Shader/Streaming Processor: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_ALU_WORKING_CYCLES, 0x3u, "SP_ALU_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: ALU working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_EFU_WORKING_CYCLES, 0x3u, "SP_EFU_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: EFU working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_STALL_CYCLES_VPC, 0x3u, "SP_STALL_CYCLES_VPC", "SP",
+     "Shader/Streaming Processor: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_STALL_CYCLES_TP, 0x3u, "SP_STALL_CYCLES_TP", "SP",
+     "Shader/Streaming Processor: stall cycles TP", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_STALL_CYCLES_UCHE, 0x3u, "SP_STALL_CYCLES_UCHE",
+     "SP", "Shader/Streaming Processor: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_STALL_CYCLES_RB, 0x3u, "SP_STALL_CYCLES_RB", "SP",
+     "Shader/Streaming Processor: stall cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_NON_EXECUTION_CYCLES, 0x2u,
+     "SP_NON_EXECUTION_CYCLES", "SP",
+     "Shader/Streaming Processor: non execution cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_CONTEXTS, 0x3u, "SP_WAVE_CONTEXTS", "SP",
+     "Shader/Streaming Processor: wave contexts", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_CONTEXT_CYCLES, 0x3u, "SP_WAVE_CONTEXT_CYCLES",
+     "SP", "Shader/Streaming Processor: wave context cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_WAVE_CYCLES, 0x3u,
+     "SP_FS_STAGE_WAVE_CYCLES", "SP",
+     "Shader/Streaming Processor: FS stage wave cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_WAVE_SAMPLES, 0x3u,
+     "SP_FS_STAGE_WAVE_SAMPLES", "SP",
+     "Shader/Streaming Processor: FS stage wave samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_WAVE_CYCLES, 0x3u,
+     "SP_VS_STAGE_WAVE_CYCLES", "SP",
+     "Shader/Streaming Processor: VS stage wave cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_WAVE_SAMPLES, 0x3u,
+     "SP_VS_STAGE_WAVE_SAMPLES", "SP",
+     "Shader/Streaming Processor: VS stage wave samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_DURATION_CYCLES, 0x3u,
+     "SP_FS_STAGE_DURATION_CYCLES", "SP",
+     "Shader/Streaming Processor: FS stage duration cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_DURATION_CYCLES, 0x3u,
+     "SP_VS_STAGE_DURATION_CYCLES", "SP",
+     "Shader/Streaming Processor: VS stage duration cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_CTRL_CYCLES, 0x3u, "SP_WAVE_CTRL_CYCLES", "SP",
+     "Shader/Streaming Processor: wave ctrl cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_LOAD_CYCLES, 0x3u, "SP_WAVE_LOAD_CYCLES", "SP",
+     "Shader/Streaming Processor: wave load cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_EMIT_CYCLES, 0x3u, "SP_WAVE_EMIT_CYCLES", "SP",
+     "Shader/Streaming Processor: wave emit cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_NOP_CYCLES, 0x3u, "SP_WAVE_NOP_CYCLES", "SP",
+     "Shader/Streaming Processor: wave nop cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_WAIT_CYCLES, 0x3u, "SP_WAVE_WAIT_CYCLES", "SP",
+     "Shader/Streaming Processor: wave wait cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_FETCH_CYCLES, 0x3u, "SP_WAVE_FETCH_CYCLES",
+     "SP", "Shader/Streaming Processor: wave fetch cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_IDLE_CYCLES, 0x3u, "SP_WAVE_IDLE_CYCLES", "SP",
+     "Shader/Streaming Processor: wave idle cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_END_CYCLES, 0x3u, "SP_WAVE_END_CYCLES", "SP",
+     "Shader/Streaming Processor: wave end cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_LONG_SYNC_CYCLES, 0x3u,
+     "SP_WAVE_LONG_SYNC_CYCLES", "SP",
+     "Shader/Streaming Processor: wave long sync cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_SHORT_SYNC_CYCLES, 0x3u,
+     "SP_WAVE_SHORT_SYNC_CYCLES", "SP",
+     "Shader/Streaming Processor: wave short sync cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WAVE_JOIN_CYCLES, 0x3u, "SP_WAVE_JOIN_CYCLES", "SP",
+     "Shader/Streaming Processor: wave join cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_LM_LOAD_INSTRUCTIONS, 0x3u,
+     "SP_LM_LOAD_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: LM load instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_LM_STORE_INSTRUCTIONS, 0x3u,
+     "SP_LM_STORE_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: LM store instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_LM_ATOMICS, 0x3u, "SP_LM_ATOMICS", "SP",
+     "Shader/Streaming Processor: LM atomics", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GM_LOAD_INSTRUCTIONS, 0x3u,
+     "SP_GM_LOAD_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GM load instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GM_STORE_INSTRUCTIONS, 0x3u,
+     "SP_GM_STORE_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GM store instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GM_ATOMICS, 0x3u, "SP_GM_ATOMICS", "SP",
+     "Shader/Streaming Processor: GM atomics", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_TEX_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_TEX_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage tex instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_EFU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage EFU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_FULL_ALU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_FULL_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage full ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_HALF_ALU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_HALF_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage half ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_TEX_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_TEX_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage tex instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_CFLOW_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_CFLOW_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage cflow instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_EFU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage EFU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_FULL_ALU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_FULL_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage full ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_HALF_ALU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_HALF_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage half ALU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_BARY_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_BARY_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage bary instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_INSTRUCTIONS, 0x3u, "SP_VS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_INSTRUCTIONS, 0x3u, "SP_FS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ADDR_LOCK_COUNT, 0x3u, "SP_ADDR_LOCK_COUNT", "SP",
+     "Shader/Streaming Processor: addr lock count", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_UCHE_READ_TRANS, 0x3u, "SP_UCHE_READ_TRANS", "SP",
+     "Shader/Streaming Processor: UCHE read trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_UCHE_WRITE_TRANS, 0x3u, "SP_UCHE_WRITE_TRANS", "SP",
+     "Shader/Streaming Processor: UCHE write trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_EXPORT_VPC_TRANS, 0x3u, "SP_EXPORT_VPC_TRANS", "SP",
+     "Shader/Streaming Processor: export VPC trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_EXPORT_RB_TRANS, 0x3u, "SP_EXPORT_RB_TRANS", "SP",
+     "Shader/Streaming Processor: export RB trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_PIXELS_KILLED, 0x3u, "SP_PIXELS_KILLED", "SP",
+     "Shader/Streaming Processor: pixels killed", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ICL1_REQUESTS, 0x3u, "SP_ICL1_REQUESTS", "SP",
+     "Shader/Streaming Processor: icl1 requests", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ICL1_MISSES, 0x3u, "SP_ICL1_MISSES", "SP",
+     "Shader/Streaming Processor: icl1 misses", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_HS_INSTRUCTIONS, 0x3u, "SP_HS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: HS instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_DS_INSTRUCTIONS, 0x3u, "SP_DS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: DS instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GS_INSTRUCTIONS, 0x3u, "SP_GS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GS instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_CS_INSTRUCTIONS, 0x3u, "SP_CS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: CS instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GPR_READ, 0x3u, "SP_GPR_READ", "SP",
+     "Shader/Streaming Processor: GPR read", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GPR_WRITE, 0x3u, "SP_GPR_WRITE", "SP",
+     "Shader/Streaming Processor: GPR write", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_FS_STAGE_HALF_EFU_INSTRUCTIONS, 0x2u,
+     "SP_FS_STAGE_HALF_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage half EFU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_VS_STAGE_HALF_EFU_INSTRUCTIONS, 0x2u,
+     "SP_VS_STAGE_HALF_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage half EFU instructions", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_LM_BANK_CONFLICTS, 0x3u, "SP_LM_BANK_CONFLICTS",
+     "SP", "Shader/Streaming Processor: LM bank conflicts", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_TEX_CONTROL_WORKING_CYCLES, 0x2u,
+     "SP_TEX_CONTROL_WORKING_CYCLES", "SP",
+     "Shader/Streaming Processor: tex control working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_LOAD_CONTROL_WORKING_CYCLES, 0x2u,
+     "SP_LOAD_CONTROL_WORKING_CYCLES", "SP",
+     "Shader/Streaming Processor: load control working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_FLOW_CONTROL_WORKING_CYCLES, 0x2u,
+     "SP_FLOW_CONTROL_WORKING_CYCLES", "SP",
+     "Shader/Streaming Processor: flow control working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_LM_WORKING_CYCLES, 0x2u, "SP_LM_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: LM working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_DISPATCHER_WORKING_CYCLES, 0x2u,
+     "SP_DISPATCHER_WORKING_CYCLES", "SP",
+     "Shader/Streaming Processor: dispatcher working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_SEQUENCER_WORKING_CYCLES, 0x2u,
+     "SP_SEQUENCER_WORKING_CYCLES", "SP",
+     "Shader/Streaming Processor: sequencer working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_LOW_EFFICIENCY_STARVED_BY_TP, 0x2u,
+     "SP_LOW_EFFICIENCY_STARVED_BY_TP", "SP",
+     "Shader/Streaming Processor: low efficiency starved BY TP", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_STARVE_CYCLES_HLSQ, 0x2u, "SP_STARVE_CYCLES_HLSQ",
+     "SP", "Shader/Streaming Processor: starve cycles HLSQ", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_NON_EXECUTION_LS_CYCLES, 0x2u,
+     "SP_NON_EXECUTION_LS_CYCLES", "SP",
+     "Shader/Streaming Processor: non execution LS cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_WORKING_EU, 0x2u, "SP_WORKING_EU", "SP",
+     "Shader/Streaming Processor: working EU", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ANY_EU_WORKING, 0x2u, "SP_ANY_EU_WORKING", "SP",
+     "Shader/Streaming Processor: any EU working", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_WORKING_EU_FS_STAGE, 0x2u, "SP_WORKING_EU_FS_STAGE",
+     "SP", "Shader/Streaming Processor: working EU FS stage", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ANY_EU_WORKING_FS_STAGE, 0x2u,
+     "SP_ANY_EU_WORKING_FS_STAGE", "SP",
+     "Shader/Streaming Processor: any EU working FS stage", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_WORKING_EU_VS_STAGE, 0x2u, "SP_WORKING_EU_VS_STAGE",
+     "SP", "Shader/Streaming Processor: working EU VS stage", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ANY_EU_WORKING_VS_STAGE, 0x2u,
+     "SP_ANY_EU_WORKING_VS_STAGE", "SP",
+     "Shader/Streaming Processor: any EU working VS stage", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_WORKING_EU_CS_STAGE, 0x2u, "SP_WORKING_EU_CS_STAGE",
+     "SP", "Shader/Streaming Processor: working EU CS stage", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_ANY_EU_WORKING_CS_STAGE, 0x2u,
+     "SP_ANY_EU_WORKING_CS_STAGE", "SP",
+     "Shader/Streaming Processor: any EU working CS stage", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GPR_READ_PREFETCH, 0x2u, "SP_GPR_READ_PREFETCH",
+     "SP", "Shader/Streaming Processor: GPR read prefetch", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GPR_READ_CONFLICT, 0x2u, "SP_GPR_READ_CONFLICT",
+     "SP", "Shader/Streaming Processor: GPR read conflict", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GPR_WRITE_CONFLICT, 0x2u, "SP_GPR_WRITE_CONFLICT",
+     "SP", "Shader/Streaming Processor: GPR write conflict", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_GM_LOAD_LATENCY_CYCLES, 0x2u,
+     "SP_GM_LOAD_LATENCY_CYCLES", "SP",
+     "Shader/Streaming Processor: GM load latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_SP_GM_LOAD_LATENCY_SAMPLES, 0x2u,
+     "SP_GM_LOAD_LATENCY_SAMPLES", "SP",
+     "Shader/Streaming Processor: GM load latency samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_SP_EXECUTABLE_WAVES, 0x2u, "SP_EXECUTABLE_WAVES", "SP",
+     "Shader/Streaming Processor: executable waves", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_BUSY_CYCLES, 0x3u, "RB_BUSY_CYCLES", "RB",
+     "RB: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_HLSQ, 0x3u, "RB_STALL_CYCLES_HLSQ",
+     "RB", "RB: stall cycles HLSQ", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_FIFO0_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO0_FULL", "RB", "RB: stall cycles fifo0 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_FIFO1_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO1_FULL", "RB", "RB: stall cycles fifo1 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_FIFO2_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO2_FULL", "RB", "RB: stall cycles fifo2 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STARVE_CYCLES_SP, 0x3u, "RB_STARVE_CYCLES_SP", "RB",
+     "RB: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STARVE_CYCLES_LRZ_TILE, 0x3u,
+     "RB_STARVE_CYCLES_LRZ_TILE", "RB", "RB: starve cycles LRZ tile", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STARVE_CYCLES_CCU, 0x3u, "RB_STARVE_CYCLES_CCU",
+     "RB", "RB: starve cycles CCU", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STARVE_CYCLES_Z_PLANE, 0x3u,
+     "RB_STARVE_CYCLES_Z_PLANE", "RB", "RB: starve cycles Z plane", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STARVE_CYCLES_BARY_PLANE, 0x3u,
+     "RB_STARVE_CYCLES_BARY_PLANE", "RB", "RB: starve cycles bary plane",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_Z_WORKLOAD, 0x3u, "RB_Z_WORKLOAD", "RB",
+     "RB: Z workload", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_HLSQ_ACTIVE, 0x3u, "RB_HLSQ_ACTIVE", "RB",
+     "RB: HLSQ active", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_Z_READ, 0x3u, "RB_Z_READ", "RB", "RB: Z read",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_Z_WRITE, 0x3u, "RB_Z_WRITE", "RB", "RB: Z write",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_C_READ, 0x3u, "RB_C_READ", "RB", "RB: C read",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_C_WRITE, 0x3u, "RB_C_WRITE", "RB", "RB: C write",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_TOTAL_PASS, 0x3u, "RB_TOTAL_PASS", "RB",
+     "RB: total pass", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_Z_PASS, 0x3u, "RB_Z_PASS", "RB", "RB: Z pass",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_Z_FAIL, 0x3u, "RB_Z_FAIL", "RB", "RB: Z fail",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_S_FAIL, 0x3u, "RB_S_FAIL", "RB", "RB: S fail",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_BLENDED_FXP_COMPONENTS, 0x3u,
+     "RB_BLENDED_FXP_COMPONENTS", "RB", "RB: blended fxp components", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_BLENDED_FP16_COMPONENTS, 0x3u,
+     "RB_BLENDED_FP16_COMPONENTS", "RB", "RB: blended fp16 components",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_PS_INVOCATIONS, 0x2u, "RB_PS_INVOCATIONS", "RB",
+     "RB: PS invocations", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_ALIVE_CYCLES, 0x3u, "RB_2D_ALIVE_CYCLES", "RB",
+     "RB: 2D alive cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_STALL_CYCLES_A2D, 0x3u, "RB_2D_STALL_CYCLES_A2D",
+     "RB", "RB: 2D stall cycles a2d", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_STARVE_CYCLES_SRC, 0x3u,
+     "RB_2D_STARVE_CYCLES_SRC", "RB", "RB: 2D starve cycles src", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_STARVE_CYCLES_SP, 0x3u, "RB_2D_STARVE_CYCLES_SP",
+     "RB", "RB: 2D starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_STARVE_CYCLES_DST, 0x3u,
+     "RB_2D_STARVE_CYCLES_DST", "RB", "RB: 2D starve cycles dst", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_VALID_PIXELS, 0x3u, "RB_2D_VALID_PIXELS", "RB",
+     "RB: 2D valid pixels", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_3D_PIXELS, 0x2u, "RB_3D_PIXELS", "RB",
+     "RB: 3D pixels", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_BLENDER_WORKING_CYCLES, 0x2u,
+     "RB_BLENDER_WORKING_CYCLES", "RB", "RB: blender working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_ZPROC_WORKING_CYCLES, 0x2u,
+     "RB_ZPROC_WORKING_CYCLES", "RB", "RB: zproc working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_CPROC_WORKING_CYCLES, 0x2u,
+     "RB_CPROC_WORKING_CYCLES", "RB", "RB: cproc working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_SAMPLER_WORKING_CYCLES, 0x2u,
+     "RB_SAMPLER_WORKING_CYCLES", "RB", "RB: sampler working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_CCU_COLOR_READ, 0x2u,
+     "RB_STALL_CYCLES_CCU_COLOR_READ", "RB", "RB: stall cycles CCU color read",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_CCU_COLOR_WRITE, 0x2u,
+     "RB_STALL_CYCLES_CCU_COLOR_WRITE", "RB",
+     "RB: stall cycles CCU color write", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_CCU_DEPTH_READ, 0x2u,
+     "RB_STALL_CYCLES_CCU_DEPTH_READ", "RB", "RB: stall cycles CCU depth read",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_CCU_DEPTH_WRITE, 0x2u,
+     "RB_STALL_CYCLES_CCU_DEPTH_WRITE", "RB",
+     "RB: stall cycles CCU depth write", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_VPC, 0x2u, "RB_STALL_CYCLES_VPC", "RB",
+     "RB: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_INPUT_TRANS, 0x2u, "RB_2D_INPUT_TRANS", "RB",
+     "RB: 2D input trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_OUTPUT_RB_DST_TRANS, 0x2u,
+     "RB_2D_OUTPUT_RB_DST_TRANS", "RB", "RB: 2D output RB dst trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_2D_OUTPUT_RB_SRC_TRANS, 0x2u,
+     "RB_2D_OUTPUT_RB_SRC_TRANS", "RB", "RB: 2D output RB src trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_BLENDED_FP32_COMPONENTS, 0x2u,
+     "RB_BLENDED_FP32_COMPONENTS", "RB", "RB: blended fp32 components",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_COLOR_PIX_TILES, 0x2u, "RB_COLOR_PIX_TILES", "RB",
+     "RB: color pix tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_STALL_CYCLES_CCU, 0x3u, "RB_STALL_CYCLES_CCU", "RB",
+     "RB: stall cycles CCU", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_RB_EARLY_Z_ARB3_GRANT, 0x2u, "RB_EARLY_Z_ARB3_GRANT",
+     "RB", "RB: early Z arb3 grant", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_LATE_Z_ARB3_GRANT, 0x2u, "RB_LATE_Z_ARB3_GRANT",
+     "RB", "RB: late Z arb3 grant", "events"},
+    {HPC_GPU_ADRENO_A6XX_RB_EARLY_Z_SKIP_GRANT, 0x2u, "RB_EARLY_Z_SKIP_GRANT",
+     "RB", "RB: early Z skip grant", "events"},
+    {HPC_GPU_ADRENO_A6XX_VSC_BUSY_CYCLES, 0x3u, "VSC_BUSY_CYCLES", "VSC",
+     "VSC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VSC_WORKING_CYCLES, 0x3u, "VSC_WORKING_CYCLES", "VSC",
+     "VSC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VSC_STALL_CYCLES_UCHE, 0x3u, "VSC_STALL_CYCLES_UCHE",
+     "VSC", "VSC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_VSC_EOT_NUM, 0x3u, "VSC_EOT_NUM", "VSC",
+     "VSC: eot num", "events"},
+    {HPC_GPU_ADRENO_A6XX_VSC_INPUT_TILES, 0x2u, "VSC_INPUT_TILES", "VSC",
+     "VSC: input tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_BUSY_CYCLES, 0x3u, "CCU_BUSY_CYCLES", "CCU",
+     "Cache and Compression Unit: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CCU_STALL_CYCLES_RB_DEPTH_RETURN, 0x3u,
+     "CCU_STALL_CYCLES_RB_DEPTH_RETURN", "CCU",
+     "Cache and Compression Unit: stall cycles RB depth return", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CCU_STALL_CYCLES_RB_COLOR_RETURN, 0x3u,
+     "CCU_STALL_CYCLES_RB_COLOR_RETURN", "CCU",
+     "Cache and Compression Unit: stall cycles RB color return", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CCU_STARVE_CYCLES_FLAG_RETURN, 0x3u,
+     "CCU_STARVE_CYCLES_FLAG_RETURN", "CCU",
+     "Cache and Compression Unit: starve cycles flag return", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_BLOCKS, 0x3u, "CCU_DEPTH_BLOCKS", "CCU",
+     "Cache and Compression Unit: depth blocks", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_BLOCKS, 0x3u, "CCU_COLOR_BLOCKS", "CCU",
+     "Cache and Compression Unit: color blocks", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_BLOCK_HIT, 0x3u, "CCU_DEPTH_BLOCK_HIT",
+     "CCU", "Cache and Compression Unit: depth block hit", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_BLOCK_HIT, 0x3u, "CCU_COLOR_BLOCK_HIT",
+     "CCU", "Cache and Compression Unit: color block hit", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_PARTIAL_BLOCK_READ, 0x3u, "CCU_PARTIAL_BLOCK_READ",
+     "CCU", "Cache and Compression Unit: partial block read", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_GMEM_READ, 0x3u, "CCU_GMEM_READ", "CCU",
+     "Cache and Compression Unit: gmem read", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_GMEM_WRITE, 0x3u, "CCU_GMEM_WRITE", "CCU",
+     "Cache and Compression Unit: gmem write", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG0_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG0_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag0 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG1_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG1_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag1 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG2_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG2_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag2 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG3_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG3_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag3 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG4_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG4_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag4 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG5_COUNT, 0x2u,
+     "CCU_DEPTH_READ_FLAG5_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag5 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG6_COUNT, 0x2u,
+     "CCU_DEPTH_READ_FLAG6_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag6 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_DEPTH_READ_FLAG8_COUNT, 0x2u,
+     "CCU_DEPTH_READ_FLAG8_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag8 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG0_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG0_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag0 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG1_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG1_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag1 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG2_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG2_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag2 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG3_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG3_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag3 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG4_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG4_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag4 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG5_COUNT, 0x2u,
+     "CCU_COLOR_READ_FLAG5_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag5 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG6_COUNT, 0x2u,
+     "CCU_COLOR_READ_FLAG6_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag6 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_COLOR_READ_FLAG8_COUNT, 0x2u,
+     "CCU_COLOR_READ_FLAG8_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag8 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_2D_RD_REQ, 0x3u, "CCU_2D_RD_REQ", "CCU",
+     "Cache and Compression Unit: 2D RD req", "events"},
+    {HPC_GPU_ADRENO_A6XX_CCU_2D_WR_REQ, 0x3u, "CCU_2D_WR_REQ", "CCU",
+     "Cache and Compression Unit: 2D WR req", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_BUSY_CYCLES, 0x3u, "LRZ_BUSY_CYCLES", "LRZ",
+     "Low Resolution Z: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STARVE_CYCLES_RAS, 0x3u, "LRZ_STARVE_CYCLES_RAS",
+     "LRZ", "Low Resolution Z: starve cycles RAS", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_RB, 0x3u, "LRZ_STALL_CYCLES_RB",
+     "LRZ", "Low Resolution Z: stall cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_VSC, 0x3u, "LRZ_STALL_CYCLES_VSC",
+     "LRZ", "Low Resolution Z: stall cycles VSC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_VPC, 0x3u, "LRZ_STALL_CYCLES_VPC",
+     "LRZ", "Low Resolution Z: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_FLAG_PREFETCH, 0x3u,
+     "LRZ_STALL_CYCLES_FLAG_PREFETCH", "LRZ",
+     "Low Resolution Z: stall cycles flag prefetch", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_UCHE, 0x3u, "LRZ_STALL_CYCLES_UCHE",
+     "LRZ", "Low Resolution Z: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_LRZ_READ, 0x3u, "LRZ_LRZ_READ", "LRZ",
+     "Low Resolution Z: LRZ read", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_LRZ_WRITE, 0x3u, "LRZ_LRZ_WRITE", "LRZ",
+     "Low Resolution Z: LRZ write", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_READ_LATENCY, 0x3u, "LRZ_READ_LATENCY", "LRZ",
+     "Low Resolution Z: read latency", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_MERGE_CACHE_UPDATING, 0x3u,
+     "LRZ_MERGE_CACHE_UPDATING", "LRZ",
+     "Low Resolution Z: merge cache updating", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_PRIM_KILLED_BY_MASKGEN, 0x3u,
+     "LRZ_PRIM_KILLED_BY_MASKGEN", "LRZ",
+     "Low Resolution Z: prim killed BY maskgen", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_PRIM_KILLED_BY_LRZ, 0x3u, "LRZ_PRIM_KILLED_BY_LRZ",
+     "LRZ", "Low Resolution Z: prim killed BY LRZ", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_VISIBLE_PRIM_AFTER_LRZ, 0x3u,
+     "LRZ_VISIBLE_PRIM_AFTER_LRZ", "LRZ",
+     "Low Resolution Z: visible prim after LRZ", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_FULL_8X8_TILES, 0x3u, "LRZ_FULL_8X8_TILES", "LRZ",
+     "Low Resolution Z: full 8x8 tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_PARTIAL_8X8_TILES, 0x3u, "LRZ_PARTIAL_8X8_TILES",
+     "LRZ", "Low Resolution Z: partial 8x8 tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_TILE_KILLED, 0x3u, "LRZ_TILE_KILLED", "LRZ",
+     "Low Resolution Z: tile killed", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_TOTAL_PIXEL, 0x3u, "LRZ_TOTAL_PIXEL", "LRZ",
+     "Low Resolution Z: total pixel", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_VISIBLE_PIXEL_AFTER_LRZ, 0x3u,
+     "LRZ_VISIBLE_PIXEL_AFTER_LRZ", "LRZ",
+     "Low Resolution Z: visible pixel after LRZ", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_FULLY_COVERED_TILES, 0x2u,
+     "LRZ_FULLY_COVERED_TILES", "LRZ", "Low Resolution Z: fully covered tiles",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_PARTIAL_COVERED_TILES, 0x2u,
+     "LRZ_PARTIAL_COVERED_TILES", "LRZ",
+     "Low Resolution Z: partial covered tiles", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_FEEDBACK_ACCEPT, 0x2u, "LRZ_FEEDBACK_ACCEPT",
+     "LRZ", "Low Resolution Z: feedback accept", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_FEEDBACK_DISCARD, 0x2u, "LRZ_FEEDBACK_DISCARD",
+     "LRZ", "Low Resolution Z: feedback discard", "events"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_FEEDBACK_STALL, 0x2u, "LRZ_FEEDBACK_STALL", "LRZ",
+     "Low Resolution Z: feedback stall", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_RB_ZPLANE, 0x2u,
+     "LRZ_STALL_CYCLES_RB_ZPLANE", "LRZ",
+     "Low Resolution Z: stall cycles RB zplane", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_RB_BPLANE, 0x2u,
+     "LRZ_STALL_CYCLES_RB_BPLANE", "LRZ",
+     "Low Resolution Z: stall cycles RB bplane", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_STALL_CYCLES_VC, 0x2u, "LRZ_STALL_CYCLES_VC",
+     "LRZ", "Low Resolution Z: stall cycles VC", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_LRZ_RAS_MASK_TRANS, 0x2u, "LRZ_RAS_MASK_TRANS", "LRZ",
+     "Low Resolution Z: RAS mask trans", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_STALL_CYCLES_ARB, 0x2u,
+     "CMP_CMPDECMP_STALL_CYCLES_ARB", "CMP", "CMP: cmpdecmp stall cycles arb",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_LATENCY_CYCLES, 0x3u,
+     "CMP_CMPDECMP_VBIF_LATENCY_CYCLES", "CMP",
+     "CMP: cmpdecmp vbif latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_LATENCY_SAMPLES, 0x3u,
+     "CMP_CMPDECMP_VBIF_LATENCY_SAMPLES", "CMP",
+     "CMP: cmpdecmp vbif latency samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_READ_DATA_CCU, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_DATA_CCU", "CMP",
+     "CMP: cmpdecmp vbif read data CCU", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_WRITE_DATA_CCU, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA_CCU", "CMP",
+     "CMP: cmpdecmp vbif write data CCU", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_READ_REQUEST, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_REQUEST", "CMP", "CMP: cmpdecmp vbif read request",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_WRITE_REQUEST, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_REQUEST", "CMP",
+     "CMP: cmpdecmp vbif write request", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_READ_DATA, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_DATA", "CMP", "CMP: cmpdecmp vbif read data",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_WRITE_DATA, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA", "CMP", "CMP: cmpdecmp vbif write data",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_FLAG_FETCH_CYCLES, 0x3u,
+     "CMP_CMPDECMP_FLAG_FETCH_CYCLES", "CMP", "CMP: cmpdecmp flag fetch cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_FLAG_FETCH_SAMPLES, 0x3u,
+     "CMP_CMPDECMP_FLAG_FETCH_SAMPLES", "CMP",
+     "CMP: cmpdecmp flag fetch samples", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag1 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag2 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag3 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag4 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG5_COUNT, 0x2u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG5_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag5 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG6_COUNT, 0x2u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG6_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag6 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG8_COUNT, 0x2u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG8_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag8 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag1 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag2 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag3 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag4 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG5_COUNT, 0x2u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG5_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag5 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG6_COUNT, 0x2u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG6_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag6 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG8_COUNT, 0x2u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG8_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag8 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ", "CMP",
+     "CMP: cmpdecmp 2D stall cycles vbif req", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR", "CMP",
+     "CMP: cmpdecmp 2D stall cycles vbif WR", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN", "CMP",
+     "CMP: cmpdecmp 2D stall cycles vbif return", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_RD_DATA, 0x3u,
+     "CMP_CMPDECMP_2D_RD_DATA", "CMP", "CMP: cmpdecmp 2D RD data", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_WR_DATA, 0x3u,
+     "CMP_CMPDECMP_2D_WR_DATA", "CMP", "CMP: cmpdecmp 2D WR data", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_READ_DATA_UCHE_CH0, 0x2u,
+     "CMP_CMPDECMP_VBIF_READ_DATA_UCHE_CH0", "CMP",
+     "CMP: cmpdecmp vbif read data UCHE ch0", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_READ_DATA_UCHE_CH1, 0x2u,
+     "CMP_CMPDECMP_VBIF_READ_DATA_UCHE_CH1", "CMP",
+     "CMP: cmpdecmp vbif read data UCHE ch1", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_OUTPUT_TRANS, 0x2u,
+     "CMP_CMPDECMP_2D_OUTPUT_TRANS", "CMP", "CMP: cmpdecmp 2D output trans",
+     "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_VBIF_WRITE_DATA_UCHE, 0x2u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA_UCHE", "CMP",
+     "CMP: cmpdecmp vbif write data UCHE", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_DEPTH_WRITE_FLAG0_COUNT, 0x2u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG0_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag0 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAG0_COUNT, 0x2u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG0_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag0 count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_COLOR_WRITE_FLAGALPHA_COUNT, 0x2u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAGALPHA_COUNT", "CMP",
+     "CMP: cmpdecmp color write flagalpha count", "events"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_BUSY_CYCLES, 0x2u,
+     "CMP_CMPDECMP_2D_BUSY_CYCLES", "CMP", "CMP: cmpdecmp 2D busy cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_REORDER_STARVE_CYCLES, 0x2u,
+     "CMP_CMPDECMP_2D_REORDER_STARVE_CYCLES", "CMP",
+     "CMP: cmpdecmp 2D reorder starve cycles", "cycles"},
+    {HPC_GPU_ADRENO_A6XX_CMP_CMPDECMP_2D_PIXELS, 0x2u, "CMP_CMPDECMP_2D_PIXELS",
+     "CMP", "CMP: cmpdecmp 2D pixels", "events"},
+    // clang-format on
+};
+
+/// The displacement of each perfect hash bucket.
+static const uint16_t adreno_a6xx_counter_displacements[136] = {
+    60, 376, 5, 8, 2, 0, 45, 1, 0, 77, 47, 3, 0, 47, 589, 11, 113, 3, 16, 6, 49,
+    12, 51, 44, 2, 4, 0, 61, 22, 7, 125, 3, 26, 111, 14, 22, 4, 104, 41, 15, 96,
+    137, 0, 396, 60, 7, 454, 5, 2, 133, 115, 7, 1, 18, 17, 0, 24, 0, 194, 59,
+    24, 65, 192, 17, 9, 1266, 15, 10, 6, 54, 44, 1, 778, 20, 3, 0, 2, 835, 13,
+    464, 172, 4, 36, 2, 0, 360, 12, 469, 2, 20, 48, 176, 103, 5, 433, 95, 163,
+    226, 56, 212, 615, 133, 28, 43, 1433, 29, 0, 205, 25, 16, 8, 246, 818, 601,
+    11, 217, 11, 582, 6167, 29, 434, 2, 4, 400, 2663, 1345, 586, 22, 87, 74, 1,
+    8, 11, 1, 259, 1857,
+};
+
+/// The metadata index of each perfect hash slot.
+static const uint16_t adreno_a6xx_counter_slots[543] = {
+    161, 264, 482, 23, 199, 216, 56, 163, 439, 38, 310, 81, 494, 31, 457, 49,
+    170, 296, 536, 155, 435, 202, 139, 244, 211, 137, 507, 321, 215, 11, 58,
+    513, 123, 366, 312, 32, 436, 212, 79, 29, 114, 268, 133, 485, 431, 255, 83,
+    236, 391, 307, 26, 534, 172, 358, 521, 97, 315, 283, 360, 302, 538, 300,
+    336, 387, 517, 525, 144, 176, 405, 111, 86, 265, 416, 127, 248, 499, 364,
+    156, 295, 320, 217, 94, 59, 271, 340, 188, 481, 473, 424, 78, 330, 151, 394,
+    355, 333, 6, 112, 472, 73, 193, 410, 210, 338, 532, 169, 402, 452, 369, 260,
+    288, 7, 325, 476, 226, 184, 323, 153, 376, 430, 99, 159, 132, 135, 411, 50,
+    117, 71, 329, 444, 35, 341, 222, 542, 253, 266, 462, 208, 237, 475, 540,
+    456, 262, 126, 531, 447, 75, 359, 39, 19, 537, 427, 298, 342, 377, 63, 4,
+    207, 516, 453, 77, 392, 527, 198, 393, 420, 467, 134, 242, 386, 125, 181,
+    278, 498, 0, 441, 165, 64, 486, 185, 25, 104, 474, 261, 522, 34, 140, 157,
+    120, 378, 389, 414, 480, 72, 275, 301, 408, 131, 110, 367, 528, 471, 368,
+    519, 407, 290, 399, 395, 409, 339, 47, 385, 351, 105, 223, 449, 269, 380,
+    74, 293, 108, 403, 332, 45, 30, 273, 259, 371, 459, 257, 60, 146, 461, 142,
+    175, 381, 206, 451, 272, 443, 9, 251, 141, 80, 319, 413, 316, 520, 331, 347,
+    502, 149, 417, 324, 119, 314, 483, 44, 322, 150, 1, 84, 372, 514, 421, 487,
+    495, 162, 224, 313, 362, 318, 200, 284, 148, 194, 466, 465, 18, 448, 432,
+    69, 57, 62, 277, 373, 478, 488, 437, 458, 100, 5, 388, 379, 328, 173, 219,
+    464, 343, 116, 370, 195, 418, 171, 317, 61, 67, 204, 103, 455, 327, 270, 28,
+    87, 440, 203, 429, 426, 46, 501, 510, 37, 209, 2, 138, 113, 398, 503, 122,
+    229, 66, 8, 20, 479, 526, 361, 167, 201, 166, 518, 21, 267, 252, 254, 505,
+    70, 250, 406, 490, 294, 196, 214, 276, 285, 512, 221, 383, 14, 401, 27, 299,
+    145, 419, 348, 450, 335, 92, 238, 425, 51, 346, 16, 43, 53, 281, 24, 17,
+    249, 107, 213, 191, 256, 423, 118, 130, 397, 15, 493, 55, 93, 365, 182, 178,
+    179, 287, 240, 115, 76, 177, 263, 233, 308, 121, 186, 539, 535, 205, 400,
+    446, 422, 220, 180, 232, 85, 297, 164, 454, 143, 136, 228, 160, 326, 65,
+    354, 289, 246, 469, 102, 305, 504, 463, 530, 95, 477, 129, 158, 231, 152,
+    128, 303, 352, 98, 306, 350, 428, 197, 412, 241, 500, 396, 433, 41, 345,
+    230, 529, 508, 492, 515, 42, 470, 190, 187, 88, 258, 292, 247, 234, 12, 344,
+    375, 82, 274, 496, 484, 96, 434, 218, 511, 438, 533, 101, 390, 124, 174,
+    356, 91, 225, 304, 22, 154, 109, 33, 523, 235, 282, 489, 291, 404, 3, 279,
+    353, 334, 189, 491, 382, 415, 541, 13, 445, 90, 10, 311, 40, 89, 227, 442,
+    506, 374, 192, 243, 52, 286, 384, 497, 36, 460, 280, 363, 183, 349, 68, 468,
+    54, 48, 509, 337, 357, 106, 239, 168, 245, 147, 309, 524,
+};
+
+static const hpc_gpu_counter_registry_t adreno_a6xx_counter_registry = {
+    543,
+    adreno_a6xx_counter_infos,
+    2,
+    adreno_a6xx_series_names,
+    136,
+    adreno_a6xx_counter_displacements,
+    adreno_a6xx_counter_slots,
+};
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+const hpc_gpu_counter_registry_t *hpc_gpu_adreno_a6xx_get_counter_registry(
+    void) {
+  return &adreno_a6xx_counter_registry;
+}
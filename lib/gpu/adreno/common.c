@@ -21,7 +21,10 @@
 #include <unistd.h>
 
 #include "context.h"
+#include "counter_conversion.h"
+#include "group_capacities.h"
 #include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/pass_planner.h"
 
 static uint32_t adreno_common_counter_get_group(
     hpc_gpu_adreno_common_counter_t counter);
@@ -30,59 +33,87 @@ static uint32_t adreno_common_counter_convert_to_a6xx(
 static uint32_t adreno_common_counter_convert_to_a5xx(
     hpc_gpu_adreno_common_counter_t counter);
 
-int hpc_gpu_adreno_common_create_context(
-    uint32_t num_counters, hpc_gpu_adreno_common_counter_t *counters,
-    const hpc_gpu_host_allocation_callbacks_t *allocator,
-    hpc_gpu_adreno_context_t **out_context) {
-  int status = hpc_gpu_adreno_create_context(num_counters, counters, allocator,
-                                             out_context);
-  if (status < 0) return status;
-
-  hpc_gpu_adreno_context_t *context = *out_context;
-  int gpu_device = context->gpu_device;
+/// Decodes counters into their groups and selectors for the current GPU and
+/// reserves them.
+static int adreno_common_setup_context(
+    hpc_gpu_adreno_context_t *context, uint32_t num_counters,
+    const hpc_gpu_adreno_common_counter_t *counters) {
   hpc_gpu_adreno_series_t series = hpc_gpu_adreno_get_series(context->gpu_id);
 
   switch (series) {
     case HPC_GPU_ADRENO_SERIES_UNKNOWN:
       return -HPC_GPU_ERROR_UNKNOWN_DEVICE;
     case HPC_GPU_ADRENO_SERIES_A6XX:
-      for (int i = 0; i < num_counters; ++i) {
-        uint32_t group_id = adreno_common_counter_get_group(counters[i]);
-        uint32_t countable_selector =
-            adreno_common_counter_convert_to_a6xx(counters[i]);
-        context->counters[i].group_id = group_id;
-        context->counters[i].countable_selector = countable_selector;
-        hpc_gpu_adreno_ioctl_activate_counter(gpu_device, group_id,
-                                              countable_selector);
-      }
-      break;
     case HPC_GPU_ADRENO_SERIES_A5XX:
-      for (int i = 0; i < num_counters; ++i) {
-        uint32_t group_id = adreno_common_counter_get_group(counters[i]);
-        uint32_t countable_selector =
-            adreno_common_counter_convert_to_a5xx(counters[i]);
-        context->counters[i].group_id = group_id;
-        context->counters[i].countable_selector = countable_selector;
-        hpc_gpu_adreno_ioctl_activate_counter(gpu_device, group_id,
-                                              countable_selector);
-      }
       break;
   }
 
+  for (int i = 0; i < num_counters; ++i) {
+    uint32_t countable_selector =
+        hpc_gpu_adreno_common_convert_counter(counters[i], series);
+    if (countable_selector == ~0u) return -HPC_GPU_ERROR_UNSUPPORTED_COUNTER;
+    context->counters[i].group_id =
+        adreno_common_counter_get_group(counters[i]);
+    context->counters[i].countable_selector = countable_selector;
+  }
+
+  hpc_gpu_adreno_context_reserve_counters(context);
   return 0;
 }
 
+int hpc_gpu_adreno_common_create_context(
+    uint32_t num_counters, hpc_gpu_adreno_common_counter_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context) {
+  int status = hpc_gpu_adreno_create_context(num_counters, counters,
+                                             output_mode, allocator,
+                                             out_context);
+  if (status < 0) return status;
+  status = adreno_common_setup_context(*out_context, num_counters, counters);
+  if (status < 0) hpc_gpu_adreno_destroy_context(*out_context, allocator);
+  return status;
+}
+
+void hpc_gpu_adreno_common_get_context_memory_requirements(
+    uint32_t num_counters, size_t *size, size_t *alignment) {
+  hpc_gpu_adreno_get_context_memory_requirements(num_counters, size,
+                                                 alignment);
+}
+
+int hpc_gpu_adreno_common_create_context_in_memory(
+    uint32_t num_counters, hpc_gpu_adreno_common_counter_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode, void *memory,
+    hpc_gpu_adreno_context_t **out_context) {
+  int status = hpc_gpu_adreno_create_context_in_memory(
+      num_counters, counters, output_mode, memory, out_context);
+  if (status < 0) return status;
+  status = adreno_common_setup_context(*out_context, num_counters, counters);
+  if (status < 0) hpc_gpu_adreno_destroy_context_in_memory(*out_context);
+  return status;
+}
+
 int hpc_gpu_adreno_common_destroy_context(
     hpc_gpu_adreno_context_t *context,
     const hpc_gpu_host_allocation_callbacks_t *allocator) {
   return hpc_gpu_adreno_destroy_context(context, allocator);
 }
 
-int hpc_gpu_adreno_common_start_counters(
-    const hpc_gpu_adreno_context_t *context) {
+int hpc_gpu_adreno_common_destroy_context_in_memory(
+    hpc_gpu_adreno_context_t *context) {
+  return hpc_gpu_adreno_destroy_context_in_memory(context);
+}
+
+int hpc_gpu_adreno_common_start_counters(hpc_gpu_adreno_context_t *context) {
   return hpc_gpu_adreno_context_start_counters(context);
 }
 
+int hpc_gpu_adreno_common_start_counters_multiplexed(
+    hpc_gpu_adreno_context_t *context, uint64_t rotation_period_ns) {
+  return hpc_gpu_adreno_context_start_counters_multiplexed(context,
+                                                           rotation_period_ns);
+}
+
 int hpc_gpu_adreno_common_stop_counters(
     const hpc_gpu_adreno_context_t *context) {
   return hpc_gpu_adreno_context_stop_counters(context);
@@ -93,6 +124,48 @@ int hpc_gpu_adreno_common_query_counters(hpc_gpu_adreno_context_t *context,
   return hpc_gpu_adreno_context_query_counters(context, values);
 }
 
+int hpc_gpu_adreno_common_query_counters_with_times(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  return hpc_gpu_adreno_context_query_counters_with_times(context, values,
+                                                          times);
+}
+
+int hpc_gpu_adreno_common_get_multiplexing_times(
+    const hpc_gpu_adreno_context_t *context, uint64_t *time_enabled_ns,
+    uint64_t *time_running_ns) {
+  return hpc_gpu_adreno_context_get_multiplexing_times(
+      context, time_enabled_ns, time_running_ns);
+}
+
+int hpc_gpu_adreno_common_plan_passes(
+    uint32_t num_counters, const hpc_gpu_adreno_common_counter_t *counters,
+    const uint32_t *counter_sets,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    uint32_t *counter_passes, uint32_t *num_passes) {
+  hpc_gpu_pass_plan_info_t plan_info;
+  plan_info.num_counters = num_counters;
+  plan_info.counters = (const uint32_t *)counters;
+  plan_info.counter_sets = counter_sets;
+  plan_info.num_groups = HPC_GPU_ADRENO_COMMON_NUM_GROUPS;
+  plan_info.group_capacities = hpc_gpu_adreno_common_group_capacities;
+  return hpc_gpu_plan_passes(&plan_info, allocator, counter_passes,
+                             num_passes);
+}
+
+uint32_t hpc_gpu_adreno_common_convert_counter(uint32_t counter,
+                                               hpc_gpu_adreno_series_t series) {
+  switch (series) {
+    case HPC_GPU_ADRENO_SERIES_UNKNOWN:
+      return ~0u;
+    case HPC_GPU_ADRENO_SERIES_A6XX:
+      return adreno_common_counter_convert_to_a6xx(counter);
+    case HPC_GPU_ADRENO_SERIES_A5XX:
+      return adreno_common_counter_convert_to_a5xx(counter);
+  }
+  return ~0u;
+}
+
 //===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
 
 static inline uint32_t adreno_common_counter_get_group(
@@ -100,738 +173,117 @@ static inline uint32_t adreno_common_counter_get_group(
   return counter >> 8u;
 }
 
-static uint32_t adreno_common_counter_convert_to_a6xx(
+/// The number of counter groups covered by the selector tables.
+#define ADRENO_COMMON_NUM_GROUPS 27u
+/// The selector table entry for values not naming a common counter.
+#define ADRENO_COMMON_NO_SELECTOR 0xffu
+
+/// The start of each group's entries in the selector tables, indexed by group
+/// ID. A counter's entry is at its group's start plus its selector bits.
+static const uint16_t adreno_common_group_starts[28] = {
+    // clang-format off
+    0, 14, 28, 65, 87, 98, 109, 127, 137, 167, 205, 267, 312, 312, 312, 312,
+    312, 312, 312, 312, 312, 312, 312, 312, 316, 345, 364, 394,
+    // clang-format on
+};
+
+/// Countable selectors of common counters in the A6XX series.
+static const uint8_t adreno_common_a6xx_selectors[394] = {
+    // clang-format off
+    /* CP */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    /* RBBM */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    /* PC */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+             36,
+    /* VFD */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+              19, 20, 21,
+    /* HLSQ */ 0, 1, 2, 3, 4, 5, 0xffu, 0xffu, 8, 9, 10,
+    /* VPC */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    /* TSE */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    /* RAS */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    /* UCHE */ 0, 0xffu, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+               18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    /* TP */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+             36, 37,
+    /* SP */ 0, 1, 2, 3, 4, 5, 6, 0xffu, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+             18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+             35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+             52, 53, 54, 55, 56, 57, 58, 0xffu, 0xffu, 61,
+    /* RB */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 0xffu, 23, 24, 25, 26, 27, 28, 0xffu, 0xffu, 0xffu,
+             0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+             0xffu, 0xffu, 0xffu, 44,
+    /* VSC */ 0, 1, 2, 3,
+    /* CCU */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0xffu,
+              0xffu, 0xffu, 19, 20, 21, 22, 23, 0xffu, 0xffu, 0xffu, 27, 28,
+    /* LRZ */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    /* CMP */ 0xffu, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 0xffu,
+              0xffu, 0xffu, 18, 19, 20, 21, 0xffu, 0xffu, 0xffu, 25, 26, 27, 28,
+              29,
+    // clang-format on
+};
+
+/// Countable selectors of common counters in the A5XX series.
+static const uint8_t adreno_common_a5xx_selectors[394] = {
+    // clang-format off
+    /* CP */ 0, 1, 2, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    /* RBBM */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    /* PC */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+             36,
+    /* VFD */ 0, 1, 2, 5, 6, 10, 11, 12, 13, 14, 16, 17, 18, 19, 20, 21, 22, 23,
+              26, 27, 28, 29,
+    /* HLSQ */ 0, 1, 2, 3, 4, 5, 0xffu, 0xffu, 8, 13, 14,
+    /* VPC */ 0, 1, 2, 3, 4, 5, 6, 8, 9, 10, 11,
+    /* TSE */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+    /* RAS */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    /* UCHE */ 0, 0xffu, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+               18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    /* TP */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 22, 25, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39,
+             40, 41,
+    /* SP */ 0, 1, 2, 3, 4, 5, 6, 0xffu, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+             18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 35,
+             36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+             53, 56, 57, 58, 59, 60, 61, 0xffu, 0xffu, 64,
+    /* RB */ 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+             20, 21, 22, 0xffu, 24, 25, 26, 27, 28, 29, 0xffu, 0xffu, 0xffu,
+             0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+             0xffu, 0xffu, 0xffu, 1,
+    /* VSC */ 0, 1, 2, 3,
+    /* CCU */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0xffu,
+              0xffu, 0xffu, 16, 17, 18, 19, 20, 0xffu, 0xffu, 0xffu, 22, 23,
+    /* LRZ */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    /* CMP */ 0xffu, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 0xffu,
+              0xffu, 0xffu, 15, 16, 17, 18, 0xffu, 0xffu, 0xffu, 19, 20, 21, 22,
+              23,
+    // clang-format on
+};
+
+/// Converts a common counter to its countable selector using the given
+/// selector table. Returns ~0u if the counter is unavailable.
+static uint32_t adreno_common_counter_convert(
+    const uint8_t *selectors, hpc_gpu_adreno_common_counter_t counter) {
+  uint32_t group = counter >> 8u;
+  uint32_t index = counter & (256u - 1u);
+  if (group >= ADRENO_COMMON_NUM_GROUPS) return ~0u;
+  uint32_t start = adreno_common_group_starts[group];
+  if (index >= adreno_common_group_starts[group + 1] - start) return ~0u;
+  uint32_t selector = selectors[start + index];
+  return selector == ADRENO_COMMON_NO_SELECTOR ? ~0u : selector;
+}
+
+static inline uint32_t adreno_common_counter_convert_to_a6xx(
     hpc_gpu_adreno_common_counter_t counter) {
-  // clang-format off
-  switch (counter) {
-    case HPC_GPU_ADRENO_COMMON_CP_ALWAYS_COUNT: return 0;
-    case HPC_GPU_ADRENO_COMMON_CP_BUSY_GFX_CORE_IDLE: return 1;
-    case HPC_GPU_ADRENO_COMMON_CP_BUSY_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_CP_NUM_PREEMPTIONS: return 3;
-    case HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_REACTION_DELAY: return 4;
-    case HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_SWITCH_OUT_TIME: return 5;
-    case HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_SWITCH_IN_TIME: return 6;
-    case HPC_GPU_ADRENO_COMMON_CP_DEAD_DRAWS_IN_BIN_RENDER: return 7;
-    case HPC_GPU_ADRENO_COMMON_CP_PREDICATED_DRAWS_KILLED: return 8;
-    case HPC_GPU_ADRENO_COMMON_CP_MODE_SWITCH: return 9;
-    case HPC_GPU_ADRENO_COMMON_CP_ZPASS_DONE: return 10;
-    case HPC_GPU_ADRENO_COMMON_CP_CONTEXT_DONE: return 11;
-    case HPC_GPU_ADRENO_COMMON_CP_CACHE_FLUSH: return 12;
-    case HPC_GPU_ADRENO_COMMON_CP_LONG_PREEMPTIONS: return 13;
-    case HPC_GPU_ADRENO_COMMON_RBBM_ALWAYS_COUNT: return 0;
-    case HPC_GPU_ADRENO_COMMON_RBBM_ALWAYS_ON: return 1;
-    case HPC_GPU_ADRENO_COMMON_RBBM_TSE_BUSY: return 2;
-    case HPC_GPU_ADRENO_COMMON_RBBM_RAS_BUSY: return 3;
-    case HPC_GPU_ADRENO_COMMON_RBBM_PC_DCALL_BUSY: return 4;
-    case HPC_GPU_ADRENO_COMMON_RBBM_PC_VSD_BUSY: return 5;
-    case HPC_GPU_ADRENO_COMMON_RBBM_STATUS_MASKED: return 6;
-    case HPC_GPU_ADRENO_COMMON_RBBM_COM_BUSY: return 7;
-    case HPC_GPU_ADRENO_COMMON_RBBM_DCOM_BUSY: return 8;
-    case HPC_GPU_ADRENO_COMMON_RBBM_VBIF_BUSY: return 9;
-    case HPC_GPU_ADRENO_COMMON_RBBM_VSC_BUSY: return 10;
-    case HPC_GPU_ADRENO_COMMON_RBBM_TESS_BUSY: return 11;
-    case HPC_GPU_ADRENO_COMMON_RBBM_UCHE_BUSY: return 12;
-    case HPC_GPU_ADRENO_COMMON_RBBM_HLSQ_BUSY: return 13;
-    case HPC_GPU_ADRENO_COMMON_PC_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_PC_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VFD: return 2;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TSE: return 3;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VPC: return 4;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_UCHE: return 5;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TESS: return 6;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TSE_ONLY: return 7;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VPC_ONLY: return 8;
-    case HPC_GPU_ADRENO_COMMON_PC_PASS1_TF_STALL_CYCLES: return 9;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_INDEX: return 10;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_TESS_FACTOR: return 11;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_VIZ_STREAM: return 12;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_POSITION: return 13;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_DI: return 14;
-    case HPC_GPU_ADRENO_COMMON_PC_VIS_STREAMS_LOADED: return 15;
-    case HPC_GPU_ADRENO_COMMON_PC_INSTANCES: return 16;
-    case HPC_GPU_ADRENO_COMMON_PC_VPC_PRIMITIVES: return 17;
-    case HPC_GPU_ADRENO_COMMON_PC_DEAD_PRIM: return 18;
-    case HPC_GPU_ADRENO_COMMON_PC_LIVE_PRIM: return 19;
-    case HPC_GPU_ADRENO_COMMON_PC_VERTEX_HITS: return 20;
-    case HPC_GPU_ADRENO_COMMON_PC_IA_VERTICES: return 21;
-    case HPC_GPU_ADRENO_COMMON_PC_IA_PRIMITIVES: return 22;
-    case HPC_GPU_ADRENO_COMMON_PC_GS_PRIMITIVES: return 23;
-    case HPC_GPU_ADRENO_COMMON_PC_HS_INVOCATIONS: return 24;
-    case HPC_GPU_ADRENO_COMMON_PC_DS_INVOCATIONS: return 25;
-    case HPC_GPU_ADRENO_COMMON_PC_VS_INVOCATIONS: return 26;
-    case HPC_GPU_ADRENO_COMMON_PC_GS_INVOCATIONS: return 27;
-    case HPC_GPU_ADRENO_COMMON_PC_DS_PRIMITIVES: return 28;
-    case HPC_GPU_ADRENO_COMMON_PC_VPC_POS_DATA_TRANSACTION: return 29;
-    case HPC_GPU_ADRENO_COMMON_PC_3D_DRAWCALLS: return 30;
-    case HPC_GPU_ADRENO_COMMON_PC_2D_DRAWCALLS: return 31;
-    case HPC_GPU_ADRENO_COMMON_PC_NON_DRAWCALL_GLOBAL_EVENTS: return 32;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_BUSY_CYCLES: return 33;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_WORKING_CYCLES: return 34;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_STALL_CYCLES_PC: return 35;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_STARVE_CYCLES_PC: return 36;
-    case HPC_GPU_ADRENO_COMMON_VFD_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_UCHE: return 1;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_VPC_ALLOC: return 2;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_SP_INFO: return 3;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_SP_ATTR: return 4;
-    case HPC_GPU_ADRENO_COMMON_VFD_STARVE_CYCLES_UCHE: return 5;
-    case HPC_GPU_ADRENO_COMMON_VFD_RBUFFER_FULL: return 6;
-    case HPC_GPU_ADRENO_COMMON_VFD_ATTR_INFO_FIFO_FULL: return 7;
-    case HPC_GPU_ADRENO_COMMON_VFD_DECODED_ATTRIBUTE_BYTES: return 8;
-    case HPC_GPU_ADRENO_COMMON_VFD_NUM_ATTRIBUTES: return 9;
-    case HPC_GPU_ADRENO_COMMON_VFD_UPPER_SHADER_FIBERS: return 10;
-    case HPC_GPU_ADRENO_COMMON_VFD_LOWER_SHADER_FIBERS: return 11;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_0_FIBERS: return 12;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_1_FIBERS: return 13;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_2_FIBERS: return 14;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_3_FIBERS: return 15;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_4_FIBERS: return 16;
-    case HPC_GPU_ADRENO_COMMON_VFD_TOTAL_VERTICES: return 17;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD: return 18;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD_INDEX: return 19;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD_PROG: return 20;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STARVE_CYCLES_PC: return 21;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_UCHE: return 1;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_SP_STATE: return 2;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_SP_FS_STAGE: return 3;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_UCHE_LATENCY_CYCLES: return 4;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_UCHE_LATENCY_COUNT: return 5;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_QUADS: return 8;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_CS_INVOCATIONS: return 9;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_COMPUTE_DRAWCALLS: return 10;
-    case HPC_GPU_ADRENO_COMMON_VPC_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_VPC_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_UCHE: return 2;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_VFD_WACK: return 3;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC: return 4;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_PC: return 5;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_SP_LM: return 6;
-    case HPC_GPU_ADRENO_COMMON_VPC_STARVE_CYCLES_SP: return 7;
-    case HPC_GPU_ADRENO_COMMON_VPC_STARVE_CYCLES_LRZ: return 8;
-    case HPC_GPU_ADRENO_COMMON_VPC_PC_PRIMITIVES: return 9;
-    case HPC_GPU_ADRENO_COMMON_VPC_SP_COMPONENTS: return 10;
-    case HPC_GPU_ADRENO_COMMON_TSE_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_TSE_CLIPPING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_RAS: return 2;
-    case HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_BARYPLANE: return 3;
-    case HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_ZPLANE: return 4;
-    case HPC_GPU_ADRENO_COMMON_TSE_STARVE_CYCLES_PC: return 5;
-    case HPC_GPU_ADRENO_COMMON_TSE_INPUT_PRIM: return 6;
-    case HPC_GPU_ADRENO_COMMON_TSE_INPUT_NULL_PRIM: return 7;
-    case HPC_GPU_ADRENO_COMMON_TSE_TRIVAL_REJ_PRIM: return 8;
-    case HPC_GPU_ADRENO_COMMON_TSE_CLIPPED_PRIM: return 9;
-    case HPC_GPU_ADRENO_COMMON_TSE_ZERO_AREA_PRIM: return 10;
-    case HPC_GPU_ADRENO_COMMON_TSE_FACENESS_CULLED_PRIM: return 11;
-    case HPC_GPU_ADRENO_COMMON_TSE_ZERO_PIXEL_PRIM: return 12;
-    case HPC_GPU_ADRENO_COMMON_TSE_OUTPUT_NULL_PRIM: return 13;
-    case HPC_GPU_ADRENO_COMMON_TSE_OUTPUT_VISIBLE_PRIM: return 14;
-    case HPC_GPU_ADRENO_COMMON_TSE_CINVOCATION: return 15;
-    case HPC_GPU_ADRENO_COMMON_TSE_CPRIMITIVES: return 16;
-    case HPC_GPU_ADRENO_COMMON_TSE_2D_INPUT_PRIM: return 17;
-    case HPC_GPU_ADRENO_COMMON_RAS_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_RAS_SUPERTILE_ACTIVE_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_RAS_STALL_CYCLES_LRZ: return 2;
-    case HPC_GPU_ADRENO_COMMON_RAS_STARVE_CYCLES_TSE: return 3;
-    case HPC_GPU_ADRENO_COMMON_RAS_SUPER_TILES: return 4;
-    case HPC_GPU_ADRENO_COMMON_RAS_8X4_TILES: return 5;
-    case HPC_GPU_ADRENO_COMMON_RAS_MASKGEN_ACTIVE: return 6;
-    case HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_SUPER_TILES: return 7;
-    case HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_8X4_TILES: return 8;
-    case HPC_GPU_ADRENO_COMMON_RAS_PRIM_KILLED_INVISILBE: return 9;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_LATENCY_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_LATENCY_SAMPLES: return 3;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_TP: return 4;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_VFD: return 5;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_HLSQ: return 6;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_LRZ: return 7;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_SP: return 8;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_TP: return 9;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_VFD: return 10;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_HLSQ: return 11;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_LRZ: return 12;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_SP: return 13;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_LRZ: return 14;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_SP: return 15;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_VPC: return 16;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_VSC: return 17;
-    case HPC_GPU_ADRENO_COMMON_UCHE_EVICTS: return 18;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ0: return 19;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ1: return 20;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ2: return 21;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ3: return 22;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ4: return 23;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ5: return 24;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ6: return 25;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ7: return 26;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_CH0: return 27;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_CH1: return 28;
-    case HPC_GPU_ADRENO_COMMON_UCHE_GMEM_READ_BEATS: return 29;
-    case HPC_GPU_ADRENO_COMMON_TP_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_TP_STALL_CYCLES_UCHE: return 1;
-    case HPC_GPU_ADRENO_COMMON_TP_LATENCY_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_TP_LATENCY_TRANS: return 3;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUEST_SAMPLES: return 4;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUEST_LATENCY: return 5;
-    case HPC_GPU_ADRENO_COMMON_TP_L1_CACHELINE_REQUESTS: return 6;
-    case HPC_GPU_ADRENO_COMMON_TP_L1_CACHELINE_MISSES: return 7;
-    case HPC_GPU_ADRENO_COMMON_TP_SP_TP_TRANS: return 8;
-    case HPC_GPU_ADRENO_COMMON_TP_TP_SP_TRANS: return 9;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS: return 10;
-    case HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_16BIT: return 11;
-    case HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_32BIT: return 12;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_RECEIVED: return 13;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_OFFSET: return 14;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_SHADOW: return 15;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_ARRAY: return 16;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_GRADIENT: return 17;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_1D: return 18;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_2D: return 19;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_BUFFER: return 20;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_3D: return 21;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_CUBE: return 22;
-    case HPC_GPU_ADRENO_COMMON_TP_DIVERGENT_QUADS_RECEIVED: return 23;
-    case HPC_GPU_ADRENO_COMMON_TP_PRT_NON_RESIDENT_EVENTS: return 24;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_POINT: return 25;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_BILINEAR: return 26;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_MIP: return 27;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_ANISO: return 28;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_ZERO_LOD: return 29;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUESTS: return 30;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_MISSES: return 31;
-    case HPC_GPU_ADRENO_COMMON_TP_L1_5_L2_REQUESTS: return 32;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS: return 33;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_POINT: return 34;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_BILINEAR: return 35;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_FILTER_WORKLOAD_16BIT: return 36;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_FILTER_WORKLOAD_32BIT: return 37;
-    case HPC_GPU_ADRENO_COMMON_SP_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_SP_ALU_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_SP_EFU_WORKING_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_VPC: return 3;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_TP: return 4;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_UCHE: return 5;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_RB: return 6;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_CONTEXTS: return 8;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_CONTEXT_CYCLES: return 9;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_WAVE_CYCLES: return 10;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_WAVE_SAMPLES: return 11;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_WAVE_CYCLES: return 12;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_WAVE_SAMPLES: return 13;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_DURATION_CYCLES: return 14;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_DURATION_CYCLES: return 15;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_CTRL_CYCLES: return 16;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_LOAD_CYCLES: return 17;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_EMIT_CYCLES: return 18;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_NOP_CYCLES: return 19;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_WAIT_CYCLES: return 20;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_FETCH_CYCLES: return 21;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_IDLE_CYCLES: return 22;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_END_CYCLES: return 23;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_LONG_SYNC_CYCLES: return 24;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_SHORT_SYNC_CYCLES: return 25;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_JOIN_CYCLES: return 26;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_LOAD_INSTRUCTIONS: return 27;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_STORE_INSTRUCTIONS: return 28;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_ATOMICS: return 29;
-    case HPC_GPU_ADRENO_COMMON_SP_GM_LOAD_INSTRUCTIONS: return 30;
-    case HPC_GPU_ADRENO_COMMON_SP_GM_STORE_INSTRUCTIONS: return 31;
-    case HPC_GPU_ADRENO_COMMON_SP_GM_ATOMICS: return 32;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_TEX_INSTRUCTIONS: return 33;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_EFU_INSTRUCTIONS: return 34;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_FULL_ALU_INSTRUCTIONS: return 35;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_HALF_ALU_INSTRUCTIONS: return 36;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_TEX_INSTRUCTIONS: return 37;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_CFLOW_INSTRUCTIONS: return 38;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_EFU_INSTRUCTIONS: return 39;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_FULL_ALU_INSTRUCTIONS: return 40;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_HALF_ALU_INSTRUCTIONS: return 41;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_BARY_INSTRUCTIONS: return 42;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_INSTRUCTIONS: return 43;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_INSTRUCTIONS: return 44;
-    case HPC_GPU_ADRENO_COMMON_SP_ADDR_LOCK_COUNT: return 45;
-    case HPC_GPU_ADRENO_COMMON_SP_UCHE_READ_TRANS: return 46;
-    case HPC_GPU_ADRENO_COMMON_SP_UCHE_WRITE_TRANS: return 47;
-    case HPC_GPU_ADRENO_COMMON_SP_EXPORT_VPC_TRANS: return 48;
-    case HPC_GPU_ADRENO_COMMON_SP_EXPORT_RB_TRANS: return 49;
-    case HPC_GPU_ADRENO_COMMON_SP_PIXELS_KILLED: return 50;
-    case HPC_GPU_ADRENO_COMMON_SP_ICL1_REQUESTS: return 51;
-    case HPC_GPU_ADRENO_COMMON_SP_ICL1_MISSES: return 52;
-    case HPC_GPU_ADRENO_COMMON_SP_HS_INSTRUCTIONS: return 53;
-    case HPC_GPU_ADRENO_COMMON_SP_DS_INSTRUCTIONS: return 54;
-    case HPC_GPU_ADRENO_COMMON_SP_GS_INSTRUCTIONS: return 55;
-    case HPC_GPU_ADRENO_COMMON_SP_CS_INSTRUCTIONS: return 56;
-    case HPC_GPU_ADRENO_COMMON_SP_GPR_READ: return 57;
-    case HPC_GPU_ADRENO_COMMON_SP_GPR_WRITE: return 58;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_BANK_CONFLICTS: return 61;
-    case HPC_GPU_ADRENO_COMMON_RB_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_HLSQ: return 1;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO0_FULL: return 2;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO1_FULL: return 3;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO2_FULL: return 4;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_SP: return 5;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_LRZ_TILE: return 6;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_CCU: return 7;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_Z_PLANE: return 8;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_BARY_PLANE: return 9;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_WORKLOAD: return 10;
-    case HPC_GPU_ADRENO_COMMON_RB_HLSQ_ACTIVE: return 11;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_READ: return 12;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_WRITE: return 13;
-    case HPC_GPU_ADRENO_COMMON_RB_C_READ: return 14;
-    case HPC_GPU_ADRENO_COMMON_RB_C_WRITE: return 15;
-    case HPC_GPU_ADRENO_COMMON_RB_TOTAL_PASS: return 16;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_PASS: return 17;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_FAIL: return 18;
-    case HPC_GPU_ADRENO_COMMON_RB_S_FAIL: return 19;
-    case HPC_GPU_ADRENO_COMMON_RB_BLENDED_FXP_COMPONENTS: return 20;
-    case HPC_GPU_ADRENO_COMMON_RB_BLENDED_FP16_COMPONENTS: return 21;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_ALIVE_CYCLES: return 23;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STALL_CYCLES_A2D: return 24;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_SRC: return 25;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_SP: return 26;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_DST: return 27;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_VALID_PIXELS: return 28;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_CCU: return 44;
-    case HPC_GPU_ADRENO_COMMON_VSC_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_VSC_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_VSC_STALL_CYCLES_UCHE: return 2;
-    case HPC_GPU_ADRENO_COMMON_VSC_EOT_NUM: return 3;
-    case HPC_GPU_ADRENO_COMMON_CCU_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_CCU_STALL_CYCLES_RB_DEPTH_RETURN: return 1;
-    case HPC_GPU_ADRENO_COMMON_CCU_STALL_CYCLES_RB_COLOR_RETURN: return 2;
-    case HPC_GPU_ADRENO_COMMON_CCU_STARVE_CYCLES_FLAG_RETURN: return 3;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_BLOCKS: return 4;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_BLOCKS: return 5;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_BLOCK_HIT: return 6;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_BLOCK_HIT: return 7;
-    case HPC_GPU_ADRENO_COMMON_CCU_PARTIAL_BLOCK_READ: return 8;
-    case HPC_GPU_ADRENO_COMMON_CCU_GMEM_READ: return 9;
-    case HPC_GPU_ADRENO_COMMON_CCU_GMEM_WRITE: return 10;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG0_COUNT: return 11;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG1_COUNT: return 12;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG2_COUNT: return 13;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG3_COUNT: return 14;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG4_COUNT: return 15;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG0_COUNT: return 19;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG1_COUNT: return 20;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG2_COUNT: return 21;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG3_COUNT: return 22;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG4_COUNT: return 23;
-    case HPC_GPU_ADRENO_COMMON_CCU_2D_RD_REQ: return 27;
-    case HPC_GPU_ADRENO_COMMON_CCU_2D_WR_REQ: return 28;
-    case HPC_GPU_ADRENO_COMMON_LRZ_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STARVE_CYCLES_RAS: return 1;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_RB: return 2;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_VSC: return 3;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_VPC: return 4;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_FLAG_PREFETCH: return 5;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_UCHE: return 6;
-    case HPC_GPU_ADRENO_COMMON_LRZ_LRZ_READ: return 7;
-    case HPC_GPU_ADRENO_COMMON_LRZ_LRZ_WRITE: return 8;
-    case HPC_GPU_ADRENO_COMMON_LRZ_READ_LATENCY: return 9;
-    case HPC_GPU_ADRENO_COMMON_LRZ_MERGE_CACHE_UPDATING: return 10;
-    case HPC_GPU_ADRENO_COMMON_LRZ_PRIM_KILLED_BY_MASKGEN: return 11;
-    case HPC_GPU_ADRENO_COMMON_LRZ_PRIM_KILLED_BY_LRZ: return 12;
-    case HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PRIM_AFTER_LRZ: return 13;
-    case HPC_GPU_ADRENO_COMMON_LRZ_FULL_8X8_TILES: return 14;
-    case HPC_GPU_ADRENO_COMMON_LRZ_PARTIAL_8X8_TILES: return 15;
-    case HPC_GPU_ADRENO_COMMON_LRZ_TILE_KILLED: return 16;
-    case HPC_GPU_ADRENO_COMMON_LRZ_TOTAL_PIXEL: return 17;
-    case HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PIXEL_AFTER_LRZ: return 18;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_LATENCY_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_LATENCY_SAMPLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_DATA_CCU: return 3;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_DATA_CCU: return 4;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_REQUEST: return 5;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_REQUEST: return 6;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_DATA: return 7;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_DATA: return 8;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_FLAG_FETCH_CYCLES: return 9;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_FLAG_FETCH_SAMPLES: return 10;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT: return 11;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT: return 12;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT: return 13;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT: return 14;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT: return 18;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT: return 19;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT: return 20;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT: return 21;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ: return 25;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR: return 26;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN: return 27;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_RD_DATA: return 28;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_WR_DATA: return 29;
-  }
-  // clang-format on
+  return adreno_common_counter_convert(adreno_common_a6xx_selectors,
+                                       counter);
 }
 
-static uint32_t adreno_common_counter_convert_to_a5xx(
+static inline uint32_t adreno_common_counter_convert_to_a5xx(
     hpc_gpu_adreno_common_counter_t counter) {
-  // clang-format off
-  switch (counter) {
-    case HPC_GPU_ADRENO_COMMON_CP_ALWAYS_COUNT: return 0;
-    case HPC_GPU_ADRENO_COMMON_CP_BUSY_GFX_CORE_IDLE: return 1;
-    case HPC_GPU_ADRENO_COMMON_CP_BUSY_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_CP_NUM_PREEMPTIONS: return 20;
-    case HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_REACTION_DELAY: return 21;
-    case HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_SWITCH_OUT_TIME: return 22;
-    case HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_SWITCH_IN_TIME: return 23;
-    case HPC_GPU_ADRENO_COMMON_CP_DEAD_DRAWS_IN_BIN_RENDER: return 24;
-    case HPC_GPU_ADRENO_COMMON_CP_PREDICATED_DRAWS_KILLED: return 25;
-    case HPC_GPU_ADRENO_COMMON_CP_MODE_SWITCH: return 26;
-    case HPC_GPU_ADRENO_COMMON_CP_ZPASS_DONE: return 27;
-    case HPC_GPU_ADRENO_COMMON_CP_CONTEXT_DONE: return 28;
-    case HPC_GPU_ADRENO_COMMON_CP_CACHE_FLUSH: return 29;
-    case HPC_GPU_ADRENO_COMMON_CP_LONG_PREEMPTIONS: return 30;
-    case HPC_GPU_ADRENO_COMMON_RBBM_ALWAYS_COUNT: return 0;
-    case HPC_GPU_ADRENO_COMMON_RBBM_ALWAYS_ON: return 1;
-    case HPC_GPU_ADRENO_COMMON_RBBM_TSE_BUSY: return 2;
-    case HPC_GPU_ADRENO_COMMON_RBBM_RAS_BUSY: return 3;
-    case HPC_GPU_ADRENO_COMMON_RBBM_PC_DCALL_BUSY: return 4;
-    case HPC_GPU_ADRENO_COMMON_RBBM_PC_VSD_BUSY: return 5;
-    case HPC_GPU_ADRENO_COMMON_RBBM_STATUS_MASKED: return 6;
-    case HPC_GPU_ADRENO_COMMON_RBBM_COM_BUSY: return 7;
-    case HPC_GPU_ADRENO_COMMON_RBBM_DCOM_BUSY: return 8;
-    case HPC_GPU_ADRENO_COMMON_RBBM_VBIF_BUSY: return 9;
-    case HPC_GPU_ADRENO_COMMON_RBBM_VSC_BUSY: return 10;
-    case HPC_GPU_ADRENO_COMMON_RBBM_TESS_BUSY: return 11;
-    case HPC_GPU_ADRENO_COMMON_RBBM_UCHE_BUSY: return 12;
-    case HPC_GPU_ADRENO_COMMON_RBBM_HLSQ_BUSY: return 13;
-    case HPC_GPU_ADRENO_COMMON_PC_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_PC_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VFD: return 2;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TSE: return 3;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VPC: return 4;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_UCHE: return 5;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TESS: return 6;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TSE_ONLY: return 7;
-    case HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VPC_ONLY: return 8;
-    case HPC_GPU_ADRENO_COMMON_PC_PASS1_TF_STALL_CYCLES: return 9;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_INDEX: return 10;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_TESS_FACTOR: return 11;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_VIZ_STREAM: return 12;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_POSITION: return 13;
-    case HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_DI: return 14;
-    case HPC_GPU_ADRENO_COMMON_PC_VIS_STREAMS_LOADED: return 15;
-    case HPC_GPU_ADRENO_COMMON_PC_INSTANCES: return 16;
-    case HPC_GPU_ADRENO_COMMON_PC_VPC_PRIMITIVES: return 17;
-    case HPC_GPU_ADRENO_COMMON_PC_DEAD_PRIM: return 18;
-    case HPC_GPU_ADRENO_COMMON_PC_LIVE_PRIM: return 19;
-    case HPC_GPU_ADRENO_COMMON_PC_VERTEX_HITS: return 20;
-    case HPC_GPU_ADRENO_COMMON_PC_IA_VERTICES: return 21;
-    case HPC_GPU_ADRENO_COMMON_PC_IA_PRIMITIVES: return 22;
-    case HPC_GPU_ADRENO_COMMON_PC_GS_PRIMITIVES: return 23;
-    case HPC_GPU_ADRENO_COMMON_PC_HS_INVOCATIONS: return 24;
-    case HPC_GPU_ADRENO_COMMON_PC_DS_INVOCATIONS: return 25;
-    case HPC_GPU_ADRENO_COMMON_PC_VS_INVOCATIONS: return 26;
-    case HPC_GPU_ADRENO_COMMON_PC_GS_INVOCATIONS: return 27;
-    case HPC_GPU_ADRENO_COMMON_PC_DS_PRIMITIVES: return 28;
-    case HPC_GPU_ADRENO_COMMON_PC_VPC_POS_DATA_TRANSACTION: return 29;
-    case HPC_GPU_ADRENO_COMMON_PC_3D_DRAWCALLS: return 30;
-    case HPC_GPU_ADRENO_COMMON_PC_2D_DRAWCALLS: return 31;
-    case HPC_GPU_ADRENO_COMMON_PC_NON_DRAWCALL_GLOBAL_EVENTS: return 32;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_BUSY_CYCLES: return 33;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_WORKING_CYCLES: return 34;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_STALL_CYCLES_PC: return 35;
-    case HPC_GPU_ADRENO_COMMON_PC_TESS_STARVE_CYCLES_PC: return 36;
-    case HPC_GPU_ADRENO_COMMON_VFD_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_UCHE: return 1;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_VPC_ALLOC: return 2;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_SP_INFO: return 5;
-    case HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_SP_ATTR: return 6;
-    case HPC_GPU_ADRENO_COMMON_VFD_STARVE_CYCLES_UCHE: return 10;
-    case HPC_GPU_ADRENO_COMMON_VFD_RBUFFER_FULL: return 11;
-    case HPC_GPU_ADRENO_COMMON_VFD_ATTR_INFO_FIFO_FULL: return 12;
-    case HPC_GPU_ADRENO_COMMON_VFD_DECODED_ATTRIBUTE_BYTES: return 13;
-    case HPC_GPU_ADRENO_COMMON_VFD_NUM_ATTRIBUTES: return 14;
-    case HPC_GPU_ADRENO_COMMON_VFD_UPPER_SHADER_FIBERS: return 16;
-    case HPC_GPU_ADRENO_COMMON_VFD_LOWER_SHADER_FIBERS: return 17;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_0_FIBERS: return 18;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_1_FIBERS: return 19;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_2_FIBERS: return 20;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_3_FIBERS: return 21;
-    case HPC_GPU_ADRENO_COMMON_VFD_MODE_4_FIBERS: return 22;
-    case HPC_GPU_ADRENO_COMMON_VFD_TOTAL_VERTICES: return 23;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD: return 26;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD_INDEX: return 27;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD_PROG: return 28;
-    case HPC_GPU_ADRENO_COMMON_VFD_VFDP_STARVE_CYCLES_PC: return 29;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_UCHE: return 1;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_SP_STATE: return 2;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_SP_FS_STAGE: return 3;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_UCHE_LATENCY_CYCLES: return 4;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_UCHE_LATENCY_COUNT: return 5;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_QUADS: return 8;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_CS_INVOCATIONS: return 13;
-    case HPC_GPU_ADRENO_COMMON_HLSQ_COMPUTE_DRAWCALLS: return 14;
-    case HPC_GPU_ADRENO_COMMON_VPC_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_VPC_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_UCHE: return 2;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_VFD_WACK: return 3;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC: return 4;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_PC: return 5;
-    case HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_SP_LM: return 6;
-    case HPC_GPU_ADRENO_COMMON_VPC_STARVE_CYCLES_SP: return 8;
-    case HPC_GPU_ADRENO_COMMON_VPC_STARVE_CYCLES_LRZ: return 9;
-    case HPC_GPU_ADRENO_COMMON_VPC_PC_PRIMITIVES: return 10;
-    case HPC_GPU_ADRENO_COMMON_VPC_SP_COMPONENTS: return 11;
-    case HPC_GPU_ADRENO_COMMON_TSE_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_TSE_CLIPPING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_RAS: return 2;
-    case HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_BARYPLANE: return 3;
-    case HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_ZPLANE: return 4;
-    case HPC_GPU_ADRENO_COMMON_TSE_STARVE_CYCLES_PC: return 5;
-    case HPC_GPU_ADRENO_COMMON_TSE_INPUT_PRIM: return 6;
-    case HPC_GPU_ADRENO_COMMON_TSE_INPUT_NULL_PRIM: return 7;
-    case HPC_GPU_ADRENO_COMMON_TSE_TRIVAL_REJ_PRIM: return 8;
-    case HPC_GPU_ADRENO_COMMON_TSE_CLIPPED_PRIM: return 9;
-    case HPC_GPU_ADRENO_COMMON_TSE_ZERO_AREA_PRIM: return 10;
-    case HPC_GPU_ADRENO_COMMON_TSE_FACENESS_CULLED_PRIM: return 11;
-    case HPC_GPU_ADRENO_COMMON_TSE_ZERO_PIXEL_PRIM: return 12;
-    case HPC_GPU_ADRENO_COMMON_TSE_OUTPUT_NULL_PRIM: return 13;
-    case HPC_GPU_ADRENO_COMMON_TSE_OUTPUT_VISIBLE_PRIM: return 14;
-    case HPC_GPU_ADRENO_COMMON_TSE_CINVOCATION: return 15;
-    case HPC_GPU_ADRENO_COMMON_TSE_CPRIMITIVES: return 16;
-    case HPC_GPU_ADRENO_COMMON_TSE_2D_INPUT_PRIM: return 17;
-    case HPC_GPU_ADRENO_COMMON_RAS_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_RAS_SUPERTILE_ACTIVE_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_RAS_STALL_CYCLES_LRZ: return 2;
-    case HPC_GPU_ADRENO_COMMON_RAS_STARVE_CYCLES_TSE: return 3;
-    case HPC_GPU_ADRENO_COMMON_RAS_SUPER_TILES: return 4;
-    case HPC_GPU_ADRENO_COMMON_RAS_8X4_TILES: return 5;
-    case HPC_GPU_ADRENO_COMMON_RAS_MASKGEN_ACTIVE: return 6;
-    case HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_SUPER_TILES: return 7;
-    case HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_8X4_TILES: return 8;
-    case HPC_GPU_ADRENO_COMMON_RAS_PRIM_KILLED_INVISILBE: return 9;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_LATENCY_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_LATENCY_SAMPLES: return 3;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_TP: return 4;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_VFD: return 5;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_HLSQ: return 6;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_LRZ: return 7;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_SP: return 8;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_TP: return 9;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_VFD: return 10;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_HLSQ: return 11;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_LRZ: return 12;
-    case HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_SP: return 13;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_LRZ: return 14;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_SP: return 15;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_VPC: return 16;
-    case HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_VSC: return 17;
-    case HPC_GPU_ADRENO_COMMON_UCHE_EVICTS: return 18;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ0: return 19;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ1: return 20;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ2: return 21;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ3: return 22;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ4: return 23;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ5: return 24;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ6: return 25;
-    case HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ7: return 26;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_CH0: return 27;
-    case HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_CH1: return 28;
-    case HPC_GPU_ADRENO_COMMON_UCHE_GMEM_READ_BEATS: return 29;
-    case HPC_GPU_ADRENO_COMMON_TP_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_TP_STALL_CYCLES_UCHE: return 1;
-    case HPC_GPU_ADRENO_COMMON_TP_LATENCY_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_TP_LATENCY_TRANS: return 3;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUEST_SAMPLES: return 4;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUEST_LATENCY: return 5;
-    case HPC_GPU_ADRENO_COMMON_TP_L1_CACHELINE_REQUESTS: return 6;
-    case HPC_GPU_ADRENO_COMMON_TP_L1_CACHELINE_MISSES: return 7;
-    case HPC_GPU_ADRENO_COMMON_TP_SP_TP_TRANS: return 8;
-    case HPC_GPU_ADRENO_COMMON_TP_TP_SP_TRANS: return 9;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS: return 10;
-    case HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_16BIT: return 11;
-    case HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_32BIT: return 12;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_RECEIVED: return 13;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_OFFSET: return 14;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_SHADOW: return 15;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_ARRAY: return 16;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_GRADIENT: return 17;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_1D: return 18;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_2D: return 19;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_BUFFER: return 20;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_3D: return 21;
-    case HPC_GPU_ADRENO_COMMON_TP_QUADS_CUBE: return 22;
-    case HPC_GPU_ADRENO_COMMON_TP_DIVERGENT_QUADS_RECEIVED: return 25;
-    case HPC_GPU_ADRENO_COMMON_TP_PRT_NON_RESIDENT_EVENTS: return 28;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_POINT: return 29;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_BILINEAR: return 30;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_MIP: return 31;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_ANISO: return 32;
-    case HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_ZERO_LOD: return 33;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUESTS: return 34;
-    case HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_MISSES: return 35;
-    case HPC_GPU_ADRENO_COMMON_TP_L1_5_L2_REQUESTS: return 36;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS: return 37;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_POINT: return 38;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_BILINEAR: return 39;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_FILTER_WORKLOAD_16BIT: return 40;
-    case HPC_GPU_ADRENO_COMMON_TP_2D_FILTER_WORKLOAD_32BIT: return 41;
-    case HPC_GPU_ADRENO_COMMON_SP_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_SP_ALU_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_SP_EFU_WORKING_CYCLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_VPC: return 3;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_TP: return 4;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_UCHE: return 5;
-    case HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_RB: return 6;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_CONTEXTS: return 8;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_CONTEXT_CYCLES: return 9;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_WAVE_CYCLES: return 10;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_WAVE_SAMPLES: return 11;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_WAVE_CYCLES: return 12;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_WAVE_SAMPLES: return 13;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_DURATION_CYCLES: return 14;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_DURATION_CYCLES: return 15;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_CTRL_CYCLES: return 16;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_LOAD_CYCLES: return 17;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_EMIT_CYCLES: return 18;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_NOP_CYCLES: return 19;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_WAIT_CYCLES: return 20;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_FETCH_CYCLES: return 21;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_IDLE_CYCLES: return 22;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_END_CYCLES: return 23;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_LONG_SYNC_CYCLES: return 24;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_SHORT_SYNC_CYCLES: return 25;
-    case HPC_GPU_ADRENO_COMMON_SP_WAVE_JOIN_CYCLES: return 26;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_LOAD_INSTRUCTIONS: return 27;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_STORE_INSTRUCTIONS: return 28;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_ATOMICS: return 29;
-    case HPC_GPU_ADRENO_COMMON_SP_GM_LOAD_INSTRUCTIONS: return 30;
-    case HPC_GPU_ADRENO_COMMON_SP_GM_STORE_INSTRUCTIONS: return 31;
-    case HPC_GPU_ADRENO_COMMON_SP_GM_ATOMICS: return 32;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_TEX_INSTRUCTIONS: return 33;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_EFU_INSTRUCTIONS: return 35;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_FULL_ALU_INSTRUCTIONS: return 36;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_HALF_ALU_INSTRUCTIONS: return 37;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_TEX_INSTRUCTIONS: return 38;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_CFLOW_INSTRUCTIONS: return 39;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_EFU_INSTRUCTIONS: return 40;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_FULL_ALU_INSTRUCTIONS: return 41;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_HALF_ALU_INSTRUCTIONS: return 42;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_BARY_INSTRUCTIONS: return 43;
-    case HPC_GPU_ADRENO_COMMON_SP_VS_INSTRUCTIONS: return 44;
-    case HPC_GPU_ADRENO_COMMON_SP_FS_INSTRUCTIONS: return 45;
-    case HPC_GPU_ADRENO_COMMON_SP_ADDR_LOCK_COUNT: return 46;
-    case HPC_GPU_ADRENO_COMMON_SP_UCHE_READ_TRANS: return 47;
-    case HPC_GPU_ADRENO_COMMON_SP_UCHE_WRITE_TRANS: return 48;
-    case HPC_GPU_ADRENO_COMMON_SP_EXPORT_VPC_TRANS: return 49;
-    case HPC_GPU_ADRENO_COMMON_SP_EXPORT_RB_TRANS: return 50;
-    case HPC_GPU_ADRENO_COMMON_SP_PIXELS_KILLED: return 51;
-    case HPC_GPU_ADRENO_COMMON_SP_ICL1_REQUESTS: return 52;
-    case HPC_GPU_ADRENO_COMMON_SP_ICL1_MISSES: return 53;
-    case HPC_GPU_ADRENO_COMMON_SP_HS_INSTRUCTIONS: return 56;
-    case HPC_GPU_ADRENO_COMMON_SP_DS_INSTRUCTIONS: return 57;
-    case HPC_GPU_ADRENO_COMMON_SP_GS_INSTRUCTIONS: return 58;
-    case HPC_GPU_ADRENO_COMMON_SP_CS_INSTRUCTIONS: return 59;
-    case HPC_GPU_ADRENO_COMMON_SP_GPR_READ: return 60;
-    case HPC_GPU_ADRENO_COMMON_SP_GPR_WRITE: return 61;
-    case HPC_GPU_ADRENO_COMMON_SP_LM_BANK_CONFLICTS: return 64;
-    case HPC_GPU_ADRENO_COMMON_RB_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_HLSQ: return 2;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO0_FULL: return 3;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO1_FULL: return 4;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO2_FULL: return 5;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_SP: return 6;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_LRZ_TILE: return 7;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_CCU: return 8;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_Z_PLANE: return 9;
-    case HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_BARY_PLANE: return 10;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_WORKLOAD: return 11;
-    case HPC_GPU_ADRENO_COMMON_RB_HLSQ_ACTIVE: return 12;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_READ: return 13;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_WRITE: return 14;
-    case HPC_GPU_ADRENO_COMMON_RB_C_READ: return 15;
-    case HPC_GPU_ADRENO_COMMON_RB_C_WRITE: return 16;
-    case HPC_GPU_ADRENO_COMMON_RB_TOTAL_PASS: return 17;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_PASS: return 18;
-    case HPC_GPU_ADRENO_COMMON_RB_Z_FAIL: return 19;
-    case HPC_GPU_ADRENO_COMMON_RB_S_FAIL: return 20;
-    case HPC_GPU_ADRENO_COMMON_RB_BLENDED_FXP_COMPONENTS: return 21;
-    case HPC_GPU_ADRENO_COMMON_RB_BLENDED_FP16_COMPONENTS: return 22;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_ALIVE_CYCLES: return 24;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STALL_CYCLES_A2D: return 25;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_SRC: return 26;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_SP: return 27;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_DST: return 28;
-    case HPC_GPU_ADRENO_COMMON_RB_2D_VALID_PIXELS: return 29;
-    case HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_CCU: return 1;
-    case HPC_GPU_ADRENO_COMMON_VSC_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_VSC_WORKING_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_VSC_STALL_CYCLES_UCHE: return 2;
-    case HPC_GPU_ADRENO_COMMON_VSC_EOT_NUM: return 3;
-    case HPC_GPU_ADRENO_COMMON_CCU_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_CCU_STALL_CYCLES_RB_DEPTH_RETURN: return 1;
-    case HPC_GPU_ADRENO_COMMON_CCU_STALL_CYCLES_RB_COLOR_RETURN: return 2;
-    case HPC_GPU_ADRENO_COMMON_CCU_STARVE_CYCLES_FLAG_RETURN: return 3;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_BLOCKS: return 4;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_BLOCKS: return 5;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_BLOCK_HIT: return 6;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_BLOCK_HIT: return 7;
-    case HPC_GPU_ADRENO_COMMON_CCU_PARTIAL_BLOCK_READ: return 8;
-    case HPC_GPU_ADRENO_COMMON_CCU_GMEM_READ: return 9;
-    case HPC_GPU_ADRENO_COMMON_CCU_GMEM_WRITE: return 10;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG0_COUNT: return 11;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG1_COUNT: return 12;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG2_COUNT: return 13;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG3_COUNT: return 14;
-    case HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG4_COUNT: return 15;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG0_COUNT: return 16;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG1_COUNT: return 17;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG2_COUNT: return 18;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG3_COUNT: return 19;
-    case HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG4_COUNT: return 20;
-    case HPC_GPU_ADRENO_COMMON_CCU_2D_RD_REQ: return 22;
-    case HPC_GPU_ADRENO_COMMON_CCU_2D_WR_REQ: return 23;
-    case HPC_GPU_ADRENO_COMMON_LRZ_BUSY_CYCLES: return 0;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STARVE_CYCLES_RAS: return 1;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_RB: return 2;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_VSC: return 3;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_VPC: return 4;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_FLAG_PREFETCH: return 5;
-    case HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_UCHE: return 6;
-    case HPC_GPU_ADRENO_COMMON_LRZ_LRZ_READ: return 7;
-    case HPC_GPU_ADRENO_COMMON_LRZ_LRZ_WRITE: return 8;
-    case HPC_GPU_ADRENO_COMMON_LRZ_READ_LATENCY: return 9;
-    case HPC_GPU_ADRENO_COMMON_LRZ_MERGE_CACHE_UPDATING: return 10;
-    case HPC_GPU_ADRENO_COMMON_LRZ_PRIM_KILLED_BY_MASKGEN: return 11;
-    case HPC_GPU_ADRENO_COMMON_LRZ_PRIM_KILLED_BY_LRZ: return 12;
-    case HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PRIM_AFTER_LRZ: return 13;
-    case HPC_GPU_ADRENO_COMMON_LRZ_FULL_8X8_TILES: return 14;
-    case HPC_GPU_ADRENO_COMMON_LRZ_PARTIAL_8X8_TILES: return 15;
-    case HPC_GPU_ADRENO_COMMON_LRZ_TILE_KILLED: return 16;
-    case HPC_GPU_ADRENO_COMMON_LRZ_TOTAL_PIXEL: return 17;
-    case HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PIXEL_AFTER_LRZ: return 18;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_LATENCY_CYCLES: return 1;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_LATENCY_SAMPLES: return 2;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_DATA_CCU: return 3;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_DATA_CCU: return 4;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_REQUEST: return 5;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_REQUEST: return 6;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_DATA: return 7;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_DATA: return 8;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_FLAG_FETCH_CYCLES: return 9;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_FLAG_FETCH_SAMPLES: return 10;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT: return 11;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT: return 12;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT: return 13;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT: return 14;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT: return 15;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT: return 16;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT: return 17;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT: return 18;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ: return 19;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR: return 20;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN: return 21;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_RD_DATA: return 22;
-    case HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_WR_DATA: return 23;
-  }
-  // clang-format on
+  return adreno_common_counter_convert(adreno_common_a5xx_selectors,
+                                       counter);
 }
 
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
@@ -0,0 +1,940 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/adreno/common.h"
+
+#include <stdint.h>
+
+#include "hpc/gpu/counter_info.h"
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The series that availability bits refer to.
+static const char *const adreno_common_series_names[2] = {
+    "a5xx", "a6xx",
+};
+
+/// Metadata of all counters, in enum order.
+static const hpc_gpu_counter_info_t adreno_common_counter_infos[359] = {
+    // clang-format off
+    {HPC_GPU_ADRENO_COMMON_CP_ALWAYS_COUNT, 0x3u, "CP_ALWAYS_COUNT", "CP",
+     "Command Parser: always count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_BUSY_GFX_CORE_IDLE, 0x3u, "CP_BUSY_GFX_CORE_IDLE",
+     "CP", "Command Parser: busy gfx core idle", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CP_BUSY_CYCLES, 0x3u, "CP_BUSY_CYCLES", "CP",
+     "Command Parser: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CP_NUM_PREEMPTIONS, 0x3u, "CP_NUM_PREEMPTIONS", "CP",
+     "Command Parser: num preemptions", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_REACTION_DELAY, 0x3u,
+     "CP_PREEMPTION_REACTION_DELAY", "CP",
+     "Command Parser: preemption reaction delay", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_SWITCH_OUT_TIME, 0x3u,
+     "CP_PREEMPTION_SWITCH_OUT_TIME", "CP",
+     "Command Parser: preemption switch out time", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_PREEMPTION_SWITCH_IN_TIME, 0x3u,
+     "CP_PREEMPTION_SWITCH_IN_TIME", "CP",
+     "Command Parser: preemption switch IN time", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_DEAD_DRAWS_IN_BIN_RENDER, 0x3u,
+     "CP_DEAD_DRAWS_IN_BIN_RENDER", "CP",
+     "Command Parser: dead draws IN bin render", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_PREDICATED_DRAWS_KILLED, 0x3u,
+     "CP_PREDICATED_DRAWS_KILLED", "CP",
+     "Command Parser: predicated draws killed", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_MODE_SWITCH, 0x3u, "CP_MODE_SWITCH", "CP",
+     "Command Parser: mode switch", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_ZPASS_DONE, 0x3u, "CP_ZPASS_DONE", "CP",
+     "Command Parser: zpass done", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_CONTEXT_DONE, 0x3u, "CP_CONTEXT_DONE", "CP",
+     "Command Parser: context done", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_CACHE_FLUSH, 0x3u, "CP_CACHE_FLUSH", "CP",
+     "Command Parser: cache flush", "events"},
+    {HPC_GPU_ADRENO_COMMON_CP_LONG_PREEMPTIONS, 0x3u, "CP_LONG_PREEMPTIONS",
+     "CP", "Command Parser: long preemptions", "events"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_ALWAYS_COUNT, 0x3u, "RBBM_ALWAYS_COUNT", "RBBM",
+     "RBBM: always count", "events"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_ALWAYS_ON, 0x3u, "RBBM_ALWAYS_ON", "RBBM",
+     "RBBM: always ON", "events"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_TSE_BUSY, 0x3u, "RBBM_TSE_BUSY", "RBBM",
+     "RBBM: TSE busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_RAS_BUSY, 0x3u, "RBBM_RAS_BUSY", "RBBM",
+     "RBBM: RAS busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_PC_DCALL_BUSY, 0x3u, "RBBM_PC_DCALL_BUSY",
+     "RBBM", "RBBM: PC dcall busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_PC_VSD_BUSY, 0x3u, "RBBM_PC_VSD_BUSY", "RBBM",
+     "RBBM: PC vsd busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_STATUS_MASKED, 0x3u, "RBBM_STATUS_MASKED",
+     "RBBM", "RBBM: status masked", "events"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_COM_BUSY, 0x3u, "RBBM_COM_BUSY", "RBBM",
+     "RBBM: com busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_DCOM_BUSY, 0x3u, "RBBM_DCOM_BUSY", "RBBM",
+     "RBBM: dcom busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_VBIF_BUSY, 0x3u, "RBBM_VBIF_BUSY", "RBBM",
+     "RBBM: vbif busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_VSC_BUSY, 0x3u, "RBBM_VSC_BUSY", "RBBM",
+     "RBBM: VSC busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_TESS_BUSY, 0x3u, "RBBM_TESS_BUSY", "RBBM",
+     "RBBM: tess busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_UCHE_BUSY, 0x3u, "RBBM_UCHE_BUSY", "RBBM",
+     "RBBM: UCHE busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RBBM_HLSQ_BUSY, 0x3u, "RBBM_HLSQ_BUSY", "RBBM",
+     "RBBM: HLSQ busy", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_BUSY_CYCLES, 0x3u, "PC_BUSY_CYCLES", "PC",
+     "PC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_WORKING_CYCLES, 0x3u, "PC_WORKING_CYCLES", "PC",
+     "PC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VFD, 0x3u, "PC_STALL_CYCLES_VFD",
+     "PC", "PC: stall cycles VFD", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TSE, 0x3u, "PC_STALL_CYCLES_TSE",
+     "PC", "PC: stall cycles TSE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VPC, 0x3u, "PC_STALL_CYCLES_VPC",
+     "PC", "PC: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_UCHE, 0x3u, "PC_STALL_CYCLES_UCHE",
+     "PC", "PC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TESS, 0x3u, "PC_STALL_CYCLES_TESS",
+     "PC", "PC: stall cycles tess", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_TSE_ONLY, 0x3u,
+     "PC_STALL_CYCLES_TSE_ONLY", "PC", "PC: stall cycles TSE only", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STALL_CYCLES_VPC_ONLY, 0x3u,
+     "PC_STALL_CYCLES_VPC_ONLY", "PC", "PC: stall cycles VPC only", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_PASS1_TF_STALL_CYCLES, 0x3u,
+     "PC_PASS1_TF_STALL_CYCLES", "PC", "PC: pass1 TF stall cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_INDEX, 0x3u,
+     "PC_STARVE_CYCLES_FOR_INDEX", "PC", "PC: starve cycles for index",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_TESS_FACTOR, 0x3u,
+     "PC_STARVE_CYCLES_FOR_TESS_FACTOR", "PC",
+     "PC: starve cycles for tess factor", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_VIZ_STREAM, 0x3u,
+     "PC_STARVE_CYCLES_FOR_VIZ_STREAM", "PC",
+     "PC: starve cycles for viz stream", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_FOR_POSITION, 0x3u,
+     "PC_STARVE_CYCLES_FOR_POSITION", "PC", "PC: starve cycles for position",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_STARVE_CYCLES_DI, 0x3u, "PC_STARVE_CYCLES_DI",
+     "PC", "PC: starve cycles DI", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_VIS_STREAMS_LOADED, 0x3u, "PC_VIS_STREAMS_LOADED",
+     "PC", "PC: vis streams loaded", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_INSTANCES, 0x3u, "PC_INSTANCES", "PC",
+     "PC: instances", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_VPC_PRIMITIVES, 0x3u, "PC_VPC_PRIMITIVES", "PC",
+     "PC: VPC primitives", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_DEAD_PRIM, 0x3u, "PC_DEAD_PRIM", "PC",
+     "PC: dead prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_LIVE_PRIM, 0x3u, "PC_LIVE_PRIM", "PC",
+     "PC: live prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_VERTEX_HITS, 0x3u, "PC_VERTEX_HITS", "PC",
+     "PC: vertex hits", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_IA_VERTICES, 0x3u, "PC_IA_VERTICES", "PC",
+     "PC: IA vertices", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_IA_PRIMITIVES, 0x3u, "PC_IA_PRIMITIVES", "PC",
+     "PC: IA primitives", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_GS_PRIMITIVES, 0x3u, "PC_GS_PRIMITIVES", "PC",
+     "PC: GS primitives", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_HS_INVOCATIONS, 0x3u, "PC_HS_INVOCATIONS", "PC",
+     "PC: HS invocations", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_DS_INVOCATIONS, 0x3u, "PC_DS_INVOCATIONS", "PC",
+     "PC: DS invocations", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_VS_INVOCATIONS, 0x3u, "PC_VS_INVOCATIONS", "PC",
+     "PC: VS invocations", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_GS_INVOCATIONS, 0x3u, "PC_GS_INVOCATIONS", "PC",
+     "PC: GS invocations", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_DS_PRIMITIVES, 0x3u, "PC_DS_PRIMITIVES", "PC",
+     "PC: DS primitives", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_VPC_POS_DATA_TRANSACTION, 0x3u,
+     "PC_VPC_POS_DATA_TRANSACTION", "PC", "PC: VPC pos data transaction",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_3D_DRAWCALLS, 0x3u, "PC_3D_DRAWCALLS", "PC",
+     "PC: 3D drawcalls", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_2D_DRAWCALLS, 0x3u, "PC_2D_DRAWCALLS", "PC",
+     "PC: 2D drawcalls", "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_NON_DRAWCALL_GLOBAL_EVENTS, 0x3u,
+     "PC_NON_DRAWCALL_GLOBAL_EVENTS", "PC", "PC: non drawcall global events",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_PC_TESS_BUSY_CYCLES, 0x3u, "PC_TESS_BUSY_CYCLES",
+     "PC", "PC: tess busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_TESS_WORKING_CYCLES, 0x3u,
+     "PC_TESS_WORKING_CYCLES", "PC", "PC: tess working cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_TESS_STALL_CYCLES_PC, 0x3u,
+     "PC_TESS_STALL_CYCLES_PC", "PC", "PC: tess stall cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_PC_TESS_STARVE_CYCLES_PC, 0x3u,
+     "PC_TESS_STARVE_CYCLES_PC", "PC", "PC: tess starve cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_BUSY_CYCLES, 0x3u, "VFD_BUSY_CYCLES", "VFD",
+     "VFD: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_UCHE, 0x3u, "VFD_STALL_CYCLES_UCHE",
+     "VFD", "VFD: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_VPC_ALLOC, 0x3u,
+     "VFD_STALL_CYCLES_VPC_ALLOC", "VFD", "VFD: stall cycles VPC alloc",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_SP_INFO, 0x3u,
+     "VFD_STALL_CYCLES_SP_INFO", "VFD", "VFD: stall cycles SP info", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_STALL_CYCLES_SP_ATTR, 0x3u,
+     "VFD_STALL_CYCLES_SP_ATTR", "VFD", "VFD: stall cycles SP attr", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_STARVE_CYCLES_UCHE, 0x3u,
+     "VFD_STARVE_CYCLES_UCHE", "VFD", "VFD: starve cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_RBUFFER_FULL, 0x3u, "VFD_RBUFFER_FULL", "VFD",
+     "VFD: rbuffer full", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_ATTR_INFO_FIFO_FULL, 0x3u,
+     "VFD_ATTR_INFO_FIFO_FULL", "VFD", "VFD: attr info fifo full", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_DECODED_ATTRIBUTE_BYTES, 0x3u,
+     "VFD_DECODED_ATTRIBUTE_BYTES", "VFD", "VFD: decoded attribute bytes",
+     "bytes"},
+    {HPC_GPU_ADRENO_COMMON_VFD_NUM_ATTRIBUTES, 0x3u, "VFD_NUM_ATTRIBUTES",
+     "VFD", "VFD: num attributes", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_UPPER_SHADER_FIBERS, 0x3u,
+     "VFD_UPPER_SHADER_FIBERS", "VFD", "VFD: upper shader fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_LOWER_SHADER_FIBERS, 0x3u,
+     "VFD_LOWER_SHADER_FIBERS", "VFD", "VFD: lower shader fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_MODE_0_FIBERS, 0x3u, "VFD_MODE_0_FIBERS", "VFD",
+     "VFD: mode 0 fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_MODE_1_FIBERS, 0x3u, "VFD_MODE_1_FIBERS", "VFD",
+     "VFD: mode 1 fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_MODE_2_FIBERS, 0x3u, "VFD_MODE_2_FIBERS", "VFD",
+     "VFD: mode 2 fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_MODE_3_FIBERS, 0x3u, "VFD_MODE_3_FIBERS", "VFD",
+     "VFD: mode 3 fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_MODE_4_FIBERS, 0x3u, "VFD_MODE_4_FIBERS", "VFD",
+     "VFD: mode 4 fibers", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_TOTAL_VERTICES, 0x3u, "VFD_TOTAL_VERTICES",
+     "VFD", "VFD: total vertices", "events"},
+    {HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD", "VFD", "VFD: vfdp stall cycles VFD",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD_INDEX, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD_INDEX", "VFD",
+     "VFD: vfdp stall cycles VFD index", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_VFDP_STALL_CYCLES_VFD_PROG, 0x3u,
+     "VFD_VFDP_STALL_CYCLES_VFD_PROG", "VFD", "VFD: vfdp stall cycles VFD prog",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VFD_VFDP_STARVE_CYCLES_PC, 0x3u,
+     "VFD_VFDP_STARVE_CYCLES_PC", "VFD", "VFD: vfdp starve cycles PC",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_BUSY_CYCLES, 0x3u, "HLSQ_BUSY_CYCLES", "HLSQ",
+     "High Level SeQuencer: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_UCHE, 0x3u,
+     "HLSQ_STALL_CYCLES_UCHE", "HLSQ",
+     "High Level SeQuencer: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_SP_STATE, 0x3u,
+     "HLSQ_STALL_CYCLES_SP_STATE", "HLSQ",
+     "High Level SeQuencer: stall cycles SP state", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_STALL_CYCLES_SP_FS_STAGE, 0x3u,
+     "HLSQ_STALL_CYCLES_SP_FS_STAGE", "HLSQ",
+     "High Level SeQuencer: stall cycles SP FS stage", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_UCHE_LATENCY_CYCLES, 0x3u,
+     "HLSQ_UCHE_LATENCY_CYCLES", "HLSQ",
+     "High Level SeQuencer: UCHE latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_UCHE_LATENCY_COUNT, 0x3u,
+     "HLSQ_UCHE_LATENCY_COUNT", "HLSQ",
+     "High Level SeQuencer: UCHE latency count", "events"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_QUADS, 0x3u, "HLSQ_QUADS", "HLSQ",
+     "High Level SeQuencer: quads", "events"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_CS_INVOCATIONS, 0x3u, "HLSQ_CS_INVOCATIONS",
+     "HLSQ", "High Level SeQuencer: CS invocations", "events"},
+    {HPC_GPU_ADRENO_COMMON_HLSQ_COMPUTE_DRAWCALLS, 0x3u,
+     "HLSQ_COMPUTE_DRAWCALLS", "HLSQ",
+     "High Level SeQuencer: compute drawcalls", "events"},
+    {HPC_GPU_ADRENO_COMMON_VPC_BUSY_CYCLES, 0x3u, "VPC_BUSY_CYCLES", "VPC",
+     "VPC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_WORKING_CYCLES, 0x3u, "VPC_WORKING_CYCLES",
+     "VPC", "VPC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_UCHE, 0x3u, "VPC_STALL_CYCLES_UCHE",
+     "VPC", "VPC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_VFD_WACK, 0x3u,
+     "VPC_STALL_CYCLES_VFD_WACK", "VPC", "VPC: stall cycles VFD wack",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC, 0x3u,
+     "VPC_STALL_CYCLES_HLSQ_PRIM_ALLOC", "VPC",
+     "VPC: stall cycles HLSQ prim alloc", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_PC, 0x3u, "VPC_STALL_CYCLES_PC",
+     "VPC", "VPC: stall cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STALL_CYCLES_SP_LM, 0x3u,
+     "VPC_STALL_CYCLES_SP_LM", "VPC", "VPC: stall cycles SP LM", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STARVE_CYCLES_SP, 0x3u, "VPC_STARVE_CYCLES_SP",
+     "VPC", "VPC: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_STARVE_CYCLES_LRZ, 0x3u, "VPC_STARVE_CYCLES_LRZ",
+     "VPC", "VPC: starve cycles LRZ", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VPC_PC_PRIMITIVES, 0x3u, "VPC_PC_PRIMITIVES", "VPC",
+     "VPC: PC primitives", "events"},
+    {HPC_GPU_ADRENO_COMMON_VPC_SP_COMPONENTS, 0x3u, "VPC_SP_COMPONENTS", "VPC",
+     "VPC: SP components", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_BUSY_CYCLES, 0x3u, "TSE_BUSY_CYCLES", "TSE",
+     "Triangle Setup Engine: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TSE_CLIPPING_CYCLES, 0x3u, "TSE_CLIPPING_CYCLES",
+     "TSE", "Triangle Setup Engine: clipping cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_RAS, 0x3u, "TSE_STALL_CYCLES_RAS",
+     "TSE", "Triangle Setup Engine: stall cycles RAS", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_BARYPLANE, 0x3u,
+     "TSE_STALL_CYCLES_LRZ_BARYPLANE", "TSE",
+     "Triangle Setup Engine: stall cycles LRZ baryplane", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TSE_STALL_CYCLES_LRZ_ZPLANE, 0x3u,
+     "TSE_STALL_CYCLES_LRZ_ZPLANE", "TSE",
+     "Triangle Setup Engine: stall cycles LRZ zplane", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TSE_STARVE_CYCLES_PC, 0x3u, "TSE_STARVE_CYCLES_PC",
+     "TSE", "Triangle Setup Engine: starve cycles PC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TSE_INPUT_PRIM, 0x3u, "TSE_INPUT_PRIM", "TSE",
+     "Triangle Setup Engine: input prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_INPUT_NULL_PRIM, 0x3u, "TSE_INPUT_NULL_PRIM",
+     "TSE", "Triangle Setup Engine: input null prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_TRIVAL_REJ_PRIM, 0x3u, "TSE_TRIVAL_REJ_PRIM",
+     "TSE", "Triangle Setup Engine: trival rej prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_CLIPPED_PRIM, 0x3u, "TSE_CLIPPED_PRIM", "TSE",
+     "Triangle Setup Engine: clipped prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_ZERO_AREA_PRIM, 0x3u, "TSE_ZERO_AREA_PRIM",
+     "TSE", "Triangle Setup Engine: zero area prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_FACENESS_CULLED_PRIM, 0x3u,
+     "TSE_FACENESS_CULLED_PRIM", "TSE",
+     "Triangle Setup Engine: faceness culled prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_ZERO_PIXEL_PRIM, 0x3u, "TSE_ZERO_PIXEL_PRIM",
+     "TSE", "Triangle Setup Engine: zero pixel prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_OUTPUT_NULL_PRIM, 0x3u, "TSE_OUTPUT_NULL_PRIM",
+     "TSE", "Triangle Setup Engine: output null prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_OUTPUT_VISIBLE_PRIM, 0x3u,
+     "TSE_OUTPUT_VISIBLE_PRIM", "TSE",
+     "Triangle Setup Engine: output visible prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_CINVOCATION, 0x3u, "TSE_CINVOCATION", "TSE",
+     "Triangle Setup Engine: cinvocation", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_CPRIMITIVES, 0x3u, "TSE_CPRIMITIVES", "TSE",
+     "Triangle Setup Engine: cprimitives", "events"},
+    {HPC_GPU_ADRENO_COMMON_TSE_2D_INPUT_PRIM, 0x3u, "TSE_2D_INPUT_PRIM", "TSE",
+     "Triangle Setup Engine: 2D input prim", "events"},
+    {HPC_GPU_ADRENO_COMMON_RAS_BUSY_CYCLES, 0x3u, "RAS_BUSY_CYCLES", "RAS",
+     "RAS: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RAS_SUPERTILE_ACTIVE_CYCLES, 0x3u,
+     "RAS_SUPERTILE_ACTIVE_CYCLES", "RAS", "RAS: supertile active cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RAS_STALL_CYCLES_LRZ, 0x3u, "RAS_STALL_CYCLES_LRZ",
+     "RAS", "RAS: stall cycles LRZ", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RAS_STARVE_CYCLES_TSE, 0x3u, "RAS_STARVE_CYCLES_TSE",
+     "RAS", "RAS: starve cycles TSE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RAS_SUPER_TILES, 0x3u, "RAS_SUPER_TILES", "RAS",
+     "RAS: super tiles", "events"},
+    {HPC_GPU_ADRENO_COMMON_RAS_8X4_TILES, 0x3u, "RAS_8X4_TILES", "RAS",
+     "RAS: 8x4 tiles", "events"},
+    {HPC_GPU_ADRENO_COMMON_RAS_MASKGEN_ACTIVE, 0x3u, "RAS_MASKGEN_ACTIVE",
+     "RAS", "RAS: maskgen active", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_SUPER_TILES, 0x3u,
+     "RAS_FULLY_COVERED_SUPER_TILES", "RAS", "RAS: fully covered super tiles",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RAS_FULLY_COVERED_8X4_TILES, 0x3u,
+     "RAS_FULLY_COVERED_8X4_TILES", "RAS", "RAS: fully covered 8x4 tiles",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RAS_PRIM_KILLED_INVISILBE, 0x3u,
+     "RAS_PRIM_KILLED_INVISILBE", "RAS", "RAS: prim killed invisilbe",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BUSY_CYCLES, 0x3u, "UCHE_BUSY_CYCLES", "UCHE",
+     "Unified L2 Cache: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_LATENCY_CYCLES, 0x3u,
+     "UCHE_VBIF_LATENCY_CYCLES", "UCHE",
+     "Unified L2 Cache: vbif latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_LATENCY_SAMPLES, 0x3u,
+     "UCHE_VBIF_LATENCY_SAMPLES", "UCHE",
+     "Unified L2 Cache: vbif latency samples", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_TP, 0x3u,
+     "UCHE_VBIF_READ_BEATS_TP", "UCHE", "Unified L2 Cache: vbif read beats TP",
+     "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_VFD, 0x3u,
+     "UCHE_VBIF_READ_BEATS_VFD", "UCHE",
+     "Unified L2 Cache: vbif read beats VFD", "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_HLSQ, 0x3u,
+     "UCHE_VBIF_READ_BEATS_HLSQ", "UCHE",
+     "Unified L2 Cache: vbif read beats HLSQ", "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_LRZ, 0x3u,
+     "UCHE_VBIF_READ_BEATS_LRZ", "UCHE",
+     "Unified L2 Cache: vbif read beats LRZ", "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_SP, 0x3u,
+     "UCHE_VBIF_READ_BEATS_SP", "UCHE", "Unified L2 Cache: vbif read beats SP",
+     "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_TP, 0x3u, "UCHE_READ_REQUESTS_TP",
+     "UCHE", "Unified L2 Cache: read requests TP", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_VFD, 0x3u,
+     "UCHE_READ_REQUESTS_VFD", "UCHE", "Unified L2 Cache: read requests VFD",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_HLSQ, 0x3u,
+     "UCHE_READ_REQUESTS_HLSQ", "UCHE", "Unified L2 Cache: read requests HLSQ",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_LRZ, 0x3u,
+     "UCHE_READ_REQUESTS_LRZ", "UCHE", "Unified L2 Cache: read requests LRZ",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_READ_REQUESTS_SP, 0x3u, "UCHE_READ_REQUESTS_SP",
+     "UCHE", "Unified L2 Cache: read requests SP", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_LRZ, 0x3u,
+     "UCHE_WRITE_REQUESTS_LRZ", "UCHE", "Unified L2 Cache: write requests LRZ",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_SP, 0x3u,
+     "UCHE_WRITE_REQUESTS_SP", "UCHE", "Unified L2 Cache: write requests SP",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_VPC, 0x3u,
+     "UCHE_WRITE_REQUESTS_VPC", "UCHE", "Unified L2 Cache: write requests VPC",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_WRITE_REQUESTS_VSC, 0x3u,
+     "UCHE_WRITE_REQUESTS_VSC", "UCHE", "Unified L2 Cache: write requests VSC",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_EVICTS, 0x3u, "UCHE_EVICTS", "UCHE",
+     "Unified L2 Cache: evicts", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ0, 0x3u, "UCHE_BANK_REQ0", "UCHE",
+     "Unified L2 Cache: bank req0", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ1, 0x3u, "UCHE_BANK_REQ1", "UCHE",
+     "Unified L2 Cache: bank req1", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ2, 0x3u, "UCHE_BANK_REQ2", "UCHE",
+     "Unified L2 Cache: bank req2", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ3, 0x3u, "UCHE_BANK_REQ3", "UCHE",
+     "Unified L2 Cache: bank req3", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ4, 0x3u, "UCHE_BANK_REQ4", "UCHE",
+     "Unified L2 Cache: bank req4", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ5, 0x3u, "UCHE_BANK_REQ5", "UCHE",
+     "Unified L2 Cache: bank req5", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ6, 0x3u, "UCHE_BANK_REQ6", "UCHE",
+     "Unified L2 Cache: bank req6", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_BANK_REQ7, 0x3u, "UCHE_BANK_REQ7", "UCHE",
+     "Unified L2 Cache: bank req7", "events"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_CH0, 0x3u,
+     "UCHE_VBIF_READ_BEATS_CH0", "UCHE",
+     "Unified L2 Cache: vbif read beats ch0", "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_VBIF_READ_BEATS_CH1, 0x3u,
+     "UCHE_VBIF_READ_BEATS_CH1", "UCHE",
+     "Unified L2 Cache: vbif read beats ch1", "beats"},
+    {HPC_GPU_ADRENO_COMMON_UCHE_GMEM_READ_BEATS, 0x3u, "UCHE_GMEM_READ_BEATS",
+     "UCHE", "Unified L2 Cache: gmem read beats", "beats"},
+    {HPC_GPU_ADRENO_COMMON_TP_BUSY_CYCLES, 0x3u, "TP_BUSY_CYCLES", "TP",
+     "Texture Processor: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TP_STALL_CYCLES_UCHE, 0x3u, "TP_STALL_CYCLES_UCHE",
+     "TP", "Texture Processor: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TP_LATENCY_CYCLES, 0x3u, "TP_LATENCY_CYCLES", "TP",
+     "Texture Processor: latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_TP_LATENCY_TRANS, 0x3u, "TP_LATENCY_TRANS", "TP",
+     "Texture Processor: latency trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUEST_SAMPLES, 0x3u,
+     "TP_FLAG_CACHE_REQUEST_SAMPLES", "TP",
+     "Texture Processor: flag cache request samples", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUEST_LATENCY, 0x3u,
+     "TP_FLAG_CACHE_REQUEST_LATENCY", "TP",
+     "Texture Processor: flag cache request latency", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_L1_CACHELINE_REQUESTS, 0x3u,
+     "TP_L1_CACHELINE_REQUESTS", "TP",
+     "Texture Processor: L1 cacheline requests", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_L1_CACHELINE_MISSES, 0x3u,
+     "TP_L1_CACHELINE_MISSES", "TP", "Texture Processor: L1 cacheline misses",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_SP_TP_TRANS, 0x3u, "TP_SP_TP_TRANS", "TP",
+     "Texture Processor: SP TP trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_TP_SP_TRANS, 0x3u, "TP_TP_SP_TRANS", "TP",
+     "Texture Processor: TP SP trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS, 0x3u, "TP_OUTPUT_PIXELS", "TP",
+     "Texture Processor: output pixels", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_16BIT, 0x3u,
+     "TP_FILTER_WORKLOAD_16BIT", "TP",
+     "Texture Processor: filter workload 16bit", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_FILTER_WORKLOAD_32BIT, 0x3u,
+     "TP_FILTER_WORKLOAD_32BIT", "TP",
+     "Texture Processor: filter workload 32bit", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_RECEIVED, 0x3u, "TP_QUADS_RECEIVED", "TP",
+     "Texture Processor: quads received", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_OFFSET, 0x3u, "TP_QUADS_OFFSET", "TP",
+     "Texture Processor: quads offset", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_SHADOW, 0x3u, "TP_QUADS_SHADOW", "TP",
+     "Texture Processor: quads shadow", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_ARRAY, 0x3u, "TP_QUADS_ARRAY", "TP",
+     "Texture Processor: quads array", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_GRADIENT, 0x3u, "TP_QUADS_GRADIENT", "TP",
+     "Texture Processor: quads gradient", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_1D, 0x3u, "TP_QUADS_1D", "TP",
+     "Texture Processor: quads 1D", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_2D, 0x3u, "TP_QUADS_2D", "TP",
+     "Texture Processor: quads 2D", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_BUFFER, 0x3u, "TP_QUADS_BUFFER", "TP",
+     "Texture Processor: quads buffer", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_3D, 0x3u, "TP_QUADS_3D", "TP",
+     "Texture Processor: quads 3D", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_QUADS_CUBE, 0x3u, "TP_QUADS_CUBE", "TP",
+     "Texture Processor: quads cube", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_DIVERGENT_QUADS_RECEIVED, 0x3u,
+     "TP_DIVERGENT_QUADS_RECEIVED", "TP",
+     "Texture Processor: divergent quads received", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_PRT_NON_RESIDENT_EVENTS, 0x3u,
+     "TP_PRT_NON_RESIDENT_EVENTS", "TP",
+     "Texture Processor: prt non resident events", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_POINT, 0x3u,
+     "TP_OUTPUT_PIXELS_POINT", "TP", "Texture Processor: output pixels point",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_BILINEAR, 0x3u,
+     "TP_OUTPUT_PIXELS_BILINEAR", "TP",
+     "Texture Processor: output pixels bilinear", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_MIP, 0x3u, "TP_OUTPUT_PIXELS_MIP",
+     "TP", "Texture Processor: output pixels mip", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_ANISO, 0x3u,
+     "TP_OUTPUT_PIXELS_ANISO", "TP", "Texture Processor: output pixels aniso",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_OUTPUT_PIXELS_ZERO_LOD, 0x3u,
+     "TP_OUTPUT_PIXELS_ZERO_LOD", "TP",
+     "Texture Processor: output pixels zero lod", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_REQUESTS, 0x3u,
+     "TP_FLAG_CACHE_REQUESTS", "TP", "Texture Processor: flag cache requests",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_FLAG_CACHE_MISSES, 0x3u, "TP_FLAG_CACHE_MISSES",
+     "TP", "Texture Processor: flag cache misses", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_L1_5_L2_REQUESTS, 0x3u, "TP_L1_5_L2_REQUESTS",
+     "TP", "Texture Processor: L1 5 L2 requests", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS, 0x3u, "TP_2D_OUTPUT_PIXELS",
+     "TP", "Texture Processor: 2D output pixels", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_POINT, 0x3u,
+     "TP_2D_OUTPUT_PIXELS_POINT", "TP",
+     "Texture Processor: 2D output pixels point", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_2D_OUTPUT_PIXELS_BILINEAR, 0x3u,
+     "TP_2D_OUTPUT_PIXELS_BILINEAR", "TP",
+     "Texture Processor: 2D output pixels bilinear", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_2D_FILTER_WORKLOAD_16BIT, 0x3u,
+     "TP_2D_FILTER_WORKLOAD_16BIT", "TP",
+     "Texture Processor: 2D filter workload 16bit", "events"},
+    {HPC_GPU_ADRENO_COMMON_TP_2D_FILTER_WORKLOAD_32BIT, 0x3u,
+     "TP_2D_FILTER_WORKLOAD_32BIT", "TP",
+     "Texture Processor: 2D filter workload 32bit", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_BUSY_CYCLES, 0x3u, "SP_BUSY_CYCLES", "SP",
+     "Shader/Streaming Processor: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_ALU_WORKING_CYCLES, 0x3u, "SP_ALU_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: ALU working cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_EFU_WORKING_CYCLES, 0x3u, "SP_EFU_WORKING_CYCLES",
+     "SP", "Shader/Streaming Processor: EFU working cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_VPC, 0x3u, "SP_STALL_CYCLES_VPC",
+     "SP", "Shader/Streaming Processor: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_TP, 0x3u, "SP_STALL_CYCLES_TP", "SP",
+     "Shader/Streaming Processor: stall cycles TP", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_UCHE, 0x3u, "SP_STALL_CYCLES_UCHE",
+     "SP", "Shader/Streaming Processor: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_STALL_CYCLES_RB, 0x3u, "SP_STALL_CYCLES_RB", "SP",
+     "Shader/Streaming Processor: stall cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_CONTEXTS, 0x3u, "SP_WAVE_CONTEXTS", "SP",
+     "Shader/Streaming Processor: wave contexts", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_CONTEXT_CYCLES, 0x3u,
+     "SP_WAVE_CONTEXT_CYCLES", "SP",
+     "Shader/Streaming Processor: wave context cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_WAVE_CYCLES, 0x3u,
+     "SP_FS_STAGE_WAVE_CYCLES", "SP",
+     "Shader/Streaming Processor: FS stage wave cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_WAVE_SAMPLES, 0x3u,
+     "SP_FS_STAGE_WAVE_SAMPLES", "SP",
+     "Shader/Streaming Processor: FS stage wave samples", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_WAVE_CYCLES, 0x3u,
+     "SP_VS_STAGE_WAVE_CYCLES", "SP",
+     "Shader/Streaming Processor: VS stage wave cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_WAVE_SAMPLES, 0x3u,
+     "SP_VS_STAGE_WAVE_SAMPLES", "SP",
+     "Shader/Streaming Processor: VS stage wave samples", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_DURATION_CYCLES, 0x3u,
+     "SP_FS_STAGE_DURATION_CYCLES", "SP",
+     "Shader/Streaming Processor: FS stage duration cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_DURATION_CYCLES, 0x3u,
+     "SP_VS_STAGE_DURATION_CYCLES", "SP",
+     "Shader/Streaming Processor: VS stage duration cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_CTRL_CYCLES, 0x3u, "SP_WAVE_CTRL_CYCLES",
+     "SP", "Shader/Streaming Processor: wave ctrl cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_LOAD_CYCLES, 0x3u, "SP_WAVE_LOAD_CYCLES",
+     "SP", "Shader/Streaming Processor: wave load cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_EMIT_CYCLES, 0x3u, "SP_WAVE_EMIT_CYCLES",
+     "SP", "Shader/Streaming Processor: wave emit cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_NOP_CYCLES, 0x3u, "SP_WAVE_NOP_CYCLES", "SP",
+     "Shader/Streaming Processor: wave nop cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_WAIT_CYCLES, 0x3u, "SP_WAVE_WAIT_CYCLES",
+     "SP", "Shader/Streaming Processor: wave wait cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_FETCH_CYCLES, 0x3u, "SP_WAVE_FETCH_CYCLES",
+     "SP", "Shader/Streaming Processor: wave fetch cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_IDLE_CYCLES, 0x3u, "SP_WAVE_IDLE_CYCLES",
+     "SP", "Shader/Streaming Processor: wave idle cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_END_CYCLES, 0x3u, "SP_WAVE_END_CYCLES", "SP",
+     "Shader/Streaming Processor: wave end cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_LONG_SYNC_CYCLES, 0x3u,
+     "SP_WAVE_LONG_SYNC_CYCLES", "SP",
+     "Shader/Streaming Processor: wave long sync cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_SHORT_SYNC_CYCLES, 0x3u,
+     "SP_WAVE_SHORT_SYNC_CYCLES", "SP",
+     "Shader/Streaming Processor: wave short sync cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_WAVE_JOIN_CYCLES, 0x3u, "SP_WAVE_JOIN_CYCLES",
+     "SP", "Shader/Streaming Processor: wave join cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_SP_LM_LOAD_INSTRUCTIONS, 0x3u,
+     "SP_LM_LOAD_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: LM load instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_LM_STORE_INSTRUCTIONS, 0x3u,
+     "SP_LM_STORE_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: LM store instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_LM_ATOMICS, 0x3u, "SP_LM_ATOMICS", "SP",
+     "Shader/Streaming Processor: LM atomics", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_GM_LOAD_INSTRUCTIONS, 0x3u,
+     "SP_GM_LOAD_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GM load instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_GM_STORE_INSTRUCTIONS, 0x3u,
+     "SP_GM_STORE_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GM store instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_GM_ATOMICS, 0x3u, "SP_GM_ATOMICS", "SP",
+     "Shader/Streaming Processor: GM atomics", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_TEX_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_TEX_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage tex instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_EFU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage EFU instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_FULL_ALU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_FULL_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage full ALU instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_STAGE_HALF_ALU_INSTRUCTIONS, 0x3u,
+     "SP_VS_STAGE_HALF_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS stage half ALU instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_TEX_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_TEX_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage tex instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_CFLOW_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_CFLOW_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage cflow instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_EFU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_EFU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage EFU instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_FULL_ALU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_FULL_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage full ALU instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_HALF_ALU_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_HALF_ALU_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage half ALU instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_STAGE_BARY_INSTRUCTIONS, 0x3u,
+     "SP_FS_STAGE_BARY_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS stage bary instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_VS_INSTRUCTIONS, 0x3u, "SP_VS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: VS instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_FS_INSTRUCTIONS, 0x3u, "SP_FS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: FS instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_ADDR_LOCK_COUNT, 0x3u, "SP_ADDR_LOCK_COUNT", "SP",
+     "Shader/Streaming Processor: addr lock count", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_UCHE_READ_TRANS, 0x3u, "SP_UCHE_READ_TRANS", "SP",
+     "Shader/Streaming Processor: UCHE read trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_UCHE_WRITE_TRANS, 0x3u, "SP_UCHE_WRITE_TRANS",
+     "SP", "Shader/Streaming Processor: UCHE write trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_EXPORT_VPC_TRANS, 0x3u, "SP_EXPORT_VPC_TRANS",
+     "SP", "Shader/Streaming Processor: export VPC trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_EXPORT_RB_TRANS, 0x3u, "SP_EXPORT_RB_TRANS", "SP",
+     "Shader/Streaming Processor: export RB trans", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_PIXELS_KILLED, 0x3u, "SP_PIXELS_KILLED", "SP",
+     "Shader/Streaming Processor: pixels killed", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_ICL1_REQUESTS, 0x3u, "SP_ICL1_REQUESTS", "SP",
+     "Shader/Streaming Processor: icl1 requests", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_ICL1_MISSES, 0x3u, "SP_ICL1_MISSES", "SP",
+     "Shader/Streaming Processor: icl1 misses", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_HS_INSTRUCTIONS, 0x3u, "SP_HS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: HS instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_DS_INSTRUCTIONS, 0x3u, "SP_DS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: DS instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_GS_INSTRUCTIONS, 0x3u, "SP_GS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: GS instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_CS_INSTRUCTIONS, 0x3u, "SP_CS_INSTRUCTIONS", "SP",
+     "Shader/Streaming Processor: CS instructions", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_GPR_READ, 0x3u, "SP_GPR_READ", "SP",
+     "Shader/Streaming Processor: GPR read", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_GPR_WRITE, 0x3u, "SP_GPR_WRITE", "SP",
+     "Shader/Streaming Processor: GPR write", "events"},
+    {HPC_GPU_ADRENO_COMMON_SP_LM_BANK_CONFLICTS, 0x3u, "SP_LM_BANK_CONFLICTS",
+     "SP", "Shader/Streaming Processor: LM bank conflicts", "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_BUSY_CYCLES, 0x3u, "RB_BUSY_CYCLES", "RB",
+     "RB: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_HLSQ, 0x3u, "RB_STALL_CYCLES_HLSQ",
+     "RB", "RB: stall cycles HLSQ", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO0_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO0_FULL", "RB", "RB: stall cycles fifo0 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO1_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO1_FULL", "RB", "RB: stall cycles fifo1 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_FIFO2_FULL, 0x3u,
+     "RB_STALL_CYCLES_FIFO2_FULL", "RB", "RB: stall cycles fifo2 full",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_SP, 0x3u, "RB_STARVE_CYCLES_SP",
+     "RB", "RB: starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_LRZ_TILE, 0x3u,
+     "RB_STARVE_CYCLES_LRZ_TILE", "RB", "RB: starve cycles LRZ tile", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_CCU, 0x3u, "RB_STARVE_CYCLES_CCU",
+     "RB", "RB: starve cycles CCU", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_Z_PLANE, 0x3u,
+     "RB_STARVE_CYCLES_Z_PLANE", "RB", "RB: starve cycles Z plane", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_STARVE_CYCLES_BARY_PLANE, 0x3u,
+     "RB_STARVE_CYCLES_BARY_PLANE", "RB", "RB: starve cycles bary plane",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_Z_WORKLOAD, 0x3u, "RB_Z_WORKLOAD", "RB",
+     "RB: Z workload", "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_HLSQ_ACTIVE, 0x3u, "RB_HLSQ_ACTIVE", "RB",
+     "RB: HLSQ active", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_Z_READ, 0x3u, "RB_Z_READ", "RB", "RB: Z read",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_Z_WRITE, 0x3u, "RB_Z_WRITE", "RB", "RB: Z write",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_C_READ, 0x3u, "RB_C_READ", "RB", "RB: C read",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_C_WRITE, 0x3u, "RB_C_WRITE", "RB", "RB: C write",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_TOTAL_PASS, 0x3u, "RB_TOTAL_PASS", "RB",
+     "RB: total pass", "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_Z_PASS, 0x3u, "RB_Z_PASS", "RB", "RB: Z pass",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_Z_FAIL, 0x3u, "RB_Z_FAIL", "RB", "RB: Z fail",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_S_FAIL, 0x3u, "RB_S_FAIL", "RB", "RB: S fail",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_BLENDED_FXP_COMPONENTS, 0x3u,
+     "RB_BLENDED_FXP_COMPONENTS", "RB", "RB: blended fxp components", "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_BLENDED_FP16_COMPONENTS, 0x3u,
+     "RB_BLENDED_FP16_COMPONENTS", "RB", "RB: blended fp16 components",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_2D_ALIVE_CYCLES, 0x3u, "RB_2D_ALIVE_CYCLES", "RB",
+     "RB: 2D alive cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_2D_STALL_CYCLES_A2D, 0x3u,
+     "RB_2D_STALL_CYCLES_A2D", "RB", "RB: 2D stall cycles a2d", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_SRC, 0x3u,
+     "RB_2D_STARVE_CYCLES_SRC", "RB", "RB: 2D starve cycles src", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_SP, 0x3u,
+     "RB_2D_STARVE_CYCLES_SP", "RB", "RB: 2D starve cycles SP", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_2D_STARVE_CYCLES_DST, 0x3u,
+     "RB_2D_STARVE_CYCLES_DST", "RB", "RB: 2D starve cycles dst", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_RB_2D_VALID_PIXELS, 0x3u, "RB_2D_VALID_PIXELS", "RB",
+     "RB: 2D valid pixels", "events"},
+    {HPC_GPU_ADRENO_COMMON_RB_STALL_CYCLES_CCU, 0x3u, "RB_STALL_CYCLES_CCU",
+     "RB", "RB: stall cycles CCU", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VSC_BUSY_CYCLES, 0x3u, "VSC_BUSY_CYCLES", "VSC",
+     "VSC: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VSC_WORKING_CYCLES, 0x3u, "VSC_WORKING_CYCLES",
+     "VSC", "VSC: working cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VSC_STALL_CYCLES_UCHE, 0x3u, "VSC_STALL_CYCLES_UCHE",
+     "VSC", "VSC: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_VSC_EOT_NUM, 0x3u, "VSC_EOT_NUM", "VSC",
+     "VSC: eot num", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_BUSY_CYCLES, 0x3u, "CCU_BUSY_CYCLES", "CCU",
+     "Cache and Compression Unit: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CCU_STALL_CYCLES_RB_DEPTH_RETURN, 0x3u,
+     "CCU_STALL_CYCLES_RB_DEPTH_RETURN", "CCU",
+     "Cache and Compression Unit: stall cycles RB depth return", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CCU_STALL_CYCLES_RB_COLOR_RETURN, 0x3u,
+     "CCU_STALL_CYCLES_RB_COLOR_RETURN", "CCU",
+     "Cache and Compression Unit: stall cycles RB color return", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CCU_STARVE_CYCLES_FLAG_RETURN, 0x3u,
+     "CCU_STARVE_CYCLES_FLAG_RETURN", "CCU",
+     "Cache and Compression Unit: starve cycles flag return", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_BLOCKS, 0x3u, "CCU_DEPTH_BLOCKS", "CCU",
+     "Cache and Compression Unit: depth blocks", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_BLOCKS, 0x3u, "CCU_COLOR_BLOCKS", "CCU",
+     "Cache and Compression Unit: color blocks", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_BLOCK_HIT, 0x3u, "CCU_DEPTH_BLOCK_HIT",
+     "CCU", "Cache and Compression Unit: depth block hit", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_BLOCK_HIT, 0x3u, "CCU_COLOR_BLOCK_HIT",
+     "CCU", "Cache and Compression Unit: color block hit", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_PARTIAL_BLOCK_READ, 0x3u,
+     "CCU_PARTIAL_BLOCK_READ", "CCU",
+     "Cache and Compression Unit: partial block read", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_GMEM_READ, 0x3u, "CCU_GMEM_READ", "CCU",
+     "Cache and Compression Unit: gmem read", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_GMEM_WRITE, 0x3u, "CCU_GMEM_WRITE", "CCU",
+     "Cache and Compression Unit: gmem write", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG0_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG0_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag0 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG1_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG1_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag1 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG2_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG2_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag2 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG3_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG3_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag3 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_DEPTH_READ_FLAG4_COUNT, 0x3u,
+     "CCU_DEPTH_READ_FLAG4_COUNT", "CCU",
+     "Cache and Compression Unit: depth read flag4 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG0_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG0_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag0 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG1_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG1_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag1 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG2_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG2_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag2 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG3_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG3_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag3 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_COLOR_READ_FLAG4_COUNT, 0x3u,
+     "CCU_COLOR_READ_FLAG4_COUNT", "CCU",
+     "Cache and Compression Unit: color read flag4 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_2D_RD_REQ, 0x3u, "CCU_2D_RD_REQ", "CCU",
+     "Cache and Compression Unit: 2D RD req", "events"},
+    {HPC_GPU_ADRENO_COMMON_CCU_2D_WR_REQ, 0x3u, "CCU_2D_WR_REQ", "CCU",
+     "Cache and Compression Unit: 2D WR req", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_BUSY_CYCLES, 0x3u, "LRZ_BUSY_CYCLES", "LRZ",
+     "Low Resolution Z: busy cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_STARVE_CYCLES_RAS, 0x3u, "LRZ_STARVE_CYCLES_RAS",
+     "LRZ", "Low Resolution Z: starve cycles RAS", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_RB, 0x3u, "LRZ_STALL_CYCLES_RB",
+     "LRZ", "Low Resolution Z: stall cycles RB", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_VSC, 0x3u, "LRZ_STALL_CYCLES_VSC",
+     "LRZ", "Low Resolution Z: stall cycles VSC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_VPC, 0x3u, "LRZ_STALL_CYCLES_VPC",
+     "LRZ", "Low Resolution Z: stall cycles VPC", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_FLAG_PREFETCH, 0x3u,
+     "LRZ_STALL_CYCLES_FLAG_PREFETCH", "LRZ",
+     "Low Resolution Z: stall cycles flag prefetch", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_STALL_CYCLES_UCHE, 0x3u, "LRZ_STALL_CYCLES_UCHE",
+     "LRZ", "Low Resolution Z: stall cycles UCHE", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_LRZ_READ, 0x3u, "LRZ_LRZ_READ", "LRZ",
+     "Low Resolution Z: LRZ read", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_LRZ_WRITE, 0x3u, "LRZ_LRZ_WRITE", "LRZ",
+     "Low Resolution Z: LRZ write", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_READ_LATENCY, 0x3u, "LRZ_READ_LATENCY", "LRZ",
+     "Low Resolution Z: read latency", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_MERGE_CACHE_UPDATING, 0x3u,
+     "LRZ_MERGE_CACHE_UPDATING", "LRZ",
+     "Low Resolution Z: merge cache updating", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_PRIM_KILLED_BY_MASKGEN, 0x3u,
+     "LRZ_PRIM_KILLED_BY_MASKGEN", "LRZ",
+     "Low Resolution Z: prim killed BY maskgen", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_PRIM_KILLED_BY_LRZ, 0x3u,
+     "LRZ_PRIM_KILLED_BY_LRZ", "LRZ", "Low Resolution Z: prim killed BY LRZ",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PRIM_AFTER_LRZ, 0x3u,
+     "LRZ_VISIBLE_PRIM_AFTER_LRZ", "LRZ",
+     "Low Resolution Z: visible prim after LRZ", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_FULL_8X8_TILES, 0x3u, "LRZ_FULL_8X8_TILES",
+     "LRZ", "Low Resolution Z: full 8x8 tiles", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_PARTIAL_8X8_TILES, 0x3u, "LRZ_PARTIAL_8X8_TILES",
+     "LRZ", "Low Resolution Z: partial 8x8 tiles", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_TILE_KILLED, 0x3u, "LRZ_TILE_KILLED", "LRZ",
+     "Low Resolution Z: tile killed", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_TOTAL_PIXEL, 0x3u, "LRZ_TOTAL_PIXEL", "LRZ",
+     "Low Resolution Z: total pixel", "events"},
+    {HPC_GPU_ADRENO_COMMON_LRZ_VISIBLE_PIXEL_AFTER_LRZ, 0x3u,
+     "LRZ_VISIBLE_PIXEL_AFTER_LRZ", "LRZ",
+     "Low Resolution Z: visible pixel after LRZ", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_LATENCY_CYCLES, 0x3u,
+     "CMP_CMPDECMP_VBIF_LATENCY_CYCLES", "CMP",
+     "CMP: cmpdecmp vbif latency cycles", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_LATENCY_SAMPLES, 0x3u,
+     "CMP_CMPDECMP_VBIF_LATENCY_SAMPLES", "CMP",
+     "CMP: cmpdecmp vbif latency samples", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_DATA_CCU, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_DATA_CCU", "CMP",
+     "CMP: cmpdecmp vbif read data CCU", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_DATA_CCU, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA_CCU", "CMP",
+     "CMP: cmpdecmp vbif write data CCU", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_REQUEST, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_REQUEST", "CMP", "CMP: cmpdecmp vbif read request",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_REQUEST, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_REQUEST", "CMP",
+     "CMP: cmpdecmp vbif write request", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_READ_DATA, 0x3u,
+     "CMP_CMPDECMP_VBIF_READ_DATA", "CMP", "CMP: cmpdecmp vbif read data",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_VBIF_WRITE_DATA, 0x3u,
+     "CMP_CMPDECMP_VBIF_WRITE_DATA", "CMP", "CMP: cmpdecmp vbif write data",
+     "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_FLAG_FETCH_CYCLES, 0x3u,
+     "CMP_CMPDECMP_FLAG_FETCH_CYCLES", "CMP", "CMP: cmpdecmp flag fetch cycles",
+     "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_FLAG_FETCH_SAMPLES, 0x3u,
+     "CMP_CMPDECMP_FLAG_FETCH_SAMPLES", "CMP",
+     "CMP: cmpdecmp flag fetch samples", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG1_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag1 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG2_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag2 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG3_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag3 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT, 0x3u,
+     "CMP_CMPDECMP_DEPTH_WRITE_FLAG4_COUNT", "CMP",
+     "CMP: cmpdecmp depth write flag4 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG1_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag1 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG2_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag2 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG3_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag3 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT, 0x3u,
+     "CMP_CMPDECMP_COLOR_WRITE_FLAG4_COUNT", "CMP",
+     "CMP: cmpdecmp color write flag4 count", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_REQ", "CMP",
+     "CMP: cmpdecmp 2D stall cycles vbif req", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_WR", "CMP",
+     "CMP: cmpdecmp 2D stall cycles vbif WR", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN, 0x3u,
+     "CMP_CMPDECMP_2D_STALL_CYCLES_VBIF_RETURN", "CMP",
+     "CMP: cmpdecmp 2D stall cycles vbif return", "cycles"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_RD_DATA, 0x3u,
+     "CMP_CMPDECMP_2D_RD_DATA", "CMP", "CMP: cmpdecmp 2D RD data", "events"},
+    {HPC_GPU_ADRENO_COMMON_CMP_CMPDECMP_2D_WR_DATA, 0x3u,
+     "CMP_CMPDECMP_2D_WR_DATA", "CMP", "CMP: cmpdecmp 2D WR data", "events"},
+    // clang-format on
+};
+
+/// The displacement of each perfect hash bucket.
+static const uint16_t adreno_common_counter_displacements[90] = {
+    148, 73, 2, 0, 33, 0, 64, 2, 26, 116, 53, 4, 0, 523, 44, 68, 83, 2, 125, 6,
+    30, 5, 37, 6, 18, 0, 32, 2, 33, 43, 33, 29, 8, 6, 7, 7, 16, 0, 12, 387, 16,
+    0, 29, 123, 135, 3, 255, 21, 39, 100, 33, 80, 131, 108, 0, 281, 32, 211,
+    200, 5, 4, 1001, 120, 76, 111, 70, 8, 465, 79, 1278, 5, 202, 328, 990, 108,
+    76, 144, 47, 1, 332, 81, 4391, 0, 384, 132, 10, 986, 1029, 1498, 12,
+};
+
+/// The metadata index of each perfect hash slot.
+static const uint16_t adreno_common_counter_slots[359] = {
+    114, 266, 202, 222, 353, 346, 320, 33, 13, 310, 153, 298, 157, 72, 293, 321,
+    107, 288, 241, 18, 323, 43, 17, 207, 146, 60, 226, 90, 236, 240, 312, 303,
+    265, 103, 83, 351, 255, 152, 55, 68, 275, 187, 318, 109, 67, 78, 175, 87,
+    89, 250, 158, 208, 50, 216, 264, 344, 252, 125, 8, 30, 22, 91, 14, 141, 42,
+    215, 347, 75, 285, 239, 195, 224, 316, 243, 237, 88, 4, 163, 171, 132, 244,
+    291, 47, 329, 142, 194, 9, 217, 168, 48, 110, 176, 328, 102, 213, 112, 273,
+    155, 335, 198, 270, 197, 58, 247, 115, 233, 227, 358, 305, 300, 223, 232,
+    210, 299, 349, 0, 191, 309, 201, 242, 151, 81, 2, 319, 192, 3, 45, 225, 314,
+    343, 53, 31, 82, 136, 70, 355, 44, 119, 230, 184, 345, 95, 336, 313, 301,
+    193, 52, 159, 290, 85, 356, 144, 126, 304, 61, 278, 120, 307, 86, 204, 292,
+    6, 21, 174, 131, 69, 212, 274, 188, 165, 333, 154, 117, 134, 121, 138, 39,
+    338, 49, 46, 340, 332, 272, 284, 15, 339, 167, 26, 156, 352, 64, 177, 263,
+    331, 261, 65, 12, 104, 100, 20, 322, 124, 282, 234, 62, 135, 170, 160, 106,
+    180, 172, 203, 181, 279, 7, 277, 99, 214, 350, 77, 76, 246, 269, 57, 211,
+    166, 286, 262, 32, 254, 94, 268, 66, 190, 79, 118, 182, 218, 84, 123, 228,
+    140, 63, 98, 315, 287, 229, 209, 73, 276, 235, 113, 80, 342, 5, 297, 16,
+    111, 122, 220, 130, 283, 54, 205, 289, 92, 24, 249, 186, 74, 258, 348, 189,
+    326, 253, 34, 271, 259, 330, 327, 325, 147, 23, 238, 256, 185, 260, 127, 35,
+    36, 128, 178, 139, 51, 317, 71, 129, 150, 306, 354, 219, 37, 281, 341, 308,
+    183, 149, 206, 169, 143, 40, 200, 93, 280, 302, 231, 196, 29, 105, 179, 296,
+    357, 19, 1, 59, 11, 334, 108, 101, 311, 337, 161, 96, 133, 38, 10, 41, 56,
+    145, 199, 162, 251, 28, 164, 148, 295, 221, 248, 294, 97, 27, 137, 324, 116,
+    267, 25, 245, 173, 257,
+};
+
+static const hpc_gpu_counter_registry_t adreno_common_counter_registry = {
+    359,
+    adreno_common_counter_infos,
+    2,
+    adreno_common_series_names,
+    90,
+    adreno_common_counter_displacements,
+    adreno_common_counter_slots,
+};
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+const hpc_gpu_counter_registry_t *hpc_gpu_adreno_common_get_counter_registry(
+    void) {
+  return &adreno_common_counter_registry;
+}
@@ -16,12 +16,20 @@
 
 #include "context.h"
 
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>  // For memset
-#include <unistd.h>  // For close
+#include <time.h>
 
+#include "counter_reservation.h"
+#include "device.h"
 #include "hpc/gpu/base_utilities.h"
 
+// The RBBM always-count counter, which counts GPU clock cycles. It has the
+// same group and selector on all supported series.
+#define CLOCK_COUNTER_GROUP_ID 1
+#define CLOCK_COUNTER_SELECTOR 0
+
 hpc_gpu_adreno_series_t hpc_gpu_adreno_get_series(int gpu_id) {
   if ((gpu_id >= 600 && gpu_id < 700) || gpu_id == 702)
     return HPC_GPU_ADRENO_SERIES_A6XX;
@@ -29,126 +37,762 @@ hpc_gpu_adreno_series_t hpc_gpu_adreno_get_series(int gpu_id) {
   return HPC_GPU_ADRENO_SERIES_UNKNOWN;
 }
 
-int hpc_gpu_adreno_create_context(
+void hpc_gpu_adreno_get_context_memory_requirements(uint32_t num_counters,
+                                                    size_t *size,
+                                                    size_t *alignment) {
+  // The context is followed by the two counter lists, start values, and the
+  // multiplexing state. All but the trailing active indices are 8-byte
+  // aligned so they can be packed back to back. Counter lists have one more
+  // entry for the clock counter.
+  size_t counter_size =
+      (num_counters + 1) * sizeof(hpc_gpu_adreno_ioctl_counter_read_counter_t);
+  *size = sizeof(hpc_gpu_adreno_context_t) + 3 * counter_size +
+          num_counters * sizeof(uint64_t) +
+          num_counters * sizeof(hpc_gpu_adreno_multiplexed_counter_t) +
+          num_counters * sizeof(uint32_t);
+  *alignment = _Alignof(hpc_gpu_adreno_context_t);
+}
+
+int hpc_gpu_adreno_create_context_in_memory(
     uint32_t num_counters, uint32_t *counters,
-    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_output_mode_t output_mode, void *memory,
     hpc_gpu_adreno_context_t **out_context) {
-  hpc_gpu_adreno_context_t *context =
-      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_adreno_context_t));
+  size_t size = 0, alignment = 0;
+  hpc_gpu_adreno_get_context_memory_requirements(num_counters, &size,
+                                                 &alignment);
+  memset(memory, 0, size);
 
-  size_t counter_size =
-      num_counters * sizeof(hpc_gpu_adreno_ioctl_counter_read_counter_t);
-  context->counters = allocator->alloc(allocator->user_data, counter_size);
-  memset(context->counters, 0, counter_size);
+  hpc_gpu_adreno_context_t *context = (hpc_gpu_adreno_context_t *)memory;
+  context->counters =
+      (hpc_gpu_adreno_ioctl_counter_read_counter_t *)(context + 1);
+  context->prev_counters = context->counters + num_counters + 1;
+  context->start_values =
+      (uint64_t *)(context->prev_counters + num_counters + 1);
+  context->multiplexed_counters =
+      (hpc_gpu_adreno_multiplexed_counter_t *)(context->start_values +
+                                               num_counters);
+  hpc_gpu_adreno_multiplexed_counter_t *multiplexed_counters_end =
+      context->multiplexed_counters + num_counters;
+  context->active_counters =
+      (hpc_gpu_adreno_ioctl_counter_read_counter_t *)multiplexed_counters_end;
+  context->active_indices =
+      (uint32_t *)(context->active_counters + num_counters + 1);
 
-  size_t init_value_size = num_counters * sizeof(uint64_t);
-  context->prev_values =
-      allocator->alloc(allocator->user_data, init_value_size);
-  memset(context->prev_values, 0, init_value_size);
+  context->counters[num_counters].group_id = CLOCK_COUNTER_GROUP_ID;
+  context->counters[num_counters].countable_selector = CLOCK_COUNTER_SELECTOR;
 
+  context->prev_timestamp_ns = 0;
   context->num_counters = num_counters;
+  context->output_mode = output_mode;
 
-  int gpu_device = hpc_gpu_adreno_ioctl_open_gpu_device();
-  if (gpu_device < 0) return gpu_device;
+  int gpu_device = -1;
+  uint32_t gpu_id = 0;
+  int status = hpc_gpu_adreno_acquire_device(&gpu_device, &gpu_id);
+  if (status < 0) return status;
   context->gpu_device = gpu_device;
-
-  uint32_t gpu_id = hpc_gpu_adreno_ioctl_get_gpu_device_id(context->gpu_device);
-  if (gpu_id < 0) return gpu_id;
   context->gpu_id = gpu_id;
 
   *out_context = context;
   return 0;
 }
 
+/// Releases the reservations of the first `num_reserved` counters, e.g., to
+/// roll back a failed start so that the caller can retry with multiplexing.
+static void adreno_context_release_counters(
+    const hpc_gpu_adreno_context_t *context, uint32_t num_reserved) {
+  int error = errno;
+  for (uint32_t i = 0; i < num_reserved; ++i) {
+    hpc_gpu_adreno_release_counter(context->gpu_device,
+                                   context->counters[i].group_id,
+                                   context->counters[i].countable_selector);
+  }
+  errno = error;
+}
+
+void hpc_gpu_adreno_context_reserve_counters(
+    hpc_gpu_adreno_context_t *context) {
+  for (uint32_t i = 0; i < context->num_counters; ++i) {
+    int status = hpc_gpu_adreno_reserve_counter(
+        context->gpu_device, context->counters[i].group_id,
+        context->counters[i].countable_selector);
+    if (status < 0) {
+      adreno_context_release_counters(context, i);
+      return;
+    }
+  }
+  context->counters_reserved = 1;
+}
+
+int hpc_gpu_adreno_destroy_context_in_memory(
+    hpc_gpu_adreno_context_t *context) {
+  if (context->counters_reserved) {
+    adreno_context_release_counters(context, context->num_counters);
+  }
+  return hpc_gpu_adreno_release_device(context->gpu_device);
+}
+
+int hpc_gpu_adreno_create_context(
+    uint32_t num_counters, uint32_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_context_t **out_context) {
+  size_t size = 0, alignment = 0;
+  hpc_gpu_adreno_get_context_memory_requirements(num_counters, &size,
+                                                 &alignment);
+  void *memory = allocator->alloc(allocator->user_data, size);
+
+  int status = hpc_gpu_adreno_create_context_in_memory(
+      num_counters, counters, output_mode, memory, out_context);
+  if (status < 0) allocator->free(allocator->user_data, memory);
+  return status;
+}
+
 int hpc_gpu_adreno_destroy_context(
     hpc_gpu_adreno_context_t *context,
     const hpc_gpu_host_allocation_callbacks_t *allocator) {
-  int status = close(context->gpu_device);
+  int status = hpc_gpu_adreno_destroy_context_in_memory(context);
   if (status < 0) return status;
 
-  allocator->free(allocator->user_data, context->prev_values);
-  allocator->free(allocator->user_data, context->counters);
   allocator->free(allocator->user_data, context);
   return 0;
 }
 
-int hpc_gpu_adreno_context_start_counters(
+static uint64_t get_monotonic_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static uint64_t get_monotonic_raw_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+/// Enables the clock counter if the kernel driver lets us. The kernel driver
+/// usually holds it already for its own busy statistics, in which case this
+/// just shares it. Sampling goes on without a clock reference otherwise.
+static void adreno_context_enable_clock_counter(
+    hpc_gpu_adreno_context_t *context) {
+  int error = errno;
+  context->has_clock_counter =
+      hpc_gpu_adreno_reserve_counter(context->gpu_device,
+                                     CLOCK_COUNTER_GROUP_ID,
+                                     CLOCK_COUNTER_SELECTOR) == 0;
+  errno = error;
+}
+
+static int adreno_context_disable_clock_counter(
     const hpc_gpu_adreno_context_t *context) {
+  if (!context->has_clock_counter) return 0;
+  return hpc_gpu_adreno_release_counter(
+      context->gpu_device, CLOCK_COUNTER_GROUP_ID, CLOCK_COUNTER_SELECTOR);
+}
+
+/// Returns the clock counter increment since the previous query given the
+/// raw value just read, and takes the value as the new baseline.
+static uint64_t adreno_context_advance_clock(hpc_gpu_adreno_context_t *context,
+                                             uint64_t value) {
+  if (!context->has_clock_counter) return 0;
+  uint64_t prev_value = context->prev_clock_value;
+  context->prev_clock_value = value;
+  return value >= prev_value ? value - prev_value : 0;
+}
+
+int hpc_gpu_adreno_context_start_counters(hpc_gpu_adreno_context_t *context) {
+  // Context creation should guard against unknown series so it should not
+  // happen here.
+  if (hpc_gpu_adreno_get_series(context->gpu_id) ==
+      HPC_GPU_ADRENO_SERIES_UNKNOWN) {
+    return 0;
+  }
+
   // Activate all selected counters
-  hpc_gpu_adreno_series_t series = hpc_gpu_adreno_get_series(context->gpu_id);
-  switch (series) {
-    case HPC_GPU_ADRENO_SERIES_UNKNOWN:
-      // Context creation should guard against this so it should not happen
-      // here.
-      return 0;
-    case HPC_GPU_ADRENO_SERIES_A6XX:
-      for (int i = 0; i < context->num_counters; ++i) {
-        int status = hpc_gpu_adreno_ioctl_activate_counter(
-            context->gpu_device, context->counters[i].group_id,
-            context->counters[i].countable_selector);
-        if (status < 0) return status;
+  for (uint32_t i = 0; i < context->num_counters; ++i) {
+    int status = hpc_gpu_adreno_reserve_counter(
+        context->gpu_device, context->counters[i].group_id,
+        context->counters[i].countable_selector);
+    if (status < 0) {
+      adreno_context_release_counters(context, i);
+      return status;
+    }
+  }
+
+  adreno_context_enable_clock_counter(context);
+
+  // Query their initial values. Both counter lists need the same groups and
+  // selectors since queries alternate between them.
+  uint32_t num_counters = context->num_counters;
+  memcpy(context->prev_counters, context->counters,
+         (num_counters + 1) * sizeof(context->counters[0]));
+  int status = hpc_gpu_adreno_ioctl_query_counters(
+      context->gpu_device, num_counters + context->has_clock_counter,
+      context->prev_counters);
+  if (status < 0) {
+    int error = errno;
+    adreno_context_disable_clock_counter(context);
+    adreno_context_release_counters(context, num_counters);
+    errno = error;
+    return status;
+  }
+  context->prev_clock_value = context->prev_counters[num_counters].value;
+  context->prev_timestamp_ns = get_monotonic_time_ns();
+  context->start_timestamp_ns = context->prev_timestamp_ns;
+  context->multiplexed = 0;
+
+  for (int i = 0; i < context->num_counters; ++i) {
+    context->start_values[i] = context->prev_counters[i].value;
+  }
+
+  return 0;
+}
+
+/// Returns whether the counter belongs to the given pass.
+static inline int adreno_counter_in_pass(
+    const hpc_gpu_adreno_multiplexed_counter_t *counter, uint64_t pass_index) {
+  return counter->slice == pass_index % counter->num_slices;
+}
+
+/// Returns whether activating the given pass activates the counter.
+static inline int adreno_counter_activated_with_pass(
+    const hpc_gpu_adreno_multiplexed_counter_t *counter, uint64_t pass_index,
+    int activate_all) {
+  return adreno_counter_in_pass(counter, pass_index) &&
+         (activate_all || counter->num_slices > 1);
+}
+
+/// Activates counters of the given pass and collects them into the active
+/// list. Counters in groups that are never rotated are only activated if
+/// `activate_all` is set.
+///
+/// On failure, counters activated so far are deactivated again and the
+/// active list is left untouched.
+static int adreno_context_activate_pass(hpc_gpu_adreno_context_t *context,
+                                        uint64_t pass_index,
+                                        int activate_all) {
+  const hpc_gpu_adreno_multiplexed_counter_t *multiplexed_counters =
+      context->multiplexed_counters;
+  const hpc_gpu_adreno_ioctl_counter_read_counter_t *counters =
+      context->counters;
+  for (uint32_t i = 0; i < context->num_counters; ++i) {
+    if (!adreno_counter_activated_with_pass(&multiplexed_counters[i],
+                                            pass_index, activate_all)) {
+      continue;
+    }
+    int status = hpc_gpu_adreno_reserve_counter(
+        context->gpu_device, counters[i].group_id,
+        counters[i].countable_selector);
+    if (status < 0) {
+      int error = errno;
+      for (uint32_t j = 0; j < i; ++j) {
+        if (!adreno_counter_activated_with_pass(&multiplexed_counters[j],
+                                                pass_index, activate_all)) {
+          continue;
+        }
+        hpc_gpu_adreno_release_counter(context->gpu_device,
+                                       counters[j].group_id,
+                                       counters[j].countable_selector);
       }
-      break;
-    case HPC_GPU_ADRENO_SERIES_A5XX:
-      for (int i = 0; i < context->num_counters; ++i) {
-        int status = hpc_gpu_adreno_ioctl_activate_counter(
-            context->gpu_device, context->counters[i].group_id,
-            context->counters[i].countable_selector);
-        if (status < 0) return status;
+      errno = error;
+      return status;
+    }
+  }
+
+  uint32_t num_active_counters = 0;
+  for (uint32_t i = 0; i < context->num_counters; ++i) {
+    if (!adreno_counter_in_pass(&multiplexed_counters[i], pass_index)) continue;
+    context->active_counters[num_active_counters] = context->counters[i];
+    context->active_indices[num_active_counters] = i;
+    ++num_active_counters;
+  }
+  context->active_counters[num_active_counters] =
+      context->counters[context->num_counters];
+  context->num_active_counters = num_active_counters;
+  return 0;
+}
+
+/// Returns whether deactivating the active pass deactivates the counter.
+static inline int adreno_counter_deactivated_with_pass(
+    const hpc_gpu_adreno_multiplexed_counter_t *counter, int deactivate_all) {
+  return deactivate_all || counter->num_slices > 1;
+}
+
+/// Deactivates counters in the active list. Counters in groups that are never
+/// rotated are only deactivated if `deactivate_all` is set.
+///
+/// When rotating, a failure activates the counters deactivated so far again,
+/// so the active list still describes what is held. With `deactivate_all`,
+/// the remaining counters are still deactivated and the first error is
+/// returned.
+static int adreno_context_deactivate_pass(
+    const hpc_gpu_adreno_context_t *context, int deactivate_all) {
+  const hpc_gpu_adreno_ioctl_counter_read_counter_t *active_counters =
+      context->active_counters;
+  int first_status = 0, first_error = 0;
+  for (uint32_t k = 0; k < context->num_active_counters; ++k) {
+    const hpc_gpu_adreno_multiplexed_counter_t *counter =
+        &context->multiplexed_counters[context->active_indices[k]];
+    if (!adreno_counter_deactivated_with_pass(counter, deactivate_all)) {
+      continue;
+    }
+    int status = hpc_gpu_adreno_release_counter(
+        context->gpu_device, active_counters[k].group_id,
+        active_counters[k].countable_selector);
+    if (status < 0 && deactivate_all) {
+      if (first_status == 0) {
+        first_status = status;
+        first_error = errno;
       }
-      break;
+    } else if (status < 0) {
+      int error = errno;
+      for (uint32_t j = 0; j < k; ++j) {
+        counter = &context->multiplexed_counters[context->active_indices[j]];
+        if (!adreno_counter_deactivated_with_pass(counter, deactivate_all)) {
+          continue;
+        }
+        hpc_gpu_adreno_reserve_counter(context->gpu_device,
+                                       active_counters[j].group_id,
+                                       active_counters[j].countable_selector);
+      }
+      errno = error;
+      return status;
+    }
+  }
+  if (first_status < 0) errno = first_error;
+  return first_status;
+}
+
+/// Removes counters of rotated groups from the active list, leaving only
+/// those that are never deactivated between passes.
+static void adreno_context_drop_rotated_counters(
+    hpc_gpu_adreno_context_t *context) {
+  uint32_t num_active_counters = 0;
+  for (uint32_t k = 0; k < context->num_active_counters; ++k) {
+    uint32_t i = context->active_indices[k];
+    if (context->multiplexed_counters[i].num_slices > 1) continue;
+    context->active_counters[num_active_counters] = context->active_counters[k];
+    context->active_indices[num_active_counters] = i;
+    ++num_active_counters;
   }
+  context->active_counters[num_active_counters] =
+      context->counters[context->num_counters];
+  context->num_active_counters = num_active_counters;
+}
 
-  // Query their initial values
+/// Reads the active list and takes the raw values of counters that just got
+/// activated as their baseline. The clock counter only takes its baseline
+/// if `read_all` is set; it keeps running across rotations.
+static int adreno_context_read_pass_baseline(hpc_gpu_adreno_context_t *context,
+                                             int read_all) {
+  uint32_t num_active_counters = context->num_active_counters;
   int status = hpc_gpu_adreno_ioctl_query_counters(
-      context->gpu_device, context->num_counters, context->counters,
-      context->prev_values);
+      context->gpu_device, num_active_counters + context->has_clock_counter,
+      context->active_counters);
   if (status < 0) return status;
+  uint64_t timestamp_ns = get_monotonic_time_ns();
+
+  for (uint32_t k = 0; k < num_active_counters; ++k) {
+    hpc_gpu_adreno_multiplexed_counter_t *counter =
+        &context->multiplexed_counters[context->active_indices[k]];
+    if (!read_all && counter->num_slices == 1) continue;
+    counter->last_value = context->active_counters[k].value;
+    counter->last_timestamp_ns = timestamp_ns;
+  }
+  if (read_all) {
+    context->prev_clock_value =
+        context->active_counters[num_active_counters].value;
+  }
+  context->pass_timestamp_ns = timestamp_ns;
+  return 0;
+}
+
+/// Marks counters in the probe scratch list that duplicate an earlier one.
+#define DUPLICATE_COUNTER UINT32_MAX
+
+/// Returns the index of the first counter with the same group and selector
+/// as the counter at `index`, which is `index` itself unless it duplicates an
+/// earlier one.
+static uint32_t adreno_context_find_first_counter(
+    const hpc_gpu_adreno_context_t *context, uint32_t index) {
+  const hpc_gpu_adreno_ioctl_counter_read_counter_t *counters =
+      context->counters;
+  for (uint32_t j = 0; j < index; ++j) {
+    if (counters[j].group_id == counters[index].group_id &&
+        counters[j].countable_selector == counters[index].countable_selector) {
+      return j;
+    }
+  }
+  return index;
+}
+
+/// Does the work of `hpc_gpu_adreno_context_start_counters_multiplexed` once
+/// the reservations taken at creation are dropped.
+static int adreno_context_start_passes(hpc_gpu_adreno_context_t *context,
+                                       uint64_t rotation_period_ns) {
+  int gpu_device = context->gpu_device;
+  const hpc_gpu_adreno_ioctl_counter_read_counter_t *counters =
+      context->counters;
+  hpc_gpu_adreno_multiplexed_counter_t *multiplexed_counters =
+      context->multiplexed_counters;
+  uint32_t num_counters = context->num_counters;
+  uint32_t *num_fits = context->active_indices;  // Scratch
+
+  // Probe how many registers each group has left by activating counters until
+  // the kernel driver reports no free register. Remember which ones fit in
+  // `slice` for now. Duplicates share the register of their first occurrence,
+  // so they are skipped lest they count as fitting twice.
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    multiplexed_counters[i].slice = 0;
+    if (adreno_context_find_first_counter(context, i) != i) {
+      num_fits[i] = DUPLICATE_COUNTER;
+      continue;
+    }
+    int status = hpc_gpu_adreno_reserve_counter(
+        gpu_device, counters[i].group_id, counters[i].countable_selector);
+    if (status < 0 && errno != EBUSY) {
+      int error = errno;
+      for (uint32_t j = 0; j < i; ++j) {
+        if (!multiplexed_counters[j].slice) continue;
+        hpc_gpu_adreno_release_counter(
+            gpu_device, counters[j].group_id, counters[j].countable_selector);
+      }
+      errno = error;
+      return status;
+    }
+    multiplexed_counters[i].slice = status == 0;
+  }
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    if (!multiplexed_counters[i].slice) continue;
+    hpc_gpu_adreno_release_counter(gpu_device, counters[i].group_id,
+                                   counters[i].countable_selector);
+  }
+
+  // Partition each group into slices of as many distinct counters as fit.
+  // This is quadratic in the number of counters, but only runs once per start
+  // and avoids a fixed bound on group IDs.
+  uint32_t num_passes = 1;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    if (num_fits[i] == DUPLICATE_COUNTER) continue;
+    uint32_t num_fit = 0;
+    for (uint32_t j = 0; j < num_counters; ++j) {
+      num_fit += counters[j].group_id == counters[i].group_id &&
+                 multiplexed_counters[j].slice;
+    }
+    num_fits[i] = num_fit;
+  }
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    if (num_fits[i] == DUPLICATE_COUNTER) {
+      // Sample duplicates in the same passes as their first occurrence.
+      uint32_t first = adreno_context_find_first_counter(context, i);
+      multiplexed_counters[i] = multiplexed_counters[first];
+      continue;
+    }
+    uint32_t rank = 0, group_size = 0;
+    for (uint32_t j = 0; j < num_counters; ++j) {
+      int same_group = counters[j].group_id == counters[i].group_id &&
+                       num_fits[j] != DUPLICATE_COUNTER;
+      rank += same_group && j < i;
+      group_size += same_group;
+    }
+    if (num_fits[i] == 0) {
+      // Another process holds all registers of this group.
+      errno = EBUSY;
+      return -1;
+    }
+    uint32_t num_slices = (group_size + num_fits[i] - 1) / num_fits[i];
+    memset(&multiplexed_counters[i], 0, sizeof(multiplexed_counters[i]));
+    multiplexed_counters[i].slice = rank / num_fits[i];
+    multiplexed_counters[i].num_slices = num_slices;
+    if (num_slices > num_passes) num_passes = num_slices;
+  }
+
+  adreno_context_enable_clock_counter(context);
+  int status = adreno_context_activate_pass(context, 0, /*activate_all=*/1);
+  if (status == 0) {
+    status = adreno_context_read_pass_baseline(context, /*read_all=*/1);
+    if (status < 0) {
+      int error = errno;
+      adreno_context_deactivate_pass(context, /*deactivate_all=*/1);
+      errno = error;
+    }
+  }
+  if (status < 0) {
+    int error = errno;
+    adreno_context_disable_clock_counter(context);
+    errno = error;
+    return status;
+  }
 
+  context->multiplexed = 1;
+  context->num_passes = num_passes;
+  context->pass_index = 0;
+  context->rotation_period_ns = rotation_period_ns;
+  context->start_timestamp_ns = context->pass_timestamp_ns;
+  context->prev_timestamp_ns = context->pass_timestamp_ns;
   return 0;
 }
 
+int hpc_gpu_adreno_context_start_counters_multiplexed(
+    hpc_gpu_adreno_context_t *context, uint64_t rotation_period_ns) {
+  if (hpc_gpu_adreno_get_series(context->gpu_id) ==
+      HPC_GPU_ADRENO_SERIES_UNKNOWN) {
+    return 0;
+  }
+
+  // Drop the reservations taken at creation so that only the active pass
+  // holds counter registers. They are taken again if starting fails, so that
+  // a failed start leaves the context as it was.
+  int reserved = context->counters_reserved;
+  if (reserved) {
+    adreno_context_release_counters(context, context->num_counters);
+    context->counters_reserved = 0;
+  }
+
+  int status = adreno_context_start_passes(context, rotation_period_ns);
+  if (status < 0 && reserved) {
+    int error = errno;
+    hpc_gpu_adreno_context_reserve_counters(context);
+    errno = error;
+  }
+  return status;
+}
+
 int hpc_gpu_adreno_context_stop_counters(
     const hpc_gpu_adreno_context_t *context) {
-  hpc_gpu_adreno_series_t series = hpc_gpu_adreno_get_series(context->gpu_id);
-  switch (series) {
-    case HPC_GPU_ADRENO_SERIES_UNKNOWN:
-      // Context creation should guard against this so it should not happen
-      // here.
-      return 0;
-    case HPC_GPU_ADRENO_SERIES_A6XX:
-      for (int i = 0; i < context->num_counters; ++i) {
-        int status = hpc_gpu_adreno_ioctl_deactivate_counter(
-            context->gpu_device, context->counters[i].group_id,
-            context->counters[i].countable_selector);
-        if (status < 0) return status;
+  // Release everything even if some release fails, and report the first
+  // failure.
+  int first_status = 0, first_error = 0;
+  if (context->multiplexed) {
+    first_status =
+        adreno_context_deactivate_pass(context, /*deactivate_all=*/1);
+    first_error = errno;
+  } else if (hpc_gpu_adreno_get_series(context->gpu_id) !=
+             HPC_GPU_ADRENO_SERIES_UNKNOWN) {
+    for (uint32_t i = 0; i < context->num_counters; ++i) {
+      int status = hpc_gpu_adreno_release_counter(
+          context->gpu_device, context->counters[i].group_id,
+          context->counters[i].countable_selector);
+      if (status < 0 && first_status == 0) {
+        first_status = status;
+        first_error = errno;
       }
+    }
+  }
+
+  int status = adreno_context_disable_clock_counter(context);
+  if (first_status < 0) {
+    errno = first_error;
+    return first_status;
+  }
+  return status;
+}
+
+/// Samples the active pass of a multiplexed context, and rotates to the next
+/// pass if the current one has lasted long enough.
+static int adreno_context_query_counters_multiplexed(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  if (times) times->host_begin_ns = get_monotonic_raw_time_ns();
+  int status = hpc_gpu_adreno_ioctl_query_counters(
+      context->gpu_device,
+      context->num_active_counters + context->has_clock_counter,
+      context->active_counters);
+  if (status < 0) return status;
+  uint64_t timestamp_ns = get_monotonic_time_ns();
+  if (times) times->host_end_ns = get_monotonic_raw_time_ns();
+
+  const hpc_gpu_adreno_ioctl_counter_read_counter_t *active_counters =
+      context->active_counters;
+  const uint32_t *active_indices = context->active_indices;
+  hpc_gpu_adreno_multiplexed_counter_t *multiplexed_counters =
+      context->multiplexed_counters;
+  uint32_t num_active_counters = context->num_active_counters;
+
+  uint64_t backwards = 0;
+  for (uint32_t k = 0; k < num_active_counters; ++k) {
+    backwards |= active_counters[k].value <
+                 multiplexed_counters[active_indices[k]].last_value;
+  }
+  if (backwards) return -HPC_GPU_ERROR_INTERNAL;
+
+  uint64_t clock_cycles = adreno_context_advance_clock(
+      context, active_counters[num_active_counters].value);
+  if (times) {
+    times->driver_timestamp_ns = 0;
+    times->gpu_clock_cycles = clock_cycles;
+  }
+
+  // Extrapolate every counter from the rate observed while it was active,
+  // then overwrite the active ones with what was actually measured.
+  uint64_t elapsed_ns = timestamp_ns - context->prev_timestamp_ns;
+  for (uint32_t i = 0; i < context->num_counters; ++i) {
+    const hpc_gpu_adreno_multiplexed_counter_t *counter =
+        &multiplexed_counters[i];
+    values[i] = counter->running_ns ? (uint64_t)((double)counter->count *
+                                                 (double)elapsed_ns /
+                                                 (double)counter->running_ns)
+                                    : 0;
+  }
+  for (uint32_t k = 0; k < num_active_counters; ++k) {
+    uint32_t i = active_indices[k];
+    hpc_gpu_adreno_multiplexed_counter_t *counter = &multiplexed_counters[i];
+    uint64_t delta = active_counters[k].value - counter->last_value;
+    uint64_t running_ns = timestamp_ns - counter->last_timestamp_ns;
+    // Counters rotated in after the previous query ran for a bit less than
+    // the whole interval.
+    values[i] = running_ns == elapsed_ns || running_ns == 0
+                    ? delta
+                    : (uint64_t)((double)delta * (double)elapsed_ns /
+                                 (double)running_ns);
+    counter->count += delta;
+    counter->running_ns += running_ns;
+    counter->last_value = active_counters[k].value;
+    counter->last_timestamp_ns = timestamp_ns;
+  }
+
+  switch (context->output_mode) {
+    case HPC_GPU_ADRENO_OUTPUT_MODE_DELTA:
       break;
-    case HPC_GPU_ADRENO_SERIES_A5XX:
-      for (int i = 0; i < context->num_counters; ++i) {
-        int status = hpc_gpu_adreno_ioctl_deactivate_counter(
-            context->gpu_device, context->counters[i].group_id,
-            context->counters[i].countable_selector);
-        if (status < 0) return status;
+    case HPC_GPU_ADRENO_OUTPUT_MODE_CUMULATIVE: {
+      double enabled_ns = (double)(timestamp_ns - context->start_timestamp_ns);
+      for (uint32_t i = 0; i < context->num_counters; ++i) {
+        const hpc_gpu_adreno_multiplexed_counter_t *counter =
+            &multiplexed_counters[i];
+        values[i] = counter->running_ns
+                        ? (uint64_t)((double)counter->count * enabled_ns /
+                                     (double)counter->running_ns)
+                        : 0;
       }
-      break;
+    } break;
+    case HPC_GPU_ADRENO_OUTPUT_MODE_RATE: {
+      double scale = elapsed_ns ? 1e9 / (double)elapsed_ns : 0.0;
+      for (uint32_t i = 0; i < context->num_counters; ++i) {
+        values[i] = (uint64_t)((double)values[i] * scale);
+      }
+    } break;
+  }
+  context->prev_timestamp_ns = timestamp_ns;
+
+  if (context->num_passes == 1 ||
+      timestamp_ns - context->pass_timestamp_ns < context->rotation_period_ns) {
+    return 0;
   }
+
+  // Rotate: swap out the slices of oversubscribed groups for their next ones.
+  // Counters of other groups keep running and keep their baselines.
+  status = adreno_context_deactivate_pass(context, /*deactivate_all=*/0);
+  if (status < 0) return status;
+  status = adreno_context_activate_pass(context, context->pass_index + 1,
+                                        /*activate_all=*/0);
+  if (status == 0) {
+    context->pass_index += 1;
+  } else {
+    // The next slices could not get their registers, e.g., because another
+    // process took them. Take back the current slices and retry rotating
+    // after another period. If even that fails, only sample the counters
+    // still held and report the error; later rotations try again.
+    int error = errno;
+    if (adreno_context_activate_pass(context, context->pass_index,
+                                     /*activate_all=*/0) < 0) {
+      adreno_context_drop_rotated_counters(context);
+      adreno_context_read_pass_baseline(context, /*read_all=*/0);
+      errno = error;
+      return status;
+    }
+  }
+  return adreno_context_read_pass_baseline(context, /*read_all=*/0);
+}
+
+/// Samples counters, and reports sample times into `times` if it is not
+/// NULL.
+static int adreno_context_query_counters(hpc_gpu_adreno_context_t *context,
+                                         uint64_t *values,
+                                         hpc_gpu_sample_times_t *times) {
+  if (context->multiplexed) {
+    return adreno_context_query_counters_multiplexed(context, values, times);
+  }
+
+  if (times) times->host_begin_ns = get_monotonic_raw_time_ns();
+  int status = hpc_gpu_adreno_ioctl_query_counters(
+      context->gpu_device, context->num_counters + context->has_clock_counter,
+      context->counters);
+  if (status < 0) return status;
+  uint64_t timestamp_ns = get_monotonic_time_ns();
+  if (times) times->host_end_ns = get_monotonic_raw_time_ns();
+
+  // Derive outputs in one pass directly over the raw values. Counters increase
+  // monotonically; going backwards is only recorded here and checked after the
+  // loop to keep it branch-free.
+  hpc_gpu_adreno_ioctl_counter_read_counter_t *counters = context->counters;
+  hpc_gpu_adreno_ioctl_counter_read_counter_t *prev_counters =
+      context->prev_counters;
+  uint32_t num_counters = context->num_counters;
+  uint64_t backwards = 0;
+  switch (context->output_mode) {
+    case HPC_GPU_ADRENO_OUTPUT_MODE_DELTA: {
+      for (uint32_t i = 0; i < num_counters; ++i) {
+        uint64_t value = counters[i].value;
+        uint64_t prev_value = prev_counters[i].value;
+        backwards |= value < prev_value;
+        values[i] = value - prev_value;
+      }
+    } break;
+    case HPC_GPU_ADRENO_OUTPUT_MODE_CUMULATIVE: {
+      const uint64_t *start_values = context->start_values;
+      for (uint32_t i = 0; i < num_counters; ++i) {
+        uint64_t value = counters[i].value;
+        backwards |= value < prev_counters[i].value;
+        values[i] = value - start_values[i];
+      }
+    } break;
+    case HPC_GPU_ADRENO_OUTPUT_MODE_RATE: {
+      uint64_t elapsed_ns = timestamp_ns - context->prev_timestamp_ns;
+      double scale = elapsed_ns ? 1e9 / (double)elapsed_ns : 0.0;
+      for (uint32_t i = 0; i < num_counters; ++i) {
+        uint64_t value = counters[i].value;
+        uint64_t prev_value = prev_counters[i].value;
+        backwards |= value < prev_value;
+        values[i] = (uint64_t)((double)(value - prev_value) * scale);
+      }
+    } break;
+  }
+  if (backwards) return -HPC_GPU_ERROR_INTERNAL;
+
+  uint64_t clock_cycles =
+      adreno_context_advance_clock(context, counters[num_counters].value);
+  if (times) {
+    times->driver_timestamp_ns = 0;
+    times->gpu_clock_cycles = clock_cycles;
+  }
+
+  // Commit this sample as the previous one.
+  context->counters = prev_counters;
+  context->prev_counters = counters;
+  context->prev_timestamp_ns = timestamp_ns;
   return 0;
 }
 
 int hpc_gpu_adreno_context_query_counters(hpc_gpu_adreno_context_t *context,
                                           uint64_t *values) {
-  int status = hpc_gpu_adreno_ioctl_query_counters(
-      context->gpu_device, context->num_counters, context->counters, values);
-  for (int i = 0; i < context->num_counters; ++i) {
-    uint64_t value = values[i];
-    uint64_t prev_value = context->prev_values[i];
-    // Counters increase linearly. We need to subtract the previous value.
-    if (value < prev_value) return -HPC_GPU_ERROR_INTERNAL;
-    values[i] -= prev_value;
-    context->prev_values[i] = value;
-  }
+  return adreno_context_query_counters(context, values, NULL);
+}
 
-  if (status < 0) return status;
+int hpc_gpu_adreno_context_query_counters_with_times(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  return adreno_context_query_counters(context, values, times);
+}
+
+int hpc_gpu_adreno_context_get_multiplexing_times(
+    const hpc_gpu_adreno_context_t *context, uint64_t *time_enabled_ns,
+    uint64_t *time_running_ns) {
+  uint64_t enabled_ns =
+      context->prev_timestamp_ns - context->start_timestamp_ns;
+  *time_enabled_ns = enabled_ns;
+  for (uint32_t i = 0; i < context->num_counters; ++i) {
+    time_running_ns[i] = context->multiplexed
+                             ? context->multiplexed_counters[i].running_ns
+                             : enabled_ns;
+  }
   return 0;
 }
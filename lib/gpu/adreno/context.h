@@ -17,9 +17,11 @@
 #ifndef HPC_GPU_ADRENO_CONTEXT_H_
 #define HPC_GPU_ADRENO_CONTEXT_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "driver_ioctl.h"
+#include "hpc/gpu/adreno/output_mode.h"
 #include "hpc/gpu/base_utilities.h"
 
 #ifdef __cplusplus
@@ -40,20 +42,113 @@ typedef enum hpc_gpu_adreno_series_e {
 /// @param[in] gpu_id The GPU ID (e.g., 540, 650, etc.)
 hpc_gpu_adreno_series_t hpc_gpu_adreno_get_series(int gpu_id);
 
+/// Per-counter state for time-multiplexed sampling.
+typedef struct hpc_gpu_adreno_multiplexed_counter_t {
+  /// The raw value at the last read while the counter was active.
+  uint64_t last_value;
+  /// The `CLOCK_MONOTONIC` time of the last read while the counter was active
+  /// in nanoseconds.
+  uint64_t last_timestamp_ns;
+  /// The total increment observed while the counter was active.
+  uint64_t count;
+  /// The total time the counter was active in nanoseconds.
+  uint64_t running_ns;
+  /// Which slice of its group the counter belongs to.
+  uint32_t slice;
+  /// The number of slices its group is partitioned into.
+  uint32_t num_slices;
+} hpc_gpu_adreno_multiplexed_counter_t;
+
 /// Adreno counter sampling context.
 typedef struct hpc_gpu_adreno_context_t {
-  /// The list of counters to sample.
+  /// The list of counters to sample. Queries read raw values into it. It has
+  /// room for the clock counter after the requested counters.
   hpc_gpu_adreno_ioctl_counter_read_counter_t *counters;
-  /// The previous sampled values of counters.
-  uint64_t *prev_values;
+  /// The list of counters holding the previous raw values. It swaps with
+  /// `counters` after each successful query so no values need copying.
+  hpc_gpu_adreno_ioctl_counter_read_counter_t *prev_counters;
+  /// The raw values when counters were started, for the cumulative mode.
+  uint64_t *start_values;
+  /// The `CLOCK_MONOTONIC` time of the previous raw read in nanoseconds.
+  uint64_t prev_timestamp_ns;
+  /// Whether the RBBM always-count counter is read after the requested
+  /// counters as a GPU clock reference. Starting counters enables it if the
+  /// kernel driver lets us.
+  int has_clock_counter;
+  /// The raw clock counter value at the previous query.
+  uint64_t prev_clock_value;
   /// The number of counters.
   uint32_t num_counters;
+  /// What queries report for each counter.
+  hpc_gpu_adreno_output_mode_t output_mode;
   /// The current GPU's ID.
   uint32_t gpu_id;
+
+  /// Whether counters are time-multiplexed. The fields below are only
+  /// meaningful when this is set.
+  int multiplexed;
+  /// The per-counter multiplexing state.
+  hpc_gpu_adreno_multiplexed_counter_t *multiplexed_counters;
+  /// The counters of the active pass, compacted for a single raw read. The
+  /// clock counter follows them.
+  hpc_gpu_adreno_ioctl_counter_read_counter_t *active_counters;
+  /// The index into `counters` of each entry in `active_counters`.
+  uint32_t *active_indices;
+  /// The number of counters in the active pass.
+  uint32_t num_active_counters;
+  /// The number of passes needed to cover all counters once.
+  uint32_t num_passes;
+  /// The index of the active pass, counting up from zero at start.
+  uint64_t pass_index;
+  /// The minimal time between two pass rotations in nanoseconds.
+  uint64_t rotation_period_ns;
+  /// The `CLOCK_MONOTONIC` time when the active pass started in nanoseconds.
+  uint64_t pass_timestamp_ns;
+  /// The `CLOCK_MONOTONIC` time when counters were started in nanoseconds.
+  uint64_t start_timestamp_ns;
+
   /// THe current GPU's file descriptor.
   int gpu_device;
+  /// Whether all counters were reserved at creation. The reservations are
+  /// held until destruction so that starting and stopping counters only
+  /// adjusts reference counts instead of issuing ioctls.
+  int counters_reserved;
 } hpc_gpu_adreno_context_t;
 
+/// Returns the size and alignment of the memory needed by a context for the
+/// given number of counters.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[out] size         The number of bytes needed.
+/// @param[out] alignment    The required alignment of the memory in bytes.
+void hpc_gpu_adreno_get_context_memory_requirements(uint32_t num_counters,
+                                                    size_t *size,
+                                                    size_t *alignment);
+
+/// Creates a context for Adreno GPU counters in the given memory.
+///
+/// The context and all its internal lists are laid out in `memory`, which
+/// must satisfy `hpc_gpu_adreno_get_context_memory_requirements` and outlive
+/// the context. No host memory is allocated.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  counters     The pointer to the list of counters to sample
+///                          later.
+/// @param[in]  output_mode  What queries report for each counter.
+/// @param[in]  memory       The memory for holding the context.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_adreno_create_context_in_memory(
+    uint32_t num_counters, uint32_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode, void *memory,
+    hpc_gpu_adreno_context_t **out_context);
+
+/// Destroys the context for Adreno GPU counters created in caller-provided
+/// memory. The memory itself is left to the caller.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_adreno_destroy_context_in_memory(hpc_gpu_adreno_context_t *context);
+
 /// Creates a context for Adreno GPU counters.
 ///
 /// Note that this function performs necessary allocation for counters, but it
@@ -63,12 +158,14 @@ typedef struct hpc_gpu_adreno_context_t {
 /// @param[in]  num_counters The number of counters to sample later.
 /// @param[in]  counters     The pointer to the list of counters to sample
 ///                          later.
+/// @param[in]  output_mode  What queries report for each counter.
 /// @param[in]  allocator    The allocator used to allocate host memory for
 ///                          sampling counters later.
 /// @param[out] out_context  The pointer to the object receiving the resultant
 ///                          context.
 int hpc_gpu_adreno_create_context(
     uint32_t num_counters, uint32_t *counters,
+    hpc_gpu_adreno_output_mode_t output_mode,
     const hpc_gpu_host_allocation_callbacks_t *allocator,
     hpc_gpu_adreno_context_t **out_context);
 
@@ -80,25 +177,64 @@ int hpc_gpu_adreno_destroy_context(
     hpc_gpu_adreno_context_t *context,
     const hpc_gpu_host_allocation_callbacks_t *allocator);
 
+/// Reserves all counters in the context until it is destroyed.
+///
+/// This is expected to be called once after decoding counters into their
+/// groups and selectors. If not all counters can be reserved, e.g., because
+/// a group runs out of registers, nothing stays reserved and starting
+/// counters reserves them instead.
+///
+/// @param[in] context The counter sampling context.
+void hpc_gpu_adreno_context_reserve_counters(hpc_gpu_adreno_context_t *context);
+
 /// Starts sampling Adreno GPU counters specified when creating the context.
 ///
 /// This activates the registered counters and reads their initial values in
 /// preparation for continously sampling.
 ///
 /// @param[in] context The counter sampling context.
-int hpc_gpu_adreno_context_start_counters(
-    const hpc_gpu_adreno_context_t *context);
+int hpc_gpu_adreno_context_start_counters(hpc_gpu_adreno_context_t *context);
 
 /// Stops sampling Adreno GPU counters specified when creating the context.
 ///
-/// This deactivates the registered counters.
+/// This deactivates the registered counters. If deactivating one fails, the
+/// others are still deactivated and the first error is returned.
 ///
 /// @param[in] context The counter sampling context.
 int hpc_gpu_adreno_context_stop_counters(
     const hpc_gpu_adreno_context_t *context);
 
+/// Starts sampling Adreno GPU counters with time multiplexing.
+///
+/// Each group only has a few physical counter registers. This activates as
+/// many counters per group as the kernel driver accepts, partitions each
+/// group's counters into slices of that size, and then rotates through the
+/// slices from queries, at most once per `rotation_period_ns`. Groups fitting
+/// into their registers are never rotated.
+///
+/// @param[in] context            The counter sampling context.
+/// @param[in] rotation_period_ns The minimal time between two rotations in
+///                               nanoseconds. Zero rotates on every query.
+int hpc_gpu_adreno_context_start_counters_multiplexed(
+    hpc_gpu_adreno_context_t *context, uint64_t rotation_period_ns);
+
 /// Samples Adreno GPU counters specified when creating the context.
 ///
+/// Values are reported according to the output mode chosen when creating the
+/// context. If any counter went backwards since the previous query, this
+/// returns `-HPC_GPU_ERROR_INTERNAL` and leaves the context untouched, so the
+/// next query still reports against the last good sample.
+///
+/// With multiplexing, only the active pass is read. Counters that were not
+/// active for the whole interval are extrapolated from the rate observed
+/// while they were active, and cumulative values are scaled by the ratio of
+/// enabled to running time, as perf does.
+///
+/// If the next pass cannot be activated, the query keeps the current pass and
+/// retries after another rotation period. If the current pass cannot be
+/// activated again either, the query returns the error, and later queries
+/// only sample the counters that are still active until a rotation succeeds.
+///
 /// @param[in]  context The counter sampling context.
 /// @param[out] values  The pointer to the memory for receiving newly sampled
 ///                     values. Its element count should be greater than or
@@ -107,6 +243,39 @@ int hpc_gpu_adreno_context_stop_counters(
 int hpc_gpu_adreno_context_query_counters(hpc_gpu_adreno_context_t *context,
                                           uint64_t *values);
 
+/// Samples Adreno GPU counters like `hpc_gpu_adreno_context_query_counters`,
+/// and reports when the sample was taken.
+///
+/// The kernel driver reports no timestamp, so `driver_timestamp_ns` is always
+/// 0. `gpu_clock_cycles` is the delta of the RBBM always-count counter, or 0
+/// if it could not be enabled.
+///
+/// @param[in]  context The counter sampling context.
+/// @param[out] values  The pointer to the memory for receiving newly sampled
+///                     values, as `hpc_gpu_adreno_context_query_counters`.
+/// @param[out] times   The pointer to the object receiving sample times.
+int hpc_gpu_adreno_context_query_counters_with_times(
+    hpc_gpu_adreno_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times);
+
+/// Returns how long counters have been enabled and running as of the last
+/// query.
+///
+/// Without multiplexing every counter runs whenever it is enabled. The ratio
+/// `time_running_ns[i] / time_enabled_ns` tells how much of a multiplexed
+/// estimate is measured rather than extrapolated.
+///
+/// @param[in]  context         The counter sampling context.
+/// @param[out] time_enabled_ns The time since starting counters in
+///                             nanoseconds.
+/// @param[out] time_running_ns The pointer to the memory for receiving the
+///                             time each counter was active in nanoseconds.
+///                             Its element count should be greater than or
+///                             equal to the number of counters.
+int hpc_gpu_adreno_context_get_multiplexing_times(
+    const hpc_gpu_adreno_context_t *context, uint64_t *time_enabled_ns,
+    uint64_t *time_running_ns);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "counter_reservation.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include "driver_ioctl.h"
+
+/// The maximal number of counters reserved at the same time, across all
+/// devices. Live reservations are bounded by the number of counter registers,
+/// which is well below this for any Adreno GPU.
+#define RESERVATION_TABLE_SIZE 1024u
+
+typedef struct reservation_entry_t {
+  /// The device, group, and selector packed by `reservation_make_key`.
+  uint64_t key;
+  /// The number of outstanding reservations. Zero means the entry is empty.
+  uint32_t refcount;
+} reservation_entry_t;
+
+/// Open-addressing hash table with linear probing. Entries are removed with
+/// backward shifting so lookups never need tombstones.
+static reservation_entry_t reservation_table[RESERVATION_TABLE_SIZE];
+static pthread_mutex_t reservation_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static inline uint64_t reservation_make_key(int gpu_device, uint32_t group_id,
+                                            uint32_t countable_selector) {
+  return ((uint64_t)(uint32_t)gpu_device << 32) | (group_id << 16) |
+         countable_selector;
+}
+
+static inline int reservation_get_device(uint64_t key) {
+  return (int)(uint32_t)(key >> 32);
+}
+
+static inline uint32_t reservation_hash(uint64_t key) {
+  // Fibonacci hashing; the table size is a power of two.
+  return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 54);
+}
+
+/// Returns the index of the entry for `key`, or of the empty entry ending its
+/// probe sequence. Returns `RESERVATION_TABLE_SIZE` if the table is full.
+static uint32_t reservation_find(uint64_t key) {
+  uint32_t index = reservation_hash(key);
+  for (uint32_t i = 0; i < RESERVATION_TABLE_SIZE; ++i) {
+    const reservation_entry_t *entry = &reservation_table[index];
+    if (entry->refcount == 0 || entry->key == key) return index;
+    index = (index + 1) & (RESERVATION_TABLE_SIZE - 1);
+  }
+  return RESERVATION_TABLE_SIZE;
+}
+
+/// Empties the entry at `index`, shifting later entries of the same probe
+/// sequence back so none of them becomes unreachable.
+static void reservation_remove(uint32_t index) {
+  uint32_t hole = index;
+  uint32_t next = index;
+  for (;;) {
+    next = (next + 1) & (RESERVATION_TABLE_SIZE - 1);
+    reservation_entry_t *entry = &reservation_table[next];
+    if (entry->refcount == 0) break;
+    // The entry can fill the hole if the hole lies on its probe sequence,
+    // i.e., between its home index and where it is now.
+    uint32_t home = reservation_hash(entry->key);
+    uint32_t distance_to_hole = (hole - home) & (RESERVATION_TABLE_SIZE - 1);
+    uint32_t distance_to_next = (next - home) & (RESERVATION_TABLE_SIZE - 1);
+    if (distance_to_hole < distance_to_next) {
+      reservation_table[hole] = *entry;
+      hole = next;
+    }
+  }
+  reservation_table[hole].refcount = 0;
+}
+
+int hpc_gpu_adreno_reserve_counter(int gpu_device, uint32_t group_id,
+                                   uint32_t countable_selector) {
+  uint64_t key =
+      reservation_make_key(gpu_device, group_id, countable_selector);
+
+  pthread_mutex_lock(&reservation_mutex);
+  int status = 0;
+  uint32_t index = reservation_find(key);
+  if (index == RESERVATION_TABLE_SIZE) {
+    errno = ENOSPC;
+    status = -1;
+  } else if (reservation_table[index].refcount != 0) {
+    ++reservation_table[index].refcount;
+  } else {
+    status = hpc_gpu_adreno_ioctl_activate_counter(gpu_device, group_id,
+                                                   countable_selector);
+    if (status == 0) {
+      reservation_table[index].key = key;
+      reservation_table[index].refcount = 1;
+    }
+  }
+  pthread_mutex_unlock(&reservation_mutex);
+  return status;
+}
+
+int hpc_gpu_adreno_release_counter(int gpu_device, uint32_t group_id,
+                                   uint32_t countable_selector) {
+  uint64_t key =
+      reservation_make_key(gpu_device, group_id, countable_selector);
+
+  pthread_mutex_lock(&reservation_mutex);
+  int status = 0;
+  uint32_t index = reservation_find(key);
+  if (index == RESERVATION_TABLE_SIZE ||
+      reservation_table[index].refcount == 0) {
+    errno = EINVAL;
+    status = -1;
+  } else if (--reservation_table[index].refcount == 0) {
+    // Keep the entry until the kernel driver agrees, so a failed deactivation
+    // leaves the reservation usable.
+    status = hpc_gpu_adreno_ioctl_deactivate_counter(gpu_device, group_id,
+                                                     countable_selector);
+    if (status < 0) {
+      reservation_table[index].refcount = 1;
+    } else {
+      reservation_remove(index);
+    }
+  }
+  pthread_mutex_unlock(&reservation_mutex);
+  return status;
+}
+
+void hpc_gpu_adreno_forget_counter_reservations(int gpu_device) {
+  pthread_mutex_lock(&reservation_mutex);
+  for (uint32_t index = 0; index < RESERVATION_TABLE_SIZE;) {
+    const reservation_entry_t *entry = &reservation_table[index];
+    if (entry->refcount != 0 &&
+        reservation_get_device(entry->key) == gpu_device) {
+      // Removal may shift another entry into this index; look at it again.
+      reservation_remove(index);
+    } else {
+      ++index;
+    }
+  }
+  pthread_mutex_unlock(&reservation_mutex);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_COUNTER_RESERVATION_H_
+#define HPC_GPU_ADRENO_COUNTER_RESERVATION_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Reserves an Adreno counter on the given GPU device.
+///
+/// Reservations are reference counted per device, group, and selector across
+/// all contexts in the process. Only the first reservation activates the
+/// counter in the kernel driver; later ones just bump the reference count.
+///
+/// @param[in] gpu_device         The file descriptor for the GPU device.
+/// @param[in] group_id           The counter's group ID.
+/// @param[in] countable_selector The counter's selector.
+int hpc_gpu_adreno_reserve_counter(int gpu_device, uint32_t group_id,
+                                   uint32_t countable_selector);
+
+/// Releases a reservation made by `hpc_gpu_adreno_reserve_counter`.
+///
+/// Only releasing the last reservation deactivates the counter in the kernel
+/// driver. Returns -1 and sets `errno` to `EINVAL` if the counter is not
+/// reserved.
+///
+/// @param[in] gpu_device         The file descriptor for the GPU device.
+/// @param[in] group_id           The counter's group ID.
+/// @param[in] countable_selector The counter's selector.
+int hpc_gpu_adreno_release_counter(int gpu_device, uint32_t group_id,
+                                   uint32_t countable_selector);
+
+/// Drops all reservations on the given GPU device without deactivating
+/// counters. This should be called right before closing the device, which
+/// releases all its counters in the kernel driver anyway.
+///
+/// @param[in] gpu_device The file descriptor for the GPU device.
+void hpc_gpu_adreno_forget_counter_reservations(int gpu_device);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_ADRENO_COUNTER_RESERVATION_H_
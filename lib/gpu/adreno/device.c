@@ -0,0 +1,103 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include "counter_reservation.h"
+#include "driver_ioctl.h"
+
+/// The process-wide Adreno GPU device. Systems only have one.
+typedef struct adreno_device_registry_t {
+  pthread_mutex_t mutex;
+  /// The file descriptor for the GPU device, if open.
+  int gpu_device;
+  /// The number of outstanding acquisitions. The device is open iff nonzero.
+  uint32_t refcount;
+  /// Whether `gpu_id` was probed.
+  int probed;
+  /// The backend generation `gpu_id` was probed with.
+  uint32_t probed_backend_generation;
+  /// The cached GPU ID.
+  uint32_t gpu_id;
+} adreno_device_registry_t;
+
+static adreno_device_registry_t device_registry = {
+    PTHREAD_MUTEX_INITIALIZER, -1, 0, 0, 0, 0};
+
+/// Does the work of `hpc_gpu_adreno_acquire_device` with the registry locked.
+static int adreno_acquire_device_locked(adreno_device_registry_t *registry,
+                                        int *gpu_device, uint32_t *gpu_id) {
+  int opened = 0;
+  if (registry->refcount == 0) {
+    int device = hpc_gpu_adreno_ioctl_open_gpu_device();
+    if (device < 0) return device;
+    registry->gpu_device = device;
+    opened = 1;
+  }
+
+  uint32_t generation = hpc_gpu_adreno_ioctl_get_backend_generation();
+  if (!registry->probed || registry->probed_backend_generation != generation) {
+    uint32_t id = hpc_gpu_adreno_ioctl_get_gpu_device_id(registry->gpu_device);
+    if (id == (uint32_t)-1) {
+      registry->probed = 0;
+      if (opened) {
+        int error = errno;
+        hpc_gpu_adreno_ioctl_close_gpu_device(registry->gpu_device);
+        registry->gpu_device = -1;
+        errno = error;
+      }
+      return -1;
+    }
+    registry->gpu_id = id;
+    registry->probed = 1;
+    registry->probed_backend_generation = generation;
+  }
+
+  ++registry->refcount;
+  *gpu_device = registry->gpu_device;
+  *gpu_id = registry->gpu_id;
+  return 0;
+}
+
+int hpc_gpu_adreno_acquire_device(int *gpu_device, uint32_t *gpu_id) {
+  pthread_mutex_lock(&device_registry.mutex);
+  int status = adreno_acquire_device_locked(&device_registry, gpu_device,
+                                            gpu_id);
+  pthread_mutex_unlock(&device_registry.mutex);
+  return status;
+}
+
+int hpc_gpu_adreno_release_device(int gpu_device) {
+  adreno_device_registry_t *registry = &device_registry;
+  pthread_mutex_lock(&registry->mutex);
+
+  int status = 0;
+  if (registry->refcount == 0 || registry->gpu_device != gpu_device) {
+    errno = EINVAL;
+    status = -1;
+  } else if (--registry->refcount == 0) {
+    hpc_gpu_adreno_forget_counter_reservations(gpu_device);
+    status = hpc_gpu_adreno_ioctl_close_gpu_device(gpu_device);
+    registry->gpu_device = -1;
+  }
+
+  pthread_mutex_unlock(&registry->mutex);
+  return status;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_DEVICE_H_
+#define HPC_GPU_ADRENO_DEVICE_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Acquires the process-wide Adreno GPU device.
+///
+/// The device is opened on the first acquisition and shared by all later ones
+/// until the last release. The GPU ID is probed once and cached until the
+/// driver backend changes, even across closing and reopening the device. If
+/// probing fails, nothing is acquired and the next acquisition probes again.
+///
+/// @param[out] gpu_device The file descriptor for the GPU device.
+/// @param[out] gpu_id     The GPU ID (e.g., 540, 650, etc.)
+int hpc_gpu_adreno_acquire_device(int *gpu_device, uint32_t *gpu_id);
+
+/// Releases the device acquired by `hpc_gpu_adreno_acquire_device`.
+///
+/// The last release drops all remaining counter reservations on the device
+/// and closes it.
+///
+/// @param[in] gpu_device The file descriptor for the GPU device.
+int hpc_gpu_adreno_release_device(int gpu_device);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_ADRENO_DEVICE_H_
@@ -38,11 +38,11 @@ static_assert(sizeof(uint64_t) == sizeof(unsigned long long),
 // Open/close device
 //===----------------------------------------------------------------------===//
 
-int hpc_gpu_adreno_ioctl_open_gpu_device(void) {
+static int kgsl_open_gpu_device(void *user_data) {
   return open("/dev/kgsl-3d0", O_RDWR);
 }
 
-int hpc_gpu_adreno_ioctl_close_gpu_device(int gpu_device) {
+static int kgsl_close_gpu_device(void *user_data, int gpu_device) {
   return close(gpu_device);
 }
 
@@ -50,7 +50,7 @@ int hpc_gpu_adreno_ioctl_close_gpu_device(int gpu_device) {
 // Get device information
 //===----------------------------------------------------------------------===//
 
-uint32_t hpc_gpu_adreno_ioctl_get_gpu_device_id(int gpu_device) {
+static uint32_t kgsl_get_gpu_device_id(void *user_data, int gpu_device) {
   struct adreno_device_info devinfo;
   memset(&devinfo, 0, sizeof(struct adreno_device_info));
 
@@ -73,8 +73,9 @@ uint32_t hpc_gpu_adreno_ioctl_get_gpu_device_id(int gpu_device) {
 // Activate counter
 //===----------------------------------------------------------------------===//
 
-int hpc_gpu_adreno_ioctl_activate_counter(int gpu_device, uint32_t group_id,
-                                          uint32_t countable_selector) {
+static int kgsl_activate_counter(void *user_data, int gpu_device,
+                                 uint32_t group_id,
+                                 uint32_t countable_selector) {
   struct adreno_counter_get payload;
   memset(&payload, 0, sizeof(struct adreno_counter_get));
   payload.group_id = group_id;
@@ -87,8 +88,9 @@ int hpc_gpu_adreno_ioctl_activate_counter(int gpu_device, uint32_t group_id,
 // Deactivate counter
 //===----------------------------------------------------------------------===//
 
-int hpc_gpu_adreno_ioctl_deactivate_counter(int gpu_device, uint32_t group_id,
-                                            uint32_t countable_selector) {
+static int kgsl_deactivate_counter(void *user_data, int gpu_device,
+                                   uint32_t group_id,
+                                   uint32_t countable_selector) {
   struct adreno_counter_put payload;
   memset(&payload, 0, sizeof(struct adreno_counter_put));
   payload.group_id = group_id;
@@ -101,18 +103,74 @@ int hpc_gpu_adreno_ioctl_deactivate_counter(int gpu_device, uint32_t group_id,
 // Query counter
 //===----------------------------------------------------------------------===//
 
-int hpc_gpu_adreno_ioctl_query_counters(
-    int gpu_device, uint32_t num_counters,
-    hpc_gpu_adreno_ioctl_counter_read_counter_t *counters, uint64_t *values) {
+static int kgsl_query_counters(
+    void *user_data, int gpu_device, uint32_t num_counters,
+    hpc_gpu_adreno_ioctl_counter_read_counter_t *counters) {
   struct adreno_counter_read payload;
   memset(&payload, 0, sizeof(struct adreno_counter_read));
   payload.num_counters = num_counters;
   payload.counters = counters;
 
-  int status = ioctl(gpu_device, ADRENO_IOCTL_COUNTER_READ, &payload);
-  if (status) return status;
+  return ioctl(gpu_device, ADRENO_IOCTL_COUNTER_READ, &payload);
+}
 
-  for (int i = 0; i < num_counters; ++i) values[i] = counters[i].value;
+//===----------------------------------------------------------------------===//
+// Backend dispatch
+//===----------------------------------------------------------------------===//
+
+static const hpc_gpu_adreno_ioctl_backend_t kgsl_backend = {
+    NULL,
+    kgsl_open_gpu_device,
+    kgsl_close_gpu_device,
+    kgsl_get_gpu_device_id,
+    kgsl_activate_counter,
+    kgsl_deactivate_counter,
+    kgsl_query_counters,
+};
+
+static const hpc_gpu_adreno_ioctl_backend_t *current_backend = &kgsl_backend;
+/// Bumped whenever the backend changes.
+static uint32_t current_backend_generation = 0;
+
+void hpc_gpu_adreno_ioctl_set_backend(
+    const hpc_gpu_adreno_ioctl_backend_t *backend) {
+  current_backend = backend ? backend : &kgsl_backend;
+  ++current_backend_generation;
+}
 
-  return 0;
+uint32_t hpc_gpu_adreno_ioctl_get_backend_generation(void) {
+  return current_backend_generation;
+}
+
+int hpc_gpu_adreno_ioctl_open_gpu_device(void) {
+  return current_backend->open_gpu_device(current_backend->user_data);
+}
+
+int hpc_gpu_adreno_ioctl_close_gpu_device(int gpu_device) {
+  return current_backend->close_gpu_device(current_backend->user_data,
+                                           gpu_device);
+}
+
+uint32_t hpc_gpu_adreno_ioctl_get_gpu_device_id(int gpu_device) {
+  return current_backend->get_gpu_device_id(current_backend->user_data,
+                                            gpu_device);
+}
+
+int hpc_gpu_adreno_ioctl_activate_counter(int gpu_device, uint32_t group_id,
+                                          uint32_t countable_selector) {
+  return current_backend->activate_counter(
+      current_backend->user_data, gpu_device, group_id, countable_selector);
+}
+
+int hpc_gpu_adreno_ioctl_deactivate_counter(int gpu_device, uint32_t group_id,
+                                            uint32_t countable_selector) {
+  return current_backend->deactivate_counter(
+      current_backend->user_data, gpu_device, group_id, countable_selector);
+}
+
+int hpc_gpu_adreno_ioctl_query_counters(
+    int gpu_device, uint32_t num_counters,
+    hpc_gpu_adreno_ioctl_counter_read_counter_t *counters) {
+  return current_backend->query_counters(current_backend->user_data,
+                                         gpu_device, num_counters, counters);
 }
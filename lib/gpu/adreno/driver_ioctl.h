@@ -33,6 +33,8 @@ int hpc_gpu_adreno_ioctl_close_gpu_device(int gpu_device);
 
 /// Gets the Adreno GPU device ID.
 ///
+/// Returns `(uint32_t)-1` and sets `errno` if the ioctl fails.
+///
 /// @param[in] gpu_device The file descriptor for the GPU device.
 uint32_t hpc_gpu_adreno_ioctl_get_gpu_device_id(int gpu_device);
 
@@ -60,16 +62,49 @@ typedef struct hpc_gpu_adreno_ioctl_counter_read_counter_t {
 
 /// Samples multiple Adreno counters.
 ///
-/// @param[in]  gpu_device   The file descriptor for the GPU device.
-/// @param[in]  num_counters The number of counters to sample.
-/// @param[in]  counters     The list of counters to sample.
-/// @param[out] values       The pointer to memory to receive sampled values.
-///                          Its element count should be greater than or
-///                          equal to the number of counters specified when
-///                          creating the `context`.
+/// The kernel driver writes sampled values into the `value` field of each
+/// element in `counters`.
+///
+/// @param[in]     gpu_device   The file descriptor for the GPU device.
+/// @param[in]     num_counters The number of counters to sample.
+/// @param[in,out] counters     The list of counters to sample.
 int hpc_gpu_adreno_ioctl_query_counters(
     int gpu_device, uint32_t num_counters,
-    hpc_gpu_adreno_ioctl_counter_read_counter_t *counters, uint64_t *values);
+    hpc_gpu_adreno_ioctl_counter_read_counter_t *counters);
+
+/// Function table implementing the Adreno driver calls above.
+///
+/// By default calls go to the KGSL kernel driver via `/dev/kgsl-3d0`. Other
+/// backends, e.g., a simulated driver, can be installed to exercise sampling
+/// logic without Adreno GPUs. Functions report errors like the system calls
+/// they replace: returning -1 and setting `errno`.
+typedef struct hpc_gpu_adreno_ioctl_backend_t {
+  /// The user data passed to all functions in the table.
+  void *user_data;
+  int (*open_gpu_device)(void *user_data);
+  int (*close_gpu_device)(void *user_data, int gpu_device);
+  uint32_t (*get_gpu_device_id)(void *user_data, int gpu_device);
+  int (*activate_counter)(void *user_data, int gpu_device, uint32_t group_id,
+                          uint32_t countable_selector);
+  int (*deactivate_counter)(void *user_data, int gpu_device,
+                            uint32_t group_id, uint32_t countable_selector);
+  int (*query_counters)(void *user_data, int gpu_device,
+                        uint32_t num_counters,
+                        hpc_gpu_adreno_ioctl_counter_read_counter_t *counters);
+} hpc_gpu_adreno_ioctl_backend_t;
+
+/// Routes all Adreno driver calls to the given backend.
+///
+/// This should only be called when no GPU device is open.
+///
+/// @param[in] backend The backend to use, or NULL to restore the KGSL kernel
+///                    driver. It must outlive all devices opened through it.
+void hpc_gpu_adreno_ioctl_set_backend(
+    const hpc_gpu_adreno_ioctl_backend_t *backend);
+
+/// Returns a number that changes whenever the backend changes, so that
+/// information probed from devices can be cached until then.
+uint32_t hpc_gpu_adreno_ioctl_get_backend_generation(void);
 
 #ifdef __cplusplus
 }  // extern "C"
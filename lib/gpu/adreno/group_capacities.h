@@ -0,0 +1,137 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_GROUP_CAPACITIES_H_
+#define HPC_GPU_ADRENO_GROUP_CAPACITIES_H_
+
+#include <stdint.h>
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The number of counter registers in each A5XX group, indexed by group ID, as
+/// exposed by the KGSL kernel driver.
+static const uint32_t hpc_gpu_adreno_a5xx_group_capacities[] = {
+    8,   // CP
+    4,   // RBBM
+    8,   // PC
+    8,   // VFD
+    8,   // HLSQ
+    4,   // VPC
+    4,   // TSE
+    4,   // RAS
+    8,   // UCHE
+    8,   // TP
+    12,  // SP
+    8,   // RB
+    0,   // PWR
+    4,   // VBIF
+    3,   // VBIF_PWR
+    0,   // MH
+    0,   // PA_SU
+    0,   // SQ
+    0,   // SX
+    0,   // TCF
+    0,   // TCM
+    0,   // TCR
+    0,   // L2
+    2,   // VSC
+    4,   // CCU
+    4,   // LRZ
+    4,   // CMP
+};
+
+/// The number of groups in the table above.
+#define HPC_GPU_ADRENO_A5XX_NUM_GROUPS            \
+  (sizeof(hpc_gpu_adreno_a5xx_group_capacities) / \
+   sizeof(hpc_gpu_adreno_a5xx_group_capacities[0]))
+
+/// The number of counter registers in each A6XX group, indexed by group ID, as
+/// exposed by the KGSL kernel driver.
+static const uint32_t hpc_gpu_adreno_a6xx_group_capacities[] = {
+    14,  // CP
+    4,   // RBBM
+    8,   // PC
+    8,   // VFD
+    6,   // HLSQ
+    6,   // VPC
+    4,   // TSE
+    4,   // RAS
+    12,  // UCHE
+    12,  // TP
+    24,  // SP
+    8,   // RB
+    1,   // PWR
+    4,   // VBIF
+    3,   // VBIF_PWR
+    0,   // MH
+    0,   // PA_SU
+    0,   // SQ
+    0,   // SX
+    0,   // TCF
+    0,   // TCM
+    0,   // TCR
+    0,   // L2
+    2,   // VSC
+    5,   // CCU
+    4,   // LRZ
+    4,   // CMP
+};
+
+/// The number of groups in the table above.
+#define HPC_GPU_ADRENO_A6XX_NUM_GROUPS            \
+  (sizeof(hpc_gpu_adreno_a6xx_group_capacities) / \
+   sizeof(hpc_gpu_adreno_a6xx_group_capacities[0]))
+
+/// The number of counter registers in each group on every known Adreno GPU,
+/// indexed by group ID, as exposed by the KGSL kernel driver.
+static const uint32_t hpc_gpu_adreno_common_group_capacities[] = {
+    8,   // CP
+    4,   // RBBM
+    8,   // PC
+    8,   // VFD
+    6,   // HLSQ
+    4,   // VPC
+    4,   // TSE
+    4,   // RAS
+    8,   // UCHE
+    8,   // TP
+    12,  // SP
+    8,   // RB
+    0,   // PWR
+    4,   // VBIF
+    3,   // VBIF_PWR
+    0,   // MH
+    0,   // PA_SU
+    0,   // SQ
+    0,   // SX
+    0,   // TCF
+    0,   // TCM
+    0,   // TCR
+    0,   // L2
+    2,   // VSC
+    4,   // CCU
+    4,   // LRZ
+    4,   // CMP
+};
+
+/// The number of groups in the table above.
+#define HPC_GPU_ADRENO_COMMON_NUM_GROUPS            \
+  (sizeof(hpc_gpu_adreno_common_group_capacities) / \
+   sizeof(hpc_gpu_adreno_common_group_capacities[0]))
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+#endif  // HPC_GPU_ADRENO_GROUP_CAPACITIES_H_
@@ -0,0 +1,361 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/adreno/sampling_client.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "hpc/gpu/base_utilities.h"
+#include "sampling_protocol.h"
+
+typedef struct hpc_gpu_adreno_sampling_client_t {
+  /// The connection to the daemon, kept open to hold the registration.
+  int socket_fd;
+  /// The mapped shared sample buffer.
+  const hpc_gpu_adreno_sampling_buffer_header_t *buffer;
+  /// The size of the mapped shared sample buffer.
+  size_t buffer_size;
+  /// The number of slots, validated against `buffer_size` when mapping.
+  uint32_t num_slots;
+
+  /// The number of counters the client registered.
+  uint32_t num_counters;
+  /// The counters the client registered.
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+  /// The layout generation `columns` was computed for, or zero if none.
+  uint32_t generation;
+  /// The index of each registered counter in slot values of `generation`.
+  uint32_t columns[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+
+  /// The index of the next sample to read.
+  uint64_t next_index;
+  /// The number of samples missed so far.
+  uint64_t num_dropped_samples;
+} hpc_gpu_adreno_sampling_client_t;
+
+/// The number of attempts at reading a consistent layout before giving up.
+#define MAX_LAYOUT_READ_ATTEMPTS 4096
+
+/// Fails a layout read that kept finding the layout changing: with EPIPE if
+/// the daemon died in the middle of a change, or EAGAIN otherwise.
+static int client_fail_layout_read(
+    const hpc_gpu_adreno_sampling_client_t *client) {
+  struct pollfd poll_fd = {client->socket_fd, 0, 0};
+  int hung_up = poll(&poll_fd, 1, /*timeout=*/0) > 0 &&
+                (poll_fd.revents & (POLLHUP | POLLERR));
+  errno = hung_up ? EPIPE : EAGAIN;
+  return -1;
+}
+
+/// Points `columns` to where each registered counter lives in slot values of
+/// the given generation. Leaves `generation` untouched if the layout has
+/// already moved past that generation or misses a registered counter.
+static int client_update_columns(hpc_gpu_adreno_sampling_client_t *client,
+                                 uint32_t generation) {
+  const hpc_gpu_adreno_sampling_buffer_header_t *buffer = client->buffer;
+  uint32_t layout_generation = 0;
+  uint32_t num_counters = 0;
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+
+  // The daemon rarely changes the layout and only holds the lock for a few
+  // stores, so retry while it does, but do not wait for a dead daemon.
+  uint32_t sequence = 0;
+  for (uint32_t attempt = 0;; ++attempt) {
+    if (attempt == MAX_LAYOUT_READ_ATTEMPTS) {
+      return client_fail_layout_read(client);
+    }
+    if (attempt != 0) sched_yield();
+    sequence =
+        atomic_load_explicit(&buffer->layout_sequence, memory_order_acquire);
+    if (sequence & 1u) continue;
+    layout_generation =
+        atomic_load_explicit(&buffer->generation, memory_order_relaxed);
+    num_counters =
+        atomic_load_explicit(&buffer->num_counters, memory_order_relaxed);
+    if (num_counters > HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS) {
+      num_counters = HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS;
+    }
+    for (uint32_t i = 0; i < num_counters; ++i) {
+      counters[i] =
+          atomic_load_explicit(&buffer->counters[i], memory_order_relaxed);
+    }
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&buffer->layout_sequence,
+                             memory_order_relaxed) == sequence) {
+      break;
+    }
+  }
+
+  if (layout_generation != generation) return 0;
+  uint32_t columns[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+  for (uint32_t i = 0; i < client->num_counters; ++i) {
+    uint32_t column = 0;
+    while (column < num_counters && counters[column] != client->counters[i]) {
+      ++column;
+    }
+    if (column == num_counters) return 0;
+    columns[i] = column;
+  }
+  memcpy(client->columns, columns, client->num_counters * sizeof(uint32_t));
+  client->generation = generation;
+  return 0;
+}
+
+/// Receives the registration response and the shared sample buffer file
+/// descriptor passed along with it.
+static int receive_response(int socket_fd,
+                            hpc_gpu_adreno_sampling_response_t *response,
+                            int *buffer_fd) {
+  union {
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+  struct iovec iov = {response, sizeof(*response)};
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = &iov;
+  message.msg_iovlen = 1;
+  message.msg_control = control.buffer;
+  message.msg_controllen = sizeof(control.buffer);
+
+  ssize_t size = 0;
+  do {
+    size = recvmsg(socket_fd, &message, MSG_CMSG_CLOEXEC);
+  } while (size < 0 && errno == EINTR);
+  if (size < 0) return -1;
+  if (size != sizeof(*response)) {
+    errno = EPROTO;
+    return -1;
+  }
+
+  *buffer_fd = -1;
+  struct cmsghdr *header = CMSG_FIRSTHDR(&message);
+  if (header != NULL && header->cmsg_level == SOL_SOCKET &&
+      header->cmsg_type == SCM_RIGHTS) {
+    memcpy(buffer_fd, CMSG_DATA(header), sizeof(int));
+  }
+  return 0;
+}
+
+/// Maps the shared sample buffer read-only and validates its header.
+static int map_buffer(int buffer_fd,
+                      const hpc_gpu_adreno_sampling_buffer_header_t **buffer,
+                      size_t *buffer_size, uint32_t *num_slots) {
+  struct stat buffer_stat;
+  if (fstat(buffer_fd, &buffer_stat) < 0) return -1;
+  size_t size = (size_t)buffer_stat.st_size;
+  if (size < sizeof(hpc_gpu_adreno_sampling_buffer_header_t)) {
+    errno = EPROTO;
+    return -1;
+  }
+
+  void *mapping = mmap(NULL, size, PROT_READ, MAP_SHARED, buffer_fd, 0);
+  if (mapping == MAP_FAILED) return -1;
+
+  const hpc_gpu_adreno_sampling_buffer_header_t *header = mapping;
+  uint32_t header_num_slots = header->num_slots;
+  if (header->magic != HPC_GPU_ADRENO_SAMPLING_BUFFER_MAGIC ||
+      header->version != HPC_GPU_ADRENO_SAMPLING_BUFFER_VERSION ||
+      (size - sizeof(*header)) / sizeof(hpc_gpu_adreno_sampling_slot_t) <
+          header_num_slots ||
+      header_num_slots == 0) {
+    munmap(mapping, size);
+    errno = EPROTO;
+    return -1;
+  }
+
+  *buffer = header;
+  *buffer_size = size;
+  *num_slots = header_num_slots;
+  return 0;
+}
+
+int hpc_gpu_adreno_connect_sampling_daemon(
+    const char *socket_name, uint32_t num_counters,
+    const hpc_gpu_adreno_a6xx_counter_t *counters,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_sampling_client_t **out_client) {
+  if (socket_name == NULL) socket_name = HPC_GPU_ADRENO_SAMPLING_DEFAULT_SOCKET;
+  size_t name_length = strlen(socket_name);
+  struct sockaddr_un address;
+  if (num_counters > HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS ||
+      name_length >= sizeof(address.sun_path)) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  // Abstract socket names start with a NUL byte and need no file system.
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path + 1, socket_name, name_length);
+  socklen_t address_size =
+      (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + name_length);
+
+  int socket_fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+  if (socket_fd < 0) return socket_fd;
+  if (connect(socket_fd, (struct sockaddr *)&address, address_size) < 0) {
+    close(socket_fd);
+    return -1;
+  }
+
+  hpc_gpu_adreno_sampling_request_t request;
+  request.num_counters = num_counters;
+  for (uint32_t i = 0; i < num_counters; ++i) request.counters[i] = counters[i];
+  size_t request_size = offsetof(hpc_gpu_adreno_sampling_request_t, counters) +
+                        num_counters * sizeof(uint32_t);
+  if (send(socket_fd, &request, request_size, MSG_NOSIGNAL) < 0) {
+    close(socket_fd);
+    return -1;
+  }
+
+  hpc_gpu_adreno_sampling_response_t response;
+  int buffer_fd = -1;
+  int status = receive_response(socket_fd, &response, &buffer_fd);
+  if (status == 0 && response.status != 0) status = response.status;
+  if (status == 0 && buffer_fd < 0) {
+    errno = EPROTO;
+    status = -1;
+  }
+  if (status != 0) {
+    if (buffer_fd >= 0) close(buffer_fd);
+    close(socket_fd);
+    return status;
+  }
+
+  const hpc_gpu_adreno_sampling_buffer_header_t *buffer = NULL;
+  size_t buffer_size = 0;
+  uint32_t num_slots = 0;
+  status = map_buffer(buffer_fd, &buffer, &buffer_size, &num_slots);
+  close(buffer_fd);
+  if (status < 0) {
+    close(socket_fd);
+    return status;
+  }
+
+  hpc_gpu_adreno_sampling_client_t *client = allocator->alloc(
+      allocator->user_data, sizeof(hpc_gpu_adreno_sampling_client_t));
+  memset(client, 0, sizeof(hpc_gpu_adreno_sampling_client_t));
+  client->socket_fd = socket_fd;
+  client->buffer = buffer;
+  client->buffer_size = buffer_size;
+  client->num_slots = num_slots;
+  client->num_counters = num_counters;
+  memcpy(client->counters, request.counters, num_counters * sizeof(uint32_t));
+  // Samples published from now on carry the response's generation or later.
+  client->next_index =
+      atomic_load_explicit(&buffer->num_published, memory_order_acquire);
+
+  // Another client may have changed the layout already; columns are then
+  // computed once the first sample of the response's generation shows up.
+  client_update_columns(client, response.generation);
+
+  *out_client = client;
+  return 0;
+}
+
+int hpc_gpu_adreno_disconnect_sampling_daemon(
+    hpc_gpu_adreno_sampling_client_t *client,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  munmap((void *)client->buffer, client->buffer_size);
+  int status = close(client->socket_fd);
+  allocator->free(allocator->user_data, client);
+  return status;
+}
+
+int hpc_gpu_adreno_sampling_client_read(
+    hpc_gpu_adreno_sampling_client_t *client, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples) {
+  const hpc_gpu_adreno_sampling_buffer_header_t *buffer = client->buffer;
+  const uint32_t num_counters = client->num_counters;
+  const uint32_t num_slots = client->num_slots;
+  uint64_t num_published =
+      atomic_load_explicit(&buffer->num_published, memory_order_acquire);
+
+  // Skip samples already overwritten.
+  if (num_published - client->next_index > num_slots) {
+    uint64_t oldest_index = num_published - num_slots;
+    client->num_dropped_samples += oldest_index - client->next_index;
+    client->next_index = oldest_index;
+  }
+
+  uint32_t count = 0;
+  for (; client->next_index < num_published && count < max_num_samples;
+       ++client->next_index) {
+    const hpc_gpu_adreno_sampling_slot_t *slot =
+        hpc_gpu_adreno_get_sampling_slot(buffer, num_slots, client->next_index);
+    uint64_t sequence =
+        atomic_load_explicit(&slot->sequence, memory_order_acquire);
+    if (sequence != client->next_index + 1) {
+      ++client->num_dropped_samples;
+      continue;
+    }
+
+    uint32_t generation =
+        atomic_load_explicit(&slot->generation, memory_order_relaxed);
+    if (generation != client->generation) {
+      int status = client_update_columns(client, generation);
+      if (status < 0) {
+        *num_samples = count;
+        return status;
+      }
+      if (generation != client->generation) {
+        ++client->num_dropped_samples;
+        continue;
+      }
+    }
+
+    uint64_t *row = values + (size_t)count * num_counters;
+    timestamps[count] =
+        atomic_load_explicit(&slot->timestamp, memory_order_relaxed);
+    for (uint32_t i = 0; i < num_counters; ++i) {
+      row[i] = atomic_load_explicit(&slot->values[client->columns[i]],
+                                    memory_order_relaxed);
+    }
+
+    // The daemon may have started overwriting the slot while copying.
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&slot->sequence, memory_order_relaxed) !=
+        sequence) {
+      ++client->num_dropped_samples;
+      continue;
+    }
+    ++count;
+  }
+
+  *num_samples = count;
+  return 0;
+}
+
+uint64_t hpc_gpu_adreno_sampling_client_get_period_ns(
+    const hpc_gpu_adreno_sampling_client_t *client) {
+  return client->buffer->period_ns;
+}
+
+uint64_t hpc_gpu_adreno_sampling_client_get_num_dropped_samples(
+    const hpc_gpu_adreno_sampling_client_t *client) {
+  return client->num_dropped_samples;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_ADRENO_SAMPLING_PROTOCOL_H_
+#define HPC_GPU_ADRENO_SAMPLING_PROTOCOL_H_
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "hpc/gpu/adreno/sampling_client.h"
+
+// The protocol between the Adreno sampling daemon and its clients.
+//
+// Clients connect to the daemon over a SOCK_SEQPACKET Unix domain socket and
+// send one registration request listing their counters. The daemon replies
+// with a registration response and, on success, passes the file descriptor of
+// the shared sample buffer as SCM_RIGHTS ancillary data. The connection stays
+// open for as long as the client is interested in the counters.
+//
+// The shared sample buffer starts with a buffer header followed by
+// `num_slots` slots. The daemon is its only writer; clients can only map it
+// read-only. The daemon keeps its own copy of everything it indexes the
+// buffer with and never reads it back.
+//
+// Slots and the counter layout are sequence locks. As with the sample board,
+// every word they guard is atomic, so a reader racing with the daemon reads
+// stale or fresh words, never torn ones, and then detects the race from the
+// sequence number.
+
+#define HPC_GPU_ADRENO_SAMPLING_BUFFER_MAGIC 0x53435048u  // "HPCS"
+#define HPC_GPU_ADRENO_SAMPLING_BUFFER_VERSION 1
+
+/// A registration request sent by a client.
+typedef struct hpc_gpu_adreno_sampling_request_t {
+  /// The number of counters.
+  uint32_t num_counters;
+  /// The A6XX counters to sample; only `num_counters` are sent.
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+} hpc_gpu_adreno_sampling_request_t;
+
+/// A registration response sent by the daemon.
+typedef struct hpc_gpu_adreno_sampling_response_t {
+  /// Zero on success, or the negative error code.
+  int32_t status;
+  /// The first layout generation containing the requested counters.
+  uint32_t generation;
+} hpc_gpu_adreno_sampling_response_t;
+
+/// One sample in the shared ring.
+///
+/// Each slot is a sequence lock: `sequence` is zero while the daemon writes
+/// the slot and `index + 1` once sample `index` is complete. Readers check
+/// that it holds the expected value both before and after copying values.
+typedef struct hpc_gpu_adreno_sampling_slot_t {
+  _Atomic uint64_t sequence;
+  /// The `CLOCK_MONOTONIC` timestamp in nanoseconds.
+  _Atomic uint64_t timestamp;
+  /// The layout generation describing `values`.
+  _Atomic uint32_t generation;
+  uint32_t reserved;
+  /// The values of the counters of the layout, in layout order.
+  _Atomic uint64_t values[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+} hpc_gpu_adreno_sampling_slot_t;
+
+/// The header of the shared sample buffer.
+typedef struct hpc_gpu_adreno_sampling_buffer_header_t {
+  uint32_t magic;
+  uint32_t version;
+  /// The number of slots following the header.
+  uint32_t num_slots;
+  uint32_t reserved;
+  /// The sampling period in nanoseconds.
+  uint64_t period_ns;
+  /// The number of samples published so far. Sample `i` lives in slot
+  /// `i % num_slots`.
+  _Atomic uint64_t num_published;
+
+  /// The sequence lock guarding the layout below; odd while it changes.
+  _Atomic uint32_t layout_sequence;
+  /// The layout generation, bumped whenever the counter set changes.
+  _Atomic uint32_t generation;
+  /// The number of sampled counters.
+  _Atomic uint32_t num_counters;
+  /// The sampled counters, in the order of slot values.
+  _Atomic uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+} hpc_gpu_adreno_sampling_buffer_header_t;
+
+/// Returns the slot holding sample `index` of the shared sample buffer.
+///
+/// `num_slots` must come from the caller's own validated copy rather than the
+/// shared header.
+static inline hpc_gpu_adreno_sampling_slot_t *
+hpc_gpu_adreno_get_sampling_slot(
+    const hpc_gpu_adreno_sampling_buffer_header_t *header, uint32_t num_slots,
+    uint64_t index) {
+  return (hpc_gpu_adreno_sampling_slot_t *)(header + 1) + index % num_slots;
+}
+
+#endif  // HPC_GPU_ADRENO_SAMPLING_PROTOCOL_H_
@@ -0,0 +1,322 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/adreno/simulated_driver.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "driver_ioctl.h"
+#include "group_capacities.h"
+#include "hpc/gpu/base_utilities.h"
+
+/// The first file descriptor handed out for simulated devices. It is chosen
+/// to be unlikely to collide with real file descriptors in logs.
+#define SIMULATED_FIRST_DEVICE_FD (1 << 20)
+
+/// The maximal number of simultaneously open simulated devices.
+#define SIMULATED_MAX_OPEN_DEVICES 64
+
+typedef struct simulated_slot_t {
+  /// The countable held by this slot.
+  uint32_t countable_selector;
+  /// The number of outstanding activations. Zero means the slot is free.
+  uint32_t refcount;
+} simulated_slot_t;
+
+struct hpc_gpu_adreno_simulated_driver_t {
+  /// The backend table routing driver calls here.
+  hpc_gpu_adreno_ioctl_backend_t backend;
+
+  uint32_t gpu_id;
+  uint32_t num_groups;
+  /// The index of each group's first slot in `slots`, plus one trailing entry
+  /// for the total number of slots.
+  uint32_t *group_slot_starts;
+  simulated_slot_t *slots;
+
+  uint64_t ioctl_latency_ns;
+  /// The time counters started counting from.
+  uint64_t start_time_ns;
+  /// The file descriptor handed out by the next open. Like the kernel's, file
+  /// descriptors are not reused while open, and this never hands out a
+  /// closed one again either.
+  int next_device_fd;
+  /// The file descriptors of open devices. Zero means the entry is free.
+  int open_devices[SIMULATED_MAX_OPEN_DEVICES];
+
+  _Atomic uint64_t num_ioctls;
+  /// Guards slots and open devices.
+  pthread_mutex_t mutex;
+};
+
+static uint64_t get_monotonic_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+/// Accounts for one driver call and spends its latency. Busy-waiting keeps
+/// the latency accurate at microsecond scale, unlike sleeping.
+static void simulated_enter_ioctl(hpc_gpu_adreno_simulated_driver_t *driver) {
+  atomic_fetch_add_explicit(&driver->num_ioctls, 1, memory_order_relaxed);
+  if (driver->ioctl_latency_ns == 0) return;
+  uint64_t end_time_ns = get_monotonic_time_ns() + driver->ioctl_latency_ns;
+  while (get_monotonic_time_ns() < end_time_ns) {
+  }
+}
+
+/// Returns the slot holding the given countable, or NULL if it is inactive.
+static simulated_slot_t *simulated_find_slot(
+    hpc_gpu_adreno_simulated_driver_t *driver, uint32_t group_id,
+    uint32_t countable_selector) {
+  uint32_t begin = driver->group_slot_starts[group_id];
+  uint32_t end = driver->group_slot_starts[group_id + 1];
+  for (uint32_t i = begin; i < end; ++i) {
+    simulated_slot_t *slot = &driver->slots[i];
+    if (slot->refcount && slot->countable_selector == countable_selector) {
+      return slot;
+    }
+  }
+  return NULL;
+}
+
+/// Returns the value of an active countable. Each countable increases at its
+/// own fixed rate between 1/16 and 2 events per nanosecond.
+static uint64_t simulated_get_counter_value(
+    const hpc_gpu_adreno_simulated_driver_t *driver, uint32_t group_id,
+    uint32_t countable_selector, uint64_t time_ns) {
+  uint64_t rate = 1 + (group_id * 7u + countable_selector * 13u) % 32u;
+  return (time_ns - driver->start_time_ns) * rate / 16u;
+}
+
+static int simulated_open_gpu_device(void *user_data) {
+  hpc_gpu_adreno_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  int gpu_device = -1;
+  pthread_mutex_lock(&driver->mutex);
+  for (uint32_t i = 0; i < SIMULATED_MAX_OPEN_DEVICES; ++i) {
+    if (driver->open_devices[i] != 0) continue;
+    gpu_device = driver->next_device_fd++;
+    driver->open_devices[i] = gpu_device;
+    break;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  if (gpu_device < 0) errno = EMFILE;
+  return gpu_device;
+}
+
+static int simulated_close_gpu_device(void *user_data, int gpu_device) {
+  hpc_gpu_adreno_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  int status = -1;
+  pthread_mutex_lock(&driver->mutex);
+  for (uint32_t i = 0; i < SIMULATED_MAX_OPEN_DEVICES; ++i) {
+    // Free entries hold zero, which is never a simulated device.
+    if (gpu_device == 0 || driver->open_devices[i] != gpu_device) continue;
+    driver->open_devices[i] = 0;
+    status = 0;
+    break;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  if (status < 0) errno = EBADF;
+  return status;
+}
+
+static uint32_t simulated_get_gpu_device_id(void *user_data, int gpu_device) {
+  hpc_gpu_adreno_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+  return driver->gpu_id;
+}
+
+static int simulated_activate_counter(void *user_data, int gpu_device,
+                                      uint32_t group_id,
+                                      uint32_t countable_selector) {
+  hpc_gpu_adreno_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+  if (group_id >= driver->num_groups) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  int status = 0;
+  pthread_mutex_lock(&driver->mutex);
+  simulated_slot_t *slot =
+      simulated_find_slot(driver, group_id, countable_selector);
+  if (!slot) {
+    // Take the first free slot in the group.
+    uint32_t begin = driver->group_slot_starts[group_id];
+    uint32_t end = driver->group_slot_starts[group_id + 1];
+    for (uint32_t i = begin; i < end && !slot; ++i) {
+      if (driver->slots[i].refcount == 0) slot = &driver->slots[i];
+    }
+    if (slot) slot->countable_selector = countable_selector;
+  }
+  if (slot) {
+    ++slot->refcount;
+  } else {
+    errno = EBUSY;
+    status = -1;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  return status;
+}
+
+static int simulated_deactivate_counter(void *user_data, int gpu_device,
+                                        uint32_t group_id,
+                                        uint32_t countable_selector) {
+  hpc_gpu_adreno_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+  if (group_id >= driver->num_groups) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  int status = 0;
+  pthread_mutex_lock(&driver->mutex);
+  simulated_slot_t *slot =
+      simulated_find_slot(driver, group_id, countable_selector);
+  if (slot) {
+    --slot->refcount;
+  } else {
+    errno = EINVAL;
+    status = -1;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  return status;
+}
+
+static int simulated_query_counters(
+    void *user_data, int gpu_device, uint32_t num_counters,
+    hpc_gpu_adreno_ioctl_counter_read_counter_t *counters) {
+  hpc_gpu_adreno_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+  uint64_t time_ns = get_monotonic_time_ns();
+
+  int status = 0;
+  pthread_mutex_lock(&driver->mutex);
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint32_t group_id = counters[i].group_id;
+    uint32_t countable_selector = counters[i].countable_selector;
+    if (group_id >= driver->num_groups) {
+      errno = EINVAL;
+      status = -1;
+      break;
+    }
+    counters[i].value =
+        simulated_find_slot(driver, group_id, countable_selector)
+            ? simulated_get_counter_value(driver, group_id, countable_selector,
+                                          time_ns)
+            : 0;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  return status;
+}
+
+int hpc_gpu_adreno_create_simulated_driver(
+    const hpc_gpu_adreno_simulated_driver_create_info_t *create_info,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_adreno_simulated_driver_t **out_driver) {
+  uint32_t num_groups = create_info->num_groups;
+  const uint32_t *num_group_slots = create_info->num_group_slots;
+  if (num_groups == 0) {
+    num_groups = HPC_GPU_ADRENO_A6XX_NUM_GROUPS;
+    num_group_slots = hpc_gpu_adreno_a6xx_group_capacities;
+  }
+
+  uint32_t num_slots = 0;
+  for (uint32_t i = 0; i < num_groups; ++i) num_slots += num_group_slots[i];
+
+  // Lay out the driver, slot starts, and slots in one allocation.
+  size_t size = sizeof(hpc_gpu_adreno_simulated_driver_t) +
+                (num_groups + 1) * sizeof(uint32_t) +
+                num_slots * sizeof(simulated_slot_t);
+  hpc_gpu_adreno_simulated_driver_t *driver =
+      allocator->alloc(allocator->user_data, size);
+  memset(driver, 0, size);
+
+  driver->group_slot_starts = (uint32_t *)(driver + 1);
+  driver->slots =
+      (simulated_slot_t *)(driver->group_slot_starts + num_groups + 1);
+  driver->group_slot_starts[0] = 0;
+  for (uint32_t i = 0; i < num_groups; ++i) {
+    driver->group_slot_starts[i + 1] =
+        driver->group_slot_starts[i] + num_group_slots[i];
+  }
+
+  driver->backend.user_data = driver;
+  driver->backend.open_gpu_device = simulated_open_gpu_device;
+  driver->backend.close_gpu_device = simulated_close_gpu_device;
+  driver->backend.get_gpu_device_id = simulated_get_gpu_device_id;
+  driver->backend.activate_counter = simulated_activate_counter;
+  driver->backend.deactivate_counter = simulated_deactivate_counter;
+  driver->backend.query_counters = simulated_query_counters;
+
+  driver->gpu_id = create_info->gpu_id;
+  driver->num_groups = num_groups;
+  driver->ioctl_latency_ns = create_info->ioctl_latency_ns;
+  driver->start_time_ns = get_monotonic_time_ns();
+  driver->next_device_fd = SIMULATED_FIRST_DEVICE_FD;
+  atomic_init(&driver->num_ioctls, 0);
+
+  int status = pthread_mutex_init(&driver->mutex, NULL);
+  if (status != 0) {
+    allocator->free(allocator->user_data, driver);
+    return -status;
+  }
+
+  *out_driver = driver;
+  return 0;
+}
+
+int hpc_gpu_adreno_destroy_simulated_driver(
+    hpc_gpu_adreno_simulated_driver_t *driver,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  pthread_mutex_destroy(&driver->mutex);
+  allocator->free(allocator->user_data, driver);
+  return 0;
+}
+
+void hpc_gpu_adreno_use_simulated_driver(
+    hpc_gpu_adreno_simulated_driver_t *driver) {
+  hpc_gpu_adreno_ioctl_set_backend(driver ? &driver->backend : NULL);
+}
+
+uint64_t hpc_gpu_adreno_simulated_driver_get_num_ioctls(
+    const hpc_gpu_adreno_simulated_driver_t *driver) {
+  return atomic_load_explicit(&driver->num_ioctls, memory_order_relaxed);
+}
+
+uint32_t hpc_gpu_adreno_simulated_driver_get_num_active_slots(
+    hpc_gpu_adreno_simulated_driver_t *driver, uint32_t group_id) {
+  if (group_id >= driver->num_groups) return 0;
+
+  uint32_t num_active_slots = 0;
+  pthread_mutex_lock(&driver->mutex);
+  uint32_t begin = driver->group_slot_starts[group_id];
+  uint32_t end = driver->group_slot_starts[group_id + 1];
+  for (uint32_t i = begin; i < end; ++i) {
+    num_active_slots += driver->slots[i].refcount != 0;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  return num_active_slots;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/counter_info.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// The hash functions below must match the ones used by the generators under
+// scripts/ to build the perfect hash tables.
+
+/// Hashes the name with 32-bit FNV-1a.
+static uint32_t counter_info_hash_name(const char *name, size_t name_length) {
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < name_length; ++i) {
+    hash ^= (uint8_t)name[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/// Scrambles all bits of the hash with the MurmurHash3 finalizer.
+static uint32_t counter_info_mix(uint32_t hash) {
+  hash ^= hash >> 16u;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13u;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16u;
+  return hash;
+}
+
+const hpc_gpu_counter_info_t *hpc_gpu_find_counter_info(
+    const hpc_gpu_counter_registry_t *registry, const char *name,
+    size_t name_length) {
+  if (registry->num_counters == 0) return NULL;
+
+  uint32_t hash = counter_info_hash_name(name, name_length);
+  uint32_t bucket = counter_info_mix(hash) % registry->num_buckets;
+  uint32_t displacement = registry->displacements[bucket] + 1u;
+  uint32_t slot = counter_info_mix(hash ^ (displacement * 0x9e3779b9u)) %
+                  registry->num_counters;
+
+  // The perfect hash maps every name in the registry to a distinct slot, but
+  // unknown names land on arbitrary ones.
+  const hpc_gpu_counter_info_t *info =
+      &registry->counters[registry->slots[slot]];
+  if (strncmp(info->name, name, name_length) != 0 ||
+      info->name[name_length] != '\0') {
+    return NULL;
+  }
+  return info;
+}
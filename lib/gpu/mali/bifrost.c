@@ -16,10 +16,11 @@
 
 #include "hpc/gpu/mali/bifrost.h"
 
-#include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "context.h"
+#include "counter_conversion.h"
 
 static uint32_t hpc_gpu_mali_bifrost_counter_convert(
     uint32_t counter, hpc_gpu_mali_counter_layout_t layout);
@@ -39,6 +40,24 @@ int hpc_gpu_mali_bifrost_destroy_context(
   return hpc_gpu_mali_destroy_context(context, allocator);
 }
 
+void hpc_gpu_mali_bifrost_get_context_memory_requirements(
+    uint32_t num_counters, size_t *size, size_t *alignment) {
+  hpc_gpu_mali_get_context_memory_requirements(num_counters, size, alignment);
+}
+
+int hpc_gpu_mali_bifrost_create_context_in_memory(
+    uint32_t num_counters, hpc_gpu_mali_bifrost_counter_t *counters,
+    void *memory, hpc_gpu_mali_context_t **out_context) {
+  return hpc_gpu_mali_create_context_in_memory(
+      num_counters, counters, hpc_gpu_mali_bifrost_counter_convert, memory,
+      out_context);
+}
+
+int hpc_gpu_mali_bifrost_destroy_context_in_memory(
+    hpc_gpu_mali_context_t *context) {
+  return hpc_gpu_mali_destroy_context_in_memory(context);
+}
+
 int hpc_gpu_mali_bifrost_start_counters(const hpc_gpu_mali_context_t *context) {
   return hpc_gpu_mali_context_start_counters(context);
 }
@@ -52,51 +71,77 @@ int hpc_gpu_mali_bifrost_query_counters(const hpc_gpu_mali_context_t *context,
   return hpc_gpu_mali_context_query_counters(context, values);
 }
 
-//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
-
-static inline uint32_t hpc_gpu_mali_bifrost_counter_convert_to_tmix(
-    uint32_t counter) {
-  return counter & ((1u << 8u) - 1u);
+int hpc_gpu_mali_bifrost_query_counters_with_times(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  return hpc_gpu_mali_context_query_counters_with_times(context, values,
+                                                        times);
 }
 
-static inline uint32_t hpc_gpu_mali_bifrost_counter_convert_to_thex(
-    uint32_t counter) {
-  return counter & ((1u << 8u) - 1u);
+int hpc_gpu_mali_bifrost_start_periodic_counters(
+    const hpc_gpu_mali_context_t *context, uint32_t interval_ns) {
+  return hpc_gpu_mali_context_start_periodic_counters(context, interval_ns);
 }
 
-static inline uint32_t hpc_gpu_mali_bifrost_counter_convert_to_tdvx(
-    uint32_t counter) {
-  return counter & ((1u << 8u) - 1u);
+int hpc_gpu_mali_bifrost_query_counter_batch(
+    const hpc_gpu_mali_context_t *context, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples) {
+  return hpc_gpu_mali_context_query_counter_batch(
+      context, max_num_samples, timestamps, values, num_samples);
 }
 
-static inline uint32_t hpc_gpu_mali_bifrost_counter_convert_to_tsix(
-    uint32_t counter) {
-  return counter & ((1u << 8u) - 1u);
+void hpc_gpu_mali_bifrost_get_breakdown_dimensions(
+    const hpc_gpu_mali_context_t *context, uint32_t *num_shader_core_counters,
+    uint32_t *num_shader_cores, uint32_t *num_l2_slice_counters,
+    uint32_t *num_l2_slices) {
+  hpc_gpu_mali_context_get_breakdown_dimensions(
+      context, num_shader_core_counters, num_shader_cores,
+      num_l2_slice_counters, num_l2_slices);
 }
 
-static inline uint32_t hpc_gpu_mali_bifrost_counter_convert_to_tgox(
-    uint32_t counter) {
-  return counter & ((1u << 8u) - 1u);
+int hpc_gpu_mali_bifrost_query_counter_breakdown(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    uint64_t *shader_core_values, uint64_t *l2_slice_values) {
+  return hpc_gpu_mali_context_query_counter_breakdown(
+      context, values, shader_core_values, l2_slice_values);
 }
 
-static inline uint32_t hpc_gpu_mali_bifrost_counter_convert_to_tnox(
-    uint32_t counter) {
-  return counter & ((1u << 8u) - 1u);
+uint32_t hpc_gpu_mali_bifrost_convert_counter(
+    uint32_t counter, hpc_gpu_mali_counter_layout_t layout) {
+  return hpc_gpu_mali_bifrost_counter_convert(counter, layout);
 }
 
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The layouts sharing the same indices for Bifrost counters, as a bit mask
+/// indexed by layout.
+#define HPC_GPU_MALI_BIFROST_LAYOUT_MASK \
+  ((1u << HPC_GPU_MALI_COUNTER_LAYOUT_TMIX) | \
+   (1u << HPC_GPU_MALI_COUNTER_LAYOUT_THEX) | \
+   (1u << HPC_GPU_MALI_COUNTER_LAYOUT_TDVX) | \
+   (1u << HPC_GPU_MALI_COUNTER_LAYOUT_TSIX) | \
+   (1u << HPC_GPU_MALI_COUNTER_LAYOUT_TGOX) | \
+   (1u << HPC_GPU_MALI_COUNTER_LAYOUT_TNOX))
+
+/// Indices of Bifrost counters in counter blocks as bit masks, indexed by
+/// category.
+static const uint64_t hpc_gpu_mali_bifrost_counter_masks[4] = {
+    0x00000000f7f7f7f0ull,
+    0xf8fffffffffa7ff0ull,
+    0x5ffff007ffddfff0ull,
+    0x01ffffffffff0010ull,
+};
+
 static uint32_t hpc_gpu_mali_bifrost_counter_convert(
     uint32_t counter, hpc_gpu_mali_counter_layout_t layout) {
-  // clang-format off
-  switch (layout) {
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TMIX: return hpc_gpu_mali_bifrost_counter_convert_to_tmix(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_THEX: return hpc_gpu_mali_bifrost_counter_convert_to_thex(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TDVX: return hpc_gpu_mali_bifrost_counter_convert_to_tdvx(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TSIX: return hpc_gpu_mali_bifrost_counter_convert_to_tsix(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TGOX: return hpc_gpu_mali_bifrost_counter_convert_to_tgox(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TNOX: return hpc_gpu_mali_bifrost_counter_convert_to_tnox(counter);
-    default: assert(0 && "should not happen!"); return ~0u;
+  uint32_t category = counter >> 8u;
+  uint32_t index = counter & ((1u << 8u) - 1u);
+  if (((HPC_GPU_MALI_BIFROST_LAYOUT_MASK >> layout) & 1u) == 0) return ~0u;
+  if (category >= 4u || index >= 64u) return ~0u;
+  if (((hpc_gpu_mali_bifrost_counter_masks[category] >> index) & 1u) == 0) {
+    return ~0u;
   }
-  // clang-format on
+  return index;
 }
 
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
@@ -0,0 +1,512 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/mali/bifrost.h"
+
+#include <stdint.h>
+
+#include "hpc/gpu/counter_info.h"
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The series that availability bits refer to.
+static const char *const hpc_gpu_mali_bifrost_series_names[14] = {
+    "T82X", "T83X", "T86X", "T88X", "THEX", "TMIX", "TDVX", "TSIX", "TNOX",
+    "TGOX", "TTRX", "TNAX", "TOTX", "TBOX",
+};
+
+/// Metadata of all counters, in enum order.
+static const hpc_gpu_counter_info_t hpc_gpu_mali_bifrost_counter_infos[168] = {
+    // clang-format off
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_MESSAGES_SENT, 0x3fffu,
+     "JOB_MANAGER_MESSAGES_SENT", "JOB_MANAGER", "Job manager: messages sent",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_MESSAGES_RECEIVED, 0x3fffu,
+     "JOB_MANAGER_MESSAGES_RECEIVED", "JOB_MANAGER",
+     "Job manager: messages received", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_GPU_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_GPU_ACTIVE", "JOB_MANAGER", "Job manager: gpu active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_IRQ_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_IRQ_ACTIVE", "JOB_MANAGER", "Job manager: irq active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_JOBS, 0x3fffu, "JOB_MANAGER_JS0_JOBS",
+     "JOB_MANAGER", "Job manager: js0 jobs", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS0_TASKS", "JOB_MANAGER", "Job manager: js0 tasks",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS0_ACTIVE", "JOB_MANAGER", "Job manager: js0 active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_READ", "JOB_MANAGER", "Job manager: js0 wait read",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js0 wait issue",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js0 wait depend", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS0_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js0 wait finish", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_JOBS, 0x3fffu, "JOB_MANAGER_JS1_JOBS",
+     "JOB_MANAGER", "Job manager: js1 jobs", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS1_TASKS", "JOB_MANAGER", "Job manager: js1 tasks",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS1_ACTIVE", "JOB_MANAGER", "Job manager: js1 active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_READ", "JOB_MANAGER", "Job manager: js1 wait read",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js1 wait issue",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js1 wait depend", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS1_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js1 wait finish", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_JOBS, 0x3fffu, "JOB_MANAGER_JS2_JOBS",
+     "JOB_MANAGER", "Job manager: js2 jobs", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS2_TASKS", "JOB_MANAGER", "Job manager: js2 tasks",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS2_ACTIVE", "JOB_MANAGER", "Job manager: js2 active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_READ", "JOB_MANAGER", "Job manager: js2 wait read",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js2 wait issue",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js2 wait depend", "events"},
+    {HPC_GPU_MALI_BIFROST_JOB_MANAGER_JS2_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js2 wait finish", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_TILER_ACTIVE, 0x3ff0u, "TILER_TILER_ACTIVE",
+     "TILER", "Tiler: tiler active", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_JOBS_PROCESSED, 0x3fffu, "TILER_JOBS_PROCESSED",
+     "TILER", "Tiler: jobs processed", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_TRIANGLES, 0x3fffu, "TILER_TRIANGLES", "TILER",
+     "Tiler: triangles", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_LINES, 0x3fffu, "TILER_LINES", "TILER",
+     "Tiler: lines", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_POINTS, 0x3fffu, "TILER_POINTS", "TILER",
+     "Tiler: points", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_FRONT_FACING, 0x3fffu, "TILER_FRONT_FACING",
+     "TILER", "Tiler: front facing", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_BACK_FACING, 0x3fffu, "TILER_BACK_FACING",
+     "TILER", "Tiler: back facing", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PRIM_VISIBLE, 0x3fffu, "TILER_PRIM_VISIBLE",
+     "TILER", "Tiler: prim visible", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PRIM_CULLED, 0x3fffu, "TILER_PRIM_CULLED",
+     "TILER", "Tiler: prim culled", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PRIM_CLIPPED, 0x3fffu, "TILER_PRIM_CLIPPED",
+     "TILER", "Tiler: prim clipped", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PRIM_SAT_CULLED, 0x3ff0u,
+     "TILER_PRIM_SAT_CULLED", "TILER", "Tiler: prim sat culled", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_BUS_READ, 0x3ffcu, "TILER_BUS_READ", "TILER",
+     "Tiler: bus read", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_BUS_WRITE, 0x3fcu, "TILER_BUS_WRITE", "TILER",
+     "Tiler: bus write", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_LOADING_DESC, 0x3ffcu, "TILER_LOADING_DESC",
+     "TILER", "Tiler: loading desc", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_POS_SHAD_REQ, 0x3ff0u,
+     "TILER_IDVS_POS_SHAD_REQ", "TILER", "Tiler: idvs pos shad req", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_POS_SHAD_WAIT, 0x3ff0u,
+     "TILER_IDVS_POS_SHAD_WAIT", "TILER", "Tiler: idvs pos shad wait",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_POS_SHAD_STALL, 0x3ff0u,
+     "TILER_IDVS_POS_SHAD_STALL", "TILER", "Tiler: idvs pos shad stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_POS_FIFO_FULL, 0x3ff0u,
+     "TILER_IDVS_POS_FIFO_FULL", "TILER", "Tiler: idvs pos fifo full",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PREFETCH_STALL, 0x3ff0u, "TILER_PREFETCH_STALL",
+     "TILER", "Tiler: prefetch stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_VCACHE_HIT, 0x3ffcu, "TILER_VCACHE_HIT",
+     "TILER", "Tiler: vcache hit", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_VCACHE_MISS, 0x3ffcu, "TILER_VCACHE_MISS",
+     "TILER", "Tiler: vcache miss", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_VCACHE_LINE_WAIT, 0x3ff0u,
+     "TILER_VCACHE_LINE_WAIT", "TILER", "Tiler: vcache line wait", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_VFETCH_POS_READ_WAIT, 0x3ff0u,
+     "TILER_VFETCH_POS_READ_WAIT", "TILER", "Tiler: vfetch pos read wait",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_VFETCH_VERTEX_WAIT, 0x3ff0u,
+     "TILER_VFETCH_VERTEX_WAIT", "TILER", "Tiler: vfetch vertex wait",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_VFETCH_STALL, 0x3ff0u, "TILER_VFETCH_STALL",
+     "TILER", "Tiler: vfetch stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_PRIMASSY_STALL, 0x3ff0u, "TILER_PRIMASSY_STALL",
+     "TILER", "Tiler: primassy stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_BBOX_GEN_STALL, 0x3ff0u, "TILER_BBOX_GEN_STALL",
+     "TILER", "Tiler: bbox gen stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_VBU_HIT, 0x3ff0u, "TILER_IDVS_VBU_HIT",
+     "TILER", "Tiler: idvs vbu hit", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_VBU_MISS, 0x3ff0u, "TILER_IDVS_VBU_MISS",
+     "TILER", "Tiler: idvs vbu miss", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_VBU_LINE_DEALLOCATE, 0x3ff0u,
+     "TILER_IDVS_VBU_LINE_DEALLOCATE", "TILER",
+     "Tiler: idvs vbu line deallocate", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_VAR_SHAD_REQ, 0x3ff0u,
+     "TILER_IDVS_VAR_SHAD_REQ", "TILER", "Tiler: idvs var shad req", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_IDVS_VAR_SHAD_STALL, 0x3ff0u,
+     "TILER_IDVS_VAR_SHAD_STALL", "TILER", "Tiler: idvs var shad stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_BINNER_STALL, 0x3ff0u, "TILER_BINNER_STALL",
+     "TILER", "Tiler: binner stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_ITER_STALL, 0x3ff0u, "TILER_ITER_STALL",
+     "TILER", "Tiler: iter stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_COMPRESS_MISS, 0x3ff0u, "TILER_COMPRESS_MISS",
+     "TILER", "Tiler: compress miss", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_COMPRESS_STALL, 0x3ff0u, "TILER_COMPRESS_STALL",
+     "TILER", "Tiler: compress stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_PCACHE_HIT, 0x3ffcu, "TILER_PCACHE_HIT",
+     "TILER", "Tiler: pcache hit", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PCACHE_MISS, 0x3ffcu, "TILER_PCACHE_MISS",
+     "TILER", "Tiler: pcache miss", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_PCACHE_MISS_STALL, 0x3ff0u,
+     "TILER_PCACHE_MISS_STALL", "TILER", "Tiler: pcache miss stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_PCACHE_EVICT_STALL, 0x3ff0u,
+     "TILER_PCACHE_EVICT_STALL", "TILER", "Tiler: pcache evict stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_PMGR_PTR_WR_STALL, 0x3ff0u,
+     "TILER_PMGR_PTR_WR_STALL", "TILER", "Tiler: pmgr ptr wr stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_PMGR_PTR_RD_STALL, 0x3ff0u,
+     "TILER_PMGR_PTR_RD_STALL", "TILER", "Tiler: pmgr ptr rd stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_PMGR_CMD_WR_STALL, 0x3ff0u,
+     "TILER_PMGR_CMD_WR_STALL", "TILER", "Tiler: pmgr cmd wr stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_WRBUF_ACTIVE, 0x3ff0u, "TILER_WRBUF_ACTIVE",
+     "TILER", "Tiler: wrbuf active", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_WRBUF_HIT, 0x3ffcu, "TILER_WRBUF_HIT", "TILER",
+     "Tiler: wrbuf hit", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_WRBUF_MISS, 0x3ffcu, "TILER_WRBUF_MISS",
+     "TILER", "Tiler: wrbuf miss", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_WRBUF_NO_FREE_LINE_STALL, 0x3ff0u,
+     "TILER_WRBUF_NO_FREE_LINE_STALL", "TILER",
+     "Tiler: wrbuf no free line stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_WRBUF_NO_AXI_ID_STALL, 0x3ff0u,
+     "TILER_WRBUF_NO_AXI_ID_STALL", "TILER", "Tiler: wrbuf no axi id stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_WRBUF_AXI_STALL, 0x3ff0u,
+     "TILER_WRBUF_AXI_STALL", "TILER", "Tiler: wrbuf axi stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_UTLB_TRANS, 0xff0u, "TILER_UTLB_TRANS", "TILER",
+     "Tiler: utlb trans", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_UTLB_TRANS_HIT, 0xff0u, "TILER_UTLB_TRANS_HIT",
+     "TILER", "Tiler: utlb trans hit", "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_UTLB_TRANS_STALL, 0xff0u,
+     "TILER_UTLB_TRANS_STALL", "TILER", "Tiler: utlb trans stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_TILER_UTLB_TRANS_MISS_DELAY, 0xff0u,
+     "TILER_UTLB_TRANS_MISS_DELAY", "TILER", "Tiler: utlb trans miss delay",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_TILER_UTLB_MMU_REQ, 0xff0u, "TILER_UTLB_MMU_REQ",
+     "TILER", "Tiler: utlb mmu req", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_ACTIVE, 0x3fffu,
+     "SHADER_CORE_FRAG_ACTIVE", "SHADER_CORE", "Shader core: frag active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_PRIMITIVES, 0x3ffu,
+     "SHADER_CORE_FRAG_PRIMITIVES", "SHADER_CORE",
+     "Shader core: frag primitives", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_PRIM_RAST, 0x3ff0u,
+     "SHADER_CORE_FRAG_PRIM_RAST", "SHADER_CORE", "Shader core: frag prim rast",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_FPK_ACTIVE, 0x3ff0u,
+     "SHADER_CORE_FRAG_FPK_ACTIVE", "SHADER_CORE",
+     "Shader core: frag fpk active", "cycles"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_STARVING, 0x3ff0u,
+     "SHADER_CORE_FRAG_STARVING", "SHADER_CORE", "Shader core: frag starving",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_WARPS, 0x3ff0u,
+     "SHADER_CORE_FRAG_WARPS", "SHADER_CORE", "Shader core: frag warps",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_PARTIAL_WARPS, 0x3f0u,
+     "SHADER_CORE_FRAG_PARTIAL_WARPS", "SHADER_CORE",
+     "Shader core: frag partial warps", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_QUADS_RAST, 0x3fffu,
+     "SHADER_CORE_FRAG_QUADS_RAST", "SHADER_CORE",
+     "Shader core: frag quads rast", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_QUADS_EZS_TEST, 0x3fffu,
+     "SHADER_CORE_FRAG_QUADS_EZS_TEST", "SHADER_CORE",
+     "Shader core: frag quads ezs test", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_QUADS_EZS_UPDATE, 0x3ff0u,
+     "SHADER_CORE_FRAG_QUADS_EZS_UPDATE", "SHADER_CORE",
+     "Shader core: frag quads ezs update", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_QUADS_EZS_KILL, 0x3ff0u,
+     "SHADER_CORE_FRAG_QUADS_EZS_KILL", "SHADER_CORE",
+     "Shader core: frag quads ezs kill", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_LZS_TEST, 0x3ff0u,
+     "SHADER_CORE_FRAG_LZS_TEST", "SHADER_CORE", "Shader core: frag lzs test",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_LZS_KILL, 0x3ff0u,
+     "SHADER_CORE_FRAG_LZS_KILL", "SHADER_CORE", "Shader core: frag lzs kill",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_PTILES, 0x3ff0u,
+     "SHADER_CORE_FRAG_PTILES", "SHADER_CORE", "Shader core: frag ptiles",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_FRAG_TRANS_ELIM, 0x3fffu,
+     "SHADER_CORE_FRAG_TRANS_ELIM", "SHADER_CORE",
+     "Shader core: frag trans elim", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_QUAD_FPK_KILLER, 0x3ff0u,
+     "SHADER_CORE_QUAD_FPK_KILLER", "SHADER_CORE",
+     "Shader core: quad fpk killer", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_COMPUTE_ACTIVE, 0x3fffu,
+     "SHADER_CORE_COMPUTE_ACTIVE", "SHADER_CORE", "Shader core: compute active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_COMPUTE_TASKS, 0x3fffu,
+     "SHADER_CORE_COMPUTE_TASKS", "SHADER_CORE", "Shader core: compute tasks",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_COMPUTE_WARPS, 0x3ff0u,
+     "SHADER_CORE_COMPUTE_WARPS", "SHADER_CORE", "Shader core: compute warps",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_COMPUTE_STARVING, 0x3ff0u,
+     "SHADER_CORE_COMPUTE_STARVING", "SHADER_CORE",
+     "Shader core: compute starving", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_EXEC_CORE_ACTIVE, 0x3ff0u,
+     "SHADER_CORE_EXEC_CORE_ACTIVE", "SHADER_CORE",
+     "Shader core: exec core active", "cycles"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_EXEC_ACTIVE, 0x3f0u,
+     "SHADER_CORE_EXEC_ACTIVE", "SHADER_CORE", "Shader core: exec active",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_EXEC_INSTR_COUNT, 0x3f0u,
+     "SHADER_CORE_EXEC_INSTR_COUNT", "SHADER_CORE",
+     "Shader core: exec instr count", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_EXEC_INSTR_DIVERGED, 0x3ff0u,
+     "SHADER_CORE_EXEC_INSTR_DIVERGED", "SHADER_CORE",
+     "Shader core: exec instr diverged", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_EXEC_INSTR_STARVING, 0x3f0u,
+     "SHADER_CORE_EXEC_INSTR_STARVING", "SHADER_CORE",
+     "Shader core: exec instr starving", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_ARITH_INSTR_SINGLE_FMA, 0x3f0u,
+     "SHADER_CORE_ARITH_INSTR_SINGLE_FMA", "SHADER_CORE",
+     "Shader core: arith instr single fma", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_ARITH_INSTR_DOUBLE, 0x3f0u,
+     "SHADER_CORE_ARITH_INSTR_DOUBLE", "SHADER_CORE",
+     "Shader core: arith instr double", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_ARITH_INSTR_MSG, 0x3f0u,
+     "SHADER_CORE_ARITH_INSTR_MSG", "SHADER_CORE",
+     "Shader core: arith instr msg", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_ARITH_INSTR_MSG_ONLY, 0x3f0u,
+     "SHADER_CORE_ARITH_INSTR_MSG_ONLY", "SHADER_CORE",
+     "Shader core: arith instr msg only", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_LS_MEM_READ_FULL, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_READ_FULL", "SHADER_CORE",
+     "Shader core: ls mem read full", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_LS_MEM_READ_SHORT, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_READ_SHORT", "SHADER_CORE",
+     "Shader core: ls mem read short", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_LS_MEM_WRITE_FULL, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_WRITE_FULL", "SHADER_CORE",
+     "Shader core: ls mem write full", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_LS_MEM_WRITE_SHORT, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_WRITE_SHORT", "SHADER_CORE",
+     "Shader core: ls mem write short", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_LS_MEM_ATOMIC, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_ATOMIC", "SHADER_CORE", "Shader core: ls mem atomic",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_VARY_INSTR, 0x3ff0u,
+     "SHADER_CORE_VARY_INSTR", "SHADER_CORE", "Shader core: vary instr",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_VARY_SLOT_32, 0x3ff0u,
+     "SHADER_CORE_VARY_SLOT_32", "SHADER_CORE", "Shader core: vary slot 32",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_VARY_SLOT_16, 0x3ff0u,
+     "SHADER_CORE_VARY_SLOT_16", "SHADER_CORE", "Shader core: vary slot 16",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_ATTR_INSTR, 0x3ff0u,
+     "SHADER_CORE_ATTR_INSTR", "SHADER_CORE", "Shader core: attr instr",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_ARITH_INSTR_FP_MUL, 0xff0u,
+     "SHADER_CORE_ARITH_INSTR_FP_MUL", "SHADER_CORE",
+     "Shader core: arith instr fp mul", "events"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_FTC, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_FTC", "SHADER_CORE", "Shader core: beats rd ftc",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_FTC_EXT, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_FTC_EXT", "SHADER_CORE",
+     "Shader core: beats rd ftc ext", "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_LSC, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_LSC", "SHADER_CORE", "Shader core: beats rd lsc",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_LSC_EXT, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_LSC_EXT", "SHADER_CORE",
+     "Shader core: beats rd lsc ext", "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_TEX, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_TEX", "SHADER_CORE", "Shader core: beats rd tex",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_TEX_EXT, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_TEX_EXT", "SHADER_CORE",
+     "Shader core: beats rd tex ext", "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_RD_OTHER, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_OTHER", "SHADER_CORE", "Shader core: beats rd other",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_SHADER_CORE_BEATS_WR_TIB, 0x3ff0u,
+     "SHADER_CORE_BEATS_WR_TIB", "SHADER_CORE", "Shader core: beats wr tib",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_MMU_REQUESTS, 0x3fffu, "MEMORY_MMU_REQUESTS",
+     "MEMORY", "Memory: mmu requests", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_RD_MSG_IN, 0x3ff0u, "MEMORY_L2_RD_MSG_IN",
+     "MEMORY", "Memory: l2 rd msg in", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_RD_MSG_IN_STALL, 0x3ff0u,
+     "MEMORY_L2_RD_MSG_IN_STALL", "MEMORY", "Memory: l2 rd msg in stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_WR_MSG_IN, 0x3ff0u, "MEMORY_L2_WR_MSG_IN",
+     "MEMORY", "Memory: l2 wr msg in", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_WR_MSG_IN_STALL, 0x3ff0u,
+     "MEMORY_L2_WR_MSG_IN_STALL", "MEMORY", "Memory: l2 wr msg in stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_SNP_MSG_IN, 0x3ff0u, "MEMORY_L2_SNP_MSG_IN",
+     "MEMORY", "Memory: l2 snp msg in", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_SNP_MSG_IN_STALL, 0x3ff0u,
+     "MEMORY_L2_SNP_MSG_IN_STALL", "MEMORY", "Memory: l2 snp msg in stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_RD_MSG_OUT, 0x3ff0u, "MEMORY_L2_RD_MSG_OUT",
+     "MEMORY", "Memory: l2 rd msg out", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_RD_MSG_OUT_STALL, 0x3ff0u,
+     "MEMORY_L2_RD_MSG_OUT_STALL", "MEMORY", "Memory: l2 rd msg out stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_WR_MSG_OUT, 0x3ff0u, "MEMORY_L2_WR_MSG_OUT",
+     "MEMORY", "Memory: l2 wr msg out", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_ANY_LOOKUP, 0x3fffu, "MEMORY_L2_ANY_LOOKUP",
+     "MEMORY", "Memory: l2 any lookup", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_READ_LOOKUP, 0x3fffu,
+     "MEMORY_L2_READ_LOOKUP", "MEMORY", "Memory: l2 read lookup", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_WRITE_LOOKUP, 0x3fffu,
+     "MEMORY_L2_WRITE_LOOKUP", "MEMORY", "Memory: l2 write lookup", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_SNOOP_LOOKUP, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_LOOKUP", "MEMORY", "Memory: l2 ext snoop lookup",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_READ, 0x3fffu, "MEMORY_L2_EXT_READ",
+     "MEMORY", "Memory: l2 ext read", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_READ_NOSNP, 0x3ff0u,
+     "MEMORY_L2_EXT_READ_NOSNP", "MEMORY", "Memory: l2 ext read nosnp",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_READ_UNIQUE, 0x3ff0u,
+     "MEMORY_L2_EXT_READ_UNIQUE", "MEMORY", "Memory: l2 ext read unique",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_READ_BEATS, 0x3fffu,
+     "MEMORY_L2_EXT_READ_BEATS", "MEMORY", "Memory: l2 ext read beats",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AR_STALL, 0x3fffu,
+     "MEMORY_L2_EXT_AR_STALL", "MEMORY", "Memory: l2 ext ar stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AR_CNT_Q1, 0x3ff0u,
+     "MEMORY_L2_EXT_AR_CNT_Q1", "MEMORY", "Memory: l2 ext ar cnt q1", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AR_CNT_Q2, 0x3ff0u,
+     "MEMORY_L2_EXT_AR_CNT_Q2", "MEMORY", "Memory: l2 ext ar cnt q2", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AR_CNT_Q3, 0x3ff0u,
+     "MEMORY_L2_EXT_AR_CNT_Q3", "MEMORY", "Memory: l2 ext ar cnt q3", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_RRESP_0_127, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_0_127", "MEMORY", "Memory: l2 ext rresp 0 127",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_RRESP_128_191, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_128_191", "MEMORY", "Memory: l2 ext rresp 128 191",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_RRESP_192_255, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_192_255", "MEMORY", "Memory: l2 ext rresp 192 255",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_RRESP_256_319, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_256_319", "MEMORY", "Memory: l2 ext rresp 256 319",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_RRESP_320_383, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_320_383", "MEMORY", "Memory: l2 ext rresp 320 383",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_WRITE, 0x3fffu, "MEMORY_L2_EXT_WRITE",
+     "MEMORY", "Memory: l2 ext write", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_WRITE_NOSNP_FULL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_NOSNP_FULL", "MEMORY",
+     "Memory: l2 ext write nosnp full", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_WRITE_NOSNP_PTL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_NOSNP_PTL", "MEMORY",
+     "Memory: l2 ext write nosnp ptl", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_WRITE_SNP_FULL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_SNP_FULL", "MEMORY", "Memory: l2 ext write snp full",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_WRITE_SNP_PTL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_SNP_PTL", "MEMORY", "Memory: l2 ext write snp ptl",
+     "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_WRITE_BEATS, 0x3fffu,
+     "MEMORY_L2_EXT_WRITE_BEATS", "MEMORY", "Memory: l2 ext write beats",
+     "beats"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_W_STALL, 0x3fffu,
+     "MEMORY_L2_EXT_W_STALL", "MEMORY", "Memory: l2 ext w stall", "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AW_CNT_Q1, 0x3ff0u,
+     "MEMORY_L2_EXT_AW_CNT_Q1", "MEMORY", "Memory: l2 ext aw cnt q1", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AW_CNT_Q2, 0x3ff0u,
+     "MEMORY_L2_EXT_AW_CNT_Q2", "MEMORY", "Memory: l2 ext aw cnt q2", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_AW_CNT_Q3, 0x3ff0u,
+     "MEMORY_L2_EXT_AW_CNT_Q3", "MEMORY", "Memory: l2 ext aw cnt q3", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_SNOOP, 0x3ff0u, "MEMORY_L2_EXT_SNOOP",
+     "MEMORY", "Memory: l2 ext snoop", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_SNOOP_STALL, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_STALL", "MEMORY", "Memory: l2 ext snoop stall",
+     "cycles"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_SNOOP_RESP_CLEAN, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_RESP_CLEAN", "MEMORY",
+     "Memory: l2 ext snoop resp clean", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_SNOOP_RESP_DATA, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_RESP_DATA", "MEMORY",
+     "Memory: l2 ext snoop resp data", "events"},
+    {HPC_GPU_MALI_BIFROST_MEMORY_L2_EXT_SNOOP_INTERNAL, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_INTERNAL", "MEMORY", "Memory: l2 ext snoop internal",
+     "events"},
+    // clang-format on
+};
+
+/// The displacement of each perfect hash bucket.
+static const uint16_t hpc_gpu_mali_bifrost_counter_displacements[42] = {
+    13, 5, 3, 0, 22, 0, 2, 5, 67, 20, 15, 2, 56, 123, 80, 2, 71, 0, 3, 98, 10,
+    272, 0, 477, 45, 101, 39, 58, 10, 84, 40, 35, 370, 651, 73, 903, 212, 463,
+    23, 70, 0, 12,
+};
+
+/// The metadata index of each perfect hash slot.
+static const uint16_t hpc_gpu_mali_bifrost_counter_slots[168] = {
+    144, 14, 32, 83, 142, 16, 95, 120, 126, 72, 68, 150, 90, 45, 97, 63, 148,
+    104, 47, 0, 54, 134, 62, 27, 43, 6, 91, 152, 136, 155, 156, 20, 141, 147,
+    110, 124, 69, 121, 65, 132, 5, 42, 38, 82, 53, 128, 84, 85, 105, 98, 29, 9,
+    94, 26, 118, 161, 28, 160, 122, 75, 71, 58, 55, 46, 146, 40, 125, 139, 23,
+    70, 100, 106, 89, 88, 137, 119, 103, 35, 18, 163, 4, 74, 12, 25, 13, 113,
+    15, 107, 19, 39, 99, 159, 7, 166, 60, 61, 135, 93, 149, 50, 96, 102, 153,
+    37, 24, 57, 52, 157, 92, 59, 67, 1, 2, 112, 140, 101, 108, 154, 66, 162, 77,
+    79, 158, 21, 22, 64, 44, 8, 30, 138, 86, 51, 151, 143, 78, 11, 10, 117, 81,
+    123, 131, 76, 130, 167, 129, 33, 31, 111, 41, 48, 49, 127, 34, 109, 145, 56,
+    73, 165, 114, 80, 116, 3, 133, 115, 164, 17, 87, 36,
+};
+
+static const hpc_gpu_counter_registry_t hpc_gpu_mali_bifrost_counter_registry =
+    {
+    168,
+    hpc_gpu_mali_bifrost_counter_infos,
+    14,
+    hpc_gpu_mali_bifrost_series_names,
+    42,
+    hpc_gpu_mali_bifrost_counter_displacements,
+    hpc_gpu_mali_bifrost_counter_slots,
+};
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+const hpc_gpu_counter_registry_t *hpc_gpu_mali_bifrost_get_counter_registry(
+    void) {
+  return &hpc_gpu_mali_bifrost_counter_registry;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "block_sum.h"
+
+#include <stdint.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#define BLOCK_SIZE HPC_GPU_MALI_NUM_COUNTERS_PER_BLOCK
+
+void hpc_gpu_mali_block_sum_scalar(const uint32_t *buffer,
+                                   const uint32_t *block_offsets,
+                                   uint32_t num_blocks, uint64_t *sums) {
+  for (uint32_t i = 0; i < BLOCK_SIZE; ++i) sums[i] = 0;
+  for (uint32_t b = 0; b < num_blocks; ++b) {
+    const uint32_t *block = buffer + block_offsets[b];
+    for (uint32_t i = 0; i < BLOCK_SIZE; ++i) sums[i] += block[i];
+  }
+}
+
+// The vector implementations walk the block in chunks small enough to keep
+// all accumulators for a chunk in registers while iterating over blocks.
+
+#if defined(__ARM_NEON)
+
+static void block_sum_neon(const uint32_t *buffer,
+                           const uint32_t *block_offsets, uint32_t num_blocks,
+                           uint64_t *sums) {
+  for (uint32_t chunk = 0; chunk < BLOCK_SIZE; chunk += 16) {
+    uint64x2_t acc[8];
+    for (int i = 0; i < 8; ++i) acc[i] = vdupq_n_u64(0);
+    for (uint32_t b = 0; b < num_blocks; ++b) {
+      const uint32_t *block = buffer + block_offsets[b] + chunk;
+      for (int i = 0; i < 4; ++i) {
+        uint32x4_t v = vld1q_u32(block + 4 * i);
+        acc[2 * i] = vaddw_u32(acc[2 * i], vget_low_u32(v));
+        acc[2 * i + 1] = vaddw_u32(acc[2 * i + 1], vget_high_u32(v));
+      }
+    }
+    for (int i = 0; i < 8; ++i) vst1q_u64(sums + chunk + 2 * i, acc[i]);
+  }
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+__attribute__((target("sse2"))) static void block_sum_sse2(
+    const uint32_t *buffer, const uint32_t *block_offsets, uint32_t num_blocks,
+    uint64_t *sums) {
+  const __m128i zero = _mm_setzero_si128();
+  for (uint32_t chunk = 0; chunk < BLOCK_SIZE; chunk += 16) {
+    __m128i acc[8];
+    for (int i = 0; i < 8; ++i) acc[i] = zero;
+    for (uint32_t b = 0; b < num_blocks; ++b) {
+      const uint32_t *block = buffer + block_offsets[b] + chunk;
+      for (int i = 0; i < 4; ++i) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(block + 4 * i));
+        // Zero-extend to 64-bit lanes by interleaving with zeros.
+        acc[2 * i] = _mm_add_epi64(acc[2 * i], _mm_unpacklo_epi32(v, zero));
+        acc[2 * i + 1] =
+            _mm_add_epi64(acc[2 * i + 1], _mm_unpackhi_epi32(v, zero));
+      }
+    }
+    for (int i = 0; i < 8; ++i) {
+      _mm_storeu_si128((__m128i *)(sums + chunk + 2 * i), acc[i]);
+    }
+  }
+}
+
+__attribute__((target("avx2"))) static void block_sum_avx2(
+    const uint32_t *buffer, const uint32_t *block_offsets, uint32_t num_blocks,
+    uint64_t *sums) {
+  for (uint32_t chunk = 0; chunk < BLOCK_SIZE; chunk += 32) {
+    __m256i acc[8];
+    for (int i = 0; i < 8; ++i) acc[i] = _mm256_setzero_si256();
+    for (uint32_t b = 0; b < num_blocks; ++b) {
+      const uint32_t *block = buffer + block_offsets[b] + chunk;
+      for (int i = 0; i < 8; ++i) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(block + 4 * i));
+        acc[i] = _mm256_add_epi64(acc[i], _mm256_cvtepu32_epi64(v));
+      }
+    }
+    for (int i = 0; i < 8; ++i) {
+      _mm256_storeu_si256((__m256i *)(sums + chunk + 4 * i), acc[i]);
+    }
+  }
+}
+
+#endif
+
+hpc_gpu_mali_block_sum_function hpc_gpu_mali_get_block_sum_function(void) {
+#if defined(__ARM_NEON)
+  return block_sum_neon;
+#elif defined(__x86_64__) || defined(__i386__)
+  if (__builtin_cpu_supports("avx2")) return block_sum_avx2;
+  if (__builtin_cpu_supports("sse2")) return block_sum_sse2;
+  return hpc_gpu_mali_block_sum_scalar;
+#else
+  return hpc_gpu_mali_block_sum_scalar;
+#endif
+}
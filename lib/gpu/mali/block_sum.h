@@ -0,0 +1,53 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_BLOCK_SUM_H_
+#define HPC_GPU_MALI_BLOCK_SUM_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// The number of 32-bit counters in each functionality block of a dump.
+#define HPC_GPU_MALI_NUM_COUNTERS_PER_BLOCK 64u
+
+/// Pointer to the function summing counter blocks lane by lane.
+///
+/// `sums[i]` receives the sum of `buffer[block_offsets[b] + i]` over all
+/// `num_blocks` blocks, for all `HPC_GPU_MALI_NUM_COUNTERS_PER_BLOCK` lanes.
+/// Sums are accumulated in 64 bits so all implementations are bit-exact.
+typedef void (*hpc_gpu_mali_block_sum_function)(const uint32_t *buffer,
+                                                const uint32_t *block_offsets,
+                                                uint32_t num_blocks,
+                                                uint64_t *sums);
+
+/// Sums counter blocks one lane at a time. This is the reference
+/// implementation.
+void hpc_gpu_mali_block_sum_scalar(const uint32_t *buffer,
+                                   const uint32_t *block_offsets,
+                                   uint32_t num_blocks, uint64_t *sums);
+
+/// Returns the fastest block sum implementation supported by the current CPU:
+/// NEON on ARM, AVX2 or SSE2 on x86, and the scalar one otherwise.
+hpc_gpu_mali_block_sum_function hpc_gpu_mali_get_block_sum_function(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_MALI_BLOCK_SUM_H_
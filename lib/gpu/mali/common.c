@@ -16,10 +16,11 @@
 
 #include "hpc/gpu/mali/common.h"
 
-#include <assert.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "context.h"
+#include "counter_conversion.h"
 
 static uint32_t hpc_gpu_mali_common_counter_convert(
     uint32_t counter, hpc_gpu_mali_counter_layout_t layout);
@@ -39,6 +40,24 @@ int hpc_gpu_mali_common_destroy_context(
   return hpc_gpu_mali_destroy_context(context, allocator);
 }
 
+void hpc_gpu_mali_common_get_context_memory_requirements(
+    uint32_t num_counters, size_t *size, size_t *alignment) {
+  hpc_gpu_mali_get_context_memory_requirements(num_counters, size, alignment);
+}
+
+int hpc_gpu_mali_common_create_context_in_memory(
+    uint32_t num_counters, hpc_gpu_mali_common_counter_t *counters,
+    void *memory, hpc_gpu_mali_context_t **out_context) {
+  return hpc_gpu_mali_create_context_in_memory(
+      num_counters, counters, hpc_gpu_mali_common_counter_convert, memory,
+      out_context);
+}
+
+int hpc_gpu_mali_common_destroy_context_in_memory(
+    hpc_gpu_mali_context_t *context) {
+  return hpc_gpu_mali_destroy_context_in_memory(context);
+}
+
 int hpc_gpu_mali_common_start_counters(const hpc_gpu_mali_context_t *context) {
   return hpc_gpu_mali_context_start_counters(context);
 }
@@ -52,827 +71,265 @@ int hpc_gpu_mali_common_query_counters(const hpc_gpu_mali_context_t *context,
   return hpc_gpu_mali_context_query_counters(context, values);
 }
 
-//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
-
-static uint32_t hpc_gpu_mali_common_counter_convert_to_t82x(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
-
-static uint32_t hpc_gpu_mali_common_counter_convert_to_t83x(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
-
-static uint32_t hpc_gpu_mali_common_counter_convert_to_t86x(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
-
-static uint32_t hpc_gpu_mali_common_counter_convert_to_t88x(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
-
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tmix(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
+int hpc_gpu_mali_common_query_counters_with_times(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  return hpc_gpu_mali_context_query_counters_with_times(context, values,
+                                                        times);
 }
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_thex(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
+int hpc_gpu_mali_common_start_periodic_counters(
+    const hpc_gpu_mali_context_t *context, uint32_t interval_ns) {
+  return hpc_gpu_mali_context_start_periodic_counters(context, interval_ns);
 }
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tdvx(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
+int hpc_gpu_mali_common_query_counter_batch(
+    const hpc_gpu_mali_context_t *context, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples) {
+  return hpc_gpu_mali_context_query_counter_batch(
+      context, max_num_samples, timestamps, values, num_samples);
 }
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tsix(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
+void hpc_gpu_mali_common_get_breakdown_dimensions(
+    const hpc_gpu_mali_context_t *context, uint32_t *num_shader_core_counters,
+    uint32_t *num_shader_cores, uint32_t *num_l2_slice_counters,
+    uint32_t *num_l2_slices) {
+  hpc_gpu_mali_context_get_breakdown_dimensions(
+      context, num_shader_core_counters, num_shader_cores,
+      num_l2_slice_counters, num_l2_slices);
 }
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tgox(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
+int hpc_gpu_mali_common_query_counter_breakdown(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    uint64_t *shader_core_values, uint64_t *l2_slice_values) {
+  return hpc_gpu_mali_context_query_counter_breakdown(
+      context, values, shader_core_values, l2_slice_values);
 }
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tnox(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
+uint32_t hpc_gpu_mali_common_convert_counter(
+    uint32_t counter, hpc_gpu_mali_counter_layout_t layout) {
+  return hpc_gpu_mali_common_counter_convert(counter, layout);
 }
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tnax(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_ttrx(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
+/// The number of counter layouts covered by the index table.
+#define HPC_GPU_MALI_COMMON_NUM_LAYOUTS 14u
+/// The index table entry for layouts or values without the counter.
+#define HPC_GPU_MALI_COMMON_NO_INDEX 0xffu
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_totx(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
+/// The start of each category's entries in the index table, indexed by
+/// category. A counter's entry is at its category's start plus its index bits.
+static const uint16_t hpc_gpu_mali_common_category_starts[5] = {
+    // clang-format off
+    0, 32, 46, 70, 129,
+    // clang-format on
+};
 
-static uint32_t hpc_gpu_mali_common_counter_convert_to_tbox(uint32_t counter) {
-  // clang-format off
-  switch ((hpc_gpu_mali_common_counter_t)counter) {
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT: return 4;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED: return 5;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE: return 6;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE: return 7;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS: return 8;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS: return 9;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE: return 10;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ: return 12;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE: return 13;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND: return 14;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH: return 15;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS: return 16;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS: return 17;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE: return 18;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ: return 20;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE: return 21;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND: return 22;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH: return 23;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS: return 24;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS: return 25;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE: return 26;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ: return 28;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE: return 29;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND: return 30;
-    case HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH: return 31;
-    case HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED: return 3;
-    case HPC_GPU_MALI_COMMON_TILER_TRIANGLES: return 4;
-    case HPC_GPU_MALI_COMMON_TILER_POINTS: return 7;
-    case HPC_GPU_MALI_COMMON_TILER_LINES: return 8;
-    case HPC_GPU_MALI_COMMON_TILER_FRONT_FACING: return 9;
-    case HPC_GPU_MALI_COMMON_TILER_BACK_FACING: return 10;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE: return 11;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED: return 12;
-    case HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED: return 13;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE: return 4;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST: return 14;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST: return 15;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM: return 21;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE: return 22;
-    case HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS: return 23;
-    case HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS: return 9;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS: return 30;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS: return 31;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP: return 32;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP: return 33;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP: return 39;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ: return 48;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE: return 50;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL: return 54;
-    case HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL: return 58;
-  }
-  // clang-format on
-}
+/// Indices of counters in counter blocks, indexed by layout minus one.
+static const uint8_t hpc_gpu_mali_common_counter_indices[14][129] = {
+    // clang-format off
+    /* T82X */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 3, 4, 0xffu, 0xffu, 7, 8, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 14, 15, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 21, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 9, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 30, 31,
+        32, 33, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 39, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 48, 0xffu, 50, 0xffu, 0xffu, 0xffu,
+        54, 0xffu, 0xffu, 0xffu, 58,
+    },
+    /* T83X */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 3, 4, 0xffu, 0xffu, 7, 8, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 14, 15, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 21, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 9, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 30, 31,
+        32, 33, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 39, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 48, 0xffu, 50, 0xffu, 0xffu, 0xffu,
+        54, 0xffu, 0xffu, 0xffu, 58,
+    },
+    /* T86X */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 3, 4, 0xffu, 0xffu, 7, 8, 11, 12, 13, 14, 15,
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 14, 15, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 21, 22,
+        23, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 9,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        30, 31, 32, 33, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 39, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 48, 0xffu, 50, 0xffu, 0xffu,
+        0xffu, 54, 0xffu, 0xffu, 0xffu, 58,
+    },
+    /* T88X */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 3, 4, 0xffu, 0xffu, 7, 8, 11, 12, 13, 14, 15,
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 14, 15, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 21, 22,
+        23, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 9,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        30, 31, 32, 33, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 39, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 48, 0xffu, 50, 0xffu, 0xffu,
+        0xffu, 54, 0xffu, 0xffu, 0xffu, 58,
+    },
+    /* THEX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TMIX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TDVX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TSIX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TNOX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TGOX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TTRX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TNAX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TOTX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    /* TBOX */ {
+        0xffu, 0xffu, 0xffu, 0xffu, 4, 5, 6, 7, 8, 9, 10, 0xffu, 12, 13, 14, 15,
+        16, 17, 18, 0xffu, 20, 21, 22, 23, 24, 25, 26, 0xffu, 28, 29, 30, 31,
+        0xffu, 0xffu, 0xffu, 5, 6, 0xffu, 0xffu, 8, 7, 9, 10, 11, 12, 13, 0xffu,
+        0xffu, 0xffu, 0xffu, 4, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 11, 12, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 19, 22, 23,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 4, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 47, 32,
+        25, 26, 0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 27, 0xffu, 0xffu, 0xffu,
+        0xffu, 0xffu, 0xffu, 0xffu, 0xffu, 29, 0xffu, 42, 0xffu, 0xffu, 0xffu,
+        33, 0xffu, 0xffu, 0xffu, 48,
+    },
+    // clang-format on
+};
 
 static uint32_t hpc_gpu_mali_common_counter_convert(
     uint32_t counter, hpc_gpu_mali_counter_layout_t layout) {
-  // clang-format off
-  switch (layout) {
-    case HPC_GPU_MALI_COUNTER_LAYOUT_T82X: return hpc_gpu_mali_common_counter_convert_to_t82x(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_T83X: return hpc_gpu_mali_common_counter_convert_to_t83x(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_T86X: return hpc_gpu_mali_common_counter_convert_to_t86x(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_T88X: return hpc_gpu_mali_common_counter_convert_to_t88x(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TMIX: return hpc_gpu_mali_common_counter_convert_to_tmix(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_THEX: return hpc_gpu_mali_common_counter_convert_to_thex(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TDVX: return hpc_gpu_mali_common_counter_convert_to_tdvx(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TSIX: return hpc_gpu_mali_common_counter_convert_to_tsix(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TGOX: return hpc_gpu_mali_common_counter_convert_to_tgox(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TNOX: return hpc_gpu_mali_common_counter_convert_to_tnox(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TNAX: return hpc_gpu_mali_common_counter_convert_to_tnax(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TTRX: return hpc_gpu_mali_common_counter_convert_to_ttrx(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TOTX: return hpc_gpu_mali_common_counter_convert_to_totx(counter);
-    case HPC_GPU_MALI_COUNTER_LAYOUT_TBOX: return hpc_gpu_mali_common_counter_convert_to_tbox(counter);
-    default: assert(0 && "should not happen!"); return ~0u;
+  uint32_t category = counter >> 8u;
+  uint32_t index = counter & ((1u << 8u) - 1u);
+  if (layout == HPC_GPU_MALI_COUNTER_LAYOUT_UNKNOWN ||
+      layout > HPC_GPU_MALI_COMMON_NUM_LAYOUTS) {
+    return ~0u;
+  }
+  if (category >= 4u) return ~0u;
+  uint32_t start = hpc_gpu_mali_common_category_starts[category];
+  if (index >= hpc_gpu_mali_common_category_starts[category + 1] - start) {
+    return ~0u;
   }
-  // clang-format on
+  uint32_t converted =
+      hpc_gpu_mali_common_counter_indices[layout - 1][start + index];
+  return converted == HPC_GPU_MALI_COMMON_NO_INDEX ? ~0u : converted;
 }
 
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
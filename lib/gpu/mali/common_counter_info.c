@@ -0,0 +1,194 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/mali/common.h"
+
+#include <stdint.h>
+
+#include "hpc/gpu/counter_info.h"
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The series that availability bits refer to.
+static const char *const hpc_gpu_mali_common_series_names[14] = {
+    "T82X", "T83X", "T86X", "T88X", "THEX", "TMIX", "TDVX", "TSIX", "TNOX",
+    "TGOX", "TTRX", "TNAX", "TOTX", "TBOX",
+};
+
+/// Metadata of all counters, in enum order.
+static const hpc_gpu_counter_info_t hpc_gpu_mali_common_counter_infos[50] = {
+    // clang-format off
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_SENT, 0x3fffu,
+     "JOB_MANAGER_MESSAGES_SENT", "JOB_MANAGER", "Job manager: messages sent",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_MESSAGES_RECEIVED, 0x3fffu,
+     "JOB_MANAGER_MESSAGES_RECEIVED", "JOB_MANAGER",
+     "Job manager: messages received", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_GPU_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_GPU_ACTIVE", "JOB_MANAGER", "Job manager: gpu active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_IRQ_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_IRQ_ACTIVE", "JOB_MANAGER", "Job manager: irq active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_JOBS, 0x3fffu, "JOB_MANAGER_JS0_JOBS",
+     "JOB_MANAGER", "Job manager: js0 jobs", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS0_TASKS", "JOB_MANAGER", "Job manager: js0 tasks",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS0_ACTIVE", "JOB_MANAGER", "Job manager: js0 active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_READ", "JOB_MANAGER", "Job manager: js0 wait read",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js0 wait issue",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js0 wait depend", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS0_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js0 wait finish", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_JOBS, 0x3fffu, "JOB_MANAGER_JS1_JOBS",
+     "JOB_MANAGER", "Job manager: js1 jobs", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS1_TASKS", "JOB_MANAGER", "Job manager: js1 tasks",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS1_ACTIVE", "JOB_MANAGER", "Job manager: js1 active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_READ", "JOB_MANAGER", "Job manager: js1 wait read",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js1 wait issue",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js1 wait depend", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS1_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js1 wait finish", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_JOBS, 0x3fffu, "JOB_MANAGER_JS2_JOBS",
+     "JOB_MANAGER", "Job manager: js2 jobs", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS2_TASKS", "JOB_MANAGER", "Job manager: js2 tasks",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS2_ACTIVE", "JOB_MANAGER", "Job manager: js2 active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_READ", "JOB_MANAGER", "Job manager: js2 wait read",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js2 wait issue",
+     "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js2 wait depend", "events"},
+    {HPC_GPU_MALI_COMMON_JOB_MANAGER_JS2_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js2 wait finish", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_JOBS_PROCESSED, 0x3fffu, "TILER_JOBS_PROCESSED",
+     "TILER", "Tiler: jobs processed", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_TRIANGLES, 0x3fffu, "TILER_TRIANGLES", "TILER",
+     "Tiler: triangles", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_POINTS, 0x3fffu, "TILER_POINTS", "TILER",
+     "Tiler: points", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_LINES, 0x3fffu, "TILER_LINES", "TILER",
+     "Tiler: lines", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_FRONT_FACING, 0x3fffu, "TILER_FRONT_FACING",
+     "TILER", "Tiler: front facing", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_BACK_FACING, 0x3fffu, "TILER_BACK_FACING",
+     "TILER", "Tiler: back facing", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_PRIM_VISIBLE, 0x3fffu, "TILER_PRIM_VISIBLE",
+     "TILER", "Tiler: prim visible", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_PRIM_CULLED, 0x3fffu, "TILER_PRIM_CULLED",
+     "TILER", "Tiler: prim culled", "events"},
+    {HPC_GPU_MALI_COMMON_TILER_PRIM_CLIPPED, 0x3fffu, "TILER_PRIM_CLIPPED",
+     "TILER", "Tiler: prim clipped", "events"},
+    {HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_ACTIVE, 0x3fffu,
+     "SHADER_CORE_FRAG_ACTIVE", "SHADER_CORE", "Shader core: frag active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_RAST, 0x3fffu,
+     "SHADER_CORE_FRAG_QUADS_RAST", "SHADER_CORE",
+     "Shader core: frag quads rast", "events"},
+    {HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_QUADS_EZS_TEST, 0x3fffu,
+     "SHADER_CORE_FRAG_QUADS_EZS_TEST", "SHADER_CORE",
+     "Shader core: frag quads ezs test", "events"},
+    {HPC_GPU_MALI_COMMON_SHADER_CORE_FRAG_TRANS_ELIM, 0x3fffu,
+     "SHADER_CORE_FRAG_TRANS_ELIM", "SHADER_CORE",
+     "Shader core: frag trans elim", "events"},
+    {HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_ACTIVE, 0x3fffu,
+     "SHADER_CORE_COMPUTE_ACTIVE", "SHADER_CORE", "Shader core: compute active",
+     "cycles"},
+    {HPC_GPU_MALI_COMMON_SHADER_CORE_COMPUTE_TASKS, 0x3fffu,
+     "SHADER_CORE_COMPUTE_TASKS", "SHADER_CORE", "Shader core: compute tasks",
+     "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_MMU_REQUESTS, 0x3fffu, "MEMORY_MMU_REQUESTS",
+     "MEMORY", "Memory: mmu requests", "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE_BEATS, 0x3fffu,
+     "MEMORY_L2_EXT_WRITE_BEATS", "MEMORY", "Memory: l2 ext write beats",
+     "beats"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ_BEATS, 0x3fffu,
+     "MEMORY_L2_EXT_READ_BEATS", "MEMORY", "Memory: l2 ext read beats",
+     "beats"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_ANY_LOOKUP, 0x3fffu, "MEMORY_L2_ANY_LOOKUP",
+     "MEMORY", "Memory: l2 any lookup", "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_READ_LOOKUP, 0x3fffu,
+     "MEMORY_L2_READ_LOOKUP", "MEMORY", "Memory: l2 read lookup", "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_WRITE_LOOKUP, 0x3fffu,
+     "MEMORY_L2_WRITE_LOOKUP", "MEMORY", "Memory: l2 write lookup", "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_READ, 0x3fffu, "MEMORY_L2_EXT_READ",
+     "MEMORY", "Memory: l2 ext read", "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_WRITE, 0x3fffu, "MEMORY_L2_EXT_WRITE",
+     "MEMORY", "Memory: l2 ext write", "events"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_AR_STALL, 0x3fffu,
+     "MEMORY_L2_EXT_AR_STALL", "MEMORY", "Memory: l2 ext ar stall", "cycles"},
+    {HPC_GPU_MALI_COMMON_MEMORY_L2_EXT_W_STALL, 0x3fffu,
+     "MEMORY_L2_EXT_W_STALL", "MEMORY", "Memory: l2 ext w stall", "cycles"},
+    // clang-format on
+};
+
+/// The displacement of each perfect hash bucket.
+static const uint16_t hpc_gpu_mali_common_counter_displacements[13] = {
+    5, 4, 29, 15, 13, 66, 270, 10, 438, 41, 3, 210, 0,
+};
+
+/// The metadata index of each perfect hash slot.
+static const uint16_t hpc_gpu_mali_common_counter_slots[50] = {
+    31, 3, 48, 21, 47, 40, 36, 44, 24, 17, 35, 34, 18, 12, 26, 9, 8, 30, 43, 13,
+    19, 4, 5, 27, 32, 33, 46, 37, 22, 39, 0, 38, 29, 41, 2, 14, 49, 25, 7, 42,
+    23, 15, 20, 6, 16, 11, 1, 28, 45, 10,
+};
+
+static const hpc_gpu_counter_registry_t hpc_gpu_mali_common_counter_registry = {
+    50,
+    hpc_gpu_mali_common_counter_infos,
+    14,
+    hpc_gpu_mali_common_series_names,
+    13,
+    hpc_gpu_mali_common_counter_displacements,
+    hpc_gpu_mali_common_counter_slots,
+};
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+const hpc_gpu_counter_registry_t *hpc_gpu_mali_common_get_counter_registry(
+    void) {
+  return &hpc_gpu_mali_common_counter_registry;
+}
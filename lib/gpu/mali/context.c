@@ -16,15 +16,15 @@
 
 #include "context.h"
 
+#include <errno.h>
 #include <stdint.h>
-#include <string.h>
-#include <unistd.h>  // For close
+#include <time.h>
 
+#include "device.h"
 #include "driver_ioctl.h"
+#include "gather_plan.h"
 #include "hpc/gpu/base_utilities.h"
 
-const uint32_t NUM_COUNTERS_PER_CATEGORY = 64;
-
 //===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
 
 hpc_gpu_mali_counter_layout_t hpc_gpu_mali_get_counter_layout(uint16_t gpu_id) {
@@ -62,22 +62,13 @@ static inline mali_counter_category_t mali_get_counter_category(
 //===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
 
 typedef struct hpc_gpu_mali_context_t {
-  /// The buffer containing all counter values returned from the driver for
-  /// one sample.
-  uint32_t *query_buffer;
-  /// The list of counter categories.
-  uint32_t *counter_categories;
-  /// The list of counter indices (into their categories).
-  uint32_t *counter_indices;
+  /// The plan for extracting requested counters from one dump.
+  hpc_gpu_mali_gather_plan_t gather_plan;
   /// The number of counters.
   uint32_t num_counters;
 
   /// The current GPU's file descriptor.
   int gpu_device;
-  /// The indices of enabled shader cores of the current GPU.
-  uint32_t *shader_core_indices;
-  /// The number of shader cores of the current GPU.
-  uint32_t num_shader_cores;
 
   /// The current GPU's information.
   hpc_gpu_mali_ioctl_gpu_device_info_t device_info;
@@ -92,99 +83,115 @@ static uint32_t popcount(uint32_t x) {
   return count;
 }
 
-int hpc_gpu_mali_create_context(
+void hpc_gpu_mali_get_context_memory_requirements(uint32_t num_counters,
+                                                  size_t *size,
+                                                  size_t *alignment) {
+  // The context is followed by its gather plan, and then scratch space for
+  // decoding counter categories and indices during creation.
+  *size = sizeof(hpc_gpu_mali_context_t) +
+          hpc_gpu_mali_get_gather_plan_size(num_counters) +
+          2 * num_counters * sizeof(uint32_t);
+  *alignment = _Alignof(hpc_gpu_mali_context_t);
+}
+
+int hpc_gpu_mali_create_context_in_memory(
     uint32_t num_counters, uint32_t *counters,
-    convert_counter_fn convert_counter,
-    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    convert_counter_fn convert_counter, void *memory,
     hpc_gpu_mali_context_t **out_context) {
-  int gpu_device = hpc_gpu_mali_ioctl_open_gpu_device();
-  if (gpu_device < 0) return gpu_device;
-
-  // First negotiate API version with the kernel driver. Feeding in 0.0 means to
-  // accept whatever version the kernel driver is at, as it does not really
-  // matter for us. But we still need to perform this step because the kernel
-  // driver needs to initialize API version inside.
-  uint16_t major_version = 0, minor_version = 0;
-  int status = hpc_gpu_mali_ioctl_setup_api_version(gpu_device, &major_version,
-                                                    &minor_version);
-  if (status < 0) return status;
-
-  // Then setup the kernel API context. This is also necessary for future
-  // interactions with the kernel driver.
-  status = hpc_gpu_mali_ioctl_setup_api_context(gpu_device);
-  if (status < 0) return status;
-
-  // Query device information to figure out which GPU product this is.
+  int gpu_device = -1;
   hpc_gpu_mali_ioctl_gpu_device_info_t device_info;
-  status = hpc_gpu_mali_ioctl_get_gpu_device_info(gpu_device, allocator,
-                                                  &device_info);
+  hpc_gpu_mali_counter_layout_t layout = HPC_GPU_MALI_COUNTER_LAYOUT_UNKNOWN;
+  int status = hpc_gpu_mali_acquire_device(&gpu_device, &device_info, &layout);
   if (status < 0) return status;
-
-  hpc_gpu_mali_counter_layout_t layout =
-      hpc_gpu_mali_get_counter_layout((uint16_t)device_info.gpu_product_id);
   if (layout == HPC_GPU_MALI_COUNTER_LAYOUT_UNKNOWN) {
+    hpc_gpu_mali_release_device(gpu_device);
     return -HPC_GPU_ERROR_UNKNOWN_DEVICE;
   }
 
   // Now it's time to set up the counter reader.
   hpc_gpu_mali_ioctl_counter_reader_t counter_reader;
   status = hpc_gpu_mali_ioctl_open_counter_reader(gpu_device, &counter_reader);
-  if (status < 0) return status;
+  if (status < 0) {
+    int error = errno;
+    hpc_gpu_mali_release_device(gpu_device);
+    errno = error;
+    return status;
+  }
 
-  // Allocate memory for the context itself.
-  hpc_gpu_mali_context_t *context =
-      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_mali_context_t));
+  hpc_gpu_mali_context_t *context = (hpc_gpu_mali_context_t *)memory;
 
   context->num_counters = num_counters;
   context->gpu_device = gpu_device;
-  context->num_shader_cores = popcount(device_info.shader_core_mask);
   context->device_info = device_info;
   context->counter_reader = counter_reader;
 
-  // Allocate memory for the embedded buffer containing counter categories and
-  // indices.
-  uint32_t *categories =
-      allocator->alloc(allocator->user_data, num_counters * sizeof(uint32_t));
-  uint32_t *indices =
-      allocator->alloc(allocator->user_data, num_counters * sizeof(uint32_t));
+  // Resolve counter categories and indices into dump offsets once here so
+  // that sampling needs no topology arithmetic.
+  uint8_t *plan_memory = (uint8_t *)(context + 1);
+  size_t plan_size = hpc_gpu_mali_get_gather_plan_size(num_counters);
+  uint32_t *categories = (uint32_t *)(plan_memory + plan_size);
+  uint32_t *indices = categories + num_counters;
   for (int i = 0; i < num_counters; ++i) {
     categories[i] = mali_get_counter_category(counters[i]);
     indices[i] = convert_counter(counters[i], layout);
-  }
-  context->counter_categories = categories;
-  context->counter_indices = indices;
-
-  // Allocate memory for enabled shader core indices.
-  context->shader_core_indices = allocator->alloc(
-      allocator->user_data, context->num_shader_cores * sizeof(uint32_t));
-  for (uint32_t index = 0, i = 0; i < 32; ++i) {
-    if (device_info.shader_core_mask & (1u << i)) {
-      context->shader_core_indices[index++] = i;
+    if (indices[i] == ~0u) {
+      hpc_gpu_mali_destroy_context_in_memory(context);
+      return -HPC_GPU_ERROR_UNSUPPORTED_COUNTER;
     }
   }
-
-  // Allocate memory for the embedded buffer for sampling counters.
-  context->query_buffer =
-      allocator->alloc(allocator->user_data, counter_reader.single_buffer_size);
-  memset(context->query_buffer, 0, counter_reader.single_buffer_size);
+  status = hpc_gpu_mali_init_gather_plan(
+      num_counters, categories, indices, device_info.num_l2_slices,
+      device_info.shader_core_mask, HPC_GPU_MALI_BLOCK_SUM_THRESHOLD,
+      plan_memory, &context->gather_plan);
+  if (status < 0) {
+    int error = errno;
+    hpc_gpu_mali_destroy_context_in_memory(context);
+    errno = error;
+    return status;
+  }
 
   *out_context = context;
   return 0;
 }
 
-int hpc_gpu_mali_destroy_context(
-    hpc_gpu_mali_context_t *context,
-    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+int hpc_gpu_mali_destroy_context_in_memory(hpc_gpu_mali_context_t *context) {
+  // Keep tearing down after a failure so the device reference is never
+  // leaked, and report the first error.
   int status =
       hpc_gpu_mali_ioctl_close_counter_reader(&context->counter_reader);
-  if (status < 0) return status;
-  status = hpc_gpu_mali_ioctl_close_gpu_device(context->gpu_device);
-  if (status < 0) return status;
+  int error = errno;
+  int release_status = hpc_gpu_mali_release_device(context->gpu_device);
+  if (status < 0) {
+    errno = error;
+    return status;
+  }
+  return release_status;
+}
+
+int hpc_gpu_mali_create_context(
+    uint32_t num_counters, uint32_t *counters,
+    convert_counter_fn convert_counter,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_context_t **out_context) {
+  size_t size = 0, alignment = 0;
+  hpc_gpu_mali_get_context_memory_requirements(num_counters, &size,
+                                               &alignment);
+  void *memory = allocator->alloc(allocator->user_data, size);
+
+  int status = hpc_gpu_mali_create_context_in_memory(
+      num_counters, counters, convert_counter, memory, out_context);
+  if (status < 0) allocator->free(allocator->user_data, memory);
+  return status;
+}
 
-  allocator->free(allocator->user_data, context->query_buffer);
-  allocator->free(allocator->user_data, context->counter_indices);
+int hpc_gpu_mali_destroy_context(
+    hpc_gpu_mali_context_t *context,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  int status = hpc_gpu_mali_destroy_context_in_memory(context);
+  int error = errno;
   allocator->free(allocator->user_data, context);
-  return 0;
+  errno = error;
+  return status;
 }
 
 int hpc_gpu_mali_context_start_counters(const hpc_gpu_mali_context_t *context) {
@@ -192,62 +199,138 @@ int hpc_gpu_mali_context_start_counters(const hpc_gpu_mali_context_t *context) {
 }
 
 int hpc_gpu_mali_context_stop_counters(const hpc_gpu_mali_context_t *context) {
-  // Nothing to do.
+  // Make sure the kernel driver is no longer dumping periodically.
+  return hpc_gpu_mali_ioctl_set_dump_interval(&context->counter_reader, 0);
+}
+
+int hpc_gpu_mali_context_start_periodic_counters(
+    const hpc_gpu_mali_context_t *context, uint32_t interval_ns) {
+  int status = hpc_gpu_mali_ioctl_zero_counters(&context->counter_reader);
+  if (status < 0) return status;
+  return hpc_gpu_mali_ioctl_set_dump_interval(&context->counter_reader,
+                                              interval_ns);
+}
+
+/// Destinations for per-shader-core and per-L2-slice values.
+typedef struct mali_counter_breakdown_t {
+  uint64_t *shader_core_values;
+  uint64_t *l2_slice_values;
+} mali_counter_breakdown_t;
+
+/// Extracts counters requested during context creation from the oldest ready
+/// dump in the kernel driver's ring buffer, and then releases the dump. Values
+/// from each shader core and L2 slice are also written out if `breakdown` is
+/// not NULL.
+///
+/// Returns 1 if a dump was extracted, 0 if no dump is ready, and a negative
+/// value on errors.
+static int mali_context_extract_ready_counters(
+    const hpc_gpu_mali_context_t *context, uint64_t *timestamp,
+    uint64_t *values, const mali_counter_breakdown_t *breakdown) {
+  hpc_gpu_mali_ioctl_counter_dump_t dump;
+  int status =
+      hpc_gpu_mali_ioctl_acquire_counters(&context->counter_reader, &dump);
+  if (status <= 0) return status;
+
+  // Read the counters directly from the kernel buffer; it stays valid until
+  // being released.
+  if (breakdown) {
+    hpc_gpu_mali_gather_plan_execute_breakdown(
+        &context->gather_plan, dump.values, values,
+        breakdown->shader_core_values, breakdown->l2_slice_values);
+  } else {
+    hpc_gpu_mali_gather_plan_execute(&context->gather_plan, dump.values,
+                                     values);
+  }
+  *timestamp = dump.timestamp;
+
+  status = hpc_gpu_mali_ioctl_release_counters(&context->counter_reader, &dump);
+  if (status < 0) return status;
+  return 1;
+}
+
+static uint64_t get_monotonic_raw_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+/// Requests a new dump from the kernel driver and extracts counters from it.
+/// Sample times are written out if `times` is not NULL.
+static int mali_context_dump_and_extract_counters(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    const mali_counter_breakdown_t *breakdown, hpc_gpu_sample_times_t *times) {
+  // Get a new sample of all perf counters.
+  if (times) times->host_begin_ns = get_monotonic_raw_time_ns();
+  int status = hpc_gpu_mali_ioctl_dump_counters(&context->counter_reader);
+  if (status < 0) return status;
+
+  status = hpc_gpu_mali_ioctl_wait_counters(&context->counter_reader);
+  if (status < 0) return status;
+  if (times) times->host_end_ns = get_monotonic_raw_time_ns();
+
+  // Extract those requested during context creation and write out.
+  uint64_t timestamp = 0;
+  status = mali_context_extract_ready_counters(context, &timestamp, values,
+                                               breakdown);
+  if (status < 0) return status;
+  if (status == 0) return -HPC_GPU_ERROR_INTERNAL;
+
+  if (times) {
+    times->driver_timestamp_ns = timestamp;
+    times->gpu_clock_cycles = 0;
+  }
   return 0;
 }
 
 int hpc_gpu_mali_context_query_counters(const hpc_gpu_mali_context_t *context,
                                         uint64_t *values) {
-  // Get a new sample of all perf counters.
-  uint64_t timestamp = 0;
-  int status = hpc_gpu_mali_ioctl_query_counters(
-      &context->counter_reader, context->query_buffer, &timestamp);
+  return mali_context_dump_and_extract_counters(context, values, NULL, NULL);
+}
+
+int hpc_gpu_mali_context_query_counters_with_times(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times) {
+  return mali_context_dump_and_extract_counters(context, values, NULL, times);
+}
+
+void hpc_gpu_mali_context_get_breakdown_dimensions(
+    const hpc_gpu_mali_context_t *context, uint32_t *num_shader_core_counters,
+    uint32_t *num_shader_cores, uint32_t *num_l2_slice_counters,
+    uint32_t *num_l2_slices) {
+  const hpc_gpu_mali_gather_plan_t *plan = &context->gather_plan;
+  *num_shader_core_counters = plan->shader_core_blocks.num_counters;
+  *num_shader_cores = popcount(context->device_info.shader_core_mask);
+  *num_l2_slice_counters = plan->memory_blocks.num_counters;
+  *num_l2_slices = context->device_info.num_l2_slices;
+}
+
+int hpc_gpu_mali_context_query_counter_breakdown(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    uint64_t *shader_core_values, uint64_t *l2_slice_values) {
+  mali_counter_breakdown_t breakdown = {shader_core_values, l2_slice_values};
+  return mali_context_dump_and_extract_counters(context, values, &breakdown,
+                                                NULL);
+}
+
+int hpc_gpu_mali_context_query_counter_batch(
+    const hpc_gpu_mali_context_t *context, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples) {
+  *num_samples = 0;
+  if (max_num_samples == 0) return 0;
+
+  int status = hpc_gpu_mali_ioctl_wait_counters(&context->counter_reader);
   if (status < 0) return status;
 
-  // Extract those requested during context creation and write out.
-  //
-  // Note that the kernel driver just returns a packed buffer containing counter
-  // samples for all functionality blocks, in the order of the job manager, the
-  // tiler, all L2 slices, all shader cores. Each functionality block are
-  // guaranteed to return 64 32-bit counters. If there are more than one L2
-  // slide, they each emit 64 counters so we need to aggregate. Further, for
-  // shader cores, the driver always return 32 (the bitwidth of the core mask)
-  // blocks. But those shader cores off in the mask aren't enabled; their blocks
-  // should be skipped.
-  for (int i = 0; i < context->num_counters; ++i) {
-    switch ((mali_counter_category_t)context->counter_categories[i]) {
-      case MALI_COUNTER_CATEGORY_JOB_MANAGER: {
-        values[i] = context->query_buffer[context->counter_indices[i]];
-      } break;
-      case MALI_COUNTER_CATEGORY_TILER: {
-        uint32_t offset =
-            NUM_COUNTERS_PER_CATEGORY + context->counter_indices[i];
-        values[i] = context->query_buffer[offset];
-      } break;
-      case MALI_COUNTER_CATEGORY_MEMORY: {
-        uint64_t total = 0;
-        uint32_t base_offset = NUM_COUNTERS_PER_CATEGORY * 2;
-        for (int j = 0; j < context->device_info.num_l2_slices; ++j) {
-          uint32_t offset = base_offset + NUM_COUNTERS_PER_CATEGORY * j +
-                            context->counter_indices[i];
-          total += context->query_buffer[offset];
-        }
-        values[i] = total;
-      } break;
-      case MALI_COUNTER_CATEGORY_SHADER_CORE: {
-        uint64_t total = 0;
-        uint32_t base_offset = NUM_COUNTERS_PER_CATEGORY *
-                               (2 + context->device_info.num_l2_slices);
-        for (int j = 0; j < context->num_shader_cores; ++j) {
-          uint32_t offset =
-              base_offset +
-              NUM_COUNTERS_PER_CATEGORY * context->shader_core_indices[j] +
-              context->counter_indices[i];
-          total += context->query_buffer[offset];
-        }
-        values[i] = total;
-      } break;
-    }
+  // Drain all dumps the kernel driver has produced since the last wake-up.
+  uint32_t count = 0;
+  while (count < max_num_samples) {
+    uint64_t *sample_values = values + (size_t)count * context->num_counters;
+    status = mali_context_extract_ready_counters(context, &timestamps[count],
+                                                 sample_values, NULL);
+    if (status < 0) return status;
+    if (status == 0) break;
+    *num_samples = ++count;
   }
 
   return 0;
@@ -17,6 +17,7 @@
 #ifndef HPC_GPU_MALI_CONTEXT_H_
 #define HPC_GPU_MALI_CONTEXT_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "hpc/gpu/base_utilities.h"
@@ -57,10 +58,51 @@ hpc_gpu_mali_counter_layout_t hpc_gpu_mali_get_counter_layout(uint16_t gpu_id);
 typedef struct hpc_gpu_mali_context_t hpc_gpu_mali_context_t;
 
 /// Function pointer for converting a counter enum value to counter index in the
-/// given layout.
+/// given layout. It returns ~0u for counters not available in the layout.
 typedef uint32_t (*convert_counter_fn)(uint32_t counter,
                                        hpc_gpu_mali_counter_layout_t layout);
 
+/// Returns the size and alignment of the memory needed by a context for the
+/// given number of counters.
+///
+/// The size is an upper bound covering the largest supported shader core and
+/// L2 slice topology, as the actual topology is only known after opening the
+/// GPU device.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[out] size         The number of bytes needed.
+/// @param[out] alignment    The required alignment of the memory in bytes.
+void hpc_gpu_mali_get_context_memory_requirements(uint32_t num_counters,
+                                                  size_t *size,
+                                                  size_t *alignment);
+
+/// Creates a context for Mali GPU counters in the given memory.
+///
+/// The context, its gather plan, and the scratch space used during creation
+/// are laid out in `memory`, which must satisfy
+/// `hpc_gpu_mali_get_context_memory_requirements` and outlive the context. No
+/// host memory is allocated.
+///
+/// @param[in]  num_counters The number of counters to sample later.
+/// @param[in]  counters     The pointer to the list of counters to sample
+///                          later.
+/// @param[in]  memory       The memory for holding the context.
+/// @param[out] out_context  The pointer to the object receiving the resultant
+///                          context.
+int hpc_gpu_mali_create_context_in_memory(
+    uint32_t num_counters, uint32_t *counters,
+    convert_counter_fn convert_counter, void *memory,
+    hpc_gpu_mali_context_t **out_context);
+
+/// Destroys the context for Mali GPU counters created in caller-provided
+/// memory. The memory itself is left to the caller.
+///
+/// Teardown continues past failures so that the device is always released;
+/// the first error is returned.
+///
+/// @param[in] context The counter sampling context.
+int hpc_gpu_mali_destroy_context_in_memory(hpc_gpu_mali_context_t *context);
+
 /// Creates a context for Mali GPU counters.
 ///
 /// @param[in]  num_counters The number of counters to sample later.
@@ -78,6 +120,8 @@ int hpc_gpu_mali_create_context(
 
 /// Destroys the context for Mali GPU counters.
 ///
+/// The context memory is freed even if the teardown reports an error.
+///
 /// @param[in] context   The counter sampling context.
 /// @param[in] allocator The allocator used to free allocated host memory.
 int hpc_gpu_mali_destroy_context(
@@ -93,9 +137,22 @@ int hpc_gpu_mali_context_start_counters(const hpc_gpu_mali_context_t *context);
 
 /// Stops sampling Mali GPU counters specified when creating the context.
 ///
+/// This also stops periodic dumping if it was started.
+///
 /// @param[in] context The counter sampling context.
 int hpc_gpu_mali_context_stop_counters(const hpc_gpu_mali_context_t *context);
 
+/// Starts sampling Mali GPU counters with dumps driven by the kernel driver.
+///
+/// This zeros the registered counters and then asks the kernel driver to dump
+/// them every `interval_ns` into its ring buffer. Samples are retrieved with
+/// `hpc_gpu_mali_context_query_counter_batch`.
+///
+/// @param[in] context     The counter sampling context.
+/// @param[in] interval_ns The dump interval in nanoseconds.
+int hpc_gpu_mali_context_start_periodic_counters(
+    const hpc_gpu_mali_context_t *context, uint32_t interval_ns);
+
 /// Samples Mali GPU counters specified when creating the context.
 ///
 /// @param[in]  context The counter sampling context.
@@ -106,6 +163,82 @@ int hpc_gpu_mali_context_stop_counters(const hpc_gpu_mali_context_t *context);
 int hpc_gpu_mali_context_query_counters(const hpc_gpu_mali_context_t *context,
                                         uint64_t *values);
 
+/// Samples Mali GPU counters like `hpc_gpu_mali_context_query_counters`, and
+/// reports when the sample was taken.
+///
+/// The host timestamps bracket requesting the dump and waiting for it. Mali
+/// GPUs have no clock reference counter, so `gpu_clock_cycles` is always 0.
+///
+/// @param[in]  context The counter sampling context.
+/// @param[out] values  The pointer to the memory for receiving newly sampled
+///                     values, as `hpc_gpu_mali_context_query_counters`.
+/// @param[out] times   The pointer to the object receiving sample times.
+int hpc_gpu_mali_context_query_counters_with_times(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    hpc_gpu_sample_times_t *times);
+
+/// Returns the dimensions of the breakdown matrices written by
+/// `hpc_gpu_mali_context_query_counter_breakdown`.
+///
+/// @param[in]  context                  The counter sampling context.
+/// @param[out] num_shader_core_counters The number of requested shader core
+///                                      counters.
+/// @param[out] num_shader_cores         The number of enabled shader cores.
+/// @param[out] num_l2_slice_counters    The number of requested L2 slice
+///                                      (memory) counters.
+/// @param[out] num_l2_slices            The number of L2 slices.
+void hpc_gpu_mali_context_get_breakdown_dimensions(
+    const hpc_gpu_mali_context_t *context, uint32_t *num_shader_core_counters,
+    uint32_t *num_shader_cores, uint32_t *num_l2_slice_counters,
+    uint32_t *num_l2_slices);
+
+/// Samples Mali GPU counters specified when creating the context, together
+/// with the value from each enabled shader core and each L2 slice.
+///
+/// The breakdown matrices have one row per requested shader core or L2 slice
+/// counter, in the order they were requested, and one column per enabled
+/// shader core or L2 slice. Values are read once from the kernel buffer;
+/// totals are accumulated while the matrices are written.
+///
+/// @param[in]  context            The counter sampling context.
+/// @param[out] values             The pointer to the memory for receiving
+///                                totals, as `*_query_counters` does.
+/// @param[out] shader_core_values The pointer to the memory for receiving the
+///                                `num_shader_core_counters x
+///                                num_shader_cores` matrix.
+/// @param[out] l2_slice_values    The pointer to the memory for receiving the
+///                                `num_l2_slice_counters x num_l2_slices`
+///                                matrix.
+int hpc_gpu_mali_context_query_counter_breakdown(
+    const hpc_gpu_mali_context_t *context, uint64_t *values,
+    uint64_t *shader_core_values, uint64_t *l2_slice_values);
+
+/// Retrieves all Mali GPU counter samples periodically dumped by the kernel
+/// driver since the last call.
+///
+/// This blocks until at least one dump is ready, then drains as many ready
+/// dumps as possible, oldest first.
+///
+/// The kernel driver takes these dumps on its own timer, not during this
+/// call, so there are no host times bracketing them as with
+/// `*_query_counters_with_times`. The kernel driver's timestamp is the only
+/// sample time.
+///
+/// @param[in]  context         The counter sampling context.
+/// @param[in]  max_num_samples The maximal number of samples to retrieve.
+/// @param[out] timestamps      The pointer to the memory for receiving the
+///                             kernel driver's timestamp for each sample. Its
+///                             element count should be at least
+///                             `max_num_samples`.
+/// @param[out] values          The pointer to the memory for receiving
+///                             sampled values, one row of `num_counters` per
+///                             sample. Its element count should be at least
+///                             `max_num_samples * num_counters`.
+/// @param[out] num_samples     The number of retrieved samples.
+int hpc_gpu_mali_context_query_counter_batch(
+    const hpc_gpu_mali_context_t *context, uint32_t max_num_samples,
+    uint64_t *timestamps, uint64_t *values, uint32_t *num_samples);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_COUNTER_CONVERSION_H_
+#define HPC_GPU_MALI_COUNTER_CONVERSION_H_
+
+#include <stdint.h>
+
+#include "context.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Converts a counter enum value of each series to its counter index in the
+/// given layout. Returns ~0u if the counter is not available in the layout.
+///
+/// These forward to the generated conversion tables used when creating
+/// contexts, so that they can be benchmarked in isolation.
+///
+/// @param[in] counter The counter enum value of the series.
+/// @param[in] layout  The counter layout of the current GPU.
+uint32_t hpc_gpu_mali_common_convert_counter(
+    uint32_t counter, hpc_gpu_mali_counter_layout_t layout);
+uint32_t hpc_gpu_mali_valhall_convert_counter(
+    uint32_t counter, hpc_gpu_mali_counter_layout_t layout);
+uint32_t hpc_gpu_mali_bifrost_convert_counter(
+    uint32_t counter, hpc_gpu_mali_counter_layout_t layout);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_MALI_COUNTER_CONVERSION_H_
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+
+#include "context.h"
+#include "driver_ioctl.h"
+
+/// The process-wide Mali GPU device. Systems only have one.
+typedef struct mali_device_registry_t {
+  pthread_mutex_t mutex;
+  /// The file descriptor for the GPU device, if open.
+  int gpu_device;
+  /// The number of outstanding acquisitions. The device is open iff nonzero.
+  uint32_t refcount;
+  /// Whether `device_info` and `layout` were probed.
+  int probed;
+  /// The backend generation `device_info` and `layout` were probed with.
+  uint32_t probed_backend_generation;
+  /// The cached GPU device information.
+  hpc_gpu_mali_ioctl_gpu_device_info_t device_info;
+  /// The cached counter layout.
+  hpc_gpu_mali_counter_layout_t layout;
+} mali_device_registry_t;
+
+static mali_device_registry_t device_registry = {
+    PTHREAD_MUTEX_INITIALIZER, -1, 0, 0, 0};
+
+/// Opens the GPU device and sets it up for talking with the kernel driver.
+static int mali_open_device(void) {
+  int gpu_device = hpc_gpu_mali_ioctl_open_gpu_device();
+  if (gpu_device < 0) return gpu_device;
+
+  // First negotiate API version with the kernel driver. Feeding in 0.0 means to
+  // accept whatever version the kernel driver is at, as it does not really
+  // matter for us. But we still need to perform this step because the kernel
+  // driver needs to initialize API version inside.
+  uint16_t major_version = 0, minor_version = 0;
+  int status = hpc_gpu_mali_ioctl_setup_api_version(gpu_device, &major_version,
+                                                    &minor_version);
+
+  // Then setup the kernel API context. This is also necessary for future
+  // interactions with the kernel driver.
+  if (status == 0) status = hpc_gpu_mali_ioctl_setup_api_context(gpu_device);
+
+  if (status < 0) {
+    int error = errno;
+    hpc_gpu_mali_ioctl_close_gpu_device(gpu_device);
+    errno = error;
+    return status;
+  }
+  return gpu_device;
+}
+
+/// Does the work of `hpc_gpu_mali_acquire_device` with the registry locked.
+static int mali_acquire_device_locked(
+    mali_device_registry_t *registry, int *gpu_device,
+    hpc_gpu_mali_ioctl_gpu_device_info_t *device_info,
+    hpc_gpu_mali_counter_layout_t *layout) {
+  int opened = 0;
+  if (registry->refcount == 0) {
+    int device = mali_open_device();
+    if (device < 0) return device;
+    registry->gpu_device = device;
+    opened = 1;
+  }
+
+  uint32_t generation = hpc_gpu_mali_ioctl_get_backend_generation();
+  if (!registry->probed || registry->probed_backend_generation != generation) {
+    // Query device information to figure out which GPU product this is.
+    int status = hpc_gpu_mali_ioctl_get_gpu_device_info(
+        registry->gpu_device, NULL, &registry->device_info);
+    if (status < 0) {
+      registry->probed = 0;
+      if (opened) {
+        int error = errno;
+        hpc_gpu_mali_ioctl_close_gpu_device(registry->gpu_device);
+        registry->gpu_device = -1;
+        errno = error;
+      }
+      return status;
+    }
+    registry->layout = hpc_gpu_mali_get_counter_layout(
+        (uint16_t)registry->device_info.gpu_product_id);
+    registry->probed = 1;
+    registry->probed_backend_generation = generation;
+  }
+
+  ++registry->refcount;
+  *gpu_device = registry->gpu_device;
+  *device_info = registry->device_info;
+  *layout = registry->layout;
+  return 0;
+}
+
+int hpc_gpu_mali_acquire_device(
+    int *gpu_device, hpc_gpu_mali_ioctl_gpu_device_info_t *device_info,
+    hpc_gpu_mali_counter_layout_t *layout) {
+  pthread_mutex_lock(&device_registry.mutex);
+  int status = mali_acquire_device_locked(&device_registry, gpu_device,
+                                          device_info, layout);
+  pthread_mutex_unlock(&device_registry.mutex);
+  return status;
+}
+
+int hpc_gpu_mali_release_device(int gpu_device) {
+  mali_device_registry_t *registry = &device_registry;
+  pthread_mutex_lock(&registry->mutex);
+
+  int status = 0;
+  if (registry->refcount == 0 || registry->gpu_device != gpu_device) {
+    errno = EINVAL;
+    status = -1;
+  } else if (--registry->refcount == 0) {
+    status = hpc_gpu_mali_ioctl_close_gpu_device(gpu_device);
+    registry->gpu_device = -1;
+  }
+
+  pthread_mutex_unlock(&registry->mutex);
+  return status;
+}
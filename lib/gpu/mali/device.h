@@ -0,0 +1,54 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_DEVICE_H_
+#define HPC_GPU_MALI_DEVICE_H_
+
+#include <stdint.h>
+
+#include "context.h"
+#include "driver_ioctl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// Acquires the process-wide Mali GPU device.
+///
+/// The device is opened and set up (API version handshake and context
+/// creation flags) on the first acquisition, and shared by all later ones
+/// until the last release. Device information and the counter layout are
+/// probed once and cached until the driver backend changes, even across
+/// closing and reopening the device.
+///
+/// @param[out] gpu_device  The file descriptor for the GPU device.
+/// @param[out] device_info The GPU device information.
+/// @param[out] layout      The counter layout of the GPU.
+int hpc_gpu_mali_acquire_device(
+    int *gpu_device, hpc_gpu_mali_ioctl_gpu_device_info_t *device_info,
+    hpc_gpu_mali_counter_layout_t *layout);
+
+/// Releases the device acquired by `hpc_gpu_mali_acquire_device`. The last
+/// release closes it.
+///
+/// @param[in] gpu_device The file descriptor for the GPU device.
+int hpc_gpu_mali_release_device(int gpu_device);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_MALI_DEVICE_H_
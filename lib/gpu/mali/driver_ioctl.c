@@ -23,22 +23,75 @@
 #include <string.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
-#include <sys/poll.h>
 #include <unistd.h>
 
 #include "hpc/gpu/base_utilities.h"
 #include "hwcpipe/mali_driver_ioctl.h"
 
+//===----------------------------------------------------------------------===//
+// Backend dispatch
+//===----------------------------------------------------------------------===//
+
+static int kbase_open(void *user_data) { return open("/dev/mali0", O_RDWR); }
+
+static int kbase_close(void *user_data, int fd) { return close(fd); }
+
+static int kbase_ioctl(void *user_data, int fd, unsigned long request,
+                       void *arg) {
+  return ioctl(fd, request, arg);
+}
+
+static void *kbase_mmap(void *user_data, int fd, size_t size) {
+  return mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+}
+
+static int kbase_munmap(void *user_data, void *address, size_t size) {
+  return munmap(address, size);
+}
+
+static int kbase_poll(void *user_data, struct pollfd *fds, nfds_t num_fds,
+                      int timeout) {
+  return poll(fds, num_fds, timeout);
+}
+
+static const hpc_gpu_mali_ioctl_backend_t kbase_backend = {
+    NULL,
+    kbase_open,
+    kbase_close,
+    kbase_ioctl,
+    kbase_mmap,
+    kbase_munmap,
+    kbase_poll,
+};
+
+static const hpc_gpu_mali_ioctl_backend_t *current_backend = &kbase_backend;
+/// Bumped whenever the backend changes.
+static uint32_t current_backend_generation = 0;
+
+void hpc_gpu_mali_ioctl_set_backend(
+    const hpc_gpu_mali_ioctl_backend_t *backend) {
+  current_backend = backend ? backend : &kbase_backend;
+  ++current_backend_generation;
+}
+
+uint32_t hpc_gpu_mali_ioctl_get_backend_generation(void) {
+  return current_backend_generation;
+}
+
+static inline int mali_ioctl(int fd, unsigned long request, void *arg) {
+  return current_backend->ioctl(current_backend->user_data, fd, request, arg);
+}
+
 //===----------------------------------------------------------------------===//
 // Open/close device
 //===----------------------------------------------------------------------===//
 
 int hpc_gpu_mali_ioctl_open_gpu_device(void) {
-  return open("/dev/mali0", O_RDWR);
+  return current_backend->open(current_backend->user_data);
 }
 
 int hpc_gpu_mali_ioctl_close_gpu_device(int gpu_device) {
-  return close(gpu_device);
+  return current_backend->close(current_backend->user_data, gpu_device);
 }
 
 //===----------------------------------------------------------------------===//
@@ -50,7 +103,8 @@ int hpc_gpu_mali_ioctl_setup_api_version(int gpu_device,
                                          uint16_t *minor_version) {
   struct mali_device_api_version api_version = {*major_version, *minor_version};
 
-  int status = ioctl(gpu_device, MALI_IOCTL_VERSION_HANDSHAKE, &api_version);
+  int status =
+      mali_ioctl(gpu_device, MALI_IOCTL_VERSION_HANDSHAKE, &api_version);
   if (status < 0) return status;
 
   *major_version = api_version.major;
@@ -62,7 +116,8 @@ int hpc_gpu_mali_ioctl_setup_api_context(int gpu_device) {
   struct mali_context_set_creation_flags flags;
   // We just want to sample counters. So disable submission.
   flags.flags = MALI_CONTEXT_DISABLE_SUBMISSION;
-  return ioctl(gpu_device, MALI_IOCTL_SET_CONTEXT_CREATION_FLAGS, &flags);
+  return mali_ioctl(gpu_device, MALI_IOCTL_SET_CONTEXT_CREATION_FLAGS,
+                    &flags);
 }
 
 //===----------------------------------------------------------------------===//
@@ -75,16 +130,27 @@ int hpc_gpu_mali_ioctl_get_gpu_device_info(
   struct mali_device_get_property properties;
   memset(&properties, 0, sizeof(struct mali_device_get_property));
 
-  // First query the size of all properties and allocate such a buffer.
+  // First query the size of all properties. They normally take a few hundred
+  // bytes, so decode them on the stack unless they don't fit.
   int buffer_size =
-      ioctl(gpu_device, MALI_IOCTL_DEVICE_GET_ROPERTY, &properties);
-  void *buffer = allocator->alloc(allocator->user_data, buffer_size);
+      mali_ioctl(gpu_device, MALI_IOCTL_DEVICE_GET_ROPERTY, &properties);
+  if (buffer_size < 0) return buffer_size;
+  uint8_t stack_buffer[4096];
+  void *buffer = stack_buffer;
+  if (buffer_size > sizeof(stack_buffer)) {
+    if (!allocator) return -HPC_GPU_ERROR_INTERNAL;
+    buffer = allocator->alloc(allocator->user_data, buffer_size);
+  }
 
   // Then get all properties.
   properties.buffer = (uint64_t)buffer;
   properties.buffer_size = buffer_size;
-  int status = ioctl(gpu_device, MALI_IOCTL_DEVICE_GET_ROPERTY, &properties);
-  if (status < 0) return status;
+  int status =
+      mali_ioctl(gpu_device, MALI_IOCTL_DEVICE_GET_ROPERTY, &properties);
+  if (status < 0) {
+    if (buffer != stack_buffer) allocator->free(allocator->user_data, buffer);
+    return status;
+  }
 
   // Clear output info struct.
   memset(info, 0, sizeof(hpc_gpu_mali_ioctl_gpu_device_info_t));
@@ -136,7 +202,7 @@ int hpc_gpu_mali_ioctl_get_gpu_device_info(
     }
   }
 
-  allocator->free(allocator->user_data, buffer);
+  if (buffer != stack_buffer) allocator->free(allocator->user_data, buffer);
   return 0;
 }
 
@@ -152,13 +218,14 @@ int hpc_gpu_mali_ioctl_open_counter_reader(
   // continue dumping.
   const uint32_t buffer_count = 16;
   struct mali_counter_reader_setup setup = {buffer_count, ~0u, ~0u, ~0u, ~0u};
-  int reader = ioctl(gpu_device, MALI_IOCTL_COUNTER_SETUP_READER, &setup);
+  int reader = mali_ioctl(gpu_device, MALI_IOCTL_COUNTER_SETUP_READER, &setup);
   if (reader < 0) return reader;
 
   uint32_t version;
 
   // Make sure the driver is at the same API version.
-  int status = ioctl(reader, MALI_COUNTER_READER_GET_API_VERSION, &version);
+  int status =
+      mali_ioctl(reader, MALI_COUNTER_READER_GET_API_VERSION, &version);
   if (status < 0) return status;
   if (version != MALI_COUNTER_READER_API_VERSION) {
     return -HPC_GPU_ERROR_INCOMPATIBLE_DEVICE;
@@ -166,17 +233,19 @@ int hpc_gpu_mali_ioctl_open_counter_reader(
 
   // Mali-T6xx or Mali-T72x are v4 GPU devices. They are quite old.
   // Don't support them right now.
-  status = ioctl(reader, MALI_COUNTER_READER_GET_HARDWARE_VERSION, &version);
+  status =
+      mali_ioctl(reader, MALI_COUNTER_READER_GET_HARDWARE_VERSION, &version);
   if (status < 0) return status;
   if (version < 5) return -HPC_GPU_ERROR_INCOMPATIBLE_DEVICE;
 
   uint32_t buffer_size = 0;
-  status = ioctl(reader, MALI_COUNTER_READER_GET_BUFFER_SIZE, &buffer_size);
+  status =
+      mali_ioctl(reader, MALI_COUNTER_READER_GET_BUFFER_SIZE, &buffer_size);
   if (status < 0) return status;
 
   // Get a pointer to the counter buffers in the kernel.
-  uint8_t *buffer =
-      mmap(NULL, buffer_count * buffer_size, PROT_READ, MAP_PRIVATE, reader, 0);
+  uint8_t *buffer = current_backend->mmap(current_backend->user_data, reader,
+                                          buffer_count * buffer_size);
   if (buffer == MAP_FAILED) return errno;
 
   counter_reader->reader_fd = reader;
@@ -188,7 +257,17 @@ int hpc_gpu_mali_ioctl_open_counter_reader(
 
 int hpc_gpu_mali_ioctl_close_counter_reader(
     const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader) {
-  return close(counter_reader->reader_fd);
+  int status = current_backend->munmap(
+      current_backend->user_data, counter_reader->whole_kernel_buffer,
+      counter_reader->buffer_count * counter_reader->single_buffer_size);
+  int error = errno;
+  int close_status = current_backend->close(current_backend->user_data,
+                                            counter_reader->reader_fd);
+  if (status < 0) {
+    errno = error;
+    return status;
+  }
+  return close_status;
 }
 
 //===----------------------------------------------------------------------===//
@@ -198,40 +277,67 @@ int hpc_gpu_mali_ioctl_close_counter_reader(
 int hpc_gpu_mali_ioctl_zero_counters(
     const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader) {
   int reader = counter_reader->reader_fd;
-  return ioctl(reader, MALI_COUNTER_READER_CLEAR, 0);
+  return mali_ioctl(reader, MALI_COUNTER_READER_CLEAR, NULL);
 }
 
-int hpc_gpu_mali_ioctl_query_counters(
-    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader, uint32_t *values,
-    uint64_t *timestamp) {
+int hpc_gpu_mali_ioctl_dump_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader) {
   int reader = counter_reader->reader_fd;
-  int status = ioctl(reader, MALI_COUNTER_READER_DUMP, 0);
-  if (status < 0) return status;
+  return mali_ioctl(reader, MALI_COUNTER_READER_DUMP, NULL);
+}
 
+int hpc_gpu_mali_ioctl_wait_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader) {
   struct pollfd poll_counters;
-  poll_counters.fd = reader;
+  poll_counters.fd = counter_reader->reader_fd;
   poll_counters.events = POLLIN;
   poll_counters.revents = 0;
 
-  status = poll(&poll_counters, 1, /*timeout=*/-1);
+  int status = current_backend->poll(current_backend->user_data,
+                                     &poll_counters, 1, /*timeout=*/-1);
   if (status < 0) return status;
   if (poll_counters.revents & POLLHUP) return -HPC_GPU_ERROR_DRIVER_HUNGUP;
+  return 0;
+}
 
-  if (poll_counters.revents & POLLIN) {
-    struct mali_counter_reader_metadata metadata;
-
-    status = ioctl(reader, MALI_COUNTER_READER_GET_BUFFER, &metadata);
-    if (status < 0) return status;
+int hpc_gpu_mali_ioctl_acquire_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader,
+    hpc_gpu_mali_ioctl_counter_dump_t *dump) {
+  int reader = counter_reader->reader_fd;
+  struct mali_counter_reader_metadata metadata;
+
+  // The kernel driver returns EAGAIN when no buffer is ready.
+  int status = mali_ioctl(reader, MALI_COUNTER_READER_GET_BUFFER, &metadata);
+  if (status < 0) return errno == EAGAIN ? 0 : status;
+
+  uint32_t offset = counter_reader->single_buffer_size * metadata.buffer_index;
+  dump->values =
+      (const uint32_t *)(counter_reader->whole_kernel_buffer + offset);
+  dump->timestamp = metadata.timestamp;
+  dump->event_id = metadata.event_id;
+  dump->buffer_index = metadata.buffer_index;
+  return 1;
+}
 
-    uint32_t offset =
-        counter_reader->single_buffer_size * metadata.buffer_index;
-    memcpy(values, counter_reader->whole_kernel_buffer + offset,
-           counter_reader->single_buffer_size);
-    *timestamp = metadata.timestamp;
+int hpc_gpu_mali_ioctl_release_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader,
+    const hpc_gpu_mali_ioctl_counter_dump_t *dump) {
+  struct mali_counter_reader_metadata metadata;
+  metadata.timestamp = dump->timestamp;
+  metadata.event_id = dump->event_id;
+  metadata.buffer_index = dump->buffer_index;
+  return mali_ioctl(counter_reader->reader_fd, MALI_COUNTER_READER_PUT_BUFFER,
+                    &metadata);
+}
 
-    status = ioctl(reader, MALI_COUNTER_READER_PUT_BUFFER, &metadata);
-    if (status < 0) return status;
-  }
+//===----------------------------------------------------------------------===//
+// Periodic dumps
+//===----------------------------------------------------------------------===//
 
-  return 0;
+int hpc_gpu_mali_ioctl_set_dump_interval(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader,
+    uint32_t interval_ns) {
+  int reader = counter_reader->reader_fd;
+  return mali_ioctl(reader, MALI_COUNTER_READER_SET_INTERVAL,
+                    (void *)(uintptr_t)interval_ns);
 }
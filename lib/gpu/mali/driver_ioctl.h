@@ -17,6 +17,8 @@
 #ifndef HPC_GPU_MALI_DRIVER_IOCTL_H_
 #define HPC_GPU_MALI_DRIVER_IOCTL_H_
 
+#include <poll.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "hpc/gpu/base_utilities.h"
@@ -25,6 +27,41 @@
 extern "C" {
 #endif  // __cplusplus
 
+/// Function table implementing the system calls made to the Mali kernel
+/// driver.
+///
+/// By default calls go to the kbase kernel driver via `/dev/mali0`. Other
+/// backends, e.g., a simulated driver, can be installed to exercise sampling
+/// logic without Mali GPUs. A backend sees the same requests and payloads as
+/// the kernel driver and reports errors the same way: returning -1 and
+/// setting `errno`.
+typedef struct hpc_gpu_mali_ioctl_backend_t {
+  /// The user data passed to all functions in the table.
+  void *user_data;
+  /// Opens the GPU device.
+  int (*open)(void *user_data);
+  int (*close)(void *user_data, int fd);
+  int (*ioctl)(void *user_data, int fd, unsigned long request, void *arg);
+  /// Maps the counter reader's ring buffer for reading.
+  void *(*mmap)(void *user_data, int fd, size_t size);
+  int (*munmap)(void *user_data, void *address, size_t size);
+  int (*poll)(void *user_data, struct pollfd *fds, nfds_t num_fds,
+              int timeout);
+} hpc_gpu_mali_ioctl_backend_t;
+
+/// Routes all Mali driver calls to the given backend.
+///
+/// This should only be called when no GPU device is open.
+///
+/// @param[in] backend The backend to use, or NULL to restore the kbase kernel
+///                    driver. It must outlive all devices opened through it.
+void hpc_gpu_mali_ioctl_set_backend(
+    const hpc_gpu_mali_ioctl_backend_t *backend);
+
+/// Returns a number that changes whenever the backend changes, so that
+/// information probed from devices can be cached until then.
+uint32_t hpc_gpu_mali_ioctl_get_backend_generation(void);
+
 /// Opens the Mali GPU device in the current system.
 int hpc_gpu_mali_ioctl_open_gpu_device(void);
 
@@ -66,8 +103,12 @@ typedef struct hpc_gpu_mali_ioctl_gpu_device_info_t {
 
 /// Gets the Mali GPU device information.
 ///
+/// Properties are decoded from a stack buffer; host memory is only allocated
+/// if the kernel driver reports unusually many of them.
+///
 /// @param[in]  gpu_device The file descriptor for the GPU device.
-/// @param[in]  allocator  Allocator for managing host memory.
+/// @param[in]  allocator  Allocator for managing host memory. It can be NULL,
+///                        in which case too many properties is an error.
 /// @param[out] info       Mali GPU device information.
 int hpc_gpu_mali_ioctl_get_gpu_device_info(
     int gpu_device, const hpc_gpu_host_allocation_callbacks_t *allocator,
@@ -99,7 +140,8 @@ typedef struct hpc_gpu_mali_ioctl_counter_reader_t {
 int hpc_gpu_mali_ioctl_open_counter_reader(
     int gpu_device, hpc_gpu_mali_ioctl_counter_reader_t *counter_reader);
 
-/// Closes the given counter reader.
+/// Closes the given counter reader. The reader is closed even if unmapping
+/// its buffer fails, and the first error is returned.
 int hpc_gpu_mali_ioctl_close_counter_reader(
     const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader);
 
@@ -107,18 +149,66 @@ int hpc_gpu_mali_ioctl_close_counter_reader(
 int hpc_gpu_mali_ioctl_zero_counters(
     const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader);
 
-/// Samples all Mali counters.
+/// Asks the kernel driver to dump all Mali counters into the ring buffer.
+///
+/// The dump becomes ready asynchronously; use
+/// `hpc_gpu_mali_ioctl_wait_counters` to wait for it.
 ///
-/// This samples all available counters on the GPU and returns them via
-/// `values`. It's the caller's responsibility to extract the interesting
-/// counters.
+/// @param[in] counter_reader The Mali GPU counter reader's information.
+int hpc_gpu_mali_ioctl_dump_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader);
+
+/// Sets the interval for the kernel driver to periodically dump counters.
+///
+/// Once set, the kernel driver dumps counters into the ring buffer on its own
+/// timer, without requiring user space to request each dump.
+///
+/// @param[in] counter_reader The Mali GPU counter reader's information.
+/// @param[in] interval_ns    The dump interval in nanoseconds. 0 disables
+///                           periodic dumping.
+int hpc_gpu_mali_ioctl_set_dump_interval(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader,
+    uint32_t interval_ns);
+
+/// Waits until at least one counter dump is ready in the ring buffer.
+///
+/// @param[in] counter_reader The Mali GPU counter reader's information.
+int hpc_gpu_mali_ioctl_wait_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader);
+
+/// One counter dump held in the kernel driver's ring buffer.
+typedef struct hpc_gpu_mali_ioctl_counter_dump_t {
+  /// The pointer to all counters in the dump. This points directly into the
+  /// mmapped kernel buffer and is only valid until the dump is released.
+  const uint32_t *values;
+  /// The timestamp for the sampling.
+  uint64_t timestamp;
+  /// The kernel driver's metadata identifying the dump.
+  uint32_t event_id;
+  uint32_t buffer_index;
+} hpc_gpu_mali_ioctl_counter_dump_t;
+
+/// Acquires the oldest ready counter dump in the ring buffer, if any.
+///
+/// This does not wait; it returns 1 if a dump was acquired, 0 if no dump is
+/// ready, and a negative value on errors. An acquired dump must be released
+/// with `hpc_gpu_mali_ioctl_release_counters` so the kernel driver can reuse
+/// its buffer. It's the caller's responsibility to extract the interesting
+/// counters before that.
 ///
 /// @param[in]  counter_reader The Mali GPU counter reader's information.
-/// @param[out] values         The pointer to recipient buffer for one sample.
-/// @param[out] timestamp      THe timestamp for the sampling.
-int hpc_gpu_mali_ioctl_query_counters(
-    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader, uint32_t *values,
-    uint64_t *timestamp);
+/// @param[out] dump           The acquired dump.
+int hpc_gpu_mali_ioctl_acquire_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader,
+    hpc_gpu_mali_ioctl_counter_dump_t *dump);
+
+/// Releases a counter dump back to the kernel driver.
+///
+/// @param[in] counter_reader The Mali GPU counter reader's information.
+/// @param[in] dump           The dump to release.
+int hpc_gpu_mali_ioctl_release_counters(
+    const hpc_gpu_mali_ioctl_counter_reader_t *counter_reader,
+    const hpc_gpu_mali_ioctl_counter_dump_t *dump);
 
 #ifdef __cplusplus
 }  // extern "C"
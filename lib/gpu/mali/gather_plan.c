@@ -0,0 +1,265 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gather_plan.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "block_sum.h"
+#include "hpc/gpu/base_utilities.h"
+
+static uint32_t popcount(uint32_t x) {
+  uint32_t count = 0;
+  for (; x != 0; x >>= 1) count += (x & 1u);
+  return count;
+}
+
+/// Returns the number of blocks summed for counters in the given block.
+static uint32_t gather_get_num_offsets(hpc_gpu_mali_gather_block_t block,
+                                       uint32_t num_l2_slices,
+                                       uint32_t num_shader_cores) {
+  switch (block) {
+    case HPC_GPU_MALI_GATHER_BLOCK_JOB_MANAGER:
+    case HPC_GPU_MALI_GATHER_BLOCK_TILER:
+      return 1;
+    case HPC_GPU_MALI_GATHER_BLOCK_MEMORY:
+      return num_l2_slices;
+    case HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE:
+      return num_shader_cores;
+  }
+  return 0;
+}
+
+/// Sets up the block plan for all counters in the given block kind, taking its
+/// lists from `*storage`. Block sums are used if there are at least
+/// `threshold` of them.
+static void gather_init_block_plan(hpc_gpu_mali_gather_block_t block_kind,
+                                   uint32_t num_counters,
+                                   const uint32_t *blocks,
+                                   const uint32_t *indices, uint32_t threshold,
+                                   uint32_t num_blocks,
+                                   const uint32_t *block_offsets,
+                                   uint32_t **storage,
+                                   hpc_gpu_mali_block_plan_t *plan) {
+  memset(plan, 0, sizeof(hpc_gpu_mali_block_plan_t));
+
+  uint32_t count = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) count += blocks[i] == block_kind;
+  if (count == 0) return;
+  plan->use_block_sum = count >= threshold;
+
+  plan->block_offsets = *storage;
+  memcpy(plan->block_offsets, block_offsets, num_blocks * sizeof(uint32_t));
+  plan->num_blocks = num_blocks;
+  plan->slots = plan->block_offsets + num_blocks;
+  plan->indices = plan->slots + count;
+  *storage = plan->indices + count;
+
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    if (blocks[i] != block_kind) continue;
+    plan->slots[plan->num_counters] = i;
+    plan->indices[plan->num_counters++] = indices[i];
+  }
+}
+
+/// Sums all blocks in the plan and picks requested counters into `values`, if
+/// the plan uses block sums.
+static void gather_execute_block_sum_plan(
+    const hpc_gpu_mali_block_plan_t *plan,
+    hpc_gpu_mali_block_sum_function block_sum, const uint32_t *buffer,
+    uint64_t *values) {
+  if (!plan->use_block_sum) return;
+
+  uint64_t sums[HPC_GPU_MALI_NUM_COUNTERS_PER_BLOCK];
+  block_sum(buffer, plan->block_offsets, plan->num_blocks, sums);
+  for (uint32_t i = 0; i < plan->num_counters; ++i) {
+    values[plan->slots[i]] = sums[plan->indices[i]];
+  }
+}
+
+size_t hpc_gpu_mali_get_gather_plan_size(uint32_t num_counters) {
+  // Offset list starts, single block slots, two block plans, and at most one
+  // offset per block for each counter.
+  size_t num_elements = (num_counters + 1) + num_counters +
+                        2 * (HPC_GPU_MALI_MAX_NUM_BLOCKS + 2 * num_counters) +
+                        (size_t)num_counters * HPC_GPU_MALI_MAX_NUM_BLOCKS;
+  return num_elements * sizeof(uint32_t);
+}
+
+int hpc_gpu_mali_init_gather_plan(
+    uint32_t num_counters, const uint32_t *blocks, const uint32_t *indices,
+    uint32_t num_l2_slices, uint32_t shader_core_mask,
+    uint32_t block_sum_threshold, void *memory,
+    hpc_gpu_mali_gather_plan_t *plan) {
+  const uint32_t block_size = HPC_GPU_MALI_NUM_COUNTERS_PER_BLOCK;
+  if (num_l2_slices > HPC_GPU_MALI_MAX_NUM_BLOCKS) {
+    return -HPC_GPU_ERROR_INCOMPATIBLE_DEVICE;
+  }
+
+  // All lists are carved from `memory` in order, starting with the offset
+  // list starts.
+  uint32_t *storage = (uint32_t *)memory;
+  uint32_t *offset_starts = storage;
+  storage += num_counters + 1;
+  uint32_t *single_block_slots = storage;
+  storage += num_counters;
+
+  // Resolve where each L2 slice and enabled shader core block lives. Shader
+  // cores off in the mask still occupy blocks; skip them.
+  uint32_t l2_offsets[HPC_GPU_MALI_MAX_NUM_BLOCKS];
+  uint32_t shader_core_offsets[HPC_GPU_MALI_MAX_NUM_BLOCKS];
+  uint32_t num_shader_cores = popcount(shader_core_mask);
+  for (uint32_t i = 0; i < num_l2_slices; ++i) {
+    l2_offsets[i] = block_size * (2 + i);
+  }
+  for (uint32_t index = 0, i = 0; i < 32; ++i) {
+    if (!(shader_core_mask & (1u << i))) continue;
+    shader_core_offsets[index++] = block_size * (2 + num_l2_slices + i);
+  }
+
+  gather_init_block_plan(HPC_GPU_MALI_GATHER_BLOCK_MEMORY, num_counters,
+                         blocks, indices, block_sum_threshold, num_l2_slices,
+                         l2_offsets, &storage, &plan->memory_blocks);
+  gather_init_block_plan(HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE, num_counters,
+                         blocks, indices, block_sum_threshold,
+                         num_shader_cores, shader_core_offsets, &storage,
+                         &plan->shader_core_blocks);
+  plan->block_sum = hpc_gpu_mali_get_block_sum_function();
+
+  // Counters covered by block sums get empty offset lists.
+  uint32_t num_summed_l2_slices =
+      plan->memory_blocks.use_block_sum ? 0 : num_l2_slices;
+  uint32_t num_summed_shader_cores =
+      plan->shader_core_blocks.use_block_sum ? 0 : num_shader_cores;
+
+  // First pass: lay out where each counter's offsets start.
+  uint32_t num_offsets = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    offset_starts[i] = num_offsets;
+    num_offsets += gather_get_num_offsets(
+        (hpc_gpu_mali_gather_block_t)blocks[i], num_summed_l2_slices,
+        num_summed_shader_cores);
+  }
+  offset_starts[num_counters] = num_offsets;
+
+  // Second pass: resolve each counter to its offsets in the dump.
+  uint32_t *offsets = storage;
+  plan->single_block_slots = single_block_slots;
+  plan->num_single_block_slots = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint32_t *counter_offsets = offsets + offset_starts[i];
+    switch ((hpc_gpu_mali_gather_block_t)blocks[i]) {
+      case HPC_GPU_MALI_GATHER_BLOCK_JOB_MANAGER: {
+        counter_offsets[0] = indices[i];
+        single_block_slots[plan->num_single_block_slots++] = i;
+      } break;
+      case HPC_GPU_MALI_GATHER_BLOCK_TILER: {
+        counter_offsets[0] = block_size + indices[i];
+        single_block_slots[plan->num_single_block_slots++] = i;
+      } break;
+      case HPC_GPU_MALI_GATHER_BLOCK_MEMORY: {
+        for (uint32_t j = 0; j < num_summed_l2_slices; ++j) {
+          counter_offsets[j] = l2_offsets[j] + indices[i];
+        }
+      } break;
+      case HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE: {
+        for (uint32_t j = 0; j < num_summed_shader_cores; ++j) {
+          counter_offsets[j] = shader_core_offsets[j] + indices[i];
+        }
+      } break;
+    }
+  }
+
+  plan->num_counters = num_counters;
+  plan->offset_starts = offset_starts;
+  plan->offsets = offsets;
+  return 0;
+}
+
+int hpc_gpu_mali_create_gather_plan(
+    uint32_t num_counters, const uint32_t *blocks, const uint32_t *indices,
+    uint32_t num_l2_slices, uint32_t shader_core_mask,
+    uint32_t block_sum_threshold,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_gather_plan_t *plan) {
+  void *memory = allocator->alloc(
+      allocator->user_data, hpc_gpu_mali_get_gather_plan_size(num_counters));
+  int status = hpc_gpu_mali_init_gather_plan(
+      num_counters, blocks, indices, num_l2_slices, shader_core_mask,
+      block_sum_threshold, memory, plan);
+  if (status < 0) allocator->free(allocator->user_data, memory);
+  return status;
+}
+
+void hpc_gpu_mali_destroy_gather_plan(
+    hpc_gpu_mali_gather_plan_t *plan,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  // The offset list starts head the memory holding all lists.
+  allocator->free(allocator->user_data, plan->offset_starts);
+  memset(plan, 0, sizeof(hpc_gpu_mali_gather_plan_t));
+}
+
+void hpc_gpu_mali_gather_plan_execute(const hpc_gpu_mali_gather_plan_t *plan,
+                                      const uint32_t *buffer,
+                                      uint64_t *values) {
+  const uint32_t *offsets = plan->offsets;
+  uint32_t begin = plan->offset_starts[0];
+  for (uint32_t i = 0; i < plan->num_counters; ++i) {
+    uint32_t end = plan->offset_starts[i + 1];
+    uint64_t total = 0;
+    for (uint32_t j = begin; j < end; ++j) total += buffer[offsets[j]];
+    values[i] = total;
+    begin = end;
+  }
+
+  gather_execute_block_sum_plan(&plan->memory_blocks, plan->block_sum, buffer,
+                                values);
+  gather_execute_block_sum_plan(&plan->shader_core_blocks, plan->block_sum,
+                                buffer, values);
+}
+
+/// Writes one row per requested counter in the block plan, with the value
+/// from each block, and its total into `values`.
+static void gather_execute_block_breakdown(
+    const hpc_gpu_mali_block_plan_t *plan, const uint32_t *buffer,
+    uint64_t *values, uint64_t *breakdown) {
+  for (uint32_t i = 0; i < plan->num_counters; ++i) {
+    const uint32_t *counter = buffer + plan->indices[i];
+    uint64_t *row = breakdown + (size_t)i * plan->num_blocks;
+    uint64_t total = 0;
+    for (uint32_t j = 0; j < plan->num_blocks; ++j) {
+      row[j] = counter[plan->block_offsets[j]];
+      total += row[j];
+    }
+    values[plan->slots[i]] = total;
+  }
+}
+
+void hpc_gpu_mali_gather_plan_execute_breakdown(
+    const hpc_gpu_mali_gather_plan_t *plan, const uint32_t *buffer,
+    uint64_t *values, uint64_t *shader_core_values, uint64_t *l2_slice_values) {
+  for (uint32_t i = 0; i < plan->num_single_block_slots; ++i) {
+    uint32_t slot = plan->single_block_slots[i];
+    values[slot] = buffer[plan->offsets[plan->offset_starts[slot]]];
+  }
+
+  gather_execute_block_breakdown(&plan->memory_blocks, buffer, values,
+                                 l2_slice_values);
+  gather_execute_block_breakdown(&plan->shader_core_blocks, buffer, values,
+                                 shader_core_values);
+}
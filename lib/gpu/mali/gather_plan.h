@@ -0,0 +1,193 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HPC_GPU_MALI_GATHER_PLAN_H_
+#define HPC_GPU_MALI_GATHER_PLAN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "block_sum.h"
+#include "hpc/gpu/base_utilities.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+/// The maximal number of L2 slice or shader core blocks in a dump. The latter
+/// is the bitwidth of the shader core mask.
+#define HPC_GPU_MALI_MAX_NUM_BLOCKS 32u
+
+/// The number of counters requested from the L2 slices or shader cores at
+/// which summing whole blocks beats gathering each counter separately. Summing
+/// one block takes 16 vector adds with 4 64-bit lanes, or 32 with 2 lanes.
+#define HPC_GPU_MALI_BLOCK_SUM_THRESHOLD 16u
+
+/// The functionality block a counter belongs to. The values match the category
+/// encoded in counter enum values.
+typedef enum hpc_gpu_mali_gather_block_e {
+  HPC_GPU_MALI_GATHER_BLOCK_JOB_MANAGER = 0,
+  HPC_GPU_MALI_GATHER_BLOCK_TILER = 1,
+  HPC_GPU_MALI_GATHER_BLOCK_SHADER_CORE = 2,
+  HPC_GPU_MALI_GATHER_BLOCK_MEMORY = 3,
+} hpc_gpu_mali_gather_block_t;
+
+/// A plan for extracting counters of one block kind replicated over L2 slices
+/// or shader cores.
+typedef struct hpc_gpu_mali_block_plan_t {
+  /// The offsets of all blocks of this kind.
+  uint32_t *block_offsets;
+  /// The number of blocks of this kind.
+  uint32_t num_blocks;
+  /// The output slots of requested counters of this kind, in request order.
+  uint32_t *slots;
+  /// The indices into the block of requested counters of this kind.
+  uint32_t *indices;
+  /// The number of requested counters of this kind.
+  uint32_t num_counters;
+  /// Whether aggregated extraction picks these counters from block sums
+  /// instead of gathering their offset lists.
+  int use_block_sum;
+} hpc_gpu_mali_block_plan_t;
+
+/// A plan for extracting requested counters from one dump.
+///
+/// Each requested counter is the sum of the dump values at its list of
+/// offsets. The lists are stored back to back so extraction is a flat
+/// gather-and-sum without any per-sample topology arithmetic.
+///
+/// When many counters are requested from the L2 slices or the shader cores,
+/// walking every block once per counter is wasteful. Those counters instead
+/// get empty offset lists and are picked from vectorized block sums.
+///
+/// The per-kind block plans also drive breakdown extraction, which reports
+/// the value of each L2 slice and shader core besides the totals.
+typedef struct hpc_gpu_mali_gather_plan_t {
+  /// The number of requested counters.
+  uint32_t num_counters;
+  /// The offsets for counter `i` are `offsets[offset_starts[i]]` to
+  /// `offsets[offset_starts[i + 1] - 1]`. It has `num_counters + 1` elements.
+  /// All lists in the plan live in one block of memory headed by this one.
+  uint32_t *offset_starts;
+  /// The offsets into the dump for all requested counters.
+  uint32_t *offsets;
+
+  /// The slots of counters read from the job manager or the tiler block.
+  uint32_t *single_block_slots;
+  /// The number of counters read from the job manager or the tiler block.
+  uint32_t num_single_block_slots;
+
+  /// The block plan for L2 slice counters.
+  hpc_gpu_mali_block_plan_t memory_blocks;
+  /// The block plan for shader core counters.
+  hpc_gpu_mali_block_plan_t shader_core_blocks;
+  /// The function for summing blocks.
+  hpc_gpu_mali_block_sum_function block_sum;
+} hpc_gpu_mali_gather_plan_t;
+
+/// Returns the number of bytes an initialized gather plan may use for the
+/// given number of counters, for any GPU topology. The memory needs 4-byte
+/// alignment.
+///
+/// @param[in] num_counters The number of counters.
+size_t hpc_gpu_mali_get_gather_plan_size(uint32_t num_counters);
+
+/// Initializes the gather plan for the given counters and GPU topology, with
+/// all its lists laid out in `memory`.
+///
+/// See `hpc_gpu_mali_create_gather_plan` for the parameters; `memory` must
+/// hold at least `hpc_gpu_mali_get_gather_plan_size(num_counters)` bytes and
+/// outlive the plan.
+int hpc_gpu_mali_init_gather_plan(
+    uint32_t num_counters, const uint32_t *blocks, const uint32_t *indices,
+    uint32_t num_l2_slices, uint32_t shader_core_mask,
+    uint32_t block_sum_threshold, void *memory,
+    hpc_gpu_mali_gather_plan_t *plan);
+
+/// Creates the gather plan for the given counters and GPU topology.
+///
+/// The kernel driver returns a packed buffer containing blocks in the order of
+/// the job manager, the tiler, all L2 slices, and 32 shader cores (the bitwidth
+/// of the core mask). L2 slice counters are summed over all slices; shader core
+/// counters are summed over the cores enabled in the mask.
+///
+/// @param[in]  num_counters        The number of counters.
+/// @param[in]  blocks              The list of `hpc_gpu_mali_gather_block_t`
+///                                 for each counter.
+/// @param[in]  indices             The list of indices into their blocks for
+///                                 each counter.
+/// @param[in]  num_l2_slices       The number of L2 slices.
+/// @param[in]  shader_core_mask    The mask of enabled shader cores.
+/// @param[in]  block_sum_threshold The number of counters requested from one
+///                                 block kind at which they are extracted via
+///                                 block sums; normally
+///                                 `HPC_GPU_MALI_BLOCK_SUM_THRESHOLD`.
+/// @param[in]  allocator           The allocator used to allocate host memory.
+/// @param[out] plan                The resultant plan.
+int hpc_gpu_mali_create_gather_plan(
+    uint32_t num_counters, const uint32_t *blocks, const uint32_t *indices,
+    uint32_t num_l2_slices, uint32_t shader_core_mask,
+    uint32_t block_sum_threshold,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_gather_plan_t *plan);
+
+/// Destroys the given gather plan.
+///
+/// @param[in] plan      The plan.
+/// @param[in] allocator The allocator used to free allocated host memory.
+void hpc_gpu_mali_destroy_gather_plan(
+    hpc_gpu_mali_gather_plan_t *plan,
+    const hpc_gpu_host_allocation_callbacks_t *allocator);
+
+/// Extracts requested counters from one dump following the plan.
+///
+/// @param[in]  plan   The plan.
+/// @param[in]  buffer The dump returned by the kernel driver.
+/// @param[out] values The pointer to the memory for receiving `num_counters`
+///                    values.
+void hpc_gpu_mali_gather_plan_execute(const hpc_gpu_mali_gather_plan_t *plan,
+                                      const uint32_t *buffer,
+                                      uint64_t *values);
+
+/// Extracts requested counters from one dump following the plan, together
+/// with the value from each L2 slice and enabled shader core.
+///
+/// Each dump value is read once; totals are accumulated while the breakdown
+/// is written.
+///
+/// @param[in]  plan               The plan.
+/// @param[in]  buffer             The dump returned by the kernel driver.
+/// @param[out] values             The pointer to the memory for receiving
+///                                `num_counters` totals.
+/// @param[out] shader_core_values The pointer to the memory for receiving a
+///                                row of `shader_core_blocks.num_blocks`
+///                                values for each shader core counter, in
+///                                request order. It can be NULL if there are
+///                                no shader core counters.
+/// @param[out] l2_slice_values    The pointer to the memory for receiving a
+///                                row of `memory_blocks.num_blocks` values for
+///                                each L2 slice counter, in request order. It
+///                                can be NULL if there are no L2 slice
+///                                counters.
+void hpc_gpu_mali_gather_plan_execute_breakdown(
+    const hpc_gpu_mali_gather_plan_t *plan, const uint32_t *buffer,
+    uint64_t *values, uint64_t *shader_core_values, uint64_t *l2_slice_values);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // HPC_GPU_MALI_GATHER_PLAN_H_
@@ -0,0 +1,503 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/mali/simulated_driver.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include "driver_ioctl.h"
+#include "hpc/gpu/base_utilities.h"
+#include "hwcpipe/mali_driver_ioctl.h"
+
+/// The file descriptor handed out for the first simulated device. It is
+/// chosen to be unlikely to collide with real file descriptors in logs.
+#define SIMULATED_FIRST_DEVICE_FD (1 << 20)
+/// The file descriptor handed out for the simulated counter reader.
+#define SIMULATED_READER_FD (SIMULATED_FIRST_DEVICE_FD - 1)
+/// The maximal number of simultaneously open simulated devices.
+#define SIMULATED_MAX_OPEN_DEVICES 64
+
+/// The maximal number of buffers in the counter reader's ring.
+#define SIMULATED_MAX_NUM_BUFFERS 32u
+/// The number of counters in each block of a dump.
+#define SIMULATED_NUM_COUNTERS_PER_BLOCK 64u
+
+/// Dump event IDs reported by the kernel driver.
+#define SIMULATED_EVENT_MANUAL 0u
+#define SIMULATED_EVENT_PERIODIC 1u
+
+struct hpc_gpu_mali_simulated_driver_t {
+  /// The backend table routing driver calls here.
+  hpc_gpu_mali_ioctl_backend_t backend;
+
+  /// The packed device property blob.
+  uint8_t properties[128];
+  uint32_t properties_size;
+
+  hpc_gpu_mali_simulated_counter_function counter_function;
+  void *counter_user_data;
+  uint64_t ioctl_latency_ns;
+
+  /// The number of bytes in one dump.
+  uint32_t buffer_size;
+  /// The ring of dump buffers, `SIMULATED_MAX_NUM_BUFFERS * buffer_size`
+  /// bytes in total.
+  uint8_t *buffers;
+
+  /// The file descriptor handed out by the next open. Like the kernel's, file
+  /// descriptors are not reused while open, and this never hands out a
+  /// closed one again either.
+  int next_device_fd;
+  /// The file descriptors of open devices. Zero means the entry is free.
+  int open_devices[SIMULATED_MAX_OPEN_DEVICES];
+  int reader_open;
+  /// The number of buffers the reader asked for.
+  uint32_t buffer_count;
+  /// The buffer holding the oldest dump not yet released.
+  uint32_t head_index;
+  /// The number of dumps acquired by user space but not yet released. They
+  /// are the oldest ones starting from `head_index`.
+  uint32_t num_acquired;
+  /// The number of dumps ready to be acquired, following acquired ones.
+  uint32_t num_ready;
+  /// The number of dumps produced so far.
+  uint64_t num_dumps;
+  uint64_t num_dropped_dumps;
+  /// The periodic dump interval in nanoseconds; 0 if disabled.
+  uint64_t interval_ns;
+  /// The time the next periodic dump is due.
+  uint64_t next_dump_time_ns;
+
+  _Atomic uint64_t num_ioctls;
+  /// Guards all the reader and device state above.
+  pthread_mutex_t mutex;
+};
+
+static uint64_t get_monotonic_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static uint32_t simulated_default_counter_function(void *user_data,
+                                                   uint64_t dump_index,
+                                                   uint32_t block_index,
+                                                   uint32_t counter_index) {
+  return ((block_index + 1) << 16) | ((counter_index + 1) << 8) |
+         (uint32_t)(dump_index & 0xffu);
+}
+
+/// Accounts for one driver call and spends its latency. Busy-waiting keeps
+/// the latency accurate at microsecond scale, unlike sleeping.
+static void simulated_enter_ioctl(hpc_gpu_mali_simulated_driver_t *driver) {
+  atomic_fetch_add_explicit(&driver->num_ioctls, 1, memory_order_relaxed);
+  if (driver->ioctl_latency_ns == 0) return;
+  uint64_t end_time_ns = get_monotonic_time_ns() + driver->ioctl_latency_ns;
+  while (get_monotonic_time_ns() < end_time_ns) {
+  }
+}
+
+/// Appends one (key, value) pair to the property blob. The key is
+/// `(<property-id> << 2) | <value-type>`, with value types 0b00: u8,
+/// 0b01: u16, 0b10: u32, 0b11: u64.
+static void simulated_add_property(hpc_gpu_mali_simulated_driver_t *driver,
+                                   uint32_t property_id, uint32_t value_type,
+                                   uint64_t value) {
+  uint8_t *property = driver->properties + driver->properties_size;
+  uint32_t key = (property_id << 2) | value_type;
+  uint32_t value_size = 1u << value_type;
+  memcpy(property, &key, sizeof(uint32_t));
+  // Values are little-endian, like the host.
+  memcpy(property + sizeof(uint32_t), &value, value_size);
+  driver->properties_size += sizeof(uint32_t) + value_size;
+}
+
+/// Returns the metadata of the dump in the given buffer. Metadata is kept
+/// after all dump buffers so the mapped memory only contains counter values.
+static struct mali_counter_reader_metadata *simulated_get_metadata(
+    hpc_gpu_mali_simulated_driver_t *driver, uint32_t buffer_index) {
+  uint8_t *metadata_begin =
+      driver->buffers + SIMULATED_MAX_NUM_BUFFERS * driver->buffer_size;
+  return (struct mali_counter_reader_metadata *)metadata_begin + buffer_index;
+}
+
+/// Writes one dump into the next free buffer in the ring. Must be called with
+/// the mutex held.
+static void simulated_produce_dump(hpc_gpu_mali_simulated_driver_t *driver,
+                                   uint32_t event_id, uint64_t timestamp) {
+  uint64_t dump_index = driver->num_dumps++;
+  uint32_t num_used = driver->num_acquired + driver->num_ready;
+  if (num_used == driver->buffer_count) {
+    ++driver->num_dropped_dumps;
+    return;
+  }
+
+  uint32_t buffer_index =
+      (driver->head_index + num_used) % driver->buffer_count;
+  uint8_t *buffer = driver->buffers + buffer_index * driver->buffer_size;
+  uint32_t *values = (uint32_t *)buffer;
+  uint32_t num_blocks = driver->buffer_size / sizeof(uint32_t) /
+                        SIMULATED_NUM_COUNTERS_PER_BLOCK;
+  for (uint32_t block = 0; block < num_blocks; ++block) {
+    for (uint32_t i = 0; i < SIMULATED_NUM_COUNTERS_PER_BLOCK; ++i) {
+      *values++ = driver->counter_function(driver->counter_user_data,
+                                           dump_index, block, i);
+    }
+  }
+
+  struct mali_counter_reader_metadata *metadata =
+      simulated_get_metadata(driver, buffer_index);
+  metadata->timestamp = timestamp;
+  metadata->event_id = event_id;
+  metadata->buffer_index = buffer_index;
+  ++driver->num_ready;
+}
+
+/// Produces all periodic dumps due by `time_ns`. Must be called with the
+/// mutex held.
+static void simulated_produce_periodic_dumps(
+    hpc_gpu_mali_simulated_driver_t *driver, uint64_t time_ns) {
+  if (driver->interval_ns == 0) return;
+  while (driver->next_dump_time_ns <= time_ns) {
+    simulated_produce_dump(driver, SIMULATED_EVENT_PERIODIC,
+                           driver->next_dump_time_ns);
+    driver->next_dump_time_ns += driver->interval_ns;
+  }
+}
+
+static int simulated_reader_ioctl(hpc_gpu_mali_simulated_driver_t *driver,
+                                  unsigned long request, void *arg) {
+  switch (request) {
+    case MALI_COUNTER_READER_GET_API_VERSION:
+      *(uint32_t *)arg = MALI_COUNTER_READER_API_VERSION;
+      return 0;
+    case MALI_COUNTER_READER_GET_HARDWARE_VERSION:
+      *(uint32_t *)arg = 5;
+      return 0;
+    case MALI_COUNTER_READER_GET_BUFFER_SIZE:
+      *(uint32_t *)arg = driver->buffer_size;
+      return 0;
+    case MALI_COUNTER_READER_CLEAR:
+      return 0;
+    case MALI_COUNTER_READER_DUMP:
+      simulated_produce_dump(driver, SIMULATED_EVENT_MANUAL,
+                             get_monotonic_time_ns());
+      return 0;
+    case MALI_COUNTER_READER_GET_BUFFER: {
+      simulated_produce_periodic_dumps(driver, get_monotonic_time_ns());
+      if (driver->num_ready == 0) {
+        errno = EAGAIN;
+        return -1;
+      }
+      uint32_t buffer_index =
+          (driver->head_index + driver->num_acquired) % driver->buffer_count;
+      *(struct mali_counter_reader_metadata *)arg =
+          *simulated_get_metadata(driver, buffer_index);
+      --driver->num_ready;
+      ++driver->num_acquired;
+      return 0;
+    }
+    case MALI_COUNTER_READER_PUT_BUFFER: {
+      // Buffers must be released in the order they were acquired.
+      const struct mali_counter_reader_metadata *metadata = arg;
+      if (driver->num_acquired == 0 ||
+          metadata->buffer_index != driver->head_index) {
+        errno = EINVAL;
+        return -1;
+      }
+      driver->head_index = (driver->head_index + 1) % driver->buffer_count;
+      --driver->num_acquired;
+      return 0;
+    }
+    case MALI_COUNTER_READER_SET_INTERVAL:
+      driver->interval_ns = (uint32_t)(uintptr_t)arg;
+      driver->next_dump_time_ns = get_monotonic_time_ns() + driver->interval_ns;
+      return 0;
+  }
+  errno = EINVAL;
+  return -1;
+}
+
+static int simulated_device_ioctl(hpc_gpu_mali_simulated_driver_t *driver,
+                                  unsigned long request, void *arg) {
+  switch (request) {
+    case MALI_IOCTL_VERSION_HANDSHAKE: {
+      // Accept whatever version is requested; 0.0 gets the latest we model.
+      struct mali_device_api_version *version = arg;
+      if (version->major == 0 && version->minor == 0) {
+        version->major = 11;
+        version->minor = 25;
+      }
+      return 0;
+    }
+    case MALI_IOCTL_SET_CONTEXT_CREATION_FLAGS:
+      return 0;
+    case MALI_IOCTL_DEVICE_GET_ROPERTY: {
+      // A zero-sized buffer asks for the blob size.
+      struct mali_device_get_property *payload = arg;
+      if (payload->buffer_size == 0) return (int)driver->properties_size;
+      if (payload->buffer_size < driver->properties_size) {
+        errno = EINVAL;
+        return -1;
+      }
+      memcpy((void *)(uintptr_t)payload->buffer, driver->properties,
+             driver->properties_size);
+      return (int)driver->properties_size;
+    }
+    case MALI_IOCTL_COUNTER_SETUP_READER: {
+      const struct mali_counter_reader_setup *setup = arg;
+      if (driver->reader_open) {
+        errno = EBUSY;
+        return -1;
+      }
+      if (setup->buffer_count == 0 ||
+          setup->buffer_count > SIMULATED_MAX_NUM_BUFFERS) {
+        errno = EINVAL;
+        return -1;
+      }
+      driver->reader_open = 1;
+      driver->buffer_count = setup->buffer_count;
+      driver->head_index = 0;
+      driver->num_acquired = driver->num_ready = 0;
+      driver->interval_ns = 0;
+      return SIMULATED_READER_FD;
+    }
+  }
+  errno = EINVAL;
+  return -1;
+}
+
+static int simulated_open(void *user_data) {
+  hpc_gpu_mali_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  int gpu_device = -1;
+  pthread_mutex_lock(&driver->mutex);
+  for (uint32_t i = 0; i < SIMULATED_MAX_OPEN_DEVICES; ++i) {
+    if (driver->open_devices[i] != 0) continue;
+    gpu_device = driver->next_device_fd++;
+    driver->open_devices[i] = gpu_device;
+    break;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  if (gpu_device < 0) errno = EMFILE;
+  return gpu_device;
+}
+
+static int simulated_close(void *user_data, int fd) {
+  hpc_gpu_mali_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  int status = -1;
+  pthread_mutex_lock(&driver->mutex);
+  if (fd == SIMULATED_READER_FD && driver->reader_open) {
+    driver->reader_open = 0;
+    status = 0;
+  }
+  for (uint32_t i = 0; status < 0 && i < SIMULATED_MAX_OPEN_DEVICES; ++i) {
+    // Free entries hold zero, which is never a simulated device.
+    if (fd == 0 || driver->open_devices[i] != fd) continue;
+    driver->open_devices[i] = 0;
+    status = 0;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  if (status < 0) errno = EBADF;
+  return status;
+}
+
+static int simulated_ioctl(void *user_data, int fd, unsigned long request,
+                           void *arg) {
+  hpc_gpu_mali_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  pthread_mutex_lock(&driver->mutex);
+  int status = fd == SIMULATED_READER_FD
+                   ? simulated_reader_ioctl(driver, request, arg)
+                   : simulated_device_ioctl(driver, request, arg);
+  pthread_mutex_unlock(&driver->mutex);
+  return status;
+}
+
+static void *simulated_mmap(void *user_data, int fd, size_t size) {
+  hpc_gpu_mali_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  if (fd != SIMULATED_READER_FD ||
+      size > (size_t)driver->buffer_count * driver->buffer_size) {
+    errno = EINVAL;
+    return MAP_FAILED;
+  }
+  return driver->buffers;
+}
+
+static int simulated_munmap(void *user_data, void *address, size_t size) {
+  hpc_gpu_mali_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+  return 0;
+}
+
+static int simulated_poll(void *user_data, struct pollfd *fds, nfds_t num_fds,
+                          int timeout) {
+  hpc_gpu_mali_simulated_driver_t *driver = user_data;
+  simulated_enter_ioctl(driver);
+
+  for (nfds_t i = 0; i < num_fds; ++i) fds[i].revents = 0;
+
+  pthread_mutex_lock(&driver->mutex);
+  uint64_t time_ns = get_monotonic_time_ns();
+  simulated_produce_periodic_dumps(driver, time_ns);
+  // Without a ready dump, wait for the next periodic one if it is within the
+  // timeout. Nothing else would ever produce a dump while we block, so give
+  // up right away otherwise.
+  uint64_t wait_ns = 0;
+  if (driver->num_ready == 0 && driver->interval_ns != 0) {
+    wait_ns = driver->next_dump_time_ns - time_ns;
+    if (timeout >= 0 && wait_ns > (uint64_t)timeout * 1000000u) wait_ns = 0;
+  }
+  pthread_mutex_unlock(&driver->mutex);
+
+  if (wait_ns) {
+    struct timespec duration = {wait_ns / 1000000000u, wait_ns % 1000000000u};
+    nanosleep(&duration, NULL);
+    pthread_mutex_lock(&driver->mutex);
+    simulated_produce_periodic_dumps(driver, get_monotonic_time_ns());
+    pthread_mutex_unlock(&driver->mutex);
+  }
+
+  int num_ready_fds = 0;
+  pthread_mutex_lock(&driver->mutex);
+  for (nfds_t i = 0; i < num_fds; ++i) {
+    if (fds[i].fd == SIMULATED_READER_FD && driver->num_ready) {
+      fds[i].revents = fds[i].events & POLLIN;
+      num_ready_fds += fds[i].revents != 0;
+    }
+  }
+  pthread_mutex_unlock(&driver->mutex);
+  return num_ready_fds;
+}
+
+int hpc_gpu_mali_create_simulated_driver(
+    const hpc_gpu_mali_simulated_driver_create_info_t *create_info,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_mali_simulated_driver_t **out_driver) {
+  if (create_info->num_coherency_groups == 0 ||
+      create_info->num_coherency_groups >
+          HPC_GPU_MALI_SIMULATED_MAX_NUM_COHERENCY_GROUPS ||
+      create_info->num_l2_slices == 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  uint64_t core_mask = 0;
+  for (uint32_t i = 0; i < create_info->num_coherency_groups; ++i) {
+    core_mask |= create_info->coherency_group_core_masks[i];
+  }
+  if (core_mask == 0 || core_mask > UINT32_MAX) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  // Dumps have one block per shader core bit up to the highest present core,
+  // following the job manager, tiler, and L2 slice blocks.
+  uint32_t num_core_blocks = 0;
+  for (uint64_t mask = core_mask; mask; mask >>= 1) ++num_core_blocks;
+  uint32_t num_blocks = 2 + create_info->num_l2_slices + num_core_blocks;
+  uint32_t buffer_size =
+      num_blocks * SIMULATED_NUM_COUNTERS_PER_BLOCK * sizeof(uint32_t);
+
+  // Lay out the driver, dump buffers, and per-buffer metadata in one
+  // allocation.
+  size_t size = sizeof(hpc_gpu_mali_simulated_driver_t) +
+                SIMULATED_MAX_NUM_BUFFERS *
+                    (buffer_size + sizeof(struct mali_counter_reader_metadata));
+  hpc_gpu_mali_simulated_driver_t *driver =
+      allocator->alloc(allocator->user_data, size);
+  memset(driver, 0, size);
+
+  driver->backend.user_data = driver;
+  driver->backend.open = simulated_open;
+  driver->backend.close = simulated_close;
+  driver->backend.ioctl = simulated_ioctl;
+  driver->backend.mmap = simulated_mmap;
+  driver->backend.munmap = simulated_munmap;
+  driver->backend.poll = simulated_poll;
+
+  // Mix value types like the kernel driver does; the parser must handle them
+  // all, including properties it does not care about.
+  simulated_add_property(driver, MALI_PROPERTY_PRODUCT_ID, 2,
+                         create_info->gpu_product_id);
+  simulated_add_property(driver, /*VERSION_STATUS=*/2, 1, 0);
+  simulated_add_property(driver, MALI_PROPERTY_NUM_L2_SLICES, 0,
+                         create_info->num_l2_slices);
+  simulated_add_property(driver, /*TLS_ALLOC=*/84, 2, 0);
+  for (uint32_t i = 0; i < create_info->num_coherency_groups; ++i) {
+    simulated_add_property(driver, MALI_PROPERTY_COHERENCY_GROUP_0 + i, 3,
+                           create_info->coherency_group_core_masks[i]);
+  }
+
+  driver->counter_function = create_info->counter_function
+                                 ? create_info->counter_function
+                                 : simulated_default_counter_function;
+  driver->counter_user_data = create_info->counter_user_data;
+  driver->ioctl_latency_ns = create_info->ioctl_latency_ns;
+  driver->buffer_size = buffer_size;
+  driver->buffers = (uint8_t *)(driver + 1);
+  driver->next_device_fd = SIMULATED_FIRST_DEVICE_FD;
+  atomic_init(&driver->num_ioctls, 0);
+
+  int status = pthread_mutex_init(&driver->mutex, NULL);
+  if (status != 0) {
+    allocator->free(allocator->user_data, driver);
+    return -status;
+  }
+
+  *out_driver = driver;
+  return 0;
+}
+
+int hpc_gpu_mali_destroy_simulated_driver(
+    hpc_gpu_mali_simulated_driver_t *driver,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  pthread_mutex_destroy(&driver->mutex);
+  allocator->free(allocator->user_data, driver);
+  return 0;
+}
+
+void hpc_gpu_mali_use_simulated_driver(
+    hpc_gpu_mali_simulated_driver_t *driver) {
+  hpc_gpu_mali_ioctl_set_backend(driver ? &driver->backend : NULL);
+}
+
+uint64_t hpc_gpu_mali_simulated_driver_get_num_ioctls(
+    const hpc_gpu_mali_simulated_driver_t *driver) {
+  return atomic_load_explicit(&driver->num_ioctls, memory_order_relaxed);
+}
+
+uint64_t hpc_gpu_mali_simulated_driver_get_num_dropped_dumps(
+    hpc_gpu_mali_simulated_driver_t *driver) {
+  pthread_mutex_lock(&driver->mutex);
+  uint64_t num_dropped_dumps = driver->num_dropped_dumps;
+  pthread_mutex_unlock(&driver->mutex);
+  return num_dropped_dumps;
+}
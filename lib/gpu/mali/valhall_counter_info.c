@@ -0,0 +1,580 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/mali/valhall.h"
+
+#include <stdint.h>
+
+#include "hpc/gpu/counter_info.h"
+
+//===-------------- BEGIN AUTOGENERATED REGION; DO NOT EDIT! --------------===//
+
+/// The series that availability bits refer to.
+static const char *const hpc_gpu_mali_valhall_series_names[14] = {
+    "T82X", "T83X", "T86X", "T88X", "THEX", "TMIX", "TDVX", "TSIX", "TNOX",
+    "TGOX", "TTRX", "TNAX", "TOTX", "TBOX",
+};
+
+/// Metadata of all counters, in enum order.
+static const hpc_gpu_counter_info_t hpc_gpu_mali_valhall_counter_infos[191] = {
+    // clang-format off
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_MESSAGES_SENT, 0x3fffu,
+     "JOB_MANAGER_MESSAGES_SENT", "JOB_MANAGER", "Job manager: messages sent",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_MESSAGES_RECEIVED, 0x3fffu,
+     "JOB_MANAGER_MESSAGES_RECEIVED", "JOB_MANAGER",
+     "Job manager: messages received", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_GPU_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_GPU_ACTIVE", "JOB_MANAGER", "Job manager: gpu active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_IRQ_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_IRQ_ACTIVE", "JOB_MANAGER", "Job manager: irq active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_JOBS, 0x3fffu, "JOB_MANAGER_JS0_JOBS",
+     "JOB_MANAGER", "Job manager: js0 jobs", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS0_TASKS", "JOB_MANAGER", "Job manager: js0 tasks",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS0_ACTIVE", "JOB_MANAGER", "Job manager: js0 active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_WAIT_FLUSH, 0x3fc0u,
+     "JOB_MANAGER_JS0_WAIT_FLUSH", "JOB_MANAGER", "Job manager: js0 wait flush",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_READ", "JOB_MANAGER", "Job manager: js0 wait read",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js0 wait issue",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js0 wait depend", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS0_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS0_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js0 wait finish", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_JOBS, 0x3fffu, "JOB_MANAGER_JS1_JOBS",
+     "JOB_MANAGER", "Job manager: js1 jobs", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS1_TASKS", "JOB_MANAGER", "Job manager: js1 tasks",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS1_ACTIVE", "JOB_MANAGER", "Job manager: js1 active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_WAIT_FLUSH, 0x3fc0u,
+     "JOB_MANAGER_JS1_WAIT_FLUSH", "JOB_MANAGER", "Job manager: js1 wait flush",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_READ", "JOB_MANAGER", "Job manager: js1 wait read",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js1 wait issue",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js1 wait depend", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS1_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS1_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js1 wait finish", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_JOBS, 0x3fffu, "JOB_MANAGER_JS2_JOBS",
+     "JOB_MANAGER", "Job manager: js2 jobs", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_TASKS, 0x3fffu,
+     "JOB_MANAGER_JS2_TASKS", "JOB_MANAGER", "Job manager: js2 tasks",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_ACTIVE, 0x3fffu,
+     "JOB_MANAGER_JS2_ACTIVE", "JOB_MANAGER", "Job manager: js2 active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_WAIT_FLUSH, 0x3fc0u,
+     "JOB_MANAGER_JS2_WAIT_FLUSH", "JOB_MANAGER", "Job manager: js2 wait flush",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_WAIT_READ, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_READ", "JOB_MANAGER", "Job manager: js2 wait read",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_WAIT_ISSUE, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_ISSUE", "JOB_MANAGER", "Job manager: js2 wait issue",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_WAIT_DEPEND, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_DEPEND", "JOB_MANAGER",
+     "Job manager: js2 wait depend", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_JS2_WAIT_FINISH, 0x3fffu,
+     "JOB_MANAGER_JS2_WAIT_FINISH", "JOB_MANAGER",
+     "Job manager: js2 wait finish", "events"},
+    {HPC_GPU_MALI_VALHALL_JOB_MANAGER_CACHE_FLUSH, 0x3f40u,
+     "JOB_MANAGER_CACHE_FLUSH", "JOB_MANAGER", "Job manager: cache flush",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_TILER_ACTIVE, 0x3ff0u, "TILER_TILER_ACTIVE",
+     "TILER", "Tiler: tiler active", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_JOBS_PROCESSED, 0x3fffu, "TILER_JOBS_PROCESSED",
+     "TILER", "Tiler: jobs processed", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_TRIANGLES, 0x3fffu, "TILER_TRIANGLES", "TILER",
+     "Tiler: triangles", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_LINES, 0x3fffu, "TILER_LINES", "TILER",
+     "Tiler: lines", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_POINTS, 0x3fffu, "TILER_POINTS", "TILER",
+     "Tiler: points", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_FRONT_FACING, 0x3fffu, "TILER_FRONT_FACING",
+     "TILER", "Tiler: front facing", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_BACK_FACING, 0x3fffu, "TILER_BACK_FACING",
+     "TILER", "Tiler: back facing", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PRIM_VISIBLE, 0x3fffu, "TILER_PRIM_VISIBLE",
+     "TILER", "Tiler: prim visible", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PRIM_CULLED, 0x3fffu, "TILER_PRIM_CULLED",
+     "TILER", "Tiler: prim culled", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PRIM_CLIPPED, 0x3fffu, "TILER_PRIM_CLIPPED",
+     "TILER", "Tiler: prim clipped", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PRIM_SAT_CULLED, 0x3ff0u,
+     "TILER_PRIM_SAT_CULLED", "TILER", "Tiler: prim sat culled", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_BIN_ALLOC_INIT, 0x3fe0u, "TILER_BIN_ALLOC_INIT",
+     "TILER", "Tiler: bin alloc init", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_BIN_ALLOC_OVERFLOW, 0x3fe0u,
+     "TILER_BIN_ALLOC_OVERFLOW", "TILER", "Tiler: bin alloc overflow",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_BUS_READ, 0x3ffcu, "TILER_BUS_READ", "TILER",
+     "Tiler: bus read", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_BUS_WRITE_UTLB0, 0x3c00u,
+     "TILER_BUS_WRITE_UTLB0", "TILER", "Tiler: bus write utlb0", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_BUS_WRITE_UTLB1, 0x3c00u,
+     "TILER_BUS_WRITE_UTLB1", "TILER", "Tiler: bus write utlb1", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_LOADING_DESC, 0x3ffcu, "TILER_LOADING_DESC",
+     "TILER", "Tiler: loading desc", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_POS_SHAD_REQ, 0x3ff0u,
+     "TILER_IDVS_POS_SHAD_REQ", "TILER", "Tiler: idvs pos shad req", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_POS_SHAD_WAIT, 0x3ff0u,
+     "TILER_IDVS_POS_SHAD_WAIT", "TILER", "Tiler: idvs pos shad wait",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_POS_SHAD_STALL, 0x3ff0u,
+     "TILER_IDVS_POS_SHAD_STALL", "TILER", "Tiler: idvs pos shad stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_POS_FIFO_FULL, 0x3ff0u,
+     "TILER_IDVS_POS_FIFO_FULL", "TILER", "Tiler: idvs pos fifo full",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PREFETCH_STALL, 0x3ff0u, "TILER_PREFETCH_STALL",
+     "TILER", "Tiler: prefetch stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_VCACHE_HIT, 0x3ffcu, "TILER_VCACHE_HIT",
+     "TILER", "Tiler: vcache hit", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_VCACHE_MISS, 0x3ffcu, "TILER_VCACHE_MISS",
+     "TILER", "Tiler: vcache miss", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_VCACHE_LINE_WAIT, 0x3ff0u,
+     "TILER_VCACHE_LINE_WAIT", "TILER", "Tiler: vcache line wait", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_VFETCH_POS_READ_WAIT, 0x3ff0u,
+     "TILER_VFETCH_POS_READ_WAIT", "TILER", "Tiler: vfetch pos read wait",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_VFETCH_VERTEX_WAIT, 0x3ff0u,
+     "TILER_VFETCH_VERTEX_WAIT", "TILER", "Tiler: vfetch vertex wait",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_VFETCH_STALL, 0x3ff0u, "TILER_VFETCH_STALL",
+     "TILER", "Tiler: vfetch stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_PRIMASSY_STALL, 0x3ff0u, "TILER_PRIMASSY_STALL",
+     "TILER", "Tiler: primassy stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_BBOX_GEN_STALL, 0x3ff0u, "TILER_BBOX_GEN_STALL",
+     "TILER", "Tiler: bbox gen stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_VBU_HIT, 0x3ff0u, "TILER_IDVS_VBU_HIT",
+     "TILER", "Tiler: idvs vbu hit", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_VBU_MISS, 0x3ff0u, "TILER_IDVS_VBU_MISS",
+     "TILER", "Tiler: idvs vbu miss", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_VBU_LINE_DEALLOCATE, 0x3ff0u,
+     "TILER_IDVS_VBU_LINE_DEALLOCATE", "TILER",
+     "Tiler: idvs vbu line deallocate", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_VAR_SHAD_REQ, 0x3ff0u,
+     "TILER_IDVS_VAR_SHAD_REQ", "TILER", "Tiler: idvs var shad req", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_IDVS_VAR_SHAD_STALL, 0x3ff0u,
+     "TILER_IDVS_VAR_SHAD_STALL", "TILER", "Tiler: idvs var shad stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_BINNER_STALL, 0x3ff0u, "TILER_BINNER_STALL",
+     "TILER", "Tiler: binner stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_ITER_STALL, 0x3ff0u, "TILER_ITER_STALL",
+     "TILER", "Tiler: iter stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_COMPRESS_MISS, 0x3ff0u, "TILER_COMPRESS_MISS",
+     "TILER", "Tiler: compress miss", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_COMPRESS_STALL, 0x3ff0u, "TILER_COMPRESS_STALL",
+     "TILER", "Tiler: compress stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_PCACHE_HIT, 0x3ffcu, "TILER_PCACHE_HIT",
+     "TILER", "Tiler: pcache hit", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PCACHE_MISS, 0x3ffcu, "TILER_PCACHE_MISS",
+     "TILER", "Tiler: pcache miss", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_PCACHE_MISS_STALL, 0x3ff0u,
+     "TILER_PCACHE_MISS_STALL", "TILER", "Tiler: pcache miss stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_PCACHE_EVICT_STALL, 0x3ff0u,
+     "TILER_PCACHE_EVICT_STALL", "TILER", "Tiler: pcache evict stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_PMGR_PTR_WR_STALL, 0x3ff0u,
+     "TILER_PMGR_PTR_WR_STALL", "TILER", "Tiler: pmgr ptr wr stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_PMGR_PTR_RD_STALL, 0x3ff0u,
+     "TILER_PMGR_PTR_RD_STALL", "TILER", "Tiler: pmgr ptr rd stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_PMGR_CMD_WR_STALL, 0x3ff0u,
+     "TILER_PMGR_CMD_WR_STALL", "TILER", "Tiler: pmgr cmd wr stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_WRBUF_ACTIVE, 0x3ff0u, "TILER_WRBUF_ACTIVE",
+     "TILER", "Tiler: wrbuf active", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_WRBUF_HIT, 0x3ffcu, "TILER_WRBUF_HIT", "TILER",
+     "Tiler: wrbuf hit", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_WRBUF_MISS, 0x3ffcu, "TILER_WRBUF_MISS",
+     "TILER", "Tiler: wrbuf miss", "events"},
+    {HPC_GPU_MALI_VALHALL_TILER_WRBUF_NO_FREE_LINE_STALL, 0x3ff0u,
+     "TILER_WRBUF_NO_FREE_LINE_STALL", "TILER",
+     "Tiler: wrbuf no free line stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_WRBUF_NO_AXI_ID_STALL, 0x3ff0u,
+     "TILER_WRBUF_NO_AXI_ID_STALL", "TILER", "Tiler: wrbuf no axi id stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_TILER_WRBUF_AXI_STALL, 0x3ff0u,
+     "TILER_WRBUF_AXI_STALL", "TILER", "Tiler: wrbuf axi stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_ACTIVE, 0x3fffu,
+     "SHADER_CORE_FRAG_ACTIVE", "SHADER_CORE", "Shader core: frag active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_PRIMITIVES_OUT, 0x3c00u,
+     "SHADER_CORE_FRAG_PRIMITIVES_OUT", "SHADER_CORE",
+     "Shader core: frag primitives out", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_PRIM_RAST, 0x3ff0u,
+     "SHADER_CORE_FRAG_PRIM_RAST", "SHADER_CORE", "Shader core: frag prim rast",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_FPK_ACTIVE, 0x3ff0u,
+     "SHADER_CORE_FRAG_FPK_ACTIVE", "SHADER_CORE",
+     "Shader core: frag fpk active", "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_STARVING, 0x3ff0u,
+     "SHADER_CORE_FRAG_STARVING", "SHADER_CORE", "Shader core: frag starving",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_WARPS, 0x3ff0u,
+     "SHADER_CORE_FRAG_WARPS", "SHADER_CORE", "Shader core: frag warps",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_PARTIAL_QUADS_RAST, 0x3c00u,
+     "SHADER_CORE_FRAG_PARTIAL_QUADS_RAST", "SHADER_CORE",
+     "Shader core: frag partial quads rast", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_QUADS_RAST, 0x3fffu,
+     "SHADER_CORE_FRAG_QUADS_RAST", "SHADER_CORE",
+     "Shader core: frag quads rast", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_QUADS_EZS_TEST, 0x3fffu,
+     "SHADER_CORE_FRAG_QUADS_EZS_TEST", "SHADER_CORE",
+     "Shader core: frag quads ezs test", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_QUADS_EZS_UPDATE, 0x3ff0u,
+     "SHADER_CORE_FRAG_QUADS_EZS_UPDATE", "SHADER_CORE",
+     "Shader core: frag quads ezs update", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_QUADS_EZS_KILL, 0x3ff0u,
+     "SHADER_CORE_FRAG_QUADS_EZS_KILL", "SHADER_CORE",
+     "Shader core: frag quads ezs kill", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_LZS_TEST, 0x3ff0u,
+     "SHADER_CORE_FRAG_LZS_TEST", "SHADER_CORE", "Shader core: frag lzs test",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_LZS_KILL, 0x3ff0u,
+     "SHADER_CORE_FRAG_LZS_KILL", "SHADER_CORE", "Shader core: frag lzs kill",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_WARP_REG_SIZE_64, 0x3f00u,
+     "SHADER_CORE_WARP_REG_SIZE_64", "SHADER_CORE",
+     "Shader core: warp reg size 64", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_PTILES, 0x3ff0u,
+     "SHADER_CORE_FRAG_PTILES", "SHADER_CORE", "Shader core: frag ptiles",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FRAG_TRANS_ELIM, 0x3fffu,
+     "SHADER_CORE_FRAG_TRANS_ELIM", "SHADER_CORE",
+     "Shader core: frag trans elim", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_QUAD_FPK_KILLER, 0x3ff0u,
+     "SHADER_CORE_QUAD_FPK_KILLER", "SHADER_CORE",
+     "Shader core: quad fpk killer", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_FULL_QUAD_WARPS, 0x3f00u,
+     "SHADER_CORE_FULL_QUAD_WARPS", "SHADER_CORE",
+     "Shader core: full quad warps", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_COMPUTE_ACTIVE, 0x3fffu,
+     "SHADER_CORE_COMPUTE_ACTIVE", "SHADER_CORE", "Shader core: compute active",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_COMPUTE_TASKS, 0x3fffu,
+     "SHADER_CORE_COMPUTE_TASKS", "SHADER_CORE", "Shader core: compute tasks",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_COMPUTE_WARPS, 0x3ff0u,
+     "SHADER_CORE_COMPUTE_WARPS", "SHADER_CORE", "Shader core: compute warps",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_COMPUTE_STARVING, 0x3ff0u,
+     "SHADER_CORE_COMPUTE_STARVING", "SHADER_CORE",
+     "Shader core: compute starving", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_CORE_ACTIVE, 0x3ff0u,
+     "SHADER_CORE_EXEC_CORE_ACTIVE", "SHADER_CORE",
+     "Shader core: exec core active", "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_INSTR_FMA, 0x3c00u,
+     "SHADER_CORE_EXEC_INSTR_FMA", "SHADER_CORE", "Shader core: exec instr fma",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_INSTR_CVT, 0x3c00u,
+     "SHADER_CORE_EXEC_INSTR_CVT", "SHADER_CORE", "Shader core: exec instr cvt",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_INSTR_SFU, 0x3c00u,
+     "SHADER_CORE_EXEC_INSTR_SFU", "SHADER_CORE", "Shader core: exec instr sfu",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_INSTR_MSG, 0x3c00u,
+     "SHADER_CORE_EXEC_INSTR_MSG", "SHADER_CORE", "Shader core: exec instr msg",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_INSTR_DIVERGED, 0x3ff0u,
+     "SHADER_CORE_EXEC_INSTR_DIVERGED", "SHADER_CORE",
+     "Shader core: exec instr diverged", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_ICACHE_MISS, 0x3c00u,
+     "SHADER_CORE_EXEC_ICACHE_MISS", "SHADER_CORE",
+     "Shader core: exec icache miss", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_EXEC_STARVE_ARITH, 0x3c00u,
+     "SHADER_CORE_EXEC_STARVE_ARITH", "SHADER_CORE",
+     "Shader core: exec starve arith", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_CALL_BLEND_SHADER, 0x3c00u,
+     "SHADER_CORE_CALL_BLEND_SHADER", "SHADER_CORE",
+     "Shader core: call blend shader", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_MSGI_NUM_FLITS, 0x3c00u,
+     "SHADER_CORE_TEX_MSGI_NUM_FLITS", "SHADER_CORE",
+     "Shader core: tex msgi num flits", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_DFCH_CLK_STALLED, 0x3c00u,
+     "SHADER_CORE_TEX_DFCH_CLK_STALLED", "SHADER_CORE",
+     "Shader core: tex dfch clk stalled", "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_TFCH_CLK_STALLED, 0x3c00u,
+     "SHADER_CORE_TEX_TFCH_CLK_STALLED", "SHADER_CORE",
+     "Shader core: tex tfch clk stalled", "cycles"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_TFCH_STARVED_PENDING_DATA_FETCH,
+     0x3c00u, "SHADER_CORE_TEX_TFCH_STARVED_PENDING_DATA_FETCH", "SHADER_CORE",
+     "Shader core: tex tfch starved pending data fetch", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_FILT_NUM_OPERATIONS, 0x3fc0u,
+     "SHADER_CORE_TEX_FILT_NUM_OPERATIONS", "SHADER_CORE",
+     "Shader core: tex filt num operations", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_FILT_NUM_FXR_OPERATIONS, 0x3c00u,
+     "SHADER_CORE_TEX_FILT_NUM_FXR_OPERATIONS", "SHADER_CORE",
+     "Shader core: tex filt num fxr operations", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_FILT_NUM_FST_OPERATIONS, 0x3c00u,
+     "SHADER_CORE_TEX_FILT_NUM_FST_OPERATIONS", "SHADER_CORE",
+     "Shader core: tex filt num fst operations", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_MSGO_NUM_MSG, 0x3c00u,
+     "SHADER_CORE_TEX_MSGO_NUM_MSG", "SHADER_CORE",
+     "Shader core: tex msgo num msg", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_TEX_MSGO_NUM_FLITS, 0x3c00u,
+     "SHADER_CORE_TEX_MSGO_NUM_FLITS", "SHADER_CORE",
+     "Shader core: tex msgo num flits", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_LS_MEM_READ_FULL, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_READ_FULL", "SHADER_CORE",
+     "Shader core: ls mem read full", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_LS_MEM_READ_SHORT, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_READ_SHORT", "SHADER_CORE",
+     "Shader core: ls mem read short", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_LS_MEM_WRITE_FULL, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_WRITE_FULL", "SHADER_CORE",
+     "Shader core: ls mem write full", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_LS_MEM_WRITE_SHORT, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_WRITE_SHORT", "SHADER_CORE",
+     "Shader core: ls mem write short", "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_LS_MEM_ATOMIC, 0x3ff0u,
+     "SHADER_CORE_LS_MEM_ATOMIC", "SHADER_CORE", "Shader core: ls mem atomic",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_VARY_INSTR, 0x3ff0u,
+     "SHADER_CORE_VARY_INSTR", "SHADER_CORE", "Shader core: vary instr",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_VARY_SLOT_32, 0x3ff0u,
+     "SHADER_CORE_VARY_SLOT_32", "SHADER_CORE", "Shader core: vary slot 32",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_VARY_SLOT_16, 0x3ff0u,
+     "SHADER_CORE_VARY_SLOT_16", "SHADER_CORE", "Shader core: vary slot 16",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_ATTR_INSTR, 0x3ff0u,
+     "SHADER_CORE_ATTR_INSTR", "SHADER_CORE", "Shader core: attr instr",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_FTC, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_FTC", "SHADER_CORE", "Shader core: beats rd ftc",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_FTC_EXT, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_FTC_EXT", "SHADER_CORE",
+     "Shader core: beats rd ftc ext", "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_LSC, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_LSC", "SHADER_CORE", "Shader core: beats rd lsc",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_LSC_EXT, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_LSC_EXT", "SHADER_CORE",
+     "Shader core: beats rd lsc ext", "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_TEX, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_TEX", "SHADER_CORE", "Shader core: beats rd tex",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_TEX_EXT, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_TEX_EXT", "SHADER_CORE",
+     "Shader core: beats rd tex ext", "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_RD_OTHER, 0x3ff0u,
+     "SHADER_CORE_BEATS_RD_OTHER", "SHADER_CORE", "Shader core: beats rd other",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_WR_LSC_OTHER, 0x3fc0u,
+     "SHADER_CORE_BEATS_WR_LSC_OTHER", "SHADER_CORE",
+     "Shader core: beats wr lsc other", "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_WR_TIB, 0x3ff0u,
+     "SHADER_CORE_BEATS_WR_TIB", "SHADER_CORE", "Shader core: beats wr tib",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_SHADER_CORE_BEATS_WR_LSC_WB, 0x3fc0u,
+     "SHADER_CORE_BEATS_WR_LSC_WB", "SHADER_CORE",
+     "Shader core: beats wr lsc wb", "beats"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_REQUESTS, 0x3fffu, "MEMORY_MMU_REQUESTS",
+     "MEMORY", "Memory: mmu requests", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_TABLE_READS_L3, 0x3fc0u,
+     "MEMORY_MMU_TABLE_READS_L3", "MEMORY", "Memory: mmu table reads l3",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_TABLE_READS_L2, 0x3fc0u,
+     "MEMORY_MMU_TABLE_READS_L2", "MEMORY", "Memory: mmu table reads l2",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_HIT_L3, 0x3fc0u, "MEMORY_MMU_HIT_L3",
+     "MEMORY", "Memory: mmu hit l3", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_HIT_L2, 0x3fc0u, "MEMORY_MMU_HIT_L2",
+     "MEMORY", "Memory: mmu hit l2", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_S2_REQUESTS, 0x3fc0u,
+     "MEMORY_MMU_S2_REQUESTS", "MEMORY", "Memory: mmu s2 requests", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_S2_TABLE_READS_L3, 0x3fc0u,
+     "MEMORY_MMU_S2_TABLE_READS_L3", "MEMORY", "Memory: mmu s2 table reads l3",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_S2_TABLE_READS_L2, 0x3fc0u,
+     "MEMORY_MMU_S2_TABLE_READS_L2", "MEMORY", "Memory: mmu s2 table reads l2",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_S2_HIT_L3, 0x3fc0u, "MEMORY_MMU_S2_HIT_L3",
+     "MEMORY", "Memory: mmu s2 hit l3", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_MMU_S2_HIT_L2, 0x3fc0u, "MEMORY_MMU_S2_HIT_L2",
+     "MEMORY", "Memory: mmu s2 hit l2", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_RD_MSG_IN, 0x3ff0u, "MEMORY_L2_RD_MSG_IN",
+     "MEMORY", "Memory: l2 rd msg in", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_RD_MSG_IN_STALL, 0x3ff0u,
+     "MEMORY_L2_RD_MSG_IN_STALL", "MEMORY", "Memory: l2 rd msg in stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_WR_MSG_IN, 0x3ff0u, "MEMORY_L2_WR_MSG_IN",
+     "MEMORY", "Memory: l2 wr msg in", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_WR_MSG_IN_STALL, 0x3ff0u,
+     "MEMORY_L2_WR_MSG_IN_STALL", "MEMORY", "Memory: l2 wr msg in stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_SNP_MSG_IN, 0x3ff0u, "MEMORY_L2_SNP_MSG_IN",
+     "MEMORY", "Memory: l2 snp msg in", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_SNP_MSG_IN_STALL, 0x3ff0u,
+     "MEMORY_L2_SNP_MSG_IN_STALL", "MEMORY", "Memory: l2 snp msg in stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_RD_MSG_OUT, 0x3ff0u, "MEMORY_L2_RD_MSG_OUT",
+     "MEMORY", "Memory: l2 rd msg out", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_RD_MSG_OUT_STALL, 0x3ff0u,
+     "MEMORY_L2_RD_MSG_OUT_STALL", "MEMORY", "Memory: l2 rd msg out stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_WR_MSG_OUT, 0x3ff0u, "MEMORY_L2_WR_MSG_OUT",
+     "MEMORY", "Memory: l2 wr msg out", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_ANY_LOOKUP, 0x3fffu, "MEMORY_L2_ANY_LOOKUP",
+     "MEMORY", "Memory: l2 any lookup", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_READ_LOOKUP, 0x3fffu,
+     "MEMORY_L2_READ_LOOKUP", "MEMORY", "Memory: l2 read lookup", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_WRITE_LOOKUP, 0x3fffu,
+     "MEMORY_L2_WRITE_LOOKUP", "MEMORY", "Memory: l2 write lookup", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_SNOOP_LOOKUP, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_LOOKUP", "MEMORY", "Memory: l2 ext snoop lookup",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_READ, 0x3fffu, "MEMORY_L2_EXT_READ",
+     "MEMORY", "Memory: l2 ext read", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_READ_NOSNP, 0x3ff0u,
+     "MEMORY_L2_EXT_READ_NOSNP", "MEMORY", "Memory: l2 ext read nosnp",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_READ_UNIQUE, 0x3ff0u,
+     "MEMORY_L2_EXT_READ_UNIQUE", "MEMORY", "Memory: l2 ext read unique",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_READ_BEATS, 0x3fffu,
+     "MEMORY_L2_EXT_READ_BEATS", "MEMORY", "Memory: l2 ext read beats",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AR_STALL, 0x3fffu,
+     "MEMORY_L2_EXT_AR_STALL", "MEMORY", "Memory: l2 ext ar stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AR_CNT_Q1, 0x3ff0u,
+     "MEMORY_L2_EXT_AR_CNT_Q1", "MEMORY", "Memory: l2 ext ar cnt q1", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AR_CNT_Q2, 0x3ff0u,
+     "MEMORY_L2_EXT_AR_CNT_Q2", "MEMORY", "Memory: l2 ext ar cnt q2", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AR_CNT_Q3, 0x3ff0u,
+     "MEMORY_L2_EXT_AR_CNT_Q3", "MEMORY", "Memory: l2 ext ar cnt q3", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_RRESP_0_127, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_0_127", "MEMORY", "Memory: l2 ext rresp 0 127",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_RRESP_128_191, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_128_191", "MEMORY", "Memory: l2 ext rresp 128 191",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_RRESP_192_255, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_192_255", "MEMORY", "Memory: l2 ext rresp 192 255",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_RRESP_256_319, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_256_319", "MEMORY", "Memory: l2 ext rresp 256 319",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_RRESP_320_383, 0x3ff0u,
+     "MEMORY_L2_EXT_RRESP_320_383", "MEMORY", "Memory: l2 ext rresp 320 383",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_WRITE, 0x3fffu, "MEMORY_L2_EXT_WRITE",
+     "MEMORY", "Memory: l2 ext write", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_WRITE_NOSNP_FULL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_NOSNP_FULL", "MEMORY",
+     "Memory: l2 ext write nosnp full", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_WRITE_NOSNP_PTL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_NOSNP_PTL", "MEMORY",
+     "Memory: l2 ext write nosnp ptl", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_WRITE_SNP_FULL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_SNP_FULL", "MEMORY", "Memory: l2 ext write snp full",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_WRITE_SNP_PTL, 0x3ff0u,
+     "MEMORY_L2_EXT_WRITE_SNP_PTL", "MEMORY", "Memory: l2 ext write snp ptl",
+     "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_WRITE_BEATS, 0x3fffu,
+     "MEMORY_L2_EXT_WRITE_BEATS", "MEMORY", "Memory: l2 ext write beats",
+     "beats"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_W_STALL, 0x3fffu,
+     "MEMORY_L2_EXT_W_STALL", "MEMORY", "Memory: l2 ext w stall", "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AW_CNT_Q1, 0x3ff0u,
+     "MEMORY_L2_EXT_AW_CNT_Q1", "MEMORY", "Memory: l2 ext aw cnt q1", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AW_CNT_Q2, 0x3ff0u,
+     "MEMORY_L2_EXT_AW_CNT_Q2", "MEMORY", "Memory: l2 ext aw cnt q2", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_AW_CNT_Q3, 0x3ff0u,
+     "MEMORY_L2_EXT_AW_CNT_Q3", "MEMORY", "Memory: l2 ext aw cnt q3", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_SNOOP, 0x3ff0u, "MEMORY_L2_EXT_SNOOP",
+     "MEMORY", "Memory: l2 ext snoop", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_SNOOP_STALL, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_STALL", "MEMORY", "Memory: l2 ext snoop stall",
+     "cycles"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_SNOOP_RESP_CLEAN, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_RESP_CLEAN", "MEMORY",
+     "Memory: l2 ext snoop resp clean", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_SNOOP_RESP_DATA, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_RESP_DATA", "MEMORY",
+     "Memory: l2 ext snoop resp data", "events"},
+    {HPC_GPU_MALI_VALHALL_MEMORY_L2_EXT_SNOOP_INTERNAL, 0x3ff0u,
+     "MEMORY_L2_EXT_SNOOP_INTERNAL", "MEMORY", "Memory: l2 ext snoop internal",
+     "events"},
+    // clang-format on
+};
+
+/// The displacement of each perfect hash bucket.
+static const uint16_t hpc_gpu_mali_valhall_counter_displacements[48] = {
+    0, 5, 0, 6, 47, 2, 14, 53, 52, 2, 37, 163, 15, 68, 5, 1018, 0, 164, 33, 419,
+    259, 9, 88, 7, 543, 0, 0, 58, 54, 21, 108, 14, 0, 8, 51, 1, 7, 247, 377,
+    310, 15, 106, 765, 393, 163, 1325, 1515, 972,
+};
+
+/// The metadata index of each perfect hash slot.
+static const uint16_t hpc_gpu_mali_valhall_counter_slots[191] = {
+    96, 37, 178, 57, 26, 159, 51, 167, 5, 133, 30, 61, 73, 74, 188, 138, 2, 163,
+    68, 146, 13, 186, 34, 97, 148, 122, 44, 69, 35, 54, 143, 153, 130, 145, 116,
+    190, 169, 9, 139, 187, 25, 24, 36, 12, 136, 135, 127, 48, 149, 125, 23, 164,
+    16, 87, 137, 172, 123, 89, 94, 103, 185, 86, 131, 151, 21, 124, 50, 53, 179,
+    104, 121, 128, 46, 114, 6, 62, 109, 174, 59, 180, 170, 105, 155, 81, 28, 84,
+    106, 20, 90, 161, 66, 29, 55, 92, 95, 33, 18, 83, 140, 162, 32, 158, 63, 39,
+    77, 160, 17, 75, 126, 173, 40, 88, 110, 67, 7, 10, 171, 76, 144, 85, 49,
+    156, 19, 150, 183, 112, 102, 64, 41, 47, 177, 132, 154, 4, 107, 176, 72, 0,
+    147, 42, 117, 157, 134, 56, 70, 166, 119, 58, 115, 22, 52, 14, 108, 113, 99,
+    101, 152, 60, 71, 98, 175, 91, 181, 165, 182, 93, 38, 80, 100, 3, 11, 120,
+    43, 141, 111, 78, 45, 65, 184, 189, 27, 168, 129, 142, 1, 79, 82, 8, 118,
+    31, 15,
+};
+
+static const hpc_gpu_counter_registry_t hpc_gpu_mali_valhall_counter_registry =
+    {
+    191,
+    hpc_gpu_mali_valhall_counter_infos,
+    14,
+    hpc_gpu_mali_valhall_series_names,
+    48,
+    hpc_gpu_mali_valhall_counter_displacements,
+    hpc_gpu_mali_valhall_counter_slots,
+};
+
+//===--------------- END AUTOGENERATED REGION; DO NOT EDIT! ---------------===//
+
+const hpc_gpu_counter_registry_t *hpc_gpu_mali_valhall_get_counter_registry(
+    void) {
+  return &hpc_gpu_mali_valhall_counter_registry;
+}
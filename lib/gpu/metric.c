@@ -0,0 +1,497 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/metric.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+/// The maximal number of bytecode instructions in one metric.
+#define MAX_NUM_INSTRUCTIONS 256
+/// The maximal parenthesis nesting level accepted by the parser.
+#define MAX_NESTING_LEVEL 64
+/// The number of samples each instruction processes at a time during
+/// evaluation. The whole value stack then takes 16 KiB.
+#define BLOCK_SIZE 128
+
+typedef enum metric_opcode_e {
+  /// Pushes the constant at the operand index.
+  METRIC_OP_CONSTANT,
+  /// Pushes the counter at the operand column.
+  METRIC_OP_COUNTER,
+  /// Pushes the sample duration in seconds.
+  METRIC_OP_DURATION,
+  /// Negates the top value.
+  METRIC_OP_NEGATE,
+  /// Pops two values and pushes their sum.
+  METRIC_OP_ADD,
+  /// Pops two values and pushes their difference.
+  METRIC_OP_SUBTRACT,
+  /// Pops two values and pushes their product.
+  METRIC_OP_MULTIPLY,
+  /// Pops two values and pushes their quotient, or zero if the divisor is zero.
+  METRIC_OP_DIVIDE,
+} metric_opcode_t;
+
+/// Instructions keep the opcode in the low 8 bits and the operand above.
+#define METRIC_INSTRUCTION(opcode, operand) \
+  ((uint32_t)(opcode) | (operand) << 8)
+#define METRIC_OPCODE(instruction) ((instruction)&0xffu)
+#define METRIC_OPERAND(instruction) ((instruction) >> 8)
+
+typedef struct hpc_gpu_metric_t {
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The number of bytecode instructions.
+  uint32_t num_instructions;
+  /// Whether any instruction pushes the sample duration.
+  int uses_duration;
+  /// The constants referenced by the bytecode.
+  const double *constants;
+  /// The bytecode in postfix order.
+  const uint32_t *code;
+} hpc_gpu_metric_t;
+
+typedef struct metric_parser_t {
+  /// The next character to parse.
+  const char *cursor;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The name of each counter in a sample.
+  const char *const *counter_names;
+  /// The first error encountered, if any.
+  int status;
+  /// The current parenthesis nesting level.
+  uint32_t nesting_level;
+
+  uint32_t code[MAX_NUM_INSTRUCTIONS];
+  uint32_t num_instructions;
+  double constants[MAX_NUM_INSTRUCTIONS];
+  uint32_t num_constants;
+} metric_parser_t;
+
+static void parser_fail(metric_parser_t *parser, int error) {
+  if (parser->status != 0) return;
+  errno = error;
+  parser->status = -1;
+}
+
+static void parser_skip_spaces(metric_parser_t *parser) {
+  while (*parser->cursor == ' ' || *parser->cursor == '\t' ||
+         *parser->cursor == '\n' || *parser->cursor == '\r') {
+    ++parser->cursor;
+  }
+}
+
+static void parser_emit(metric_parser_t *parser, metric_opcode_t opcode,
+                        uint32_t operand) {
+  if (parser->num_instructions == MAX_NUM_INSTRUCTIONS) {
+    parser_fail(parser, E2BIG);
+    return;
+  }
+  parser->code[parser->num_instructions++] =
+      METRIC_INSTRUCTION(opcode, operand);
+}
+
+static void parser_emit_constant(metric_parser_t *parser, double value) {
+  if (parser->num_instructions == MAX_NUM_INSTRUCTIONS) {
+    parser_fail(parser, E2BIG);
+    return;
+  }
+  parser->constants[parser->num_constants] = value;
+  parser_emit(parser, METRIC_OP_CONSTANT, parser->num_constants++);
+}
+
+/// Returns whether the instruction `offset` places from the end pushes a
+/// constant.
+static int parser_is_constant(const metric_parser_t *parser, uint32_t offset) {
+  return parser->num_instructions >= offset &&
+         METRIC_OPCODE(parser->code[parser->num_instructions - offset]) ==
+             METRIC_OP_CONSTANT;
+}
+
+static double apply_operator(metric_opcode_t opcode, double lhs, double rhs) {
+  switch (opcode) {
+    case METRIC_OP_ADD:
+      return lhs + rhs;
+    case METRIC_OP_SUBTRACT:
+      return lhs - rhs;
+    case METRIC_OP_MULTIPLY:
+      return lhs * rhs;
+    default:
+      return rhs != 0.0 ? lhs / rhs : 0.0;
+  }
+}
+
+/// Emits a binary operator, folding it if both operands are constants.
+///
+/// An operand that is a single constant push is always the last instruction
+/// of its subexpression, and constants are appended in emission order, so
+/// the two operands are the last two constants.
+static void parser_emit_operator(metric_parser_t *parser,
+                                 metric_opcode_t opcode) {
+  if (parser->status != 0) return;
+  if (parser_is_constant(parser, 1) && parser_is_constant(parser, 2)) {
+    double rhs = parser->constants[--parser->num_constants];
+    double lhs = parser->constants[--parser->num_constants];
+    parser->num_instructions -= 2;
+    parser_emit_constant(parser, apply_operator(opcode, lhs, rhs));
+    return;
+  }
+  parser_emit(parser, opcode, 0);
+}
+
+static void parse_expression(metric_parser_t *parser);
+
+static void parse_number(metric_parser_t *parser) {
+  char *end = NULL;
+  double value = strtod(parser->cursor, &end);
+  if (end == parser->cursor) {
+    parser_fail(parser, EINVAL);
+    return;
+  }
+  parser->cursor = end;
+  parser_emit_constant(parser, value);
+}
+
+static int is_identifier_character(char c) {
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+         (c >= '0' && c <= '9') || c == '_';
+}
+
+static void parse_identifier(metric_parser_t *parser) {
+  const char *name = parser->cursor;
+  size_t length = 0;
+  while (is_identifier_character(name[length])) ++length;
+  parser->cursor += length;
+
+  if (length == 8 && strncmp(name, "duration", length) == 0) {
+    parser_emit(parser, METRIC_OP_DURATION, 0);
+    return;
+  }
+
+  for (uint32_t i = 0; i < parser->num_counters; ++i) {
+    const char *counter_name = parser->counter_names[i];
+    if (strncmp(counter_name, name, length) == 0 &&
+        counter_name[length] == '\0') {
+      parser_emit(parser, METRIC_OP_COUNTER, i);
+      return;
+    }
+  }
+  if (parser->status == 0) parser->status = -HPC_GPU_ERROR_UNSUPPORTED_COUNTER;
+}
+
+static void parse_primary(metric_parser_t *parser) {
+  parser_skip_spaces(parser);
+  char c = *parser->cursor;
+  if (c == '(') {
+    if (++parser->nesting_level > MAX_NESTING_LEVEL) {
+      parser_fail(parser, E2BIG);
+      return;
+    }
+    ++parser->cursor;
+    parse_expression(parser);
+    parser_skip_spaces(parser);
+    if (*parser->cursor != ')') {
+      parser_fail(parser, EINVAL);
+      return;
+    }
+    ++parser->cursor;
+    --parser->nesting_level;
+  } else if ((c >= '0' && c <= '9') || c == '.') {
+    parse_number(parser);
+  } else if (is_identifier_character(c)) {
+    parse_identifier(parser);
+  } else {
+    parser_fail(parser, EINVAL);
+  }
+}
+
+static void parse_unary(metric_parser_t *parser) {
+  parser_skip_spaces(parser);
+  if (*parser->cursor != '-') {
+    parse_primary(parser);
+    return;
+  }
+
+  ++parser->cursor;
+  if (++parser->nesting_level > MAX_NESTING_LEVEL) {
+    parser_fail(parser, E2BIG);
+    return;
+  }
+  parse_unary(parser);
+  --parser->nesting_level;
+  if (parser->status != 0) return;
+
+  if (parser_is_constant(parser, 1)) {
+    double *constant = &parser->constants[parser->num_constants - 1];
+    *constant = -*constant;
+  } else {
+    parser_emit(parser, METRIC_OP_NEGATE, 0);
+  }
+}
+
+static void parse_term(metric_parser_t *parser) {
+  parse_unary(parser);
+  while (parser->status == 0) {
+    parser_skip_spaces(parser);
+    char c = *parser->cursor;
+    if (c != '*' && c != '/') return;
+    ++parser->cursor;
+    parse_unary(parser);
+    parser_emit_operator(parser,
+                         c == '*' ? METRIC_OP_MULTIPLY : METRIC_OP_DIVIDE);
+  }
+}
+
+static void parse_expression(metric_parser_t *parser) {
+  parse_term(parser);
+  while (parser->status == 0) {
+    parser_skip_spaces(parser);
+    char c = *parser->cursor;
+    if (c != '+' && c != '-') return;
+    ++parser->cursor;
+    parse_term(parser);
+    parser_emit_operator(parser, c == '+' ? METRIC_OP_ADD : METRIC_OP_SUBTRACT);
+  }
+}
+
+/// Returns the maximal number of values live on the stack while running the
+/// bytecode.
+static uint32_t get_max_stack_depth(const uint32_t *code,
+                                    uint32_t num_instructions) {
+  uint32_t depth = 0;
+  uint32_t max_depth = 0;
+  for (uint32_t i = 0; i < num_instructions; ++i) {
+    switch (METRIC_OPCODE(code[i])) {
+      case METRIC_OP_CONSTANT:
+      case METRIC_OP_COUNTER:
+      case METRIC_OP_DURATION:
+        if (++depth > max_depth) max_depth = depth;
+        break;
+      case METRIC_OP_NEGATE:
+        break;
+      default:
+        --depth;
+        break;
+    }
+  }
+  return max_depth;
+}
+
+int hpc_gpu_compile_metric(const char *expression, uint32_t num_counters,
+                           const char *const *counter_names,
+                           const hpc_gpu_host_allocation_callbacks_t *allocator,
+                           hpc_gpu_metric_t **out_metric) {
+  metric_parser_t *parser =
+      allocator->alloc(allocator->user_data, sizeof(metric_parser_t));
+  memset(parser, 0, sizeof(metric_parser_t));
+  parser->cursor = expression;
+  parser->num_counters = num_counters;
+  parser->counter_names = counter_names;
+
+  parse_expression(parser);
+  parser_skip_spaces(parser);
+  if (*parser->cursor != '\0') parser_fail(parser, EINVAL);
+  if (parser->status == 0 &&
+      get_max_stack_depth(parser->code, parser->num_instructions) >
+          HPC_GPU_METRIC_MAX_STACK_DEPTH) {
+    parser_fail(parser, E2BIG);
+  }
+
+  int status = parser->status;
+  if (status != 0) {
+    allocator->free(allocator->user_data, parser);
+    return status;
+  }
+
+  // Keep everything in one allocation: the constants right after the struct,
+  // whose size is a multiple of the pointer size, then the bytecode.
+  size_t constants_size = parser->num_constants * sizeof(double);
+  size_t code_size = parser->num_instructions * sizeof(uint32_t);
+  hpc_gpu_metric_t *metric =
+      allocator->alloc(allocator->user_data,
+                       sizeof(hpc_gpu_metric_t) + constants_size + code_size);
+  double *constants = (double *)(metric + 1);
+  uint32_t *code = (uint32_t *)((char *)constants + constants_size);
+  memcpy(constants, parser->constants, constants_size);
+  memcpy(code, parser->code, code_size);
+
+  metric->num_counters = num_counters;
+  metric->num_instructions = parser->num_instructions;
+  metric->uses_duration = 0;
+  for (uint32_t i = 0; i < parser->num_instructions; ++i) {
+    if (METRIC_OPCODE(code[i]) == METRIC_OP_DURATION) metric->uses_duration = 1;
+  }
+  metric->constants = constants;
+  metric->code = code;
+
+  allocator->free(allocator->user_data, parser);
+  *out_metric = metric;
+  return 0;
+}
+
+int hpc_gpu_destroy_metric(
+    hpc_gpu_metric_t *metric,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  allocator->free(allocator->user_data, metric);
+  return 0;
+}
+
+int hpc_gpu_metric_uses_duration(const hpc_gpu_metric_t *metric) {
+  return metric->uses_duration;
+}
+
+/// Runs the bytecode over `num_samples` samples, at most `BLOCK_SIZE`, and
+/// leaves the results in `stack[0]`.
+static void evaluate_block(const hpc_gpu_metric_t *metric,
+                           uint32_t num_samples, const uint64_t *durations_ns,
+                           const uint64_t *values,
+                           double stack[][BLOCK_SIZE]) {
+  const size_t stride = metric->num_counters;
+  uint32_t top = 0;
+  for (uint32_t i = 0; i < metric->num_instructions; ++i) {
+    uint32_t instruction = metric->code[i];
+    metric_opcode_t opcode = METRIC_OPCODE(instruction);
+
+    if (opcode <= METRIC_OP_DURATION) {
+      double *restrict out = stack[top++];
+      if (opcode == METRIC_OP_CONSTANT) {
+        double value = metric->constants[METRIC_OPERAND(instruction)];
+        for (uint32_t j = 0; j < num_samples; ++j) out[j] = value;
+      } else if (opcode == METRIC_OP_COUNTER) {
+        const uint64_t *counter = values + METRIC_OPERAND(instruction);
+        for (uint32_t j = 0; j < num_samples; ++j) {
+          out[j] = (double)counter[j * stride];
+        }
+      } else {
+        for (uint32_t j = 0; j < num_samples; ++j) {
+          out[j] = (double)durations_ns[j] * 1e-9;
+        }
+      }
+      continue;
+    }
+
+    if (opcode == METRIC_OP_NEGATE) {
+      double *restrict value = stack[top - 1];
+      for (uint32_t j = 0; j < num_samples; ++j) value[j] = -value[j];
+      continue;
+    }
+
+    double *restrict lhs = stack[top - 2];
+    const double *restrict rhs = stack[top - 1];
+    --top;
+    switch (opcode) {
+      case METRIC_OP_ADD:
+        for (uint32_t j = 0; j < num_samples; ++j) lhs[j] += rhs[j];
+        break;
+      case METRIC_OP_SUBTRACT:
+        for (uint32_t j = 0; j < num_samples; ++j) lhs[j] -= rhs[j];
+        break;
+      case METRIC_OP_MULTIPLY:
+        for (uint32_t j = 0; j < num_samples; ++j) lhs[j] *= rhs[j];
+        break;
+      default:
+        for (uint32_t j = 0; j < num_samples; ++j) {
+          lhs[j] = rhs[j] != 0.0 ? lhs[j] / rhs[j] : 0.0;
+        }
+        break;
+    }
+  }
+}
+
+int hpc_gpu_metric_evaluate(const hpc_gpu_metric_t *metric,
+                            uint32_t num_samples, const uint64_t *durations_ns,
+                            const uint64_t *values, double *column) {
+  if (metric->uses_duration && durations_ns == NULL) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  double stack[HPC_GPU_METRIC_MAX_STACK_DEPTH][BLOCK_SIZE];
+  for (uint32_t base = 0; base < num_samples; base += BLOCK_SIZE) {
+    uint32_t count = num_samples - base;
+    if (count > BLOCK_SIZE) count = BLOCK_SIZE;
+    evaluate_block(metric, count,
+                   durations_ns != NULL ? durations_ns + base : NULL,
+                   values + (size_t)base * metric->num_counters, stack);
+    memcpy(column + base, stack[0], count * sizeof(double));
+  }
+  return 0;
+}
+
+static const hpc_gpu_metric_definition_t adreno_a6xx_metrics[] = {
+    {"alu_utilization",
+     "Fraction of busy shader processor cycles with the ALU working", "ratio",
+     "SP_ALU_WORKING_CYCLES / SP_BUSY_CYCLES"},
+    {"texture_stall_ratio",
+     "Fraction of busy shader processor cycles stalled on the texture pipe",
+     "ratio", "SP_STALL_CYCLES_TP / SP_BUSY_CYCLES"},
+    {"read_bandwidth",
+     "Bytes read from system memory through UCHE, assuming 32-byte beats",
+     "bytes/s",
+     "(UCHE_VBIF_READ_BEATS_CH0 + UCHE_VBIF_READ_BEATS_CH1) * 32 / duration"},
+};
+
+static const hpc_gpu_metric_definition_t mali_valhall_metrics[] = {
+    {"alu_utilization",
+     "FMA instructions issued per active execution engine cycle", "ratio",
+     "SHADER_CORE_EXEC_INSTR_FMA / SHADER_CORE_EXEC_CORE_ACTIVE"},
+    {"texture_stall_ratio",
+     "Texture fetch stall cycles per active execution engine cycle", "ratio",
+     "SHADER_CORE_TEX_TFCH_CLK_STALLED / SHADER_CORE_EXEC_CORE_ACTIVE"},
+    {"read_bandwidth",
+     "Bytes read from external memory by L2, assuming 16-byte beats",
+     "bytes/s", "MEMORY_L2_EXT_READ_BEATS * 16 / duration"},
+    {"write_bandwidth",
+     "Bytes written to external memory by L2, assuming 16-byte beats",
+     "bytes/s", "MEMORY_L2_EXT_WRITE_BEATS * 16 / duration"},
+};
+
+static const hpc_gpu_metric_definition_t mali_bifrost_metrics[] = {
+    {"alu_utilization",
+     "FMA instructions issued per active execution engine cycle", "ratio",
+     "SHADER_CORE_ARITH_INSTR_SINGLE_FMA / SHADER_CORE_EXEC_CORE_ACTIVE"},
+    {"read_bandwidth",
+     "Bytes read from external memory by L2, assuming 16-byte beats",
+     "bytes/s", "MEMORY_L2_EXT_READ_BEATS * 16 / duration"},
+    {"write_bandwidth",
+     "Bytes written to external memory by L2, assuming 16-byte beats",
+     "bytes/s", "MEMORY_L2_EXT_WRITE_BEATS * 16 / duration"},
+};
+
+#define METRIC_COUNT(metrics) (sizeof(metrics) / sizeof(metrics[0]))
+
+const hpc_gpu_metric_definition_t *hpc_gpu_get_builtin_metrics(
+    hpc_gpu_metric_series_t series, uint32_t *num_metrics) {
+  switch (series) {
+    case HPC_GPU_METRIC_SERIES_ADRENO_A6XX:
+      *num_metrics = METRIC_COUNT(adreno_a6xx_metrics);
+      return adreno_a6xx_metrics;
+    case HPC_GPU_METRIC_SERIES_MALI_VALHALL:
+      *num_metrics = METRIC_COUNT(mali_valhall_metrics);
+      return mali_valhall_metrics;
+    case HPC_GPU_METRIC_SERIES_MALI_BIFROST:
+      *num_metrics = METRIC_COUNT(mali_bifrost_metrics);
+      return mali_bifrost_metrics;
+  }
+  *num_metrics = 0;
+  return NULL;
+}
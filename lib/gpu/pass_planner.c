@@ -0,0 +1,336 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/pass_planner.h"
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+/// The number of search steps allowed after the first complete plan before
+/// settling for the best plan found so far.
+#define PASS_PLANNER_SEARCH_BUDGET 100000u
+
+/// Marks counters not assigned to any pass yet.
+#define PASS_PLANNER_UNASSIGNED UINT32_MAX
+
+/// Planning state. Items are the units of placement: either one counter or
+/// all counters of one set.
+typedef struct pass_planner_t {
+  /// The counters to plan.
+  const uint32_t *counters;
+  /// The number of counters.
+  uint32_t num_counters;
+  /// The number of registers in each group.
+  const uint32_t *group_capacities;
+  /// The number of groups.
+  uint32_t num_groups;
+  /// Counter indices ordered by item, with items in placement order.
+  uint32_t *members;
+  /// The index of each item's first member in `members`, plus one trailing
+  /// entry for the end.
+  uint32_t *item_starts;
+  /// The number of items.
+  uint32_t num_items;
+  /// The number of registers taken in each group of each pass.
+  uint32_t *pass_usages;
+  /// The index of each counter among distinct counter values. Duplicated
+  /// counters share one index.
+  uint32_t *counter_ids;
+  /// The number of distinct counter values.
+  uint32_t num_ids;
+  /// The number of counters with each distinct value in each pass. A value
+  /// takes a register in a pass while its count there is nonzero.
+  uint32_t *pass_id_counts;
+  /// The pass of each counter in the plan being searched.
+  uint32_t *assignments;
+  /// The pass of each counter in the best plan found so far.
+  uint32_t *best_assignments;
+  /// The number of passes in the best plan found so far.
+  uint32_t best_num_passes;
+  /// No plan can have fewer passes than this.
+  uint32_t lower_bound;
+  /// The number of search steps left.
+  uint32_t search_budget;
+} pass_planner_t;
+
+static inline uint32_t planner_get_group(uint32_t counter) {
+  return counter >> 8u;
+}
+
+/// Returns the pointer to the number of counters sharing the value of the
+/// counter at `index` in the given pass.
+static inline uint32_t *planner_get_pass_id_count(const pass_planner_t *planner,
+                                                  uint32_t pass,
+                                                  uint32_t index) {
+  return &planner->pass_id_counts[(size_t)pass * planner->num_ids +
+                                  planner->counter_ids[index]];
+}
+
+static void planner_unplace_item(pass_planner_t *planner, uint32_t item,
+                                 uint32_t pass) {
+  for (uint32_t k = planner->item_starts[item];
+       k < planner->item_starts[item + 1]; ++k) {
+    uint32_t index = planner->members[k];
+    planner->assignments[index] = PASS_PLANNER_UNASSIGNED;
+    // The last counter with a value in the pass releases its register.
+    if (--*planner_get_pass_id_count(planner, pass, index) != 0) continue;
+    uint32_t group = planner_get_group(planner->counters[index]);
+    --planner->pass_usages[pass * planner->num_groups + group];
+  }
+}
+
+/// Places the item into the given pass if it fits. Returns whether it did.
+static int planner_place_item(pass_planner_t *planner, uint32_t item,
+                              uint32_t pass) {
+  int fits = 1;
+  for (uint32_t k = planner->item_starts[item];
+       k < planner->item_starts[item + 1]; ++k) {
+    uint32_t index = planner->members[k];
+    // Only the first counter with a value in the pass takes a register.
+    if ((*planner_get_pass_id_count(planner, pass, index))++ == 0) {
+      uint32_t group = planner_get_group(planner->counters[index]);
+      uint32_t *usage =
+          &planner->pass_usages[pass * planner->num_groups + group];
+      fits &= ++*usage <= planner->group_capacities[group];
+    }
+    planner->assignments[index] = pass;
+  }
+  if (!fits) planner_unplace_item(planner, item, pass);
+  return fits;
+}
+
+/// Searches plans depth-first, placing items in order into each existing pass
+/// or one new pass. The first complete plan is first-fit decreasing; later
+/// ones only need to beat the best so far.
+static void planner_search(pass_planner_t *planner, uint32_t item,
+                           uint32_t num_passes) {
+  if (num_passes >= planner->best_num_passes) return;
+  if (item == planner->num_items) {
+    planner->best_num_passes = num_passes;
+    memcpy(planner->best_assignments, planner->assignments,
+           planner->num_counters * sizeof(uint32_t));
+    return;
+  }
+  if (planner->best_num_passes != PASS_PLANNER_UNASSIGNED) {
+    if (planner->search_budget == 0) return;
+    --planner->search_budget;
+  }
+
+  for (uint32_t pass = 0; pass <= num_passes; ++pass) {
+    if (!planner_place_item(planner, item, pass)) continue;
+    planner_search(planner, item + 1,
+                   pass == num_passes ? num_passes + 1 : num_passes);
+    planner_unplace_item(planner, item, pass);
+    if (planner->best_num_passes == planner->lower_bound) return;
+  }
+}
+
+int hpc_gpu_plan_passes(const hpc_gpu_pass_plan_info_t *plan_info,
+                        const hpc_gpu_host_allocation_callbacks_t *allocator,
+                        uint32_t *counter_passes, uint32_t *num_passes) {
+  uint32_t num_counters = plan_info->num_counters;
+  const uint32_t *counters = plan_info->counters;
+  uint32_t num_groups = plan_info->num_groups;
+
+  if (!plan_info->group_capacities) {
+    memset(counter_passes, 0, num_counters * sizeof(uint32_t));
+    *num_passes = num_counters ? 1 : 0;
+    return 0;
+  }
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    if (planner_get_group(counters[i]) >= num_groups) {
+      errno = EINVAL;
+      return -1;
+    }
+  }
+  if (num_counters == 0) {
+    *num_passes = 0;
+    return 0;
+  }
+
+  // Number distinct counter values so that placing a counter can tell in
+  // constant time whether its value already has a register in a pass.
+  uint32_t num_ids = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint32_t j = 0;
+    while (j < i && counters[j] != counters[i]) ++j;
+    num_ids += j == i;
+  }
+
+  // There can never be more passes than items, nor more items than counters.
+  size_t num_words = 8 * (size_t)num_counters + 1 +
+                     (size_t)num_counters * num_groups +
+                     (size_t)num_counters * num_ids;
+  uint32_t *memory =
+      allocator->alloc(allocator->user_data, num_words * sizeof(uint32_t));
+
+  pass_planner_t planner;
+  planner.counters = counters;
+  planner.num_counters = num_counters;
+  planner.group_capacities = plan_info->group_capacities;
+  planner.num_groups = num_groups;
+  planner.members = memory;
+  planner.item_starts = planner.members + num_counters;
+  planner.assignments = planner.item_starts + num_counters + 1;
+  planner.best_assignments = planner.assignments + num_counters;
+  uint32_t *counter_items = planner.best_assignments + num_counters;
+  uint32_t *item_order = counter_items + num_counters;
+  uint32_t *item_keys = item_order + num_counters;
+  planner.pass_usages = item_keys + num_counters;
+  planner.counter_ids = planner.pass_usages + (size_t)num_counters * num_groups;
+  planner.num_ids = num_ids;
+  planner.pass_id_counts = planner.counter_ids + num_counters;
+  memset(planner.pass_usages, 0,
+         (size_t)num_counters * num_groups * sizeof(uint32_t));
+  memset(planner.pass_id_counts, 0,
+         (size_t)num_counters * num_ids * sizeof(uint32_t));
+  uint32_t next_id = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint32_t j = 0;
+    while (j < i && counters[j] != counters[i]) ++j;
+    planner.counter_ids[i] = j == i ? next_id++ : planner.counter_ids[j];
+  }
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    planner.assignments[i] = PASS_PLANNER_UNASSIGNED;
+  }
+
+  // Group counters into items by set.
+  const uint32_t *counter_sets = plan_info->counter_sets;
+  uint32_t num_items = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    counter_items[i] = num_items;
+    if (counter_sets && counter_sets[i] != HPC_GPU_PASS_PLANNER_NO_SET) {
+      for (uint32_t j = 0; j < i; ++j) {
+        if (counter_sets[j] == counter_sets[i]) {
+          counter_items[i] = counter_items[j];
+          break;
+        }
+      }
+    }
+    if (counter_items[i] == num_items) ++num_items;
+  }
+
+  // Lay out members by item with a counting sort, in unsorted item order
+  // for now.
+  memset(planner.item_starts, 0, (num_items + 1) * sizeof(uint32_t));
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    ++planner.item_starts[counter_items[i] + 1];
+  }
+  for (uint32_t item = 0; item < num_items; ++item) {
+    planner.item_starts[item + 1] += planner.item_starts[item];
+  }
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    planner.members[planner.item_starts[counter_items[i]]++] = i;
+  }
+  for (uint32_t item = num_items; item > 0; --item) {
+    planner.item_starts[item] = planner.item_starts[item - 1];
+  }
+  planner.item_starts[0] = 0;
+  planner.num_items = num_items;
+
+  // Size each item by its largest share of any group's registers, which also
+  // catches sets that cannot fit into a pass at all.
+  for (uint32_t item = 0; item < num_items; ++item) {
+    if (!planner_place_item(&planner, item, 0)) {
+      allocator->free(allocator->user_data, memory);
+      errno = E2BIG;
+      return -1;
+    }
+    uint32_t key = 0;
+    for (uint32_t group = 0; group < num_groups; ++group) {
+      uint32_t usage = planner.pass_usages[group];
+      if (usage == 0) continue;
+      uint32_t share = (uint32_t)(((uint64_t)usage << 16) /
+                                  planner.group_capacities[group]);
+      if (share > key) key = share;
+    }
+    item_keys[item] = key;
+    planner_unplace_item(&planner, item, 0);
+  }
+
+  // Sort items by decreasing size; insertion sort keeps equal items in input
+  // order.
+  for (uint32_t k = 0; k < num_items; ++k) {
+    uint32_t item = k, key = item_keys[k];
+    uint32_t j = k;
+    for (; j > 0 && item_keys[item_order[j - 1]] < key; --j) {
+      item_order[j] = item_order[j - 1];
+    }
+    item_order[j] = item;
+  }
+
+  // Rebuild the member layout in sorted order, reusing `counter_passes` as
+  // scratch for the sorted members.
+  uint32_t num_members = 0;
+  for (uint32_t k = 0; k < num_items; ++k) {
+    uint32_t item = item_order[k];
+    for (uint32_t m = planner.item_starts[item];
+         m < planner.item_starts[item + 1]; ++m) {
+      counter_passes[num_members++] = planner.members[m];
+    }
+  }
+  memcpy(planner.members, counter_passes, num_counters * sizeof(uint32_t));
+  uint32_t *item_sizes = item_keys;  // Scratch; keys are no longer needed
+  for (uint32_t item = 0; item < num_items; ++item) {
+    item_sizes[item] =
+        planner.item_starts[item + 1] - planner.item_starts[item];
+  }
+  for (uint32_t k = 0; k < num_items; ++k) {
+    planner.item_starts[k + 1] =
+        planner.item_starts[k] + item_sizes[item_order[k]];
+  }
+
+  // Each group needs at least as many passes as its distinct counters fill.
+  planner.lower_bound = 1;
+  uint32_t *group_counts = planner.pass_usages;  // Scratch; cleared below
+  next_id = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    // Counters are numbered in order, so a new number marks a first one.
+    if (planner.counter_ids[i] != next_id) continue;
+    ++next_id;
+    uint32_t group = planner_get_group(counters[i]);
+    uint32_t capacity = planner.group_capacities[group];
+    uint32_t count = ++group_counts[group];
+    uint32_t bound = (count + capacity - 1) / capacity;
+    if (bound > planner.lower_bound) planner.lower_bound = bound;
+  }
+  memset(group_counts, 0, num_groups * sizeof(uint32_t));
+
+  planner.best_num_passes = PASS_PLANNER_UNASSIGNED;
+  planner.search_budget = PASS_PLANNER_SEARCH_BUDGET;
+  planner_search(&planner, 0, 0);
+
+  // Number passes by their first counter so plans read in input order.
+  uint32_t *pass_renames = counter_items;  // Scratch
+  for (uint32_t pass = 0; pass < planner.best_num_passes; ++pass) {
+    pass_renames[pass] = PASS_PLANNER_UNASSIGNED;
+  }
+  uint32_t num_renamed = 0;
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint32_t pass = planner.best_assignments[i];
+    if (pass_renames[pass] == PASS_PLANNER_UNASSIGNED) {
+      pass_renames[pass] = num_renamed++;
+    }
+    counter_passes[i] = pass_renames[pass];
+  }
+  *num_passes = planner.best_num_passes;
+
+  allocator->free(allocator->user_data, memory);
+  return 0;
+}
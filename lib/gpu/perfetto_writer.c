@@ -0,0 +1,574 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/perfetto_writer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+/// The number of blocks the buffer is split into. One is filled by the
+/// appending thread while the others wait to be or are being written.
+#define NUM_BLOCKS 4
+#define DEFAULT_BUFFER_SIZE (256u << 10)
+/// The smallest block, large enough for any counter event packet.
+#define MIN_BLOCK_SIZE 256
+
+/// The UUID of the parent track; counter tracks follow it.
+#define PARENT_TRACK_UUID UINT64_C(0x4850432d47505500)
+/// The sequence ID shared by all packets.
+#define SEQUENCE_ID 1
+
+// Protobuf wire types.
+#define WIRE_VARINT 0
+#define WIRE_LENGTH_DELIMITED 2
+#define FIELD_TAG(field, wire_type) (((field) << 3) | (wire_type))
+
+// Field numbers from perfetto/protos/perfetto/trace/.
+#define TRACE_PACKET 1
+#define TRACE_PACKET_CLOCK_SNAPSHOT 6
+#define TRACE_PACKET_TIMESTAMP 8
+#define TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID 10
+#define TRACE_PACKET_TRACK_EVENT 11
+#define TRACE_PACKET_SEQUENCE_FLAGS 13
+#define TRACE_PACKET_TIMESTAMP_CLOCK_ID 58
+#define TRACE_PACKET_TRACK_DESCRIPTOR 60
+#define CLOCK_SNAPSHOT_CLOCKS 1
+#define CLOCK_SNAPSHOT_CLOCK_ID 1
+#define CLOCK_SNAPSHOT_TIMESTAMP 2
+#define TRACK_DESCRIPTOR_UUID 1
+#define TRACK_DESCRIPTOR_NAME 2
+#define TRACK_DESCRIPTOR_PARENT_UUID 5
+#define TRACK_DESCRIPTOR_COUNTER 8
+#define COUNTER_DESCRIPTOR_UNIT_NAME 6
+#define TRACK_EVENT_TYPE 9
+#define TRACK_EVENT_TRACK_UUID 11
+#define TRACK_EVENT_COUNTER_VALUE 30
+
+#define SEQUENCE_INCREMENTAL_STATE_CLEARED 1
+#define TRACK_EVENT_TYPE_COUNTER 4
+#define BUILTIN_CLOCK_MONOTONIC 3
+#define BUILTIN_CLOCK_BOOTTIME 6
+
+typedef struct hpc_gpu_perfetto_writer_t {
+  /// The trace file descriptor.
+  int fd;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The longest time appended samples may stay buffered, or zero.
+  uint64_t flush_period_ns;
+
+  /// The buffer blocks, `block_size` bytes each.
+  uint8_t *blocks;
+  uint32_t block_size;
+
+  /// The guard of fields below. Appending holds it while encoding packets, so
+  /// that the writer thread can queue the block being filled once it gets
+  /// older than `flush_period_ns`.
+  pthread_mutex_t mutex;
+  /// The block being filled by the appending thread.
+  uint32_t fill_block;
+  /// The number of bytes used in each block.
+  uint32_t block_sizes[NUM_BLOCKS];
+  /// The time the block being filled received its first packet.
+  uint64_t block_start_time;
+  /// Signaled when a block is queued, the block being filled receives its
+  /// first packet, or the writer thread should exit. It waits on
+  /// `CLOCK_MONOTONIC`.
+  pthread_cond_t queued_cond;
+  /// Signaled when the writer thread finished writing a block.
+  pthread_cond_t written_cond;
+  /// The oldest queued block. Queued blocks follow it in ring order, and
+  /// `fill_block` follows the queued blocks.
+  uint32_t queue_head;
+  /// The number of queued blocks, including the one being written.
+  uint32_t num_queued;
+  /// Whether the writer thread should exit once the queue is empty.
+  int exiting;
+  /// The `errno` of the first error encountered when writing the file, or 0.
+  int status;
+  /// The writer thread.
+  pthread_t thread;
+} hpc_gpu_perfetto_writer_t;
+
+static uint64_t get_clock_time_ns(clockid_t clock) {
+  struct timespec time;
+  clock_gettime(clock, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static uint32_t get_varint_size(uint64_t value) {
+  uint32_t size = 1;
+  while (value >= 0x80u) {
+    value >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+static uint8_t *put_varint(uint8_t *buffer, uint64_t value) {
+  while (value >= 0x80u) {
+    *buffer++ = (uint8_t)(value | 0x80u);
+    value >>= 7;
+  }
+  *buffer++ = (uint8_t)value;
+  return buffer;
+}
+
+/// Returns the size of a varint field.
+static uint32_t get_varint_field_size(uint32_t field, uint64_t value) {
+  return get_varint_size(FIELD_TAG(field, WIRE_VARINT)) +
+         get_varint_size(value);
+}
+
+static uint8_t *put_varint_field(uint8_t *buffer, uint32_t field,
+                                 uint64_t value) {
+  buffer = put_varint(buffer, FIELD_TAG(field, WIRE_VARINT));
+  return put_varint(buffer, value);
+}
+
+/// Returns the size of a length-delimited field with `length` bytes.
+static uint32_t get_length_field_size(uint32_t field, uint32_t length) {
+  return get_varint_size(FIELD_TAG(field, WIRE_LENGTH_DELIMITED)) +
+         get_varint_size(length) + length;
+}
+
+/// Writes the tag and length of a length-delimited field, leaving its
+/// content to the caller.
+static uint8_t *put_length_field_header(uint8_t *buffer, uint32_t field,
+                                        uint32_t length) {
+  buffer = put_varint(buffer, FIELD_TAG(field, WIRE_LENGTH_DELIMITED));
+  return put_varint(buffer, length);
+}
+
+static uint8_t *put_string_field(uint8_t *buffer, uint32_t field,
+                                 const char *string, uint32_t length) {
+  buffer = put_length_field_header(buffer, field, length);
+  memcpy(buffer, string, length);
+  return buffer + length;
+}
+
+//===----------------------------------------------------------------------===//
+// Writer thread
+//===----------------------------------------------------------------------===//
+
+static int write_fully(int fd, const uint8_t *data, size_t size) {
+  while (size != 0) {
+    ssize_t num_written = write(fd, data, size);
+    if (num_written < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    data += num_written;
+    size -= (size_t)num_written;
+  }
+  return 0;
+}
+
+/// Queues the block being filled for writing and moves on to the next block.
+/// The caller must hold the mutex and make sure the next block is not
+/// queued.
+static void writer_queue_fill_block(hpc_gpu_perfetto_writer_t *writer) {
+  ++writer->num_queued;
+  writer->fill_block = (writer->fill_block + 1) % NUM_BLOCKS;
+  pthread_cond_signal(&writer->queued_cond);
+}
+
+/// Waits for the writer thread to be woken up. With a flush period, this
+/// queues the block being filled once its first packet gets that old, so
+/// samples are written out even if appending stops. The caller must hold the
+/// mutex, and no block may be queued.
+static void writer_wait_queued(hpc_gpu_perfetto_writer_t *writer) {
+  if (writer->flush_period_ns == 0 ||
+      writer->block_sizes[writer->fill_block] == 0) {
+    pthread_cond_wait(&writer->queued_cond, &writer->mutex);
+    return;
+  }
+
+  uint64_t deadline = writer->block_start_time + writer->flush_period_ns;
+  if (get_clock_time_ns(CLOCK_MONOTONIC) >= deadline) {
+    writer_queue_fill_block(writer);
+    return;
+  }
+  struct timespec time;
+  time.tv_sec = (time_t)(deadline / 1000000000u);
+  time.tv_nsec = (long)(deadline % 1000000000u);
+  pthread_cond_timedwait(&writer->queued_cond, &writer->mutex, &time);
+}
+
+static void *writer_thread_main(void *data) {
+  hpc_gpu_perfetto_writer_t *writer = (hpc_gpu_perfetto_writer_t *)data;
+
+  pthread_mutex_lock(&writer->mutex);
+  for (;;) {
+    while (writer->num_queued == 0 && !writer->exiting) {
+      writer_wait_queued(writer);
+    }
+    if (writer->num_queued == 0) break;
+
+    uint32_t block = writer->queue_head;
+    int failed = writer->status != 0;
+    pthread_mutex_unlock(&writer->mutex);
+
+    // After the first failure blocks are dropped, so that appending never
+    // waits for a file that cannot be written.
+    int error = 0;
+    if (!failed &&
+        write_fully(writer->fd, writer->blocks + block * writer->block_size,
+                    writer->block_sizes[block]) < 0) {
+      error = errno;
+    }
+
+    pthread_mutex_lock(&writer->mutex);
+    if (error != 0 && writer->status == 0) writer->status = error;
+    writer->block_sizes[block] = 0;
+    writer->queue_head = (block + 1) % NUM_BLOCKS;
+    --writer->num_queued;
+    pthread_cond_broadcast(&writer->written_cond);
+  }
+  pthread_mutex_unlock(&writer->mutex);
+
+  return NULL;
+}
+
+/// Queues the block being filled for writing and waits until the next one
+/// is free. The caller must hold the mutex.
+static void writer_submit_block(hpc_gpu_perfetto_writer_t *writer) {
+  writer_queue_fill_block(writer);
+  while (writer->num_queued == NUM_BLOCKS) {
+    pthread_cond_wait(&writer->written_cond, &writer->mutex);
+  }
+}
+
+/// Returns 0, or -1 with `errno` set to the first error encountered when
+/// writing the file. The caller must hold the mutex.
+static int writer_get_status(const hpc_gpu_perfetto_writer_t *writer) {
+  if (writer->status == 0) return 0;
+  errno = writer->status;
+  return -1;
+}
+
+//===----------------------------------------------------------------------===//
+// Packet encoding
+//===----------------------------------------------------------------------===//
+
+/// Returns the size of a clock snapshot packet.
+static uint32_t get_clock_snapshot_sizes(uint64_t monotonic_time,
+                                         uint64_t boot_time,
+                                         uint32_t *monotonic_size,
+                                         uint32_t *boot_size,
+                                         uint32_t *snapshot_size,
+                                         uint32_t *body_size) {
+  *monotonic_size =
+      get_varint_field_size(CLOCK_SNAPSHOT_CLOCK_ID, BUILTIN_CLOCK_MONOTONIC) +
+      get_varint_field_size(CLOCK_SNAPSHOT_TIMESTAMP, monotonic_time);
+  *boot_size =
+      get_varint_field_size(CLOCK_SNAPSHOT_CLOCK_ID, BUILTIN_CLOCK_BOOTTIME) +
+      get_varint_field_size(CLOCK_SNAPSHOT_TIMESTAMP, boot_time);
+  *snapshot_size = get_length_field_size(CLOCK_SNAPSHOT_CLOCKS,
+                                         *monotonic_size) +
+                   get_length_field_size(CLOCK_SNAPSHOT_CLOCKS, *boot_size);
+  *body_size = get_length_field_size(TRACE_PACKET_CLOCK_SNAPSHOT,
+                                     *snapshot_size) +
+               get_varint_field_size(TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID,
+                                     SEQUENCE_ID);
+  return get_length_field_size(TRACE_PACKET, *body_size);
+}
+
+/// Writes a clock snapshot relating `CLOCK_MONOTONIC` timestamps to the
+/// default `CLOCK_BOOTTIME` trace clock.
+static uint8_t *put_clock_snapshot(uint8_t *buffer, uint64_t monotonic_time,
+                                   uint64_t boot_time) {
+  uint32_t monotonic_size, boot_size, snapshot_size, body_size;
+  get_clock_snapshot_sizes(monotonic_time, boot_time, &monotonic_size,
+                           &boot_size, &snapshot_size, &body_size);
+
+  buffer = put_length_field_header(buffer, TRACE_PACKET, body_size);
+  buffer = put_length_field_header(buffer, TRACE_PACKET_CLOCK_SNAPSHOT,
+                                   snapshot_size);
+  buffer = put_length_field_header(buffer, CLOCK_SNAPSHOT_CLOCKS,
+                                   monotonic_size);
+  buffer = put_varint_field(buffer, CLOCK_SNAPSHOT_CLOCK_ID,
+                            BUILTIN_CLOCK_MONOTONIC);
+  buffer = put_varint_field(buffer, CLOCK_SNAPSHOT_TIMESTAMP, monotonic_time);
+  buffer = put_length_field_header(buffer, CLOCK_SNAPSHOT_CLOCKS, boot_size);
+  buffer = put_varint_field(buffer, CLOCK_SNAPSHOT_CLOCK_ID,
+                            BUILTIN_CLOCK_BOOTTIME);
+  buffer = put_varint_field(buffer, CLOCK_SNAPSHOT_TIMESTAMP, boot_time);
+  return put_varint_field(buffer, TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID,
+                          SEQUENCE_ID);
+}
+
+/// Returns a pointer to `size` free bytes in the block being filled,
+/// submitting the block first if it is too full. Each block starts with a
+/// clock snapshot, so that monotonic timestamps stay convertible to the trace
+/// clock across system suspends. The caller must hold the mutex.
+static uint8_t *writer_reserve(hpc_gpu_perfetto_writer_t *writer,
+                               uint32_t size) {
+  if (writer->block_sizes[writer->fill_block] + size > writer->block_size) {
+    writer_submit_block(writer);
+  }
+  uint32_t block = writer->fill_block;
+
+  uint8_t *begin = writer->blocks + block * writer->block_size;
+  if (writer->block_sizes[block] == 0) {
+    uint64_t monotonic_time = get_clock_time_ns(CLOCK_MONOTONIC);
+    uint8_t *end = put_clock_snapshot(begin, monotonic_time,
+                                      get_clock_time_ns(CLOCK_BOOTTIME));
+    writer->block_sizes[block] = (uint32_t)(end - begin);
+    writer->block_start_time = monotonic_time;
+    // Let the writer thread time the flush period from the first packet.
+    if (writer->flush_period_ns != 0) {
+      pthread_cond_signal(&writer->queued_cond);
+    }
+  }
+
+  uint8_t *buffer = begin + writer->block_sizes[block];
+  writer->block_sizes[block] += size;
+  return buffer;
+}
+
+/// Writes a track descriptor packet, or returns its size if `writer` is
+/// NULL. Counter tracks have a parent and a possibly empty unit.
+static uint32_t write_track_descriptor(hpc_gpu_perfetto_writer_t *writer,
+                                       uint64_t uuid, const char *name,
+                                       int is_counter, const char *unit,
+                                       int is_first) {
+  uint32_t name_length = (uint32_t)strlen(name);
+  uint32_t unit_length = unit != NULL ? (uint32_t)strlen(unit) : 0;
+
+  uint32_t counter_size =
+      unit_length != 0
+          ? get_length_field_size(COUNTER_DESCRIPTOR_UNIT_NAME, unit_length)
+          : 0;
+  uint32_t track_size =
+      get_varint_field_size(TRACK_DESCRIPTOR_UUID, uuid) +
+      get_length_field_size(TRACK_DESCRIPTOR_NAME, name_length);
+  if (is_counter) {
+    track_size +=
+        get_varint_field_size(TRACK_DESCRIPTOR_PARENT_UUID, PARENT_TRACK_UUID) +
+        get_length_field_size(TRACK_DESCRIPTOR_COUNTER, counter_size);
+  }
+  uint32_t body_size =
+      get_length_field_size(TRACE_PACKET_TRACK_DESCRIPTOR, track_size) +
+      get_varint_field_size(TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID,
+                            SEQUENCE_ID);
+  if (is_first) {
+    body_size += get_varint_field_size(TRACE_PACKET_SEQUENCE_FLAGS,
+                                       SEQUENCE_INCREMENTAL_STATE_CLEARED);
+  }
+  uint32_t packet_size = get_length_field_size(TRACE_PACKET, body_size);
+  if (writer == NULL) return packet_size;
+
+  uint8_t *buffer = writer_reserve(writer, packet_size);
+  buffer = put_length_field_header(buffer, TRACE_PACKET, body_size);
+  buffer = put_length_field_header(buffer, TRACE_PACKET_TRACK_DESCRIPTOR,
+                                   track_size);
+  buffer = put_varint_field(buffer, TRACK_DESCRIPTOR_UUID, uuid);
+  buffer = put_string_field(buffer, TRACK_DESCRIPTOR_NAME, name, name_length);
+  if (is_counter) {
+    buffer = put_varint_field(buffer, TRACK_DESCRIPTOR_PARENT_UUID,
+                              PARENT_TRACK_UUID);
+    buffer = put_length_field_header(buffer, TRACK_DESCRIPTOR_COUNTER,
+                                     counter_size);
+    if (unit_length != 0) {
+      buffer = put_string_field(buffer, COUNTER_DESCRIPTOR_UNIT_NAME, unit,
+                                unit_length);
+    }
+  }
+  buffer = put_varint_field(buffer, TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID,
+                            SEQUENCE_ID);
+  if (is_first) {
+    put_varint_field(buffer, TRACE_PACKET_SEQUENCE_FLAGS,
+                     SEQUENCE_INCREMENTAL_STATE_CLEARED);
+  }
+  return packet_size;
+}
+
+/// Writes a counter event packet.
+static void write_counter_event(hpc_gpu_perfetto_writer_t *writer,
+                                uint64_t uuid, uint64_t timestamp,
+                                uint64_t value) {
+  uint32_t event_size =
+      get_varint_field_size(TRACK_EVENT_TYPE, TRACK_EVENT_TYPE_COUNTER) +
+      get_varint_field_size(TRACK_EVENT_TRACK_UUID, uuid) +
+      get_varint_field_size(TRACK_EVENT_COUNTER_VALUE, value);
+  uint32_t body_size =
+      get_varint_field_size(TRACE_PACKET_TIMESTAMP, timestamp) +
+      get_varint_field_size(TRACE_PACKET_TIMESTAMP_CLOCK_ID,
+                            BUILTIN_CLOCK_MONOTONIC) +
+      get_varint_field_size(TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID,
+                            SEQUENCE_ID) +
+      get_length_field_size(TRACE_PACKET_TRACK_EVENT, event_size);
+
+  uint8_t *buffer = writer_reserve(
+      writer, get_length_field_size(TRACE_PACKET, body_size));
+  buffer = put_length_field_header(buffer, TRACE_PACKET, body_size);
+  buffer = put_varint_field(buffer, TRACE_PACKET_TIMESTAMP, timestamp);
+  buffer = put_varint_field(buffer, TRACE_PACKET_TIMESTAMP_CLOCK_ID,
+                            BUILTIN_CLOCK_MONOTONIC);
+  buffer = put_varint_field(buffer, TRACE_PACKET_TRUSTED_PACKET_SEQUENCE_ID,
+                            SEQUENCE_ID);
+  buffer = put_length_field_header(buffer, TRACE_PACKET_TRACK_EVENT,
+                                   event_size);
+  buffer = put_varint_field(buffer, TRACK_EVENT_TYPE, TRACK_EVENT_TYPE_COUNTER);
+  buffer = put_varint_field(buffer, TRACK_EVENT_TRACK_UUID, uuid);
+  put_varint_field(buffer, TRACK_EVENT_COUNTER_VALUE, value);
+}
+
+//===----------------------------------------------------------------------===//
+// Public API
+//===----------------------------------------------------------------------===//
+
+int hpc_gpu_create_perfetto_writer(
+    const char *path, const hpc_gpu_perfetto_writer_create_info_t *create_info,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_perfetto_writer_t **out_writer) {
+  uint32_t buffer_size = create_info->buffer_size != 0
+                             ? create_info->buffer_size
+                             : DEFAULT_BUFFER_SIZE;
+  uint32_t block_size = buffer_size / NUM_BLOCKS;
+  if (block_size < MIN_BLOCK_SIZE) block_size = MIN_BLOCK_SIZE;
+
+  // Every descriptor must fit into a block after the clock snapshot.
+  uint32_t unused[4];
+  uint32_t max_clock_snapshot_size = get_clock_snapshot_sizes(
+      UINT64_MAX, UINT64_MAX, &unused[0], &unused[1], &unused[2], &unused[3]);
+  uint32_t max_packet_size = write_track_descriptor(
+      NULL, PARENT_TRACK_UUID, create_info->track_name, 0, NULL, 1);
+  for (uint32_t i = 0; i < create_info->num_counters; ++i) {
+    const char *unit = create_info->counter_units != NULL
+                           ? create_info->counter_units[i]
+                           : NULL;
+    uint32_t size =
+        write_track_descriptor(NULL, PARENT_TRACK_UUID + 1 + i,
+                               create_info->counter_names[i], 1, unit, 0);
+    if (size > max_packet_size) max_packet_size = size;
+  }
+  if (max_clock_snapshot_size + max_packet_size > block_size) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) return fd;
+
+  hpc_gpu_perfetto_writer_t *writer = allocator->alloc(
+      allocator->user_data, sizeof(hpc_gpu_perfetto_writer_t));
+  memset(writer, 0, sizeof(hpc_gpu_perfetto_writer_t));
+  writer->fd = fd;
+  writer->num_counters = create_info->num_counters;
+  writer->flush_period_ns = create_info->flush_period_ns;
+  writer->block_size = block_size;
+  writer->blocks =
+      allocator->alloc(allocator->user_data, (size_t)block_size * NUM_BLOCKS);
+
+  pthread_condattr_t queued_cond_attr;
+  pthread_condattr_init(&queued_cond_attr);
+  pthread_condattr_setclock(&queued_cond_attr, CLOCK_MONOTONIC);
+  pthread_mutex_init(&writer->mutex, NULL);
+  pthread_cond_init(&writer->queued_cond, &queued_cond_attr);
+  pthread_cond_init(&writer->written_cond, NULL);
+  pthread_condattr_destroy(&queued_cond_attr);
+  int status =
+      pthread_create(&writer->thread, NULL, writer_thread_main, writer);
+  if (status != 0) {
+    pthread_cond_destroy(&writer->written_cond);
+    pthread_cond_destroy(&writer->queued_cond);
+    pthread_mutex_destroy(&writer->mutex);
+    allocator->free(allocator->user_data, writer->blocks);
+    allocator->free(allocator->user_data, writer);
+    close(fd);
+    errno = status;
+    return -1;
+  }
+
+  pthread_mutex_lock(&writer->mutex);
+  write_track_descriptor(writer, PARENT_TRACK_UUID, create_info->track_name,
+                         0, NULL, 1);
+  for (uint32_t i = 0; i < create_info->num_counters; ++i) {
+    const char *unit = create_info->counter_units != NULL
+                           ? create_info->counter_units[i]
+                           : NULL;
+    write_track_descriptor(writer, PARENT_TRACK_UUID + 1 + i,
+                           create_info->counter_names[i], 1, unit, 0);
+  }
+  pthread_mutex_unlock(&writer->mutex);
+
+  *out_writer = writer;
+  return 0;
+}
+
+int hpc_gpu_destroy_perfetto_writer(
+    hpc_gpu_perfetto_writer_t *writer,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  int status = hpc_gpu_perfetto_writer_flush(writer);
+  int error = status < 0 ? errno : 0;
+
+  pthread_mutex_lock(&writer->mutex);
+  writer->exiting = 1;
+  pthread_cond_signal(&writer->queued_cond);
+  pthread_mutex_unlock(&writer->mutex);
+  pthread_join(writer->thread, NULL);
+
+  pthread_cond_destroy(&writer->written_cond);
+  pthread_cond_destroy(&writer->queued_cond);
+  pthread_mutex_destroy(&writer->mutex);
+  if (close(writer->fd) < 0 && error == 0) error = errno;
+
+  allocator->free(allocator->user_data, writer->blocks);
+  allocator->free(allocator->user_data, writer);
+  if (error == 0) return 0;
+  errno = error;
+  return -1;
+}
+
+int hpc_gpu_perfetto_writer_append(hpc_gpu_perfetto_writer_t *writer,
+                                   uint32_t num_samples,
+                                   const uint64_t *timestamps,
+                                   const uint64_t *values) {
+  const uint32_t num_counters = writer->num_counters;
+  pthread_mutex_lock(&writer->mutex);
+  for (uint32_t i = 0; i < num_samples; ++i) {
+    const uint64_t *row = values + (size_t)i * num_counters;
+    for (uint32_t j = 0; j < num_counters; ++j) {
+      write_counter_event(writer, PARENT_TRACK_UUID + 1 + j, timestamps[i],
+                          row[j]);
+    }
+  }
+  int status = writer_get_status(writer);
+  pthread_mutex_unlock(&writer->mutex);
+  return status;
+}
+
+int hpc_gpu_perfetto_writer_flush(hpc_gpu_perfetto_writer_t *writer) {
+  pthread_mutex_lock(&writer->mutex);
+  if (writer->block_sizes[writer->fill_block] != 0) {
+    writer_submit_block(writer);
+  }
+  while (writer->num_queued != 0) {
+    pthread_cond_wait(&writer->written_cond, &writer->mutex);
+  }
+  int status = writer_get_status(writer);
+  pthread_mutex_unlock(&writer->mutex);
+  return status;
+}
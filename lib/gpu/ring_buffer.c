@@ -0,0 +1,304 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/ring_buffer.h"
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+// Assumed cache line size. 64 bytes covers all ARM and x86 cores we care
+// about; some ARM cores prefetch in pairs of lines but that's secondary.
+#define CACHE_LINE_SIZE 64
+
+typedef struct hpc_gpu_ring_buffer_t {
+  /// The sample records. Each record is one timestamp followed by the values
+  /// of all counters.
+  uint64_t *records;
+  /// Per-record sequence numbers used to order concurrent producers. Only
+  /// allocated in the multi-producer mode.
+  _Atomic uint32_t *sequences;
+  /// The number of uint64_t words in one record.
+  uint32_t record_size;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The number of records; always a power of two.
+  uint32_t capacity;
+  /// The producer mode.
+  hpc_gpu_ring_buffer_mode_t mode;
+
+  uint8_t padding0[CACHE_LINE_SIZE];
+
+  /// The index of the next record to write. Owned by producers.
+  _Atomic uint32_t write_index;
+  /// The producer's last observed read index, for avoiding touching the
+  /// consumer cache line on every push. Only used in single-producer mode.
+  uint32_t cached_read_index;
+
+  uint8_t padding1[CACHE_LINE_SIZE];
+
+  /// The index of the next record to read. Owned by the consumer.
+  _Atomic uint32_t read_index;
+  /// The consumer's last observed write index. Only used in single-producer
+  /// mode.
+  uint32_t cached_write_index;
+
+  uint8_t padding2[CACHE_LINE_SIZE];
+} hpc_gpu_ring_buffer_t;
+
+static uint32_t round_up_to_power_of_two(uint32_t x) {
+  uint32_t result = 1;
+  while (result < x) result <<= 1;
+  return result;
+}
+
+static inline void ring_buffer_write_record(hpc_gpu_ring_buffer_t *ring_buffer,
+                                            uint32_t index, uint64_t timestamp,
+                                            const uint64_t *values) {
+  uint64_t *record =
+      ring_buffer->records +
+      (size_t)(index & (ring_buffer->capacity - 1)) * ring_buffer->record_size;
+  record[0] = timestamp;
+  memcpy(record + 1, values, ring_buffer->num_counters * sizeof(uint64_t));
+}
+
+static inline void ring_buffer_read_record(
+    const hpc_gpu_ring_buffer_t *ring_buffer, uint32_t index,
+    uint64_t *timestamp, uint64_t *values) {
+  const uint64_t *record =
+      ring_buffer->records +
+      (size_t)(index & (ring_buffer->capacity - 1)) * ring_buffer->record_size;
+  *timestamp = record[0];
+  memcpy(values, record + 1, ring_buffer->num_counters * sizeof(uint64_t));
+}
+
+int hpc_gpu_create_ring_buffer(
+    uint32_t num_counters, uint32_t min_num_samples,
+    hpc_gpu_ring_buffer_mode_t mode,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_ring_buffer_t **out_ring_buffer) {
+  if (min_num_samples == 0 || min_num_samples > (1u << 31)) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  hpc_gpu_ring_buffer_t *ring_buffer =
+      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_ring_buffer_t));
+  memset(ring_buffer, 0, sizeof(hpc_gpu_ring_buffer_t));
+
+  ring_buffer->num_counters = num_counters;
+  ring_buffer->record_size = 1 + num_counters;
+  ring_buffer->capacity = round_up_to_power_of_two(min_num_samples);
+  ring_buffer->mode = mode;
+
+  ring_buffer->records = allocator->alloc(
+      allocator->user_data, (size_t)ring_buffer->capacity *
+                                ring_buffer->record_size * sizeof(uint64_t));
+
+  if (mode == HPC_GPU_RING_BUFFER_MULTI_PRODUCER) {
+    ring_buffer->sequences = allocator->alloc(
+        allocator->user_data, ring_buffer->capacity * sizeof(_Atomic uint32_t));
+    // Sequence number i means record i is free for the producer claiming
+    // write index i.
+    for (uint32_t i = 0; i < ring_buffer->capacity; ++i) {
+      atomic_init(&ring_buffer->sequences[i], i);
+    }
+  }
+
+  atomic_init(&ring_buffer->write_index, 0);
+  atomic_init(&ring_buffer->read_index, 0);
+
+  *out_ring_buffer = ring_buffer;
+  return 0;
+}
+
+int hpc_gpu_destroy_ring_buffer(
+    hpc_gpu_ring_buffer_t *ring_buffer,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  if (ring_buffer->sequences) {
+    allocator->free(allocator->user_data, (void *)ring_buffer->sequences);
+  }
+  allocator->free(allocator->user_data, ring_buffer->records);
+  allocator->free(allocator->user_data, ring_buffer);
+  return 0;
+}
+
+uint32_t hpc_gpu_ring_buffer_get_capacity(
+    const hpc_gpu_ring_buffer_t *ring_buffer) {
+  return ring_buffer->capacity;
+}
+
+uint32_t hpc_gpu_ring_buffer_get_num_counters(
+    const hpc_gpu_ring_buffer_t *ring_buffer) {
+  return ring_buffer->num_counters;
+}
+
+//===----------------------------------------------------------------------===//
+// Single producer
+//===----------------------------------------------------------------------===//
+
+static uint32_t ring_buffer_push_single(hpc_gpu_ring_buffer_t *ring_buffer,
+                                        uint32_t num_samples,
+                                        const uint64_t *timestamps,
+                                        const uint64_t *values) {
+  uint32_t write_index =
+      atomic_load_explicit(&ring_buffer->write_index, memory_order_relaxed);
+  uint32_t num_free = ring_buffer->capacity -
+                      (write_index - ring_buffer->cached_read_index);
+  if (num_free < num_samples) {
+    ring_buffer->cached_read_index =
+        atomic_load_explicit(&ring_buffer->read_index, memory_order_acquire);
+    num_free = ring_buffer->capacity -
+               (write_index - ring_buffer->cached_read_index);
+  }
+
+  uint32_t count = num_samples < num_free ? num_samples : num_free;
+  for (uint32_t i = 0; i < count; ++i) {
+    ring_buffer_write_record(ring_buffer, write_index + i, timestamps[i],
+                             values + (size_t)i * ring_buffer->num_counters);
+  }
+
+  atomic_store_explicit(&ring_buffer->write_index, write_index + count,
+                        memory_order_release);
+  return count;
+}
+
+static uint32_t ring_buffer_pop_single(hpc_gpu_ring_buffer_t *ring_buffer,
+                                       uint32_t max_num_samples,
+                                       uint64_t *timestamps, uint64_t *values) {
+  uint32_t read_index =
+      atomic_load_explicit(&ring_buffer->read_index, memory_order_relaxed);
+  uint32_t num_ready = ring_buffer->cached_write_index - read_index;
+  if (num_ready < max_num_samples) {
+    ring_buffer->cached_write_index =
+        atomic_load_explicit(&ring_buffer->write_index, memory_order_acquire);
+    num_ready = ring_buffer->cached_write_index - read_index;
+  }
+
+  uint32_t count = max_num_samples < num_ready ? max_num_samples : num_ready;
+  for (uint32_t i = 0; i < count; ++i) {
+    ring_buffer_read_record(ring_buffer, read_index + i, &timestamps[i],
+                            values + (size_t)i * ring_buffer->num_counters);
+  }
+
+  atomic_store_explicit(&ring_buffer->read_index, read_index + count,
+                        memory_order_release);
+  return count;
+}
+
+//===----------------------------------------------------------------------===//
+// Multiple producers
+//===----------------------------------------------------------------------===//
+
+// Producers claim write indices with a CAS and publish each record through
+// its sequence number:
+// * sequence == index: the record is free for the producer claiming `index`;
+// * sequence == index + 1: the record is written and ready for the consumer;
+// * sequence == index + capacity: the record was consumed and is free for
+//   the producer claiming `index + capacity`.
+
+static uint32_t ring_buffer_push_multiple(hpc_gpu_ring_buffer_t *ring_buffer,
+                                          uint32_t num_samples,
+                                          const uint64_t *timestamps,
+                                          const uint64_t *values) {
+  uint32_t mask = ring_buffer->capacity - 1;
+  uint32_t count = 0;
+  for (; count < num_samples; ++count) {
+    uint32_t write_index =
+        atomic_load_explicit(&ring_buffer->write_index, memory_order_relaxed);
+    for (;;) {
+      uint32_t sequence = atomic_load_explicit(
+          &ring_buffer->sequences[write_index & mask], memory_order_acquire);
+      int32_t difference = (int32_t)(sequence - write_index);
+      if (difference == 0) {
+        if (atomic_compare_exchange_weak_explicit(
+                &ring_buffer->write_index, &write_index, write_index + 1,
+                memory_order_relaxed, memory_order_relaxed)) {
+          break;
+        }
+      } else if (difference < 0) {
+        return count;  // Full
+      } else {
+        write_index = atomic_load_explicit(&ring_buffer->write_index,
+                                           memory_order_relaxed);
+      }
+    }
+
+    ring_buffer_write_record(ring_buffer, write_index, timestamps[count],
+                             values + (size_t)count * ring_buffer->num_counters);
+    atomic_store_explicit(&ring_buffer->sequences[write_index & mask],
+                          write_index + 1, memory_order_release);
+  }
+  return count;
+}
+
+static uint32_t ring_buffer_pop_multiple(hpc_gpu_ring_buffer_t *ring_buffer,
+                                         uint32_t max_num_samples,
+                                         uint64_t *timestamps,
+                                         uint64_t *values) {
+  uint32_t mask = ring_buffer->capacity - 1;
+  uint32_t read_index =
+      atomic_load_explicit(&ring_buffer->read_index, memory_order_relaxed);
+
+  uint32_t count = 0;
+  for (; count < max_num_samples; ++count, ++read_index) {
+    _Atomic uint32_t *sequence = &ring_buffer->sequences[read_index & mask];
+    if (atomic_load_explicit(sequence, memory_order_acquire) !=
+        read_index + 1) {
+      break;
+    }
+    ring_buffer_read_record(ring_buffer, read_index, &timestamps[count],
+                            values + (size_t)count * ring_buffer->num_counters);
+    atomic_store_explicit(sequence, read_index + ring_buffer->capacity,
+                          memory_order_release);
+  }
+
+  atomic_store_explicit(&ring_buffer->read_index, read_index,
+                        memory_order_relaxed);
+  return count;
+}
+
+uint32_t hpc_gpu_ring_buffer_push(hpc_gpu_ring_buffer_t *ring_buffer,
+                                  uint32_t num_samples,
+                                  const uint64_t *timestamps,
+                                  const uint64_t *values) {
+  switch (ring_buffer->mode) {
+    case HPC_GPU_RING_BUFFER_SINGLE_PRODUCER:
+      return ring_buffer_push_single(ring_buffer, num_samples, timestamps,
+                                     values);
+    case HPC_GPU_RING_BUFFER_MULTI_PRODUCER:
+      return ring_buffer_push_multiple(ring_buffer, num_samples, timestamps,
+                                       values);
+  }
+  return 0;
+}
+
+uint32_t hpc_gpu_ring_buffer_pop(hpc_gpu_ring_buffer_t *ring_buffer,
+                                 uint32_t max_num_samples, uint64_t *timestamps,
+                                 uint64_t *values) {
+  switch (ring_buffer->mode) {
+    case HPC_GPU_RING_BUFFER_SINGLE_PRODUCER:
+      return ring_buffer_pop_single(ring_buffer, max_num_samples, timestamps,
+                                    values);
+    case HPC_GPU_RING_BUFFER_MULTI_PRODUCER:
+      return ring_buffer_pop_multiple(ring_buffer, max_num_samples, timestamps,
+                                      values);
+  }
+  return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/sample_board.h"
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+// Assumed cache line size; see ring_buffer.c.
+#define CACHE_LINE_SIZE 64
+#define WORDS_PER_CACHE_LINE (CACHE_LINE_SIZE / sizeof(uint64_t))
+
+typedef struct hpc_gpu_sample_board_t {
+  /// The two sample copies, each one timestamp followed by the values of all
+  /// counters. Words are accessed atomically so that a reader racing with
+  /// the writer reads stale or fresh words, never torn ones.
+  _Atomic uint64_t *copies;
+  /// The distance between the two copies in words, rounded up to whole cache
+  /// lines so that the writer filling one copy does not invalidate the lines
+  /// readers are copying from the other.
+  uint32_t copy_stride;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+
+  uint8_t padding0[CACHE_LINE_SIZE];
+
+  /// The number of published samples. Sample `n` lives in copy `n % 2`.
+  _Atomic uint64_t sequence;
+
+  uint8_t padding1[CACHE_LINE_SIZE];
+} hpc_gpu_sample_board_t;
+
+int hpc_gpu_create_sample_board(
+    uint32_t num_counters, const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_sample_board_t **out_board) {
+  hpc_gpu_sample_board_t *board =
+      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_sample_board_t));
+  if (!board) {
+    errno = ENOMEM;
+    return -1;
+  }
+  memset(board, 0, sizeof(hpc_gpu_sample_board_t));
+
+  uint32_t record_size = num_counters + 1;
+  board->copy_stride = (record_size + WORDS_PER_CACHE_LINE - 1) /
+                       WORDS_PER_CACHE_LINE * WORDS_PER_CACHE_LINE;
+  board->num_counters = num_counters;
+  atomic_init(&board->sequence, 0);
+
+  size_t num_words = 2 * (size_t)board->copy_stride;
+  board->copies =
+      allocator->alloc(allocator->user_data, num_words * sizeof(uint64_t));
+  if (!board->copies) {
+    allocator->free(allocator->user_data, board);
+    errno = ENOMEM;
+    return -1;
+  }
+  for (size_t i = 0; i < num_words; ++i) atomic_init(&board->copies[i], 0);
+
+  *out_board = board;
+  return 0;
+}
+
+int hpc_gpu_destroy_sample_board(
+    hpc_gpu_sample_board_t *board,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  allocator->free(allocator->user_data, board->copies);
+  allocator->free(allocator->user_data, board);
+  return 0;
+}
+
+uint32_t hpc_gpu_sample_board_get_num_counters(
+    const hpc_gpu_sample_board_t *board) {
+  return board->num_counters;
+}
+
+void hpc_gpu_sample_board_publish(hpc_gpu_sample_board_t *board,
+                                  uint64_t timestamp, const uint64_t *values) {
+  uint64_t sequence =
+      atomic_load_explicit(&board->sequence, memory_order_relaxed);
+  _Atomic uint64_t *copy =
+      board->copies + ((sequence + 1) & 1) * board->copy_stride;
+
+  // The copy being overwritten held sample `sequence - 1`. Readers that
+  // picked it before the previous publish must see that publish before any
+  // of the words below, so they notice the sequence moved and retry.
+  atomic_thread_fence(memory_order_release);
+
+  atomic_store_explicit(&copy[0], timestamp, memory_order_relaxed);
+  for (uint32_t i = 0; i < board->num_counters; ++i) {
+    atomic_store_explicit(&copy[i + 1], values[i], memory_order_relaxed);
+  }
+
+  atomic_store_explicit(&board->sequence, sequence + 1, memory_order_release);
+}
+
+uint64_t hpc_gpu_sample_board_get_sequence(
+    const hpc_gpu_sample_board_t *board) {
+  return atomic_load_explicit(&board->sequence, memory_order_acquire);
+}
+
+uint64_t hpc_gpu_sample_board_read(const hpc_gpu_sample_board_t *board,
+                                   uint64_t *timestamp, uint64_t *values) {
+  for (;;) {
+    uint64_t sequence =
+        atomic_load_explicit(&board->sequence, memory_order_acquire);
+    const _Atomic uint64_t *copy =
+        board->copies + (sequence & 1) * board->copy_stride;
+
+    *timestamp = atomic_load_explicit(&copy[0], memory_order_relaxed);
+    for (uint32_t i = 0; i < board->num_counters; ++i) {
+      values[i] = atomic_load_explicit(&copy[i + 1], memory_order_relaxed);
+    }
+
+    // The writer only starts overwriting this copy after publishing the
+    // next sample, so an unchanged sequence means the copy was stable.
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&board->sequence, memory_order_relaxed) ==
+        sequence) {
+      return sequence;
+    }
+  }
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/sampler.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hpc/gpu/base_utilities.h"
+#include "hpc/gpu/ring_buffer.h"
+#include "hpc/gpu/sample_board.h"
+
+typedef struct hpc_gpu_sampler_t {
+  /// The vendor context to sample.
+  void *context;
+  /// The function for sampling the vendor context.
+  hpc_gpu_sampler_query_function query;
+  /// The number of counters per sample.
+  uint32_t num_counters;
+  /// The sampling period in nanoseconds.
+  uint64_t period_ns;
+
+  /// The buffer receiving values from one query on the sampler thread, with
+  /// room for the time values after the counter values.
+  uint64_t *query_values;
+
+  /// The ring buffer publishing samples to the consumer.
+  hpc_gpu_ring_buffer_t *ring_buffer;
+  /// The board holding the latest sample for concurrent readers.
+  hpc_gpu_sample_board_t *sample_board;
+  /// The number of dropped samples.
+  _Atomic uint64_t num_dropped_samples;
+
+  /// The timer file descriptor waking up the sampler thread.
+  int timer_fd;
+  /// The event file descriptor for asking the sampler thread to exit.
+  int exit_fd;
+  /// The sampler thread.
+  pthread_t thread;
+  /// Whether the sampler thread is running.
+  int running;
+  /// The first error encountered by the sampler thread.
+  int thread_status;
+} hpc_gpu_sampler_t;
+
+static void sampler_push_sample(hpc_gpu_sampler_t *sampler,
+                                const hpc_gpu_sample_times_t *times,
+                                uint64_t num_missed_samples) {
+  uint64_t *time_values = sampler->query_values + sampler->num_counters;
+  time_values[0] = times->driver_timestamp_ns;
+  time_values[1] = times->host_end_ns;
+  time_values[2] = times->gpu_clock_cycles;
+
+  uint64_t timestamp = times->host_begin_ns;
+  hpc_gpu_sample_board_publish(sampler->sample_board, timestamp,
+                               sampler->query_values);
+
+  uint32_t num_pushed = hpc_gpu_ring_buffer_push(
+      sampler->ring_buffer, 1, &timestamp, sampler->query_values);
+  uint64_t num_dropped = num_missed_samples + (1 - num_pushed);
+  if (num_dropped != 0) {
+    atomic_fetch_add_explicit(&sampler->num_dropped_samples, num_dropped,
+                              memory_order_relaxed);
+  }
+}
+
+static void *sampler_thread_main(void *data) {
+  hpc_gpu_sampler_t *sampler = (hpc_gpu_sampler_t *)data;
+
+  struct pollfd poll_fds[2];
+  poll_fds[0].fd = sampler->timer_fd;
+  poll_fds[0].events = POLLIN;
+  poll_fds[1].fd = sampler->exit_fd;
+  poll_fds[1].events = POLLIN;
+
+  for (;;) {
+    poll_fds[0].revents = poll_fds[1].revents = 0;
+    int status = poll(poll_fds, 2, /*timeout=*/-1);
+    if (status < 0) {
+      if (errno == EINTR) continue;
+      sampler->thread_status = status;
+      break;
+    }
+    if (poll_fds[1].revents & POLLIN) break;
+    if (!(poll_fds[0].revents & POLLIN)) continue;
+
+    // The timer reports how many periods elapsed since the last read. Anything
+    // beyond one means we were descheduled long enough to miss samples.
+    uint64_t num_expirations = 0;
+    if (read(sampler->timer_fd, &num_expirations, sizeof(uint64_t)) !=
+        sizeof(uint64_t)) {
+      continue;
+    }
+
+    hpc_gpu_sample_times_t times;
+    status = sampler->query(sampler->context, sampler->query_values, &times);
+    if (status < 0) {
+      sampler->thread_status = status;
+      break;
+    }
+    sampler_push_sample(sampler, &times, num_expirations - 1);
+  }
+
+  return NULL;
+}
+
+static int sampler_arm_timer(const hpc_gpu_sampler_t *sampler,
+                             uint64_t period_ns) {
+  struct itimerspec timer;
+  timer.it_interval.tv_sec = period_ns / 1000000000u;
+  timer.it_interval.tv_nsec = period_ns % 1000000000u;
+  timer.it_value = timer.it_interval;
+  return timerfd_settime(sampler->timer_fd, 0, &timer, NULL);
+}
+
+int hpc_gpu_create_sampler(const hpc_gpu_sampler_create_info_t *create_info,
+                           const hpc_gpu_host_allocation_callbacks_t *allocator,
+                           hpc_gpu_sampler_t **out_sampler) {
+  if (create_info->period_ns == 0 || create_info->max_num_samples == 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  int timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  if (timer_fd < 0) return timer_fd;
+  int exit_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (exit_fd < 0) {
+    close(timer_fd);
+    return exit_fd;
+  }
+
+  uint32_t num_values =
+      create_info->num_counters + HPC_GPU_SAMPLER_NUM_TIME_VALUES;
+  hpc_gpu_ring_buffer_t *ring_buffer = NULL;
+  int status = hpc_gpu_create_ring_buffer(
+      num_values, create_info->max_num_samples,
+      HPC_GPU_RING_BUFFER_SINGLE_PRODUCER, allocator, &ring_buffer);
+  if (status < 0) {
+    close(exit_fd);
+    close(timer_fd);
+    return status;
+  }
+  hpc_gpu_sample_board_t *sample_board = NULL;
+  status = hpc_gpu_create_sample_board(num_values, allocator, &sample_board);
+  if (status < 0) {
+    hpc_gpu_destroy_ring_buffer(ring_buffer, allocator);
+    close(exit_fd);
+    close(timer_fd);
+    return status;
+  }
+
+  hpc_gpu_sampler_t *sampler =
+      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_sampler_t));
+  memset(sampler, 0, sizeof(hpc_gpu_sampler_t));
+
+  sampler->context = create_info->context;
+  sampler->query = create_info->query;
+  sampler->num_counters = create_info->num_counters;
+  sampler->period_ns = create_info->period_ns;
+  sampler->ring_buffer = ring_buffer;
+  sampler->sample_board = sample_board;
+  sampler->timer_fd = timer_fd;
+  sampler->exit_fd = exit_fd;
+  atomic_init(&sampler->num_dropped_samples, 0);
+
+  sampler->query_values =
+      allocator->alloc(allocator->user_data, num_values * sizeof(uint64_t));
+
+  *out_sampler = sampler;
+  return 0;
+}
+
+int hpc_gpu_destroy_sampler(
+    hpc_gpu_sampler_t *sampler,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  if (sampler->running) hpc_gpu_sampler_stop(sampler);
+
+  close(sampler->exit_fd);
+  close(sampler->timer_fd);
+
+  hpc_gpu_destroy_ring_buffer(sampler->ring_buffer, allocator);
+  hpc_gpu_destroy_sample_board(sampler->sample_board, allocator);
+  allocator->free(allocator->user_data, sampler->query_values);
+  allocator->free(allocator->user_data, sampler);
+  return 0;
+}
+
+int hpc_gpu_sampler_start(hpc_gpu_sampler_t *sampler) {
+  if (sampler->running) return 0;
+
+  // Drain any pending exit request from a previous run.
+  uint64_t exit_count = 0;
+  if (read(sampler->exit_fd, &exit_count, sizeof(uint64_t)) < 0 &&
+      errno != EAGAIN) {
+    return -1;
+  }
+  sampler->thread_status = 0;
+
+  int status = sampler_arm_timer(sampler, sampler->period_ns);
+  if (status < 0) return status;
+
+  status = pthread_create(&sampler->thread, NULL, sampler_thread_main, sampler);
+  if (status != 0) {
+    sampler_arm_timer(sampler, 0);
+    errno = status;
+    return -1;
+  }
+
+  sampler->running = 1;
+  return 0;
+}
+
+int hpc_gpu_sampler_stop(hpc_gpu_sampler_t *sampler) {
+  if (!sampler->running) return 0;
+
+  uint64_t exit_count = 1;
+  if (write(sampler->exit_fd, &exit_count, sizeof(uint64_t)) < 0) return -1;
+  pthread_join(sampler->thread, NULL);
+  sampler->running = 0;
+
+  // An all-zero timer value disarms the timer.
+  int status = sampler_arm_timer(sampler, 0);
+  if (status < 0) return status;
+
+  return sampler->thread_status;
+}
+
+int hpc_gpu_sampler_flush(hpc_gpu_sampler_t *sampler, uint32_t max_num_samples,
+                          uint64_t *timestamps, uint64_t *values,
+                          uint32_t *num_samples) {
+  *num_samples = hpc_gpu_ring_buffer_pop(sampler->ring_buffer, max_num_samples,
+                                         timestamps, values);
+  return 0;
+}
+
+hpc_gpu_ring_buffer_t *hpc_gpu_sampler_get_ring_buffer(
+    hpc_gpu_sampler_t *sampler) {
+  return sampler->ring_buffer;
+}
+
+const hpc_gpu_sample_board_t *hpc_gpu_sampler_get_sample_board(
+    const hpc_gpu_sampler_t *sampler) {
+  return sampler->sample_board;
+}
+
+uint64_t hpc_gpu_sampler_get_num_dropped_samples(
+    const hpc_gpu_sampler_t *sampler) {
+  return atomic_load_explicit(&sampler->num_dropped_samples,
+                              memory_order_relaxed);
+}
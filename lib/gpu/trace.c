@@ -0,0 +1,501 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hpc/gpu/trace.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hpc/gpu/base_utilities.h"
+
+// A trace file is a file header followed by chunks. All integers are
+// little-endian.
+//
+// File header:
+//   char     magic[8] = "HPCTRACE"
+//   uint32_t version
+//   uint32_t vendor
+//   uint64_t device_id
+//   char     series[16], NUL-padded
+//   uint32_t num_counters
+//   uint32_t reserved
+//   uint32_t counters[num_counters]
+//
+// Chunk:
+//   uint32_t num_samples
+//   uint32_t payload_size
+//   uint64_t first_timestamp
+//   uint32_t column_sizes[1 + num_counters]
+//   uint8_t  payload[payload_size]
+//
+// The payload holds the timestamp column followed by one column per counter,
+// each `column_sizes[i]` bytes. A column stores the zig-zag varint encoded
+// difference of each value from the previous one; the timestamp column starts
+// from `first_timestamp` and counter columns start from zero.
+
+#define TRACE_MAGIC "HPCTRACE"
+#define TRACE_VERSION 1
+#define TRACE_SERIES_SIZE (HPC_GPU_TRACE_MAX_SERIES_NAME_LENGTH + 1)
+#define TRACE_HEADER_SIZE 48
+#define CHUNK_HEADER_SIZE 16
+/// The maximal number of bytes of one varint encoded uint64_t.
+#define MAX_VARINT_SIZE 10
+
+static void put_u32(uint8_t *buffer, uint32_t value) {
+  for (int i = 0; i < 4; ++i) buffer[i] = (uint8_t)(value >> (i * 8));
+}
+
+static void put_u64(uint8_t *buffer, uint64_t value) {
+  for (int i = 0; i < 8; ++i) buffer[i] = (uint8_t)(value >> (i * 8));
+}
+
+static uint32_t get_u32(const uint8_t *buffer) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) value |= (uint32_t)buffer[i] << (i * 8);
+  return value;
+}
+
+static uint64_t get_u64(const uint8_t *buffer) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; ++i) value |= (uint64_t)buffer[i] << (i * 8);
+  return value;
+}
+
+static size_t get_chunk_header_size(uint32_t num_counters) {
+  return CHUNK_HEADER_SIZE + (1 + (size_t)num_counters) * sizeof(uint32_t);
+}
+
+//===----------------------------------------------------------------------===//
+// Writer
+//===----------------------------------------------------------------------===//
+
+typedef struct hpc_gpu_trace_writer_t {
+  /// The trace file descriptor.
+  int fd;
+  /// The number of counters in each sample.
+  uint32_t num_counters;
+  /// The number of samples per chunk.
+  uint32_t chunk_size;
+  /// The number of samples buffered for the current chunk.
+  uint32_t num_samples;
+  /// The timestamps of buffered samples.
+  uint64_t *timestamps;
+  /// The values of buffered samples, one row per sample.
+  uint64_t *values;
+  /// The buffer receiving the encoded chunk.
+  uint8_t *chunk;
+  /// The size of the file header and complete chunks written so far. The next
+  /// chunk is written at this offset, so it replaces any partially written
+  /// one.
+  uint64_t file_size;
+} hpc_gpu_trace_writer_t;
+
+static int write_fully(int fd, const uint8_t *data, size_t size,
+                       uint64_t offset) {
+  while (size != 0) {
+    ssize_t num_written = pwrite(fd, data, size, (off_t)offset);
+    if (num_written < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    data += num_written;
+    size -= (size_t)num_written;
+    offset += (uint64_t)num_written;
+  }
+  return 0;
+}
+
+/// Appends `value` as a LEB128 varint and returns the new end of `buffer`.
+static uint8_t *put_varint(uint8_t *buffer, uint64_t value) {
+  while (value >= 0x80u) {
+    *buffer++ = (uint8_t)(value | 0x80u);
+    value >>= 7;
+  }
+  *buffer++ = (uint8_t)value;
+  return buffer;
+}
+
+/// Encodes `count` values strided by `stride` as zig-zag varint deltas from
+/// `previous` and returns the new end of `buffer`.
+static uint8_t *encode_column(uint8_t *buffer, const uint64_t *values,
+                              size_t stride, uint32_t count,
+                              uint64_t previous) {
+  for (uint32_t i = 0; i < count; ++i) {
+    uint64_t value = values[i * stride];
+    int64_t delta = (int64_t)(value - previous);
+    buffer = put_varint(buffer,
+                        ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+    previous = value;
+  }
+  return buffer;
+}
+
+int hpc_gpu_create_trace_writer(
+    const char *path, const hpc_gpu_trace_info_t *info, uint32_t chunk_size,
+    const hpc_gpu_host_allocation_callbacks_t *allocator,
+    hpc_gpu_trace_writer_t **out_writer) {
+  if (chunk_size == 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) return fd;
+
+  size_t header_size =
+      TRACE_HEADER_SIZE + info->num_counters * sizeof(uint32_t);
+  uint8_t *header = allocator->alloc(allocator->user_data, header_size);
+  memset(header, 0, header_size);
+  memcpy(header, TRACE_MAGIC, 8);
+  put_u32(header + 8, TRACE_VERSION);
+  put_u32(header + 12, info->vendor);
+  put_u64(header + 16, info->device_id);
+  if (info->series != NULL) {
+    strncpy((char *)header + 24, info->series, TRACE_SERIES_SIZE - 1);
+  }
+  put_u32(header + 40, info->num_counters);
+  for (uint32_t i = 0; i < info->num_counters; ++i) {
+    put_u32(header + TRACE_HEADER_SIZE + i * sizeof(uint32_t),
+            info->counters[i]);
+  }
+  int status = write_fully(fd, header, header_size, /*offset=*/0);
+  allocator->free(allocator->user_data, header);
+  if (status < 0) {
+    close(fd);
+    return status;
+  }
+
+  hpc_gpu_trace_writer_t *writer =
+      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_trace_writer_t));
+  writer->fd = fd;
+  writer->num_counters = info->num_counters;
+  writer->chunk_size = chunk_size;
+  writer->num_samples = 0;
+  writer->timestamps =
+      allocator->alloc(allocator->user_data, chunk_size * sizeof(uint64_t));
+  writer->values = allocator->alloc(
+      allocator->user_data,
+      (size_t)chunk_size * info->num_counters * sizeof(uint64_t));
+  writer->chunk = allocator->alloc(
+      allocator->user_data,
+      get_chunk_header_size(info->num_counters) +
+          (1 + (size_t)info->num_counters) * chunk_size * MAX_VARINT_SIZE);
+  writer->file_size = header_size;
+
+  *out_writer = writer;
+  return 0;
+}
+
+int hpc_gpu_destroy_trace_writer(
+    hpc_gpu_trace_writer_t *writer,
+    const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  int status = hpc_gpu_trace_writer_flush(writer);
+  if (close(writer->fd) < 0 && status == 0) status = -1;
+
+  allocator->free(allocator->user_data, writer->chunk);
+  allocator->free(allocator->user_data, writer->values);
+  allocator->free(allocator->user_data, writer->timestamps);
+  allocator->free(allocator->user_data, writer);
+  return status;
+}
+
+int hpc_gpu_trace_writer_append(hpc_gpu_trace_writer_t *writer,
+                                uint32_t num_samples,
+                                const uint64_t *timestamps,
+                                const uint64_t *values) {
+  const size_t num_counters = writer->num_counters;
+  while (num_samples != 0) {
+    uint32_t count = writer->chunk_size - writer->num_samples;
+    if (count > num_samples) count = num_samples;
+
+    memcpy(writer->timestamps + writer->num_samples, timestamps,
+           count * sizeof(uint64_t));
+    memcpy(writer->values + writer->num_samples * num_counters, values,
+           count * num_counters * sizeof(uint64_t));
+    writer->num_samples += count;
+    timestamps += count;
+    values += count * num_counters;
+    num_samples -= count;
+
+    if (writer->num_samples == writer->chunk_size) {
+      int status = hpc_gpu_trace_writer_flush(writer);
+      if (status < 0) return status;
+    }
+  }
+  return 0;
+}
+
+int hpc_gpu_trace_writer_flush(hpc_gpu_trace_writer_t *writer) {
+  const uint32_t num_samples = writer->num_samples;
+  if (num_samples == 0) return 0;
+
+  const uint32_t num_counters = writer->num_counters;
+  uint8_t *header = writer->chunk;
+  uint8_t *column_sizes = header + CHUNK_HEADER_SIZE;
+  uint8_t *payload = header + get_chunk_header_size(num_counters);
+
+  uint64_t first_timestamp = writer->timestamps[0];
+  uint8_t *end = encode_column(payload, writer->timestamps, 1, num_samples,
+                               first_timestamp);
+  put_u32(column_sizes, (uint32_t)(end - payload));
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint8_t *begin = end;
+    end = encode_column(begin, writer->values + i, num_counters, num_samples,
+                        0);
+    put_u32(column_sizes + (1 + i) * sizeof(uint32_t),
+            (uint32_t)(end - begin));
+  }
+
+  put_u32(header, num_samples);
+  put_u32(header + 4, (uint32_t)(end - payload));
+  put_u64(header + 8, first_timestamp);
+
+  size_t size = (size_t)(end - header);
+  int status = write_fully(writer->fd, header, size, writer->file_size);
+  if (status < 0) {
+    // Readers stop at the first incomplete chunk, so cut it off in case
+    // nothing follows. The samples stay buffered, and the next flush writes
+    // over whatever could not be cut.
+    int error = errno;
+    ftruncate(writer->fd, (off_t)writer->file_size);
+    errno = error;
+    return status;
+  }
+  writer->file_size += size;
+  writer->num_samples = 0;
+  return 0;
+}
+
+//===----------------------------------------------------------------------===//
+// Reader
+//===----------------------------------------------------------------------===//
+
+typedef struct trace_chunk_t {
+  /// The offset of the chunk header in the file.
+  uint64_t offset;
+  /// The number of samples in the chunk.
+  uint32_t num_samples;
+} trace_chunk_t;
+
+typedef struct hpc_gpu_trace_reader_t {
+  /// The mapped trace file.
+  const uint8_t *data;
+  /// The size of the mapped trace file.
+  size_t size;
+  /// The device and counters of the trace.
+  hpc_gpu_trace_info_t info;
+  /// The NUL-terminated series name.
+  char series[TRACE_SERIES_SIZE];
+  /// The counter enum values.
+  uint32_t *counters;
+  /// The number of complete chunks.
+  uint32_t num_chunks;
+  /// The location of each complete chunk.
+  trace_chunk_t *chunks;
+} hpc_gpu_trace_reader_t;
+
+/// Walks chunk headers from `offset`, recording at most `max_num_chunks`
+/// into `chunks` if not NULL, and returns the number of complete chunks.
+static uint32_t index_chunks(const uint8_t *data, size_t size, size_t offset,
+                             uint32_t num_counters, trace_chunk_t *chunks,
+                             uint32_t max_num_chunks) {
+  const size_t header_size = get_chunk_header_size(num_counters);
+  uint32_t num_chunks = 0;
+  while (num_chunks < max_num_chunks && size - offset >= header_size) {
+    const uint8_t *header = data + offset;
+    uint32_t num_samples = get_u32(header);
+    uint64_t payload_size = get_u32(header + 4);
+    if (num_samples == 0 || size - offset - header_size < payload_size) break;
+
+    uint64_t columns_size = 0;
+    for (uint32_t i = 0; i <= num_counters; ++i) {
+      columns_size += get_u32(header + CHUNK_HEADER_SIZE + i * 4);
+    }
+    if (columns_size != payload_size) break;
+
+    if (chunks != NULL) {
+      chunks[num_chunks].offset = offset;
+      chunks[num_chunks].num_samples = num_samples;
+    }
+    ++num_chunks;
+    offset += header_size + payload_size;
+  }
+  return num_chunks;
+}
+
+int hpc_gpu_open_trace(const char *path,
+                       const hpc_gpu_host_allocation_callbacks_t *allocator,
+                       hpc_gpu_trace_reader_t **out_reader) {
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return fd;
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) < 0) {
+    close(fd);
+    return -1;
+  }
+  size_t size = (size_t)file_stat.st_size;
+  if (size < TRACE_HEADER_SIZE) {
+    close(fd);
+    errno = EINVAL;
+    return -1;
+  }
+
+  // The mapping stays valid after closing the file descriptor.
+  void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) return -1;
+  const uint8_t *data = (const uint8_t *)mapping;
+
+  uint32_t num_counters = get_u32(data + 40);
+  if (memcmp(data, TRACE_MAGIC, 8) != 0 ||
+      get_u32(data + 8) != TRACE_VERSION ||
+      (size - TRACE_HEADER_SIZE) / sizeof(uint32_t) < num_counters) {
+    munmap(mapping, size);
+    errno = EINVAL;
+    return -1;
+  }
+
+  hpc_gpu_trace_reader_t *reader =
+      allocator->alloc(allocator->user_data, sizeof(hpc_gpu_trace_reader_t));
+  memset(reader, 0, sizeof(hpc_gpu_trace_reader_t));
+  reader->data = data;
+  reader->size = size;
+
+  memcpy(reader->series, data + 24, TRACE_SERIES_SIZE - 1);
+  reader->counters = allocator->alloc(allocator->user_data,
+                                      num_counters * sizeof(uint32_t));
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    reader->counters[i] = get_u32(data + TRACE_HEADER_SIZE + i * 4);
+  }
+  reader->info.vendor = (hpc_gpu_trace_vendor_t)get_u32(data + 12);
+  reader->info.device_id = get_u64(data + 16);
+  reader->info.series = reader->series;
+  reader->info.num_counters = num_counters;
+  reader->info.counters = reader->counters;
+
+  // Count chunks first so that the index takes exactly one allocation.
+  size_t offset = TRACE_HEADER_SIZE + num_counters * sizeof(uint32_t);
+  reader->num_chunks =
+      index_chunks(data, size, offset, num_counters, NULL, UINT32_MAX);
+  reader->chunks = allocator->alloc(
+      allocator->user_data, reader->num_chunks * sizeof(trace_chunk_t));
+  index_chunks(data, size, offset, num_counters, reader->chunks,
+               reader->num_chunks);
+
+  *out_reader = reader;
+  return 0;
+}
+
+int hpc_gpu_close_trace(hpc_gpu_trace_reader_t *reader,
+                        const hpc_gpu_host_allocation_callbacks_t *allocator) {
+  int status = munmap((void *)reader->data, reader->size);
+  allocator->free(allocator->user_data, reader->chunks);
+  allocator->free(allocator->user_data, reader->counters);
+  allocator->free(allocator->user_data, reader);
+  return status;
+}
+
+const hpc_gpu_trace_info_t *hpc_gpu_trace_get_info(
+    const hpc_gpu_trace_reader_t *reader) {
+  return &reader->info;
+}
+
+uint32_t hpc_gpu_trace_get_num_chunks(const hpc_gpu_trace_reader_t *reader) {
+  return reader->num_chunks;
+}
+
+uint32_t hpc_gpu_trace_get_chunk_num_samples(
+    const hpc_gpu_trace_reader_t *reader, uint32_t chunk) {
+  return reader->chunks[chunk].num_samples;
+}
+
+/// Decodes `count` zig-zag varint deltas from `previous` into `values`
+/// strided by `stride`. Returns -1 if the column is malformed.
+static int decode_column(const uint8_t *begin, const uint8_t *end,
+                         uint32_t count, uint64_t previous, uint64_t *values,
+                         size_t stride) {
+  for (uint32_t i = 0; i < count; ++i) {
+    if (begin == end) return -1;
+    uint64_t encoded = *begin++;
+    // Most deltas fit into one byte; only longer ones take the loop.
+    if (encoded >= 0x80u) {
+      encoded &= 0x7fu;
+      for (int shift = 7;; shift += 7) {
+        if (begin == end || shift >= 64) return -1;
+        uint8_t byte = *begin++;
+        encoded |= (uint64_t)(byte & 0x7fu) << shift;
+        if (byte < 0x80u) break;
+      }
+    }
+    previous += (encoded >> 1) ^ (0 - (encoded & 1));
+    values[i * stride] = previous;
+  }
+  return begin == end ? 0 : -1;
+}
+
+/// Decodes `num_columns` consecutive columns of a chunk, where column 0 holds
+/// timestamps and column `i + 1` holds counter `i`. The `i`-th decoded column
+/// is written to `values + i` strided by `stride`, so that multiple columns
+/// interleave into rows. Returns -1 if any decoded column is malformed.
+static int read_columns(const hpc_gpu_trace_reader_t *reader, uint32_t chunk,
+                        uint32_t first_column, uint32_t num_columns,
+                        uint64_t *values, size_t stride) {
+  const uint8_t *header = reader->data + reader->chunks[chunk].offset;
+  const uint8_t *column_sizes = header + CHUNK_HEADER_SIZE;
+  const uint8_t *begin =
+      header + get_chunk_header_size(reader->info.num_counters);
+  for (uint32_t i = 0; i < first_column; ++i) {
+    begin += get_u32(column_sizes + i * 4);
+  }
+
+  for (uint32_t i = 0; i < num_columns; ++i) {
+    uint32_t column = first_column + i;
+    const uint8_t *end = begin + get_u32(column_sizes + column * 4);
+    uint64_t previous = column == 0 ? get_u64(header + 8) : 0;
+    if (decode_column(begin, end, reader->chunks[chunk].num_samples, previous,
+                      values + i, stride) < 0) {
+      errno = EINVAL;
+      return -1;
+    }
+    begin = end;
+  }
+  return 0;
+}
+
+int hpc_gpu_trace_read_chunk(const hpc_gpu_trace_reader_t *reader,
+                             uint32_t chunk, uint64_t *timestamps,
+                             uint64_t *values) {
+  if (timestamps != NULL) {
+    int status = read_columns(reader, chunk, 0, 1, timestamps, 1);
+    if (status < 0) return status;
+  }
+  if (values == NULL) return 0;
+
+  const uint32_t num_counters = reader->info.num_counters;
+  return read_columns(reader, chunk, 1, num_counters, values, num_counters);
+}
+
+int hpc_gpu_trace_read_chunk_counter(const hpc_gpu_trace_reader_t *reader,
+                                     uint32_t chunk, uint32_t counter,
+                                     uint64_t *values) {
+  return read_columns(reader, chunk, 1 + counter, 1, values, 1);
+}
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+# Copyright 2021 Google LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Helpers shared by generators for emitting counter metadata registries."""
+
+from typing import List, Sequence, Tuple
+
+UINT32_MASK = 0xffffffff
+
+# Multiplier for turning perfect hash displacements into hash seeds
+PERFECT_HASH_SEED_MULTIPLIER = 0x9e3779b9
+# The average number of keys per perfect hash bucket
+PERFECT_HASH_BUCKET_SIZE = 4
+
+
+def hash_name(name: str) -> int:
+  """Hashes the name with 32-bit FNV-1a.
+
+  This must match `counter_info_hash_name` in lib/gpu/counter_info.c.
+  """
+  value = 2166136261
+  for byte in name.encode("utf-8"):
+    value ^= byte
+    value = (value * 16777619) & UINT32_MASK
+  return value
+
+
+def mix(value: int) -> int:
+  """Scrambles all bits with the MurmurHash3 finalizer.
+
+  This must match `counter_info_mix` in lib/gpu/counter_info.c.
+  """
+  value ^= value >> 16
+  value = (value * 0x85ebca6b) & UINT32_MASK
+  value ^= value >> 13
+  value = (value * 0xc2b2ae35) & UINT32_MASK
+  value ^= value >> 16
+  return value
+
+
+def get_perfect_hash_slot(name_hash: int, displacement: int,
+                          num_slots: int) -> int:
+  """Returns the slot of a name hash given its bucket's displacement."""
+  seed = ((displacement + 1) * PERFECT_HASH_SEED_MULTIPLIER) & UINT32_MASK
+  return mix(name_hash ^ seed) % num_slots
+
+
+def build_perfect_hash(names: Sequence[str]) -> Tuple[List[int], List[int]]:
+  """Builds a minimal perfect hash for the given names with hash-and-displace.
+
+  Returns the displacement of each bucket and the name index of each slot.
+  """
+  num_slots = len(names)
+  num_buckets = max(1, (num_slots + PERFECT_HASH_BUCKET_SIZE - 1) //
+                    PERFECT_HASH_BUCKET_SIZE)
+  hashes = [hash_name(name) for name in names]
+  if len(set(hashes)) != len(hashes):
+    raise ValueError("Counter names have colliding hashes!")
+
+  buckets = [[] for _ in range(num_buckets)]
+  for index, name_hash in enumerate(hashes):
+    buckets[mix(name_hash) % num_buckets].append(index)
+
+  displacements = [0] * num_buckets
+  slots = [None] * num_slots
+  # Place larger buckets first while there are still many free slots.
+  for bucket_index in sorted(range(num_buckets),
+                             key=lambda b: len(buckets[b]),
+                             reverse=True):
+    bucket = buckets[bucket_index]
+    if not bucket:
+      continue
+    for displacement in range(0xffff):
+      candidates = [
+          get_perfect_hash_slot(hashes[index], displacement, num_slots)
+          for index in bucket
+      ]
+      if len(set(candidates)) == len(candidates) and all(
+          [slots[slot] is None for slot in candidates]):
+        break
+    else:
+      raise ValueError("Failed to build the perfect hash!")
+    displacements[bucket_index] = displacement
+    for slot, index in zip(candidates, bucket):
+      slots[slot] = index
+
+  return displacements, slots
+
+
+def guess_unit(name: str) -> str:
+  """Guesses the unit of counted values from the counter name."""
+  if "BEATS" in name:
+    return "beats"
+  if "BYTES" in name:
+    return "bytes"
+  if ("CYCLE" in name or "STALL" in name or "BUSY" in name or
+      name.endswith("ACTIVE")):
+    return "cycles"
+  return "events"
+
+
+def wrap_c_list(prefix: str, items: Sequence[str], indent: int) -> List[str]:
+  """Wraps the items of a C initializer list into lines of up to 80 columns.
+
+  The first line starts with the prefix; the following ones are aligned with
+  the first item. Each line ends with a comma.
+  """
+  lines = []
+  line = prefix
+  for item in items:
+    if line.strip() and indent + len(line) + len(item) + 1 > 80:
+      lines.append(line.rstrip())
+      line = " " * len(prefix)
+    line += item + ", "
+  lines.append(line.rstrip())
+  return lines
+
+
+def get_counter_registry_definitions(prefix: str, series_names: Sequence[str],
+                                     counters: Sequence[Tuple]) -> str:
+  """Returns C tables defining a counter metadata registry.
+
+  Each counter is an (enum-symbol, availability-mask, name, group,
+  description, unit) tuple; counters should be in enum order. The registry is
+  named `<prefix>_counter_registry`.
+  """
+  lines = []
+  lines.append("")
+  lines.append("/// The series that availability bits refer to.")
+  lines.append(f"static const char *const {prefix}_series_names"
+               f"[{len(series_names)}] = {{")
+  lines.extend(["    " + line for line in wrap_c_list(
+      "", [f'"{name}"' for name in series_names], 4)])
+  lines.append("};")
+
+  lines.append("")
+  lines.append("/// Metadata of all counters, in enum order.")
+  lines.append(f"static const hpc_gpu_counter_info_t {prefix}_counter_infos"
+               f"[{len(counters)}] = {{")
+  lines.append("    // clang-format off")
+  for symbol, availability, name, group, description, unit in counters:
+    fields = [
+        symbol, f"0x{availability:x}u", f'"{name}"', f'"{group}"',
+        f'"{description}"', f'"{unit}"}}'
+    ]
+    entry = wrap_c_list("{", fields, 4)
+    lines.extend(["    " + line for line in entry])
+  lines.append("    // clang-format on")
+  lines.append("};")
+
+  displacements, slots = build_perfect_hash(
+      [counter[2] for counter in counters])
+  lines.append("")
+  lines.append("/// The displacement of each perfect hash bucket.")
+  lines.append(f"static const uint16_t {prefix}_counter_displacements"
+               f"[{len(displacements)}] = {{")
+  lines.extend(["    " + line for line in wrap_c_list(
+      "", [str(d) for d in displacements], 4)])
+  lines.append("};")
+  lines.append("")
+  lines.append("/// The metadata index of each perfect hash slot.")
+  lines.append(f"static const uint16_t {prefix}_counter_slots"
+               f"[{len(slots)}] = {{")
+  lines.extend(
+      ["    " + line for line in wrap_c_list("", [str(s) for s in slots], 4)])
+  lines.append("};")
+
+  lines.append("")
+  declaration = (f"static const hpc_gpu_counter_registry_t "
+                 f"{prefix}_counter_registry =")
+  if len(declaration) + 2 <= 80:
+    lines.append(declaration + " {")
+  else:
+    lines.append(declaration)
+    lines.append("    {")
+  lines.append(f"    {len(counters)},")
+  lines.append(f"    {prefix}_counter_infos,")
+  lines.append(f"    {len(series_names)},")
+  lines.append(f"    {prefix}_series_names,")
+  lines.append(f"    {len(displacements)},")
+  lines.append(f"    {prefix}_counter_displacements,")
+  lines.append(f"    {prefix}_counter_slots,")
+  lines.append("};")
+  return "\n".join(lines) + "\n\n"
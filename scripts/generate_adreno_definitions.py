@@ -17,10 +17,14 @@
 import argparse
 import os
 import re
+import textwrap
 
 import xml.etree.ElementTree as ET
 from dataclasses import dataclass
-from typing import Dict, Tuple
+from typing import Dict, Sequence, Tuple
+
+from counter_registry import (get_counter_registry_definitions, guess_unit,
+                              wrap_c_list)
 
 # Known acronyms that should be kept as all capitals
 ADRENO_ACRONYMS = ["ALU", "EFU", "GPR"]
@@ -77,6 +81,20 @@ ADRENO_COUNTER_GROUP_NAMES = {
     "TSE": "Triangle Setup Engine",
     "UCHE": "Unified L2 Cache",
 }
+# The number of counter registers the KGSL kernel driver exposes for each
+# group, per series. Groups left out have no registers.
+ADRENO_KGSL_GROUP_CAPACITIES = {
+    "a5xx": {
+        "CP": 8, "RBBM": 4, "PC": 8, "VFD": 8, "HLSQ": 8, "VPC": 4, "TSE": 4,
+        "RAS": 4, "UCHE": 8, "TP": 8, "SP": 12, "RB": 8, "VBIF": 4,
+        "VBIF_PWR": 3, "VSC": 2, "CCU": 4, "LRZ": 4, "CMP": 4,
+    },
+    "a6xx": {
+        "CP": 14, "RBBM": 4, "PC": 8, "VFD": 8, "HLSQ": 6, "VPC": 6, "TSE": 4,
+        "RAS": 4, "UCHE": 12, "TP": 12, "SP": 24, "RB": 8, "PWR": 1,
+        "VBIF": 4, "VBIF_PWR": 3, "VSC": 2, "CCU": 5, "LRZ": 4, "CMP": 4,
+    },
+}
 # Namespace prefixes used in Freedreno's envytool definition
 ADRENO_XML_NS = {"nouveau": "http://nouveau.freedesktop.org/"}
 
@@ -105,14 +123,46 @@ static inline uint32_t adreno_{series}_counter_get_selector(
   {selector_logic}
 }}
 """
-ADRENO_ENUM_VALUE_TO_SELECTOR_SWITCH_FN = """
-static uint32_t adreno_common_counter_convert_to_{series}(
+ADRENO_COMMON_SELECTOR_TABLES = """
+/// The number of counter groups covered by the selector tables.
+#define ADRENO_COMMON_NUM_GROUPS {num_groups}u
+/// The selector table entry for values not naming a common counter.
+#define ADRENO_COMMON_NO_SELECTOR {no_selector}
+
+/// The start of each group's entries in the selector tables, indexed by group
+/// ID. A counter's entry is at its group's start plus its selector bits.
+static const uint16_t adreno_common_group_starts[{num_starts}] = {{
+    // clang-format off
+    {starts}
+    // clang-format on
+}};
+{tables}
+/// Converts a common counter to its countable selector using the given
+/// selector table. Returns ~0u if the counter is unavailable.
+static uint32_t adreno_common_counter_convert(
+    const {entry_type} *selectors, hpc_gpu_adreno_common_counter_t counter) {{
+  uint32_t group = counter >> {num_bits}u;
+  uint32_t index = counter & ({max_count}u - 1u);
+  if (group >= ADRENO_COMMON_NUM_GROUPS) return ~0u;
+  uint32_t start = adreno_common_group_starts[group];
+  if (index >= adreno_common_group_starts[group + 1] - start) return ~0u;
+  uint32_t selector = selectors[start + index];
+  return selector == ADRENO_COMMON_NO_SELECTOR ? ~0u : selector;
+}}
+"""
+ADRENO_COMMON_SELECTOR_TABLE = """
+/// Countable selectors of common counters in the {upper_series} series.
+static const {entry_type} adreno_common_{series}_selectors[{num_entries}] = {{
+    // clang-format off
+    {entries}
+    // clang-format on
+}};
+"""
+ADRENO_COMMON_CONVERT_TO_SERIES_FN = """
+static inline uint32_t adreno_common_counter_convert_to_{series}(
     hpc_gpu_adreno_common_counter_t counter) {{
-  // clang-format off
-  switch (counter) {{
-    {cases}
-  }}
-  // clang-format on
+  return adreno_common_counter_convert(adreno_common_{series}_selectors,
+                                       counter);
 }}
 """
 ADRENO_ENUM_VALUE_TO_GROUP_FN = """
@@ -146,6 +196,40 @@ class AdrenoPerSeriesDefinition:
         lines.append(f"    {case.selector} -> {case.symbol} ({case.name})")
     return "\n".join(lines)
 
+  def get_known_groups(self):
+    """Returns (group-name, group) pairs for known groups, ordered by ID."""
+    known_groups = [
+        item for item in self.groups.items()
+        if ADRENO_COUNTER_GROUP_IDS.get(item[0]) is not None
+    ]
+    return sorted(known_groups,
+                  key=lambda item: ADRENO_COUNTER_GROUP_IDS[item[0]])
+
+  def get_counter_registry(
+      self, all_series: Sequence["AdrenoPerSeriesDefinition"]) -> str:
+    """Returns C tables defining the counter metadata registry.
+
+    Availability bits follow the order of `all_series`; a counter is
+    available in a series if the series has a counter of the same name.
+    """
+    counters = []
+    for group_name, group in self.get_known_groups():
+      full_group_name = ADRENO_COUNTER_GROUP_NAMES.get(group_name, group_name)
+      for case in group.values():
+        availability = 0
+        for bit, series in enumerate(all_series):
+          if case.symbol in series.groups.get(group_name, {}):
+            availability |= 1 << bit
+        symbol = ADRENO_C_ENUM_CASE.format(series=self.series.upper(),
+                                           group=group_name,
+                                           symbol=case.symbol)
+        counters.append((symbol, availability, f"{group_name}_{case.symbol}",
+                         group_name, f"{full_group_name}: {case.name}",
+                         guess_unit(case.symbol)))
+    return get_counter_registry_definitions(
+        f"adreno_{self.series}", [series.series for series in all_series],
+        counters)
+
   def get_all_counters_as_one_enum(self):
     """Returns one C enum definition for all groups' perf counters.
 
@@ -153,10 +237,6 @@ class AdrenoPerSeriesDefinition:
     is assumed to have less than 2^ADRENO_MAX_NUM_COUNTER_BIT_PER_GROUP, which
     is used to assign value ranges.
     """
-    known_groups = [
-        item for item in self.groups.items()
-        if ADRENO_COUNTER_GROUP_IDS.get(item[0]) is not None
-    ]
     uknown_groups = [
         item[0]
         for item in self.groups.items()
@@ -166,9 +246,7 @@ class AdrenoPerSeriesDefinition:
       print(f"  warning: {self.series} UKNOWN groups: {uknown_groups}")
 
     cases = []
-    sorted_groups = sorted(known_groups,
-                           key=lambda item: ADRENO_COUNTER_GROUP_IDS[item[0]])
-    for group_name, group in sorted_groups:
+    for group_name, group in self.get_known_groups():
       if len(group) >= 2**ADRENO_MAX_NUM_COUNTER_BIT_PER_GROUP:
         raise ValueError("Max counter count per group exceeded!")
       full_group_name = ADRENO_COUNTER_GROUP_NAMES.get(group_name, group_name)
@@ -239,29 +317,85 @@ class AdrenoAllSeriesDefinition:
     return AdrenoPerSeriesDefinition("common", common_groups)
 
   def get_counter_conversion_functions(self) -> str:
-    """Returns C functions converting enum values to groups/selectors."""
-    functions = []
+    """Returns C tables and functions converting enum values to selectors.
+
+    Each series gets one dense selector table. Entries are grouped by group ID
+    and, within a group, indexed by the selector bits of the common enum
+    value; gaps hold a sentinel so that conversion is a bounds check plus one
+    load.
+    """
     common_series = self.get_common_series()
+    group_ids = [
+        ADRENO_COUNTER_GROUP_IDS[name]
+        for name in common_series.groups.keys()
+        if ADRENO_COUNTER_GROUP_IDS.get(name) is not None
+    ]
+    num_groups = max(group_ids) + 1 if group_ids else 0
+
+    # {group-id -> (group-name, {common-selector -> counter-symbol})}
+    slots = {}
+    for group_name, group in common_series.groups.items():
+      group_id = ADRENO_COUNTER_GROUP_IDS.get(group_name)
+      if group_id is None:
+        continue
+      slots[group_id] = (group_name, {
+          counter.selector: symbol for symbol, counter in group.items()
+      })
+
+    starts = [0]
+    for group_id in range(num_groups):
+      _, group_slots = slots.get(group_id, ("", {}))
+      size = max(group_slots.keys()) + 1 if group_slots else 0
+      starts.append(starts[-1] + size)
+
+    max_selector = max([
+        counter.selector
+        for series in self.all_series
+        for group in series.groups.values()
+        for counter in group.values()
+    ] + [0])
+    if max_selector < 0xff:
+      entry_type, no_selector = "uint8_t", "0xffu"
+    else:
+      entry_type, no_selector = "uint16_t", "0xffffu"
+
+    tables = []
+    functions = []
     for to_series in self.all_series:
-      value_to_selector = []
-      for common_group_name, common_group in common_series.groups.items():
-        to_group = to_series.groups[common_group_name]
-        for common_counter_symbol, _ in common_group.items():
-          full_symbol = ADRENO_C_ENUM_CASE.format(
-              series=common_series.series.upper(),
-              group=common_group_name,
-              symbol=common_counter_symbol)
-          to_selector = to_group[common_counter_symbol].selector
-          value_to_selector.append("case {}: return {};".format(
-              full_symbol, to_selector))
+      rows = []
+      for group_id in range(num_groups):
+        group_name, group_slots = slots.get(group_id, ("", {}))
+        if not group_slots:
+          continue
+        to_group = to_series.groups[group_name]
+        entries = [no_selector] * (max(group_slots.keys()) + 1)
+        for index, symbol in group_slots.items():
+          entries[index] = str(to_group[symbol].selector)
+        rows.extend(wrap_c_list(f"/* {group_name} */ ", entries, 4))
+      tables.append(
+          ADRENO_COMMON_SELECTOR_TABLE.format(
+              series=to_series.series,
+              upper_series=to_series.series.upper(),
+              entry_type=entry_type,
+              num_entries=starts[-1],
+              entries="\n    ".join(rows)))
       functions.append(
-          ADRENO_ENUM_VALUE_TO_SELECTOR_SWITCH_FN.format(
-              series=to_series.series, cases="\n    ".join(value_to_selector)))
+          ADRENO_COMMON_CONVERT_TO_SERIES_FN.format(series=to_series.series))
+
     group_logic = "return counter >> {}u;".format(
         ADRENO_MAX_NUM_COUNTER_BIT_PER_GROUP)
     group_fn = ADRENO_ENUM_VALUE_TO_GROUP_FN.format(series="common",
                                                     group_logic=group_logic)
-    return group_fn + "".join(functions) + "\n"
+    convert_fn = ADRENO_COMMON_SELECTOR_TABLES.format(
+        num_groups=num_groups,
+        no_selector=no_selector,
+        num_starts=len(starts),
+        starts="\n    ".join(wrap_c_list("", [str(s) for s in starts], 4)),
+        tables="".join(tables),
+        entry_type=entry_type,
+        num_bits=ADRENO_MAX_NUM_COUNTER_BIT_PER_GROUP,
+        max_count=2**ADRENO_MAX_NUM_COUNTER_BIT_PER_GROUP)
+    return group_fn + convert_fn + "".join(functions) + "\n"
 
 
 def parse_xml_file(xml_path: str) -> AdrenoPerSeriesDefinition:
@@ -332,6 +466,68 @@ def parse_xml_file(xml_path: str) -> AdrenoPerSeriesDefinition:
   return AdrenoPerSeriesDefinition(series.lower(), groups)
 
 
+ADRENO_C_GROUP_CAPACITIES = """
+{comment}
+static const uint32_t hpc_gpu_adreno_{series}_group_capacities[] = {{
+{entries}
+}};
+
+/// The number of groups in the table above.
+{num_groups_macro}
+"""
+
+
+def get_group_capacity_tables() -> str:
+  """Returns C tables of the group capacities of each series.
+
+  Common counters take the smallest capacity among all series, so that plans
+  for them fit whichever GPU they run on.
+  """
+  group_names = {v: k for k, v in ADRENO_COUNTER_GROUP_IDS.items()}
+  capacities = dict(ADRENO_KGSL_GROUP_CAPACITIES)
+  capacities["common"] = {
+      group: min(c.get(group, 0)
+                 for c in ADRENO_KGSL_GROUP_CAPACITIES.values())
+      for group in ADRENO_COUNTER_GROUP_IDS
+  }
+
+  tables = []
+  for series, series_capacities in capacities.items():
+    num_groups = 1 + max(ADRENO_COUNTER_GROUP_IDS[group]
+                         for group, capacity in series_capacities.items()
+                         if capacity != 0)
+    entries = []
+    for group_id in range(num_groups):
+      capacity = series_capacities.get(group_names[group_id], 0)
+      entries.append(f"    {f'{capacity},':<4} // {group_names[group_id]}")
+
+    array = f"hpc_gpu_adreno_{series}_group_capacities"
+    macro_lines = [
+        f"#define HPC_GPU_ADRENO_{series.upper()}_NUM_GROUPS",
+        f"  (sizeof({array}) /",
+        f"   sizeof({array}[0]))",
+    ]
+    width = max(len(line) for line in macro_lines[:-1]) + 1
+    num_groups_macro = "\n".join(
+        [f"{line:<{width}}\\" for line in macro_lines[:-1]] +
+        macro_lines[-1:])
+
+    if series == "common":
+      groups = "group on every known Adreno GPU"
+    else:
+      groups = f"{series.upper()} group"
+    comment = textwrap.wrap(
+        f"The number of counter registers in each {groups}, indexed by group "
+        "ID, as exposed by the KGSL kernel driver.", 76)
+    tables.append(
+        ADRENO_C_GROUP_CAPACITIES.format(comment="\n".join(
+            f"/// {line}" for line in comment),
+                                         series=series,
+                                         entries="\n".join(entries),
+                                         num_groups_macro=num_groups_macro))
+  return "".join(tables) + "\n"
+
+
 def update_generated_file(autogen_file: str, updated_content: str):
   """Updates the autogen region in the given file to the new content."""
   with open(autogen_file, "r") as f:
@@ -423,6 +619,21 @@ def main(args):
                               common_definition.series + ".c")
   update_generated_file(common_c_lib, functions)
 
+  # Generate the register count tables for planning passes
+  group_capacities_c_header = os.path.join(args.output, *lib_dir_prefix,
+                                           "group_capacities.h")
+  update_generated_file(group_capacities_c_header,
+                        get_group_capacity_tables())
+
+  # Generate counter metadata registries, with availability bits in the order
+  # of series generations.
+  registry_series = (a5xx_definition, a6xx_definition)
+  for definition in (a5xx_definition, a6xx_definition, common_definition):
+    registry_c_lib = os.path.join(args.output, *lib_dir_prefix,
+                                  definition.series + "_counter_info.c")
+    update_generated_file(registry_c_lib,
+                          definition.get_counter_registry(registry_series))
+
 
 if __name__ == "__main__":
   main(parse_arguments())
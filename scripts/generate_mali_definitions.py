@@ -21,6 +21,9 @@ import xml.etree.ElementTree as ET
 from dataclasses import dataclass
 from typing import Dict, Optional, Sequence, Tuple
 
+from counter_registry import (get_counter_registry_definitions, guess_unit,
+                              wrap_c_list)
+
 VERBOSE = False
 
 # Omit Midgard Gen1/Gen2/Gen3 architectures: they are fairly old now.
@@ -64,35 +67,67 @@ typedef enum hpc_gpu_mali_{group}_counter_e {{
 """
 
 # Code templates for Mali counter conversion definitions
-MALI_COUNTER_CONVERSION_CASE = "case HPC_GPU_MALI_{group}_{category}_{counter}: return {value};"
-MALI_COUNTER_CONVERSION_SWITCH_FN = """
-static uint32_t hpc_gpu_mali_{group}_counter_convert_to_{layout}(uint32_t counter) {{
-  // clang-format off
-  switch ((hpc_gpu_mali_{group}_counter_t)counter) {{
-    {cases}
+MALI_COUNTER_CONVERSION_TABLE_FN = """
+/// The number of counter layouts covered by the index table.
+#define HPC_GPU_MALI_{ugroup}_NUM_LAYOUTS {num_layouts}u
+/// The index table entry for layouts or values without the counter.
+#define HPC_GPU_MALI_{ugroup}_NO_INDEX {no_index}
+
+/// The start of each category's entries in the index table, indexed by
+/// category. A counter's entry is at its category's start plus its index bits.
+static const uint16_t hpc_gpu_mali_{group}_category_starts[{num_starts}] = {{
+    // clang-format off
+    {starts}
+    // clang-format on
+}};
+
+/// Indices of {comment}counters in counter blocks, indexed by layout minus one.
+static const {entry_type} hpc_gpu_mali_{group}_counter_indices[{num_layouts}][{num_entries}] = {{
+    // clang-format off
+    {rows}
+    // clang-format on
+}};
+
+static uint32_t hpc_gpu_mali_{group}_counter_convert(
+    uint32_t counter, hpc_gpu_mali_counter_layout_t layout) {{
+  uint32_t category = counter >> {bits}u;
+  uint32_t index = counter & ((1u << {bits}u) - 1u);
+  if (layout == HPC_GPU_MALI_COUNTER_LAYOUT_UNKNOWN ||
+      layout > HPC_GPU_MALI_{ugroup}_NUM_LAYOUTS) {{
+    return ~0u;
   }}
-  // clang-format on
-}}
-"""
-MALI_COUNTER_CONVERSION_DIRECT_FN = """
-static inline uint32_t hpc_gpu_mali_{group}_counter_convert_to_{layout}(
-    uint32_t counter) {{
-  return counter & ((1u << {bits}u) - 1u);
+  if (category >= {num_categories}u) return ~0u;
+  uint32_t start = hpc_gpu_mali_{group}_category_starts[category];
+  if (index >= hpc_gpu_mali_{group}_category_starts[category + 1] - start) {{
+    return ~0u;
+  }}
+  uint32_t converted =
+      hpc_gpu_mali_{group}_counter_indices[layout - 1][start + index];
+  return converted == HPC_GPU_MALI_{ugroup}_NO_INDEX ? ~0u : converted;
 }}
 """
+MALI_COUNTER_CONVERSION_MASK_FN = """
+/// The layouts sharing the same indices for {comment}counters, as a bit mask
+/// indexed by layout.
+#define HPC_GPU_MALI_{ugroup}_LAYOUT_MASK \\
+  ({layout_mask})
+
+/// Indices of {comment}counters in counter blocks as bit masks, indexed by
+/// category.
+static const uint64_t hpc_gpu_mali_{group}_counter_masks[{num_categories}] = {{
+    {masks}
+}};
 
-# Code templates for Mali counter layout conversion definitions
-MALI_LAYOUT_CONVERSION_CASE = ("case {prefix}{ulayout}: return hpc_gpu_mali_"
-                               "{group}_counter_convert_to_{llayout}(counter);")
-MALI_LAYOUT_CONVERSION_SWITCH_FN = """
 static uint32_t hpc_gpu_mali_{group}_counter_convert(
     uint32_t counter, hpc_gpu_mali_counter_layout_t layout) {{
-  // clang-format off
-  switch (layout) {{
-    {cases}
-    default: assert(0 && "should not happen!"); return ~0u;
+  uint32_t category = counter >> {bits}u;
+  uint32_t index = counter & ((1u << {bits}u) - 1u);
+  if (((HPC_GPU_MALI_{ugroup}_LAYOUT_MASK >> layout) & 1u) == 0) return ~0u;
+  if (category >= {num_categories}u || index >= 64u) return ~0u;
+  if (((hpc_gpu_mali_{group}_counter_masks[category] >> index) & 1u) == 0) {{
+    return ~0u;
   }}
-  // clang-format on
+  return index;
 }}
 """
 
@@ -251,51 +286,139 @@ class MaliDatabase:
 
   def get_counter_common_to_specific_fn(self) -> Dict[str, str]:
     """Returns functions that convert common enum counter values to the index
-    for a specific GPU product."""
+    for a specific GPU product.
+
+    Conversion is table-driven: a bounds check plus one table load. Counters
+    that are unavailable for a layout, or values not naming any counter,
+    convert to ~0u.
+    """
     all_fns = {}
+    all_layouts = list(self.layouts.keys())
+    if len(all_layouts) >= 32:
+      raise ValueError("Too many layouts to fit in a 32-bit mask!")
 
-    for group in ["common", "valhall", "bifrost"]:
-      all_fns[group] = ""
+    for group, comment in [("common", ""), ("valhall", "Valhall "),
+                           ("bifrost", "Bifrost ")]:
       layouts = self._get_layouts_for_arch(group)
       common_counters, same_index = self._get_common_counter_for_layouts(
           layouts)
+      num_categories = max(MALI_COUNTER_CATEGORIES.values()) + 1
 
-      layout_cases = []
-      for target_layout in layouts:
-        layout_cases.append(
-            MALI_LAYOUT_CONVERSION_CASE.format(prefix=MALI_LAYOUT_ENUM_PREFIX,
-                                               group=group,
-                                               ulayout=target_layout.upper(),
-                                               llayout=target_layout.lower()))
-
-        # If for any common counter, it has the same index across all products,
-        # we can just directly extract the index.
-        if same_index:
-          all_fns[group] += MALI_COUNTER_CONVERSION_DIRECT_FN.format(
-              group=group,
-              layout=target_layout.lower(),
-              bits=MALI_COUNTER_CATEGORY_NUM_BITS)
-          continue
-
-        cases = []
+      # If all common counters have the same index across all products, the
+      # index is directly in the enum value; only availability needs checking.
+      if same_index:
+        masks = [0] * num_categories
         for name, category in common_counters.items():
           for counter in category:
-            cases.append(
-                MALI_COUNTER_CONVERSION_CASE.format(group=group.upper(),
-                                                    category=name.upper(),
-                                                    counter=counter.name,
-                                                    value=counter.index))
-        all_fns[group] += MALI_COUNTER_CONVERSION_SWITCH_FN.format(
+            if counter.index >= 64:
+              raise ValueError("Counter index does not fit in a 64-bit mask!")
+            masks[MALI_COUNTER_CATEGORIES[name]] |= 1 << counter.index
+        layout_mask = " | \\\n   ".join([
+            f"(1u << {MALI_LAYOUT_ENUM_PREFIX}{layout.upper()})"
+            for layout in layouts
+        ])
+        all_fns[group] = MALI_COUNTER_CONVERSION_MASK_FN.format(
             group=group,
-            layout=target_layout.lower(),
-            cases="\n    ".join(cases))
-
-      all_fns[group] += MALI_LAYOUT_CONVERSION_SWITCH_FN.format(
-          group=group, cases="\n    ".join(layout_cases))
+            ugroup=group.upper(),
+            comment=comment,
+            layout_mask=layout_mask,
+            num_categories=num_categories,
+            masks="\n    ".join([f"0x{mask:016x}ull," for mask in masks]),
+            bits=MALI_COUNTER_CATEGORY_NUM_BITS)
+        continue
+
+      # Entries of each category are indexed by the index bits of the enum
+      # value, i.e., the counter's index in the first layout.
+      category_slots = [{} for _ in range(num_categories)]
+      for name, category in common_counters.items():
+        for counter in category:
+          category_slots[MALI_COUNTER_CATEGORIES[name]][
+              counter.index] = counter.name
+      starts = [0]
+      for slots in category_slots:
+        starts.append(starts[-1] + (max(slots.keys()) + 1 if slots else 0))
+
+      max_index = max([
+          counter.index
+          for layout in self.layouts.values()
+          for category in layout.categories.values()
+          for counter in category
+      ] + [0])
+      if max_index < 0xff:
+        entry_type, no_index = "uint8_t", "0xffu"
+      else:
+        entry_type, no_index = "uint16_t", "0xffffu"
+
+      rows = []
+      for layout_name in all_layouts:
+        entries = [no_index] * starts[-1]
+        if layout_name in layouts:
+          layout = self.layouts[layout_name]
+          for name, category in layout.categories.items():
+            category_id = MALI_COUNTER_CATEGORIES.get(name)
+            if category_id is None:
+              continue
+            slots = category_slots[category_id]
+            for counter in category:
+              for slot, slot_name in slots.items():
+                if slot_name == counter.name:
+                  entries[starts[category_id] + slot] = str(counter.index)
+        rows.append(f"/* {layout_name} */ {{")
+        rows.extend(wrap_c_list("    ", entries, 4))
+        rows.append("},")
+
+      all_fns[group] = MALI_COUNTER_CONVERSION_TABLE_FN.format(
+          group=group,
+          ugroup=group.upper(),
+          comment=comment,
+          num_layouts=len(all_layouts),
+          no_index=no_index,
+          num_starts=len(starts),
+          starts="\n    ".join(wrap_c_list("", [str(s) for s in starts], 4)),
+          entry_type=entry_type,
+          num_entries=starts[-1],
+          rows="\n    ".join(rows),
+          num_categories=num_categories,
+          bits=MALI_COUNTER_CATEGORY_NUM_BITS)
 
     return all_fns
 
 
+  def get_counter_registries(self) -> Dict[str, str]:
+    """Returns C tables defining counter metadata registries.
+
+    Availability bits follow the order of counter layouts; a counter is
+    available in a layout if the layout has a counter of the same name in the
+    same category.
+    """
+    all_registries = {}
+    all_layouts = list(self.layouts.keys())
+
+    for group in ["common", "valhall", "bifrost"]:
+      layouts = self._get_layouts_for_arch(group)
+      common_counters, _ = self._get_common_counter_for_layouts(layouts)
+      counters = []
+      for name, category in common_counters.items():
+        category_name = name.replace("_", " ").capitalize()
+        for counter in category:
+          availability = 0
+          for bit, layout_name in enumerate(all_layouts):
+            layout_counters = self.layouts[layout_name].categories.get(name, [])
+            if any([c.name == counter.name for c in layout_counters]):
+              availability |= 1 << bit
+          symbol = "HPC_GPU_MALI_{}_{}_{}".format(group.upper(), name.upper(),
+                                                  counter.name)
+          description = "{}: {}".format(category_name,
+                                        counter.name.replace("_", " ").lower())
+          counters.append(
+              (symbol, availability, f"{name.upper()}_{counter.name}",
+               name.upper(), description, guess_unit(counter.name)))
+      all_registries[group] = get_counter_registry_definitions(
+          f"hpc_gpu_mali_{group}", all_layouts, counters)
+
+    return all_registries
+
+
 def get_counter_category_definitions():
   """Returns definitions related to counter categories."""
   category_enum = ["typedef enum mali_counter_category_e {"]
@@ -435,7 +558,12 @@ def main(args):
   counter_enums = db.get_common_counter_enum()
   conversion_fns = db.get_counter_common_to_specific_fn()
 
+  registries = db.get_counter_registries()
+
   for group in ["common", "valhall", "bifrost"]:
+    registry_lib = os.path.join(args.output, *lib_dir_prefix,
+                                f"{group}_counter_info.c")
+    update_generated_file(registry_lib, registries[group])
     common_header = os.path.join(args.output, *header_dir_prefix, f"{group}.h")
     update_generated_file(common_header, counter_enums[group] + "\n")
     common_lib = os.path.join(args.output, *lib_dir_prefix, f"{group}.c")
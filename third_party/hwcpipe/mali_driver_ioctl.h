@@ -107,6 +107,8 @@ struct mali_counter_reader_metadata {
 #define MALI_COUNTER_READER_PUT_BUFFER       \
   _IOW(MALI_COUNTER_READER_IOCTL_TYPE, 0x21, \
        struct mali_counter_reader_metadata)
+#define MALI_COUNTER_READER_SET_INTERVAL \
+  _IOW(MALI_COUNTER_READER_IOCTL_TYPE, 0x30, uint32_t)
 #define MALI_COUNTER_READER_GET_API_VERSION \
   _IOW(MALI_COUNTER_READER_IOCTL_TYPE, 0xFF, uint32_t)
 
@@ -0,0 +1,623 @@
+/*
+ * Copyright 2021 Google LLC
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// A daemon owning the only Adreno counter context of the device and serving
+// samples to any number of client processes.
+//
+// Clients connect over a Unix domain socket and register the A6XX counters
+// they are interested in; see `hpc/gpu/adreno/sampling_client.h`. The daemon
+// samples the union of all registered counters at a fixed period and
+// publishes samples into a shared-memory ring that clients map read-only.
+// Registering counters that cannot be sampled together with those already
+// registered fails without disturbing other clients.
+//
+// Usage: adreno_sampling_daemon [--socket=<name>] [--period_us=<n>]
+//                               [--num_slots=<n>] [--simulated]
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "adreno/sampling_protocol.h"
+#include "hpc/gpu/adreno/a6xx.h"
+#include "hpc/gpu/adreno/output_mode.h"
+#include "hpc/gpu/adreno/sampling_client.h"
+#include "hpc/gpu/adreno/simulated_driver.h"
+#include "hpc/gpu/base_utilities.h"
+
+static void *allocate(void *user_data, size_t size) { return malloc(size); }
+static void deallocate(void *user_data, void *memory) { return free(memory); }
+
+#define MAX_NUM_CLIENTS 64
+#define DEFAULT_PERIOD_US 1000
+#define DEFAULT_NUM_SLOTS 4096
+
+// Added in Linux 5.1; older kernels reject it.
+#ifndef F_SEAL_FUTURE_WRITE
+#define F_SEAL_FUTURE_WRITE 0x0010
+#endif
+
+typedef struct client_t {
+  /// The connection to the client.
+  int socket_fd;
+  /// The counters the client registered.
+  uint32_t num_counters;
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+} client_t;
+
+typedef struct sampling_daemon_t {
+  hpc_gpu_host_allocation_callbacks_t allocator;
+  /// The sampling period in nanoseconds.
+  uint64_t period_ns;
+
+  /// The shared sample buffer and its memory file descriptor.
+  hpc_gpu_adreno_sampling_buffer_header_t *buffer;
+  size_t buffer_size;
+  int buffer_fd;
+  /// The read-only file descriptor of the shared sample buffer handed out to
+  /// clients. It is `buffer_fd` itself if the kernel supports sealing future
+  /// writes.
+  int client_buffer_fd;
+
+  // Clients cannot write the shared buffer, but the daemon still keeps its
+  // own copy of everything it indexes the buffer with, rather than trusting
+  // shared memory.
+
+  /// The number of slots in the shared sample buffer.
+  uint32_t num_slots;
+  /// The number of samples published so far.
+  uint64_t num_published;
+  /// The current layout generation.
+  uint32_t generation;
+  /// The current value of the layout sequence lock.
+  uint32_t layout_sequence;
+
+  /// The listening socket.
+  int listen_fd;
+  /// The timer waking up the daemon to sample.
+  int timer_fd;
+
+  /// The connected clients.
+  client_t clients[MAX_NUM_CLIENTS];
+  uint32_t num_clients;
+
+  /// The context sampling the union of registered counters, or NULL if no
+  /// counters are registered.
+  hpc_gpu_adreno_context_t *context;
+  /// The counters `context` samples.
+  uint32_t num_counters;
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+} sampling_daemon_t;
+
+static volatile sig_atomic_t exit_requested = 0;
+
+static void handle_exit_signal(int signal_number) { exit_requested = 1; }
+
+static uint64_t get_monotonic_time_ns(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+static int print_error(int status, const char *message) {
+  if (-status >= HPC_GPU_FIRST_ERROR_CODE) {
+    fprintf(stderr, "error %d: %s\n", status, message);
+  } else {
+    perror(message);
+  }
+  return status;
+}
+
+//===----------------------------------------------------------------------===//
+// Counter set management
+//===----------------------------------------------------------------------===//
+
+/// Inserts the counters into the sorted, duplicate-free set. Returns -1 if
+/// the set would grow beyond `HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS`.
+static int merge_counters(uint32_t num_counters, const uint32_t *counters,
+                          uint32_t *num_merged, uint32_t *merged) {
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    uint32_t position = 0;
+    while (position < *num_merged && merged[position] < counters[i]) {
+      ++position;
+    }
+    if (position < *num_merged && merged[position] == counters[i]) continue;
+    if (*num_merged == HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS) return -1;
+
+    memmove(merged + position + 1, merged + position,
+            (*num_merged - position) * sizeof(uint32_t));
+    merged[position] = counters[i];
+    ++*num_merged;
+  }
+  return 0;
+}
+
+/// Computes the union of all clients' counters, with client `replaced` using
+/// `counters` instead of its registered ones if it is a valid index.
+static int get_counter_union(const sampling_daemon_t *daemon,
+                             uint32_t replaced, uint32_t num_counters,
+                             const uint32_t *counters, uint32_t *num_merged,
+                             uint32_t *merged) {
+  *num_merged = 0;
+  for (uint32_t i = 0; i < daemon->num_clients; ++i) {
+    const client_t *client = &daemon->clients[i];
+    int status =
+        i == replaced
+            ? merge_counters(num_counters, counters, num_merged, merged)
+            : merge_counters(client->num_counters, client->counters,
+                             num_merged, merged);
+    if (status < 0) return status;
+  }
+  return 0;
+}
+
+static int arm_timer(const sampling_daemon_t *daemon, uint64_t period_ns) {
+  struct itimerspec timer;
+  timer.it_interval.tv_sec = period_ns / 1000000000u;
+  timer.it_interval.tv_nsec = period_ns % 1000000000u;
+  timer.it_value = timer.it_interval;
+  return timerfd_settime(daemon->timer_fd, 0, &timer, NULL);
+}
+
+/// Creates and starts a context sampling the given counters. Leaves
+/// `out_context` NULL if there are no counters.
+static int start_context(const sampling_daemon_t *daemon,
+                         uint32_t num_counters, const uint32_t *counters,
+                         hpc_gpu_adreno_context_t **out_context) {
+  *out_context = NULL;
+  if (num_counters == 0) return 0;
+
+  hpc_gpu_adreno_a6xx_counter_t a6xx_counters
+      [HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    a6xx_counters[i] = (hpc_gpu_adreno_a6xx_counter_t)counters[i];
+  }
+  hpc_gpu_adreno_context_t *context = NULL;
+  int status = hpc_gpu_adreno_a6xx_create_context(
+      num_counters, a6xx_counters, HPC_GPU_ADRENO_OUTPUT_MODE_DELTA,
+      &daemon->allocator, &context);
+  if (status < 0) return status;
+  status = hpc_gpu_adreno_a6xx_start_counters(context);
+  if (status < 0) {
+    int error = errno;
+    hpc_gpu_adreno_a6xx_destroy_context(context, &daemon->allocator);
+    errno = error;
+    return status;
+  }
+  *out_context = context;
+  return 0;
+}
+
+static void stop_context(const sampling_daemon_t *daemon,
+                         hpc_gpu_adreno_context_t *context) {
+  if (context == NULL) return;
+  hpc_gpu_adreno_a6xx_stop_counters(context);
+  hpc_gpu_adreno_a6xx_destroy_context(context, &daemon->allocator);
+}
+
+/// Switches sampling to the given counters.
+///
+/// The new context is created and started before the old one is destroyed,
+/// so counters in both sets keep their reservations throughout. If that runs
+/// out of counter registers, e.g., because a counter replaces another in a
+/// full group, the old context is stopped first and the new one retried. On
+/// failure the old counters keep being sampled.
+static int reconfigure(sampling_daemon_t *daemon, uint32_t num_counters,
+                       const uint32_t *counters) {
+  // A failed restore below leaves the old counters without a context; treat
+  // them as changed so the next reconfiguration retries.
+  if ((daemon->context != NULL || num_counters == 0) &&
+      num_counters == daemon->num_counters &&
+      memcmp(counters, daemon->counters, num_counters * sizeof(uint32_t)) ==
+          0) {
+    return 0;
+  }
+
+  hpc_gpu_adreno_context_t *context = NULL;
+  int status = start_context(daemon, num_counters, counters, &context);
+  if (status == -1 && errno == EBUSY && daemon->context != NULL) {
+    stop_context(daemon, daemon->context);
+    daemon->context = NULL;
+    status = start_context(daemon, num_counters, counters, &context);
+    if (status < 0) {
+      int error = errno;
+      int restore_status = start_context(daemon, daemon->num_counters,
+                                         daemon->counters, &daemon->context);
+      if (restore_status < 0) {
+        print_error(restore_status, "restore previous counters");
+      }
+      errno = error;
+    }
+  }
+  if (status < 0) return status;
+
+  stop_context(daemon, daemon->context);
+  daemon->context = context;
+  daemon->num_counters = num_counters;
+  memcpy(daemon->counters, counters, num_counters * sizeof(uint32_t));
+
+  // Publish the new layout under its sequence lock.
+  hpc_gpu_adreno_sampling_buffer_header_t *buffer = daemon->buffer;
+  atomic_store_explicit(&buffer->layout_sequence, ++daemon->layout_sequence,
+                        memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  atomic_store_explicit(&buffer->generation, ++daemon->generation,
+                        memory_order_relaxed);
+  atomic_store_explicit(&buffer->num_counters, num_counters,
+                        memory_order_relaxed);
+  for (uint32_t i = 0; i < num_counters; ++i) {
+    atomic_store_explicit(&buffer->counters[i], counters[i],
+                          memory_order_relaxed);
+  }
+  atomic_store_explicit(&buffer->layout_sequence, ++daemon->layout_sequence,
+                        memory_order_release);
+
+  return arm_timer(daemon, num_counters != 0 ? daemon->period_ns : 0);
+}
+
+//===----------------------------------------------------------------------===//
+// Sampling
+//===----------------------------------------------------------------------===//
+
+static int sample(sampling_daemon_t *daemon) {
+  uint64_t num_expirations = 0;
+  if (read(daemon->timer_fd, &num_expirations, sizeof(uint64_t)) !=
+      sizeof(uint64_t)) {
+    return 0;
+  }
+  if (daemon->context == NULL) return 0;
+
+  uint64_t timestamp = get_monotonic_time_ns();
+  uint64_t values[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+  int status = hpc_gpu_adreno_a6xx_query_counters(daemon->context, values);
+  if (status < 0) return status;
+
+  hpc_gpu_adreno_sampling_buffer_header_t *buffer = daemon->buffer;
+  uint64_t index = daemon->num_published;
+  hpc_gpu_adreno_sampling_slot_t *slot =
+      hpc_gpu_adreno_get_sampling_slot(buffer, daemon->num_slots, index);
+
+  // Invalidate the slot first so that readers still copying the sample it
+  // held notice it changed underneath them.
+  atomic_store_explicit(&slot->sequence, 0, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+
+  atomic_store_explicit(&slot->timestamp, timestamp, memory_order_relaxed);
+  atomic_store_explicit(&slot->generation, daemon->generation,
+                        memory_order_relaxed);
+  for (uint32_t i = 0; i < daemon->num_counters; ++i) {
+    atomic_store_explicit(&slot->values[i], values[i], memory_order_relaxed);
+  }
+
+  daemon->num_published = index + 1;
+  atomic_store_explicit(&slot->sequence, index + 1, memory_order_release);
+  atomic_store_explicit(&buffer->num_published, index + 1,
+                        memory_order_release);
+  return 0;
+}
+
+//===----------------------------------------------------------------------===//
+// Client handling
+//===----------------------------------------------------------------------===//
+
+static int send_response(const sampling_daemon_t *daemon, int socket_fd,
+                         int32_t status) {
+  hpc_gpu_adreno_sampling_response_t response;
+  response.status = status;
+  response.generation = daemon->generation;
+
+  union {
+    struct cmsghdr header;
+    char buffer[CMSG_SPACE(sizeof(int))];
+  } control;
+  memset(&control, 0, sizeof(control));
+  struct iovec iov = {&response, sizeof(response)};
+  struct msghdr message;
+  memset(&message, 0, sizeof(message));
+  message.msg_iov = &iov;
+  message.msg_iovlen = 1;
+  if (status == 0) {
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+    struct cmsghdr *header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(header), &daemon->client_buffer_fd, sizeof(int));
+  }
+
+  return sendmsg(socket_fd, &message, MSG_NOSIGNAL) < 0 ? -1 : 0;
+}
+
+static void accept_client(sampling_daemon_t *daemon) {
+  int socket_fd = accept4(daemon->listen_fd, NULL, NULL, SOCK_CLOEXEC);
+  if (socket_fd < 0) return;
+  if (daemon->num_clients == MAX_NUM_CLIENTS) {
+    send_response(daemon, socket_fd, -EBUSY);
+    close(socket_fd);
+    return;
+  }
+
+  client_t *client = &daemon->clients[daemon->num_clients++];
+  client->socket_fd = socket_fd;
+  client->num_counters = 0;
+}
+
+static void remove_client(sampling_daemon_t *daemon, uint32_t index) {
+  close(daemon->clients[index].socket_fd);
+  daemon->clients[index] = daemon->clients[--daemon->num_clients];
+
+  // Dropping counters only shrinks the set, which does not fail unless the
+  // driver does; keep sampling the old set if it does.
+  uint32_t num_counters = 0;
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+  get_counter_union(daemon, UINT32_MAX, 0, NULL, &num_counters, counters);
+  int status = reconfigure(daemon, num_counters, counters);
+  if (status < 0) print_error(status, "reconfigure after client exit");
+}
+
+/// Handles a registration request. Returns -1 if the client should be
+/// dropped.
+static int handle_request(sampling_daemon_t *daemon, uint32_t index) {
+  client_t *client = &daemon->clients[index];
+  hpc_gpu_adreno_sampling_request_t request;
+  ssize_t size = recv(client->socket_fd, &request, sizeof(request), 0);
+  if (size <= 0) return -1;
+
+  size_t header_size = offsetof(hpc_gpu_adreno_sampling_request_t, counters);
+  if ((size_t)size < header_size ||
+      request.num_counters > HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS ||
+      (size_t)size != header_size + request.num_counters * sizeof(uint32_t)) {
+    send_response(daemon, client->socket_fd, -EINVAL);
+    return -1;
+  }
+
+  uint32_t num_counters = 0;
+  uint32_t counters[HPC_GPU_ADRENO_SAMPLING_MAX_COUNTERS];
+  int status = get_counter_union(daemon, index, request.num_counters,
+                                 request.counters, &num_counters, counters);
+  if (status < 0) {
+    errno = E2BIG;
+  } else {
+    status = reconfigure(daemon, num_counters, counters);
+  }
+  if (status == -1) status = -errno;
+
+  if (status == 0) {
+    client->num_counters = request.num_counters;
+    memcpy(client->counters, request.counters,
+           request.num_counters * sizeof(uint32_t));
+  }
+  return send_response(daemon, client->socket_fd, status);
+}
+
+//===----------------------------------------------------------------------===//
+// Setup
+//===----------------------------------------------------------------------===//
+
+static int create_buffer(sampling_daemon_t *daemon, uint32_t num_slots) {
+  size_t size = sizeof(hpc_gpu_adreno_sampling_buffer_header_t) +
+                num_slots * sizeof(hpc_gpu_adreno_sampling_slot_t);
+
+  int fd = memfd_create("hpc-gpu-adreno-sampling",
+                        MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) return fd;
+  // Forbid resizing so that clients cannot make the daemon fault.
+  if (ftruncate(fd, (off_t)size) < 0 ||
+      fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW) < 0) {
+    close(fd);
+    return -1;
+  }
+
+  void *mapping =
+      mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED) {
+    close(fd);
+    return -1;
+  }
+
+  hpc_gpu_adreno_sampling_buffer_header_t *buffer = mapping;
+  buffer->magic = HPC_GPU_ADRENO_SAMPLING_BUFFER_MAGIC;
+  buffer->version = HPC_GPU_ADRENO_SAMPLING_BUFFER_VERSION;
+  buffer->num_slots = num_slots;
+  buffer->period_ns = daemon->period_ns;
+  atomic_init(&buffer->num_published, 0);
+  atomic_init(&buffer->layout_sequence, 0);
+
+  // Now that the daemon has its writable mapping, forbid any new one, so
+  // clients can only map the buffer read-only.
+  int client_fd = fd;
+  if (fcntl(fd, F_ADD_SEALS, F_SEAL_FUTURE_WRITE | F_SEAL_SEAL) < 0) {
+    // Older kernels cannot seal future writes; hand out a read-only file
+    // descriptor instead. A client could still reopen it writable through
+    // /proc, but the daemon never relies on what it reads back.
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/self/fd/%d", fd);
+    client_fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (client_fd < 0 || fcntl(fd, F_ADD_SEALS, F_SEAL_SEAL) < 0) {
+      if (client_fd >= 0) close(client_fd);
+      munmap(mapping, size);
+      close(fd);
+      return -1;
+    }
+  }
+
+  daemon->buffer = buffer;
+  daemon->buffer_size = size;
+  daemon->buffer_fd = fd;
+  daemon->client_buffer_fd = client_fd;
+  daemon->num_slots = num_slots;
+  return 0;
+}
+
+static int create_socket(sampling_daemon_t *daemon, const char *name) {
+  struct sockaddr_un address;
+  size_t name_length = strlen(name);
+  if (name_length >= sizeof(address.sun_path)) {
+    errno = EINVAL;
+    return -1;
+  }
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  memcpy(address.sun_path + 1, name, name_length);
+  socklen_t address_size =
+      (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + name_length);
+
+  int fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+  if (fd < 0) return fd;
+  if (bind(fd, (struct sockaddr *)&address, address_size) < 0 ||
+      listen(fd, MAX_NUM_CLIENTS) < 0) {
+    close(fd);
+    return -1;
+  }
+  daemon->listen_fd = fd;
+  return 0;
+}
+
+static int serve(sampling_daemon_t *daemon) {
+  struct pollfd poll_fds[2 + MAX_NUM_CLIENTS];
+  while (!exit_requested) {
+    poll_fds[0].fd = daemon->listen_fd;
+    poll_fds[1].fd = daemon->timer_fd;
+    for (uint32_t i = 0; i < daemon->num_clients; ++i) {
+      poll_fds[2 + i].fd = daemon->clients[i].socket_fd;
+    }
+    uint32_t num_fds = 2 + daemon->num_clients;
+    for (uint32_t i = 0; i < num_fds; ++i) {
+      poll_fds[i].events = POLLIN;
+      poll_fds[i].revents = 0;
+    }
+
+    int status = poll(poll_fds, num_fds, /*timeout=*/-1);
+    if (status < 0) {
+      if (errno == EINTR) continue;
+      return status;
+    }
+
+    // Sample first; it is the only time-critical event. A failed query only
+    // costs clients this sample, e.g., when a counter went backwards, so
+    // keep serving unless the device is gone.
+    if (poll_fds[1].revents & POLLIN) {
+      status = sample(daemon);
+      if (status < 0) {
+        print_error(status, "query counters");
+        if (status == -1 && (errno == ENODEV || errno == EBADF)) return status;
+      }
+    }
+
+    // Walk backwards so that removing a client does not skip another.
+    for (uint32_t i = num_fds - 2; i-- > 0;) {
+      short revents = poll_fds[2 + i].revents;
+      if (revents == 0) continue;
+      if (!(revents & POLLIN) || handle_request(daemon, i) < 0) {
+        remove_client(daemon, i);
+      }
+    }
+
+    if (poll_fds[0].revents & POLLIN) accept_client(daemon);
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  static sampling_daemon_t daemon;
+  daemon.allocator.alloc = &allocate;
+  daemon.allocator.free = &deallocate;
+  daemon.period_ns = DEFAULT_PERIOD_US * 1000u;
+
+  const char *socket_name = HPC_GPU_ADRENO_SAMPLING_DEFAULT_SOCKET;
+  uint32_t num_slots = DEFAULT_NUM_SLOTS;
+  int simulated = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], "--socket=", 9) == 0) {
+      socket_name = argv[i] + 9;
+    } else if (strncmp(argv[i], "--period_us=", 12) == 0) {
+      daemon.period_ns = strtoull(argv[i] + 12, NULL, 10) * 1000u;
+    } else if (strncmp(argv[i], "--num_slots=", 12) == 0) {
+      num_slots = (uint32_t)strtoul(argv[i] + 12, NULL, 10);
+    } else if (strcmp(argv[i], "--simulated") == 0) {
+      simulated = 1;
+    } else {
+      fprintf(stderr,
+              "usage: %s [--socket=<name>] [--period_us=<n>] "
+              "[--num_slots=<n>] [--simulated]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  if (daemon.period_ns == 0 || num_slots == 0) {
+    fprintf(stderr, "period and slot count must be positive\n");
+    return 1;
+  }
+
+  hpc_gpu_adreno_simulated_driver_t *driver = NULL;
+  if (simulated) {
+    hpc_gpu_adreno_simulated_driver_create_info_t create_info;
+    memset(&create_info, 0, sizeof(create_info));
+    create_info.gpu_id = 640;
+    int status = hpc_gpu_adreno_create_simulated_driver(
+        &create_info, &daemon.allocator, &driver);
+    if (status < 0) return print_error(status, "create simulated driver");
+    hpc_gpu_adreno_use_simulated_driver(driver);
+  }
+
+  struct sigaction action;
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = handle_exit_signal;
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+
+  int status = create_buffer(&daemon, num_slots);
+  if (status < 0) return print_error(status, "create sample buffer");
+  daemon.timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  if (daemon.timer_fd < 0) return print_error(-1, "create timer");
+  status = create_socket(&daemon, socket_name);
+  if (status < 0) return print_error(status, socket_name);
+
+  fprintf(stderr, "sampling every %" PRIu64 " ns on socket @%s\n",
+          daemon.period_ns, socket_name);
+  status = serve(&daemon);
+
+  while (daemon.num_clients != 0) remove_client(&daemon, 0);
+  close(daemon.listen_fd);
+  close(daemon.timer_fd);
+  munmap(daemon.buffer, daemon.buffer_size);
+  if (daemon.client_buffer_fd != daemon.buffer_fd) {
+    close(daemon.client_buffer_fd);
+  }
+  close(daemon.buffer_fd);
+  if (driver != NULL) {
+    hpc_gpu_adreno_use_simulated_driver(NULL);
+    hpc_gpu_adreno_destroy_simulated_driver(driver, &daemon.allocator);
+  }
+  return status < 0 ? 1 : 0;
+}